@@ -10,9 +10,13 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include <utility>
+#include <algorithm>
+#include <unordered_map>
 
 // Qt libraries
+#include <QtCore/QJsonObject>
 #include <QtWidgets/QWidget>
 
 #include "app/utility/cpp/qt_types_to_stl.h"
@@ -40,6 +44,8 @@ namespace app {
 
 			/**
 			 * @brief Action class
+			 * Fields listed by Data::getIndexedParameters() are indexed in hash tables in order to look data up in constant time
+			 * Indexes are stored by the position of the field in enumeration Data::indexed_parameter_e and keyed by the value of the field as returned by Data::getIndexKey
 			 *
 			 */
 			template<class Data>
@@ -83,6 +89,7 @@ namespace app {
 					 *
 					 * This functions searching a data having a matching field value
 					 * This functions returns the first match or nullptr if no match
+					 * If the field is indexed, the search takes constant time otherwise it is linear in the number of actions
 					 */
 					template<typename FuncRet = const std::unique_ptr<Data> &>
 					enableFunction<FuncRet> findDataWithFieldValue(const std::string & name, const void * value) const;
@@ -145,6 +152,8 @@ namespace app {
 					 * \param filename: JSON file name to append
 					 *
 					 * This function append to the action data map with the content of a JSON file
+					 * The JSON file is decoded in a single pass: every entry of the top level object is visited once and its fields are read by name
+					 * Schema errors are reported with the path of the offending value
 					 */
 					template<typename FuncRet = void>
 					enableFunction<FuncRet> appendActionData(const std::string & filename);
@@ -156,6 +165,15 @@ namespace app {
 					 */
 					void clear();
 
+					/**
+					 * @brief Function: void removeActionData(const std::string & key)
+					 *
+					 * \param key: key of the action to remove
+					 *
+					 * This function removes an action and updates the indexes accordingly
+					 */
+					void removeActionData(const std::string & key);
+
 					/**
 					 * @brief Function: virtual void addItemToActionData(std::unique_ptr<Data> & data, const std::string & key, const std::string & item)
 					 *
@@ -167,7 +185,51 @@ namespace app {
 					 */
 					virtual void addItemToActionData(std::unique_ptr<Data> & data, const std::string & key, const std::string & item) = 0;
 
+					/**
+					 * @brief Function: const std::unique_ptr<Data> & findIndexedData(const typename Data::indexed_parameter_e & parameter, const app::base::json::Data::index_key_t & key) const
+					 *
+					 * \param parameter: indexed parameter
+					 * \param key: value of the parameter
+					 *
+					 * \return JSON data having a matching parameter value or the invalid data if no match
+					 *
+					 * This functions searches in constant time the data whose indexed parameter has the value provided as argument
+					 */
+					const std::unique_ptr<Data> & findIndexedData(const typename Data::indexed_parameter_e & parameter, const app::base::json::Data::index_key_t & key) const;
+
 				private:
+					/**
+					 * @brief field table type
+					 * first is the name of the field as a QString in order to search it in the JSON file
+					 * second is the name of the field as a std::string in order to set it in the data
+					 *
+					 */
+					typedef std::vector<std::pair<QString, std::string>> field_table_t;
+
+					/**
+					 * @brief Function: static const field_table_t & getFieldTable()
+					 *
+					 * \return the table of fields to read from every entry of a JSON file
+					 *
+					 * This function returns the table of fields to read from every entry of a JSON file
+					 * The table is built only once from the parameters of Data
+					 */
+					static const field_table_t & getFieldTable();
+
+					/**
+					 * @brief index of a field
+					 * key is the value of the field as returned by Data::getIndexKey
+					 * value is the first action in actionData having that value
+					 *
+					 */
+					typedef std::unordered_map<app::base::json::Data::index_key_t, typename action_data_t::const_iterator> field_index_t;
+
+					/**
+					 * @brief indexes of the fields
+					 * The index of a field is at the position of the field in enumeration Data::indexed_parameter_e
+					 *
+					 */
+					typedef std::vector<field_index_t> field_indexes_t;
 
 					/**
 					 * @brief list of JSON filenames that were parsed
@@ -175,6 +237,31 @@ namespace app {
 					 */
 					std::list<std::string> actionJsonFiles;
 
+					/**
+					 * @brief indexes of the fields listed by Data::getIndexedParameters()
+					 *
+					 */
+					field_indexes_t fieldIndexes;
+
+					/**
+					 * @brief Function: void addToIndexes(const typename action_data_t::const_iterator & dataIt)
+					 *
+					 * \param dataIt: iterator to the action to index
+					 *
+					 * This function adds an action to the indexes
+					 * If another action has the same field value, the index keeps the one with the smaller key as the map of actions is ordered by key
+					 */
+					void addToIndexes(const typename action_data_t::const_iterator & dataIt);
+
+					/**
+					 * @brief Function: void removeFromIndexes(const typename action_data_t::const_iterator & dataIt)
+					 *
+					 * \param dataIt: iterator to the action to remove from the indexes
+					 *
+					 * This function removes an action from the indexes and replaces it with the next action having the same field value, if any
+					 */
+					void removeFromIndexes(const typename action_data_t::const_iterator & dataIt);
+
 					/**
 					 * @brief invalid data
 					 *
@@ -198,7 +285,7 @@ namespace app {
 /** @} */ // End of JsonGroup group
 
 template<class Data>
-app::base::json::Action<Data>::Action() : actionData(app::base::json::Action<Data>::action_data_t()), actionJsonFiles(std::list<std::string>()), invalidData(nullptr) {
+app::base::json::Action<Data>::Action() : actionData(app::base::json::Action<Data>::action_data_t()), actionJsonFiles(std::list<std::string>()), fieldIndexes(app::base::json::Action<Data>::field_indexes_t(Data::getIndexedParameters().size(), app::base::json::Action<Data>::field_index_t())), invalidData(nullptr) {
 
 }
 
@@ -225,64 +312,107 @@ typename app::base::json::Action<Data>::template enableFunction<FuncRet> app::ba
 
 	EXCEPTION_ACTION_COND((filename.empty() == true), throw, "Provided an empty JSON file name to function " << __func__);
 
-	app::utility::json::Parser commands(QString::fromStdString(filename), QIODevice::ReadOnly);
-	const std::list<std::string> keys = app::utility::qStringListToStdList(commands.getJsonKeys());
-
-	if (keys.empty() == false) {
-		// Iterate over keys in JSON file
-		std::for_each(keys.cbegin(), keys.cend(), [&] (const std::string & key) {
-			// Create JSON data
-			std::unique_ptr<Data> newData = std::make_unique<Data>(key);
-			const app::base::json::Data::parameter_t & dataParameters = newData->getParameters();
-			// Search all parameters for a given key and use them to pouplate the data
-			std::for_each(dataParameters.cbegin(), dataParameters.cend(), [&] (const std::string & param) {
-				const auto foundParam = commands.findKeyValue(QString::fromStdString(key), QString::fromStdString(param));
-				if (foundParam.first == true) {
-					// Assign a value to a parameter data by name
-					const auto value = foundParam.second.toStdString();
-					this->addItemToActionData(newData, param, value);
+	const app::utility::json::Parser commands(QString::fromStdString(filename), QIODevice::ReadOnly);
+	const QJsonObject jsonObject(commands.getJsonObject());
+
+	const auto jsonFile = std::find(this->actionJsonFiles.cbegin(), this->actionJsonFiles.cend(), filename);
+	if (jsonFile == this->actionJsonFiles.cend()) {
+		LOG_INFO(app::logger::info_level_e::ZERO, jsonActionOverall, "Adding " << filename << " to the list of action JSON files");
+		this->actionJsonFiles.push_back(filename);
+	} else {
+		LOG_WARNING(jsonActionOverall, "File " << filename << " has already been added to the list of JSON files");
+	}
+
+	const typename app::base::json::Action<Data>::field_table_t & fieldTable = app::base::json::Action<Data>::getFieldTable();
+
+	// Iterate over keys in JSON file
+	for (QJsonObject::const_iterator entryIt = jsonObject.constBegin(); entryIt != jsonObject.constEnd(); entryIt++) {
+		const std::string key(entryIt.key().toStdString());
+		const QString entryPath(QString::fromStdString(filename) + "/" + entryIt.key());
+		EXCEPTION_ACTION_COND((entryIt.value().isObject() == false), throw, "Schema error at " << entryPath << ": expected an object but found a value of type " << entryIt.value().type());
+		const QJsonObject entry(entryIt.value().toObject());
+
+		// Create JSON data
+		std::unique_ptr<Data> newData = std::make_unique<Data>(key);
+		// Read fields by name in order to populate the data
+		int foundFields = 0;
+		for (const auto & field : fieldTable) {
+			const QJsonObject::const_iterator valueIt = entry.constFind(field.first);
+			if (valueIt != entry.constEnd()) {
+				// Assign a value to a parameter data by name
+				const std::string value(app::utility::json::Parser::valueToString(valueIt.value(), entryPath + "/" + field.first).toStdString());
+				this->addItemToActionData(newData, field.second, value);
+				foundFields++;
+			}
+		}
+
+		if (foundFields != entry.size()) {
+			for (QJsonObject::const_iterator memberIt = entry.constBegin(); memberIt != entry.constEnd(); memberIt++) {
+				const auto knownField = std::find_if(fieldTable.cbegin(), fieldTable.cend(), [&] (const auto & field) -> bool {
+					return (field.first.compare(memberIt.key()) == 0);
+				});
+				if (knownField == fieldTable.cend()) {
+					LOG_WARNING(jsonActionOverall, "Schema warning at " << entryPath << "/" << memberIt.key() << ": unknown field is ignored");
 				}
-			});
+			}
+		}
 
-			std::pair<std::string, std::unique_ptr<Data>> dataPair;
+		std::pair<std::string, std::unique_ptr<Data>> dataPair;
 
-			dataPair.first = key;
-			// Pass ownership to dataPair
-			dataPair.second = std::move(newData);
+		dataPair.first = key;
+		// Pass ownership to dataPair
+		dataPair.second = std::move(newData);
 
-			// insert returns a pair where:
-			// - first points to the newly created iterator or the element with the same key
-			// - second is true if the insertion is successful, false otherwise
-			const auto [it, success] = this->actionData.insert(std::move(dataPair));
+		// insert returns a pair where:
+		// - first points to the newly created iterator or the element with the same key
+		// - second is true if the insertion is successful, false otherwise
+		const auto [it, success] = this->actionData.insert(std::move(dataPair));
 
-			EXCEPTION_ACTION_COND((success == false), throw, "Insertion of element " << *(it->second) << " failed.");
+		EXCEPTION_ACTION_COND((success == false), throw, "Schema error at " << entryPath << ": insertion of element " << *(it->second) << " failed because key " << key << " already exists");
 
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonActionOverall, "Appending data for key " << it->first << ": " << *(it->second));
+		this->addToIndexes(it);
 
-			const auto jsonFile = std::find(this->actionJsonFiles.cbegin(), this->actionJsonFiles.cend(), filename);
-			if (jsonFile == this->actionJsonFiles.cend()) {
-				LOG_INFO(app::logger::info_level_e::ZERO, jsonActionOverall, "Adding " << filename << " to the list of action JSON files");
-				this->actionJsonFiles.push_back(filename);
-			} else {
-				LOG_WARNING(jsonActionOverall, "File " << filename << " has already been added to the list of JSON files");
-			}
+		LOG_INFO(app::logger::info_level_e::HIGH, jsonActionOverall, "Appending data for key " << it->first << ": " << *(it->second));
+	}
 
-		});
-	};
+}
 
+template<class Data>
+const typename app::base::json::Action<Data>::field_table_t & app::base::json::Action<Data>::getFieldTable() {
+	static const typename app::base::json::Action<Data>::field_table_t fieldTable = [] () {
+		typename app::base::json::Action<Data>::field_table_t table;
+		// Parameters are the same for all data therefore they are read from a prototype
+		const std::string prototypeKey("prototype");
+		const Data prototype(prototypeKey);
+		for (const std::string & param : prototype.getParameters()) {
+			table.emplace_back(QString::fromStdString(param), param);
+		}
+		return table;
+	}();
+
+	return fieldTable;
 }
 
 template<class Data>
 template<typename FuncRet>
 typename app::base::json::Action<Data>::template enableFunction<FuncRet> app::base::json::Action<Data>::findDataWithFieldValue(const std::string & name, const void * value) const {
-	const typename app::base::json::Action<Data>::action_data_t::const_iterator foundData = std::find_if(this->actionData.cbegin(), this->actionData.cend(), [&] (const auto & data) -> bool {
-		const std::unique_ptr<Data> & commandData = data.second;
-		bool found = commandData->isSameFieldValue(name, value);
-		return found;
-	});
-
-	if (foundData != this->actionData.cend()) {
-		return foundData->second;
+	const typename Data::indexed_parameter_map_t & indexedParameters = Data::getIndexedParameters();
+	const typename Data::indexed_parameter_map_t::const_iterator parameterIt = indexedParameters.find(name);
+	if (parameterIt != indexedParameters.cend()) {
+		const std::unique_ptr<Data> & foundData = this->findIndexedData(parameterIt->second, Data::toIndexKey(parameterIt->second, value));
+		if (foundData != this->invalidData) {
+			return foundData;
+		}
+	} else {
+		const typename app::base::json::Action<Data>::action_data_t::const_iterator foundData = std::find_if(this->actionData.cbegin(), this->actionData.cend(), [&] (const auto & data) -> bool {
+			const std::unique_ptr<Data> & commandData = data.second;
+			bool found = commandData->isSameFieldValue(name, value);
+			return found;
+		});
+
+		if (foundData != this->actionData.cend()) {
+			return foundData->second;
+		}
 	}
 
 	LOG_INFO(app::logger::info_level_e::ZERO, jsonActionOverall, "Unable to find matching value for field " << name);
@@ -290,10 +420,68 @@ typename app::base::json::Action<Data>::template enableFunction<FuncRet> app::ba
 	return this->invalidData;
 }
 
+template<class Data>
+const std::unique_ptr<Data> & app::base::json::Action<Data>::findIndexedData(const typename Data::indexed_parameter_e & parameter, const app::base::json::Data::index_key_t & key) const {
+	const typename app::base::json::Action<Data>::field_index_t & fieldIndex = this->fieldIndexes.at(static_cast<std::size_t>(parameter));
+	const typename app::base::json::Action<Data>::field_index_t::const_iterator foundData = fieldIndex.find(key);
+	if (foundData != fieldIndex.cend()) {
+		return foundData->second->second;
+	}
+
+	return this->invalidData;
+}
+
 template<class Data>
 void app::base::json::Action<Data>::clear() {
 	this->actionData.clear();
 	this->actionJsonFiles.clear();
+	for (typename app::base::json::Action<Data>::field_index_t & fieldIndex : this->fieldIndexes) {
+		fieldIndex.clear();
+	}
+}
+
+template<class Data>
+void app::base::json::Action<Data>::removeActionData(const std::string & key) {
+	const typename app::base::json::Action<Data>::action_data_t::const_iterator dataIt = this->actionData.find(key);
+	if (dataIt == this->actionData.cend()) {
+		LOG_WARNING(jsonActionOverall, "Unable to remove action with key " << key << " because it cannot be found");
+	} else {
+		LOG_INFO(app::logger::info_level_e::ZERO, jsonActionOverall, "Removing action with key " << key);
+		this->removeFromIndexes(dataIt);
+		this->actionData.erase(dataIt);
+	}
+}
+
+template<class Data>
+void app::base::json::Action<Data>::addToIndexes(const typename app::base::json::Action<Data>::action_data_t::const_iterator & dataIt) {
+	for (const typename Data::indexed_parameter_map_t::value_type & parameter : Data::getIndexedParameters()) {
+		typename app::base::json::Action<Data>::field_index_t & fieldIndex = this->fieldIndexes.at(static_cast<std::size_t>(parameter.second));
+		const std::pair<typename app::base::json::Action<Data>::field_index_t::iterator, bool> insertion = fieldIndex.emplace(dataIt->second->getIndexKey(parameter.second), dataIt);
+		// Keep the action that a linear search would find first. The entry is replaced as its key views the value of the action it refers to
+		if ((insertion.second == false) && (dataIt->first.compare(insertion.first->second->first) < 0)) {
+			fieldIndex.erase(insertion.first);
+			fieldIndex.emplace(dataIt->second->getIndexKey(parameter.second), dataIt);
+		}
+	}
+}
+
+template<class Data>
+void app::base::json::Action<Data>::removeFromIndexes(const typename app::base::json::Action<Data>::action_data_t::const_iterator & dataIt) {
+	for (const typename Data::indexed_parameter_map_t::value_type & parameter : Data::getIndexedParameters()) {
+		typename app::base::json::Action<Data>::field_index_t & fieldIndex = this->fieldIndexes.at(static_cast<std::size_t>(parameter.second));
+		const app::base::json::Data::index_key_t indexKey(dataIt->second->getIndexKey(parameter.second));
+		const typename app::base::json::Action<Data>::field_index_t::iterator entry = fieldIndex.find(indexKey);
+		if ((entry != fieldIndex.end()) && (entry->second == dataIt)) {
+			fieldIndex.erase(entry);
+			// Another action may share the same field value
+			const typename app::base::json::Action<Data>::action_data_t::const_iterator replacement = std::find_if(this->actionData.cbegin(), this->actionData.cend(), [&] (const auto & data) -> bool {
+				return ((data.first.compare(dataIt->first) != 0) && (data.second->getIndexKey(parameter.second) == indexKey));
+			});
+			if (replacement != this->actionData.cend()) {
+				fieldIndex.emplace(replacement->second->getIndexKey(parameter.second), replacement);
+			}
+		}
+	}
 }
 
 template<class Data>
@@ -9,6 +9,9 @@
 */
 
 #include <set>
+#include <string>
+#include <variant>
+#include <string_view>
 
 #include "app/shared/classes.h"
 #include "app/utility/log/printable_object.h"
@@ -36,6 +39,13 @@ namespace app {
 					 */
 					typedef std::set<std::string, app::shared::StringCompare> parameter_t;
 
+					/**
+					 * @brief type of the key of an indexed parameter
+					 * Strings are viewed rather than copied therefore the key of a data is valid as long as the data is not modified
+					 *
+					 */
+					typedef std::variant<std::string_view, int> index_key_t;
+
 					/**
 					 * @brief Function: virtual const parameter_t & getParameters() const final
 					 *
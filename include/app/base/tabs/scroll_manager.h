@@ -9,6 +9,11 @@
 */
 
 #include <memory>
+#include <optional>
+
+// Qt libraries
+#include <QtCore/QTimer>
+#include <QtCore/QPoint>
 
 #include "app/base/tabs/tab_component_widget.h"
 #include "app/base/tabs/tab_shared_types.h"
@@ -186,6 +191,60 @@ namespace app {
 					 */
 					std::shared_ptr<app::base::tab::TabBar> bar;
 
+					/**
+					 * @brief timer limiting the rate of scroll requests sent to the page
+					 * At most one request is sent every time the timer expires
+					 *
+					 */
+					std::unique_ptr<QTimer> dispatchTimer;
+
+					/**
+					 * @brief net scroll offset accumulated since the last request sent to the page
+					 * While the page is loading, it accumulates every request until the page can scroll
+					 *
+					 */
+					QPoint pendingScroll;
+
+					/**
+					 * @brief position requested to the page the last time
+					 * It is used as starting point of the next request while the page has not reported the new scroll position yet
+					 *
+					 */
+					QPoint scrollTarget;
+
+					/**
+					 * @brief flag stating whether the scroll target is more recent than the scroll position reported by the page
+					 *
+					 */
+					bool scrollTargetValid;
+
+					/**
+					 * @brief Function: void dispatchScrollRequest()
+					 *
+					 * This function sends the net scroll offset accumulated since the last request to the page as a single request
+					 */
+					void dispatchScrollRequest();
+
+					/**
+					 * @brief Function: QPoint clampScrollPosition(const QPoint & position) const
+					 *
+					 * \param position: scroll position
+					 *
+					 * \return the scroll position within the scrollable area of the page
+					 *
+					 * This function clamps the scroll position provided as argument to the scrollable area of the page
+					 */
+					QPoint clampScrollPosition(const QPoint & position) const;
+
+					/**
+					 * @brief Function: QSize getViewportSize() const
+					 *
+					 * \return the size of the area showing the page
+					 *
+					 * This function returns the size of the area showing the page, i.e. the size of the parent widget without the tab bar
+					 */
+					QSize getViewportSize() const;
+
 					/**
 					 * @brief Function: vortual void execute(const app::base::tab::direction_e & direction) override final
 					 *
@@ -196,14 +255,17 @@ namespace app {
 					virtual void execute(const app::base::tab::direction_e & direction) override final;
 
 					/**
-					 * @brief Function: void checkScrollValue(const int & scroll, const QString & direction) const
+					 * @brief Function: std::optional<int> computeScrollPercentage(const qreal & position, const qreal & scrollableSize, const QString & direction) const
 					 *
-					 * \param scroll: value of scrolling
+					 * \param position: scroll position
+					 * \param scrollableSize: range the scroll position can span
 					 * \param direction: direction of scrolling
 					 *
-					 * This function checks that the value of scrolling is within the allowed range defined by app::base::tab::minScrollPercentage and app::base::tab::maxScrollPercentage
+					 * \return the percentage of scrolling or no value if the page cannot be scrolled in the direction provided as argument
+					 *
+					 * This function computes the percentage of scrolling. Values outside the allowed range defined by app::base::tab::minScrollPercentage and app::base::tab::maxScrollPercentage, e.g. while the size of the contents is being updated, are clamped to it
 					 */
-					void checkScrollValue(const int & scroll, const QString & direction) const;
+					std::optional<int> computeScrollPercentage(const qreal & position, const qreal & scrollableSize, const QString & direction) const;
 
 					/**
 					 * @brief Function: virtual void canProcessRequests() const override
@@ -50,6 +50,24 @@ namespace app {
 					 */
 					virtual ~Search();
 
+					/**
+					 * @brief Function: const app::windows::shared::FindSettings & getSettings() const
+					 *
+					 * \return settings of the last search
+					 *
+					 * This function returns the settings of the last search
+					 */
+					const app::windows::shared::FindSettings & getSettings() const;
+
+					/**
+					 * @brief Function: void setSettings(const app::windows::shared::FindSettings & value)
+					 *
+					 * \param value: settings of the last search
+					 *
+					 * This function sets the settings of the last search without searching the text
+					 */
+					void setSettings(const app::windows::shared::FindSettings & value);
+
 				protected:
 					/**
 					 * @brief find settings
@@ -79,13 +97,12 @@ namespace app {
 					 */
 					virtual void setCallback();
 
-				private:
 					/**
-					 * @brief Function: virtual void search() final
+					 * @brief Function: virtual void search()
 					 *
 					 * This function searches text in a webpage
 					 */
-					virtual void search() final;
+					virtual void search();
 
 					/**
 					 * @brief Function: virtual void canProcessRequests() const override
@@ -96,6 +113,7 @@ namespace app {
 					 */
 					virtual bool canProcessRequests() const override;
 
+				private:
 					// Move and copy constructor
 					/**
 					 * @brief Disable move and copy constructors and operator= overloading for class Search
@@ -361,6 +361,13 @@ namespace app {
 					 */
 					const std::shared_ptr<app::base::tab::ScrollManager> getScrollManager() const;
 
+					/**
+					 * @brief Function: void releaseComponents()
+					 *
+					 * This function disconnects and destroys the view and all components attached to it
+					 */
+					void releaseComponents();
+
 					/**
 					 * @brief Function: virtual virtual void find(const app::windows::shared::FindSettings & settings) const final
 					 *
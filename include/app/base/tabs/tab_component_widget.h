@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <list>
+#include <cstddef>
 
 // Qt libraries
 #include <QtWidgets/QWidget>
@@ -94,6 +95,25 @@ namespace app {
 					 */
 					virtual void emptyRequestQueue() final;
 
+					/**
+					 * @brief Function: void setMaximumQueueLength(const std::size_t & value)
+					 *
+					 * \param value: maximum number of requests in the queue
+					 *
+					 * This function sets the maximum number of requests in the queue
+					 * If the queue is longer than the new value, the oldest requests are dropped
+					 */
+					void setMaximumQueueLength(const std::size_t & value);
+
+					/**
+					 * @brief Function: const std::size_t & getMaximumQueueLength() const
+					 *
+					 * \return maximum number of requests in the queue
+					 *
+					 * This function returns the maximum number of requests in the queue
+					 */
+					const std::size_t & getMaximumQueueLength() const;
+
 					/**
 					 * @brief Function: void setTab(std::weak_ptr<QWidget> newTab)
 					 *
@@ -129,12 +149,31 @@ namespace app {
 					std::list<type> requestQueue;
 
 				private:
+					/**
+					 * @brief default maximum number of requests in the queue
+					 *
+					 */
+					static constexpr std::size_t defaultMaximumQueueLength = 64;
+
 					/**
 					 * @brief tab the scroll manager belongs to
 					 *
 					 */
 					std::weak_ptr<app::base::tab::Tab> browserTab;
 
+					/**
+					 * @brief maximum number of requests in the queue
+					 * When the queue is full, the oldest request is dropped to make room for the new one
+					 *
+					 */
+					std::size_t maximumQueueLength;
+
+					/**
+					 * @brief number of requests dropped since the queue was last emptied
+					 *
+					 */
+					std::size_t droppedRequests;
+
 					// Move and copy constructor
 					/**
 					 * @brief Disable move and copy constructors and operator= overscrolling for class TabComponentWidget
@@ -152,7 +191,7 @@ namespace app {
 /** @} */ // End of TabGroup group
 
 template<typename type>
-app::base::tab::TabComponentWidget<type>::TabComponentWidget(QWidget * parent, std::weak_ptr<app::base::tab::Tab> attachedTab): QWidget(parent) {
+app::base::tab::TabComponentWidget<type>::TabComponentWidget(QWidget * parent, std::weak_ptr<app::base::tab::Tab> attachedTab): QWidget(parent), requestQueue(), browserTab(), maximumQueueLength(app::base::tab::TabComponentWidget<type>::defaultMaximumQueueLength), droppedRequests(0) {
 	LOG_INFO(app::logger::info_level_e::ZERO, tabComponentWidgetOverall, "TabComponentWidget constructor");
 
 	this->browserTab.reset();
@@ -186,6 +225,26 @@ void app::base::tab::TabComponentWidget<type>::setTab(std::weak_ptr<app::base::t
 template<typename type>
 void app::base::tab::TabComponentWidget<type>::pushRequestQueue(const type & entry) {
 	this->requestQueue.push_back(entry);
+
+	while (this->requestQueue.size() > this->maximumQueueLength) {
+		this->requestQueue.pop_front();
+		this->droppedRequests++;
+	}
+}
+
+template<typename type>
+void app::base::tab::TabComponentWidget<type>::setMaximumQueueLength(const std::size_t & value) {
+	this->maximumQueueLength = value;
+
+	while (this->requestQueue.size() > this->maximumQueueLength) {
+		this->requestQueue.pop_front();
+		this->droppedRequests++;
+	}
+}
+
+template<typename type>
+const std::size_t & app::base::tab::TabComponentWidget<type>::getMaximumQueueLength() const {
+	return this->maximumQueueLength;
 }
 
 template<typename type>
@@ -196,6 +255,12 @@ void app::base::tab::TabComponentWidget<type>::emptyRequestQueue() {
 		}
 	}
 
+	// Dropped requests are reported once per queue rather than once per request
+	if (this->droppedRequests > 0) {
+		LOG_WARNING(tabComponentWidgetOverall, "Request queue was full (" << this->maximumQueueLength << " requests) - " << this->droppedRequests << " oldest requests have been dropped");
+		this->droppedRequests = 0;
+	}
+
 	this->requestQueue.clear();
 }
 
@@ -8,6 +8,10 @@
  * @brief Web Engine Profile header file
 */
 
+#include <string>
+
+// Qt libraries
+#include <QtCore/QString>
 #include <QtWebEngineWidgets/QWebEngineProfile>
 
 #include "app/shared/enums.h"
@@ -26,6 +30,7 @@ namespace app {
 
 			/**
 			 * @brief WebEngineProfile class
+			 * The default profile is created only once and it is shared by all pages so that they share the HTTP cache and the cookies
 			 *
 			 */
 			class WebEngineProfile : public QWebEngineProfile {
@@ -36,10 +41,20 @@ namespace app {
 					 *
 					 * \return the default profile
 					 *
-					 * this function constructs the default web engine profile
+					 * this function constructs the default web engine profile the first time it is called and configures it based on the browser settings
 					 */
 					static app::base::tab::WebEngineProfile * defaultProfile();
 
+					/**
+					 * @brief Function: static QString getDefaultStorageName()
+					 *
+					 * \return the storage name of the default profile
+					 *
+					 * This function returns the storage name of the default profile based on the browser settings
+					 * The name is empty if the profile must be kept in memory in order to create an off-the-record profile
+					 */
+					static QString getDefaultStorageName();
+
 					/**
 					 * @brief Function: explicit WebEngineProfile(const QString & storageName, QObject * parent)
 					 *
@@ -58,8 +73,26 @@ namespace app {
 					virtual ~WebEngineProfile();
 
 				protected:
+					/**
+					 * @brief Function: void applySettings()
+					 *
+					 * This function configures the HTTP cache and the cookie policy of the profile based on the browser settings
+					 */
+					void applySettings();
 
 				private:
+					/**
+					 * @brief Function: static std::string getSetting(const std::string & name, const bool & allowEmpty)
+					 *
+					 * \param name: name of the setting
+					 * \param allowEmpty: the value of the setting can be an empty string
+					 *
+					 * \return the value of the setting
+					 *
+					 * This function returns the value of a browser setting and throws an exception if it is not found or empty when it is not allowed
+					 */
+					static std::string getSetting(const std::string & name, const bool & allowEmpty);
+
 					// Move and copy constructor
 					/**
 					 * @brief Disable move and copy constructors and operator= overloading for class WebEngineProfile
@@ -74,6 +74,16 @@ namespace app {
 					const std::shared_ptr<app::base::tab::Tab> getTab() const;
 
 				protected:
+					/**
+					 * @brief Function: explicit WebEngineView(QWidget * parent, std::weak_ptr<app::base::tab::Tab> attachedTab, const std::shared_ptr<app::base::tab::WebEnginePage> & newPage)
+					 *
+					 * \param parent: parent widget
+					 * \param attachedTab: tab attached to this view
+					 * \param newPage: page of the view
+					 *
+					 * Web engine view constructor used by derived classes in order not to create a page that would be replaced straight away
+					 */
+					explicit WebEngineView(QWidget * parent, std::weak_ptr<app::base::tab::Tab> attachedTab, const std::shared_ptr<app::base::tab::WebEnginePage> & newPage);
 
 					/**
 					 * @brief Function: void updatePage(const std::shared_ptr<app::base::tab::WebEnginePage> & newPage)
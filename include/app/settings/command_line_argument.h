@@ -8,6 +8,7 @@
  * @brief Command line argument header file
  */
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -223,6 +224,66 @@ namespace app {
 				 */
 				virtual bool isSameFieldValue(const std::string & name, const void * value) const override;
 
+				/**
+				 * @brief Function: virtual const void * getValueFromMemberName(const std::string & name) const override
+				 *
+				 * \param name: name of the name of the member as a string
+				 *
+				 * \return value of the member
+				 *
+				 * This functions returns the value of a member of Argument by accessing it through its name
+				 */
+				virtual const void * getValueFromMemberName(const std::string & name) const override;
+
+				/**
+				 * @brief indexed parameters
+				 *
+				 */
+				typedef enum class indexed_parameter_list {
+					SHORT_CMD, /**< Short command */
+					LONG_CMD   /**< Long command */
+				} indexed_parameter_e;
+
+				/**
+				 * @brief map of indexed parameters
+				 * key is the name of the parameter
+				 * value is the parameter
+				 *
+				 */
+				typedef std::map<std::string, indexed_parameter_e> indexed_parameter_map_t;
+
+				/**
+				 * @brief Function: static const indexed_parameter_map_t & getIndexedParameters()
+				 *
+				 * \return the parameters to be indexed
+				 *
+				 * This functions returns the parameters whose value is indexed in order to search arguments in constant time
+				 */
+				static const indexed_parameter_map_t & getIndexedParameters();
+
+				/**
+				 * @brief Function: static app::base::json::Data::index_key_t toIndexKey(const indexed_parameter_e & parameter, const void * value)
+				 *
+				 * \param parameter: indexed parameter
+				 * \param value: value of the parameter
+				 *
+				 * \return the key of the value in the index of the parameter
+				 *
+				 * This functions converts the value of an indexed parameter to the key of its index
+				 */
+				static app::base::json::Data::index_key_t toIndexKey(const indexed_parameter_e & parameter, const void * value);
+
+				/**
+				 * @brief Function: app::base::json::Data::index_key_t getIndexKey(const indexed_parameter_e & parameter) const
+				 *
+				 * \param parameter: indexed parameter
+				 *
+				 * \return the key of the argument in the index of the parameter
+				 *
+				 * This functions returns the value of an indexed parameter of the argument as a key of its index
+				 */
+				app::base::json::Data::index_key_t getIndexKey(const indexed_parameter_e & parameter) const;
+
 			private:
 				/**
 				 * @brief key under which the JSON object is
@@ -282,17 +343,6 @@ namespace app {
 				 */
 				virtual void setValueFromMemberName(const std::string & name, const void * value) override;
 
-				/**
-				 * @brief Function: virtual const void * getValueFromMemberName(const std::string & name) const override
-				 *
-				 * \param name: name of the name of the member as a string
-				 *
-				 * \return value of the member
-				 *
-				 * This functions returns the value of a member of Argument by accessing it through its name
-				 */
-				virtual const void * getValueFromMemberName(const std::string & name) const override;
-
 		};
 
 	}
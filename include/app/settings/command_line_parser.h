@@ -107,6 +107,28 @@ namespace app {
 				 */
 				const app::command_line::argument_map_t & getDecodedArguments() const;
 
+				/**
+				 * @brief Function: const std::unique_ptr<app::command_line::Argument> & findByShortCmd(const std::string & shortCmd) const
+				 *
+				 * \param shortCmd: short command to search
+				 *
+				 * \return argument having the short command provided as argument or the invalid data if no match
+				 *
+				 * This functions searches in constant time the argument having the short command provided as argument
+				 */
+				const std::unique_ptr<app::command_line::Argument> & findByShortCmd(const std::string & shortCmd) const;
+
+				/**
+				 * @brief Function: const std::unique_ptr<app::command_line::Argument> & findByLongCmd(const std::string & longCmd) const
+				 *
+				 * \param longCmd: long command to search
+				 *
+				 * \return argument having the long command provided as argument or the invalid data if no match
+				 *
+				 * This functions searches in constant time the argument having the long command provided as argument
+				 */
+				const std::unique_ptr<app::command_line::Argument> & findByLongCmd(const std::string & longCmd) const;
+
 				/**
 				 * @brief Function: const std::string print() const override
 				 *
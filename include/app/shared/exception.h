@@ -50,11 +50,12 @@
  * \param ...       : variable number of arguments to provide to infoMsg
  *
  * Execute action on an exception
+ * Only the message is formatted here. File and condition are string literals and the timestamp is formatted if the exception is printed
  */
 #define EXCEPTION_ACTION_INTERNAL(ACTION, CONDITION, ...)\
-	std::stringstream msgStream; \
+	std::ostringstream msgStream; \
 	msgStream << __VA_ARGS__; \
-	ACTION app::exception::Exception(app::shared::getDateTime().toStdString(), __LINE__, __FILE__, CONDITION, msgStream.str());
+	ACTION app::exception::Exception(__LINE__, __FILE__, CONDITION, msgStream.str());
 
 /** @} */ // End of SharedGroup group
 
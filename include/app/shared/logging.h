@@ -27,6 +27,17 @@ namespace app {
 		 */
 		QString getDateTime();
 
+		/**
+		 * @brief Function: QString getDateTime(const qint64 & msecsSinceEpoch)
+		 *
+		 * \param msecsSinceEpoch: number of milliseconds elapsed since epoch
+		 *
+		 * \return date and time as a QString
+		 *
+		 * This function returns the date and time corresponding to the number of milliseconds since epoch provided as argument
+		 */
+		QString getDateTime(const qint64 & msecsSinceEpoch);
+
 	}
 
 }
@@ -0,0 +1,170 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+/**
+ * @copyright
+ * @file mapped_file.h
+ * @author Andrea Gianarda
+ * @date 03rd September 2020
+ * @brief Mapped file header file
+ */
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <string_view>
+
+#include "app/shared/constructor_macros.h"
+
+/** @defgroup MappedFileGroup Mapped File Group
+ *  Mapped file functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace utility {
+
+		/**
+		 * @brief MappedFile class
+		 * The content of the file is mapped in memory in read-only mode so that pages are only loaded when they are accessed
+		 * If the file cannot be mapped, its content is read with a single read into a buffer
+		 *
+		 */
+		class MappedFile final {
+
+			public:
+				/**
+				 * @brief Function: explicit MappedFile(const std::string & filename)
+				 *
+				 * \param filename: file to open
+				 *
+				 * Mapped file constructor
+				 * It throws an exception if the file cannot be opened or read
+				 */
+				explicit MappedFile(const std::string & filename);
+
+				/**
+				 * @brief Function: virtual ~MappedFile()
+				 *
+				 * Mapped file destructor
+				 */
+				virtual ~MappedFile();
+
+				/**
+				 * @brief Function: const char * data() const
+				 *
+				 * \return pointer to the first byte of the file
+				 *
+				 * This function returns a pointer to the content of the file
+				 */
+				const char * data() const;
+
+				/**
+				 * @brief Function: std::size_t size() const
+				 *
+				 * \return size of the file in bytes
+				 *
+				 * This function returns the size of the file in bytes
+				 */
+				std::size_t size() const;
+
+				/**
+				 * @brief Function: std::string_view view() const
+				 *
+				 * \return view over the whole content of the file
+				 *
+				 * This function returns a view over the whole content of the file
+				 */
+				std::string_view view() const;
+
+				/**
+				 * @brief Function: bool isMapped() const
+				 *
+				 * \return true if the file is mapped in memory and false if its content has been copied into a buffer
+				 *
+				 * This function returns whether the file is mapped in memory
+				 */
+				bool isMapped() const;
+
+				/**
+				 * @brief Function: const std::string & getFilename() const
+				 *
+				 * \return name of the file
+				 *
+				 * This function returns the name of the file
+				 */
+				const std::string & getFilename() const;
+
+				/**
+				 * @brief Function: std::size_t findLineStart(const std::size_t & offset) const
+				 *
+				 * \param offset: offset in the file
+				 *
+				 * \return offset of the first character of the line the offset provided as argument belongs to
+				 *
+				 * This function returns the offset of the first character of the line containing the offset provided as argument
+				 */
+				std::size_t findLineStart(const std::size_t & offset) const;
+
+				/**
+				 * @brief Function: std::size_t findLineEnd(const std::size_t & offset) const
+				 *
+				 * \param offset: offset in the file
+				 *
+				 * \return offset following the newline character terminating the line the offset provided as argument belongs to
+				 *
+				 * This function returns the offset following the line containing the offset provided as argument or the size of the file if it is the last line
+				 */
+				std::size_t findLineEnd(const std::size_t & offset) const;
+
+			protected:
+
+			private:
+				/**
+				 * @brief name of the file
+				 *
+				 */
+				std::string filename;
+
+				/**
+				 * @brief mapped content
+				 * It is a nullptr if the file is not mapped
+				 *
+				 */
+				void * mapping;
+
+				/**
+				 * @brief content of the file if it cannot be mapped
+				 *
+				 */
+				std::vector<char> buffer;
+
+				/**
+				 * @brief size of the file in bytes
+				 *
+				 */
+				std::size_t fileSize;
+
+				/**
+				 * @brief Function: void readContent(const int & descriptor)
+				 *
+				 * \param descriptor: file descriptor
+				 *
+				 * This function copies the content of the file into the buffer
+				 */
+				void readContent(const int & descriptor);
+
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class MappedFile
+				 *
+				 */
+				DISABLE_COPY_MOVE(MappedFile)
+
+		};
+
+	}
+
+}
+/** @} */ // End of MappedFileGroup group
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,58 @@
+#ifndef PROCESS_MEMORY_H
+#define PROCESS_MEMORY_H
+/**
+ * @copyright
+ * @file process_memory.h
+ * @author Andrea Gianarda
+ * @date 02nd of September 2020
+ * @brief Process memory header file
+*/
+
+#include <cstdint>
+#include <string>
+
+/** @defgroup ProcessMemoryGroup Process Memory Doxygen Group
+ *  Process Memory
+ *  @{
+ */
+namespace app {
+
+	namespace utility {
+
+		/**
+		 * @brief Function: std::int64_t getMemoryStatus(const std::string & field, const std::string & process = "self")
+		 *
+		 * \param field: memory field of the status of the process, e.g. VmRSS or VmHWM
+		 * \param process: process ID or self for the calling process
+		 *
+		 * \return: value of the field in bytes or -1 if it cannot be read
+		 *
+		 * This function reads a memory field of /proc/<process>/status
+		 */
+		std::int64_t getMemoryStatus(const std::string & field, const std::string & process = "self");
+
+		/**
+		 * @brief Function: std::int64_t getResidentMemory()
+		 *
+		 * \return: resident memory of the calling process in bytes or -1 if it cannot be read
+		 *
+		 * This function returns the resident memory of the calling process
+		 * Renderer processes spawned by the web engine are not accounted for
+		 */
+		std::int64_t getResidentMemory();
+
+		/**
+		 * @brief Function: std::int64_t getPeakResidentMemory()
+		 *
+		 * \return: peak resident memory of the calling process in bytes or -1 if it cannot be read
+		 *
+		 * This function returns the peak resident memory of the calling process
+		 */
+		std::int64_t getPeakResidentMemory();
+
+	}
+
+}
+/** @} */ // End of ProcessMemoryGroup group
+
+#endif // PROCESS_MEMORY_H
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <string>
 #include <list>
+#include <vector>
 
 #include "app/shared/exception.h"
 
@@ -47,6 +48,18 @@ namespace app {
 		 */
 		const std::string removeTrailingCharacter(std::string text, const std::string & trailingCharacters);
 
+		/**
+		 * @brief Function: std::size_t editDistance(const std::string & lhs, const std::string & rhs)
+		 *
+		 * \param lhs: first string to compare
+		 * \param rhs: second string to compare
+		 *
+		 * \return: minimum number of insertions, deletions and substitutions of characters required to change one string into the other
+		 *
+		 * This function computes the Levenshtein distance between two strings
+		 */
+		std::size_t editDistance(const std::string & lhs, const std::string & rhs);
+
 		/**
 		 * @brief Function: const Container<std::string> splitStringByDelimiter(const std::string & text, const std::string & delimiter)
 		 *
@@ -8,7 +8,10 @@
  * @brief Browser exception functions
  */
 
+#include <atomic>
+#include <string>
 #include <sstream>
+#include <cstdint>
 #include <exception>
 
 /** @defgroup ExceptionGroup Browser Exception Doxygen Group
@@ -31,6 +34,8 @@ namespace app {
 
 		/**
 		 * @brief Exception class
+		 * Throwing an exception only captures the time, the line, pointers to the file and condition strings, which are string literals, and the message
+		 * Timestamp and description are formatted the first time they are requested and cached
 		 *
 		 */
 		class Exception final : public std::exception {
@@ -38,17 +43,26 @@ namespace app {
 			public:
 
 				/**
-				 * @brief Function: explicit Exception(const std::string exceptionTimestamp, const int & exceptionLine, const std::string & exceptionFile, const std::string & exceptionCondition, const std::string & exceptionMsg)
+				 * @brief Function: explicit Exception(const int & exceptionLine, const char * exceptionFile, const char * exceptionCondition, std::string && exceptionMsg)
 				 *
-				 * \param exceptionTimestamp: timestamp when the exception was created
 				 * \param exceptionLine: line where the exception was triggered
-				 * \param exceptionFile: file in which the exception was triggered
-				 * \param exceptionCondition: condition that triggered the exception
+				 * \param exceptionFile: file in which the exception was triggered. It must have static storage duration
+				 * \param exceptionCondition: condition that triggered the exception. It must have static storage duration
 				 * \param exceptionMsg: message of the exception
 				 *
 				 * Browser exception constructor
 				 */
-				explicit Exception(const std::string exceptionTimestamp, const int & exceptionLine, const std::string & exceptionFile, const std::string & exceptionCondition, const std::string & exceptionMsg);
+				explicit Exception(const int & exceptionLine, const char * exceptionFile, const char * exceptionCondition, std::string && exceptionMsg);
+
+				/**
+				 * @brief Function: static std::uint64_t getCreatedExceptions()
+				 *
+				 * \return the number of exceptions created since the program started
+				 *
+				 * This function returns the number of exceptions created since the program started. Copies are not counted
+				 * It allows to check that a path does not use exceptions for control flow
+				 */
+				static std::uint64_t getCreatedExceptions();
 
 				/**
 				 * @brief Function: virtual ~Exception()
@@ -69,7 +83,7 @@ namespace app {
 				 *
 				 * \return a deep copy of the exception
 				 *
-				 * Clone exception
+				 * Clone exception. File and condition are not owned by the exception therefore only pointers are copied
 				 */
 				app::exception::Exception * clone() const;
 
@@ -78,7 +92,7 @@ namespace app {
 				 *
 				 * \return print the exception message
 				 *
-				 * Print message
+				 * Print message. The description is formatted on the first call and the returned pointer stays valid as long as the exception exists
 				 */
 				virtual const char * what() const noexcept override;
 
@@ -96,7 +110,7 @@ namespace app {
 				 *
 				 * \return exception timestamp
 				 *
-				 * This function returns the timestamp when the exception was triggered
+				 * This function returns the timestamp when the exception was triggered. It is formatted on the first call
 				 */
 				const std::string & getTimestamp() const;
 
@@ -110,22 +124,22 @@ namespace app {
 				const int & getLine() const;
 
 				/**
-				 * @brief Function: const std::string & getFilename() const
+				 * @brief Function: const char * getFilename() const
 				 *
 				 * \return file where the exception was triggered
 				 *
 				 * This function returns the filename where the exception occurred
 				 */
-				const std::string & getFilename() const;
+				const char * getFilename() const;
 
 				/**
-				 * @brief Function: const std::string & getCondition() const
+				 * @brief Function: const char * getCondition() const
 				 *
 				 * \return condition triggering the exception
 				 *
 				 * This function returns the condition that triggered the exception
 				 */
-				const std::string & getCondition() const;
+				const char * getCondition() const;
 
 				/**
 				 * @brief Function: const std::string & getMessage() const
@@ -138,10 +152,28 @@ namespace app {
 
 			private:
 				/**
-				 * @brief timestamp of the exception
+				 * @brief number of exceptions created since the program started
+				 *
+				 */
+				static std::atomic<std::uint64_t> createdExceptions;
+
+				/**
+				 * @brief time of the exception in milliseconds since the epoch
+				 *
+				 */
+				std::int64_t time;
+
+				/**
+				 * @brief timestamp of the exception. It is empty until it is requested
+				 *
+				 */
+				mutable std::string timestamp;
+
+				/**
+				 * @brief description of the exception returned by what(). It is empty until it is requested
 				 *
 				 */
-				std::string timestamp;
+				mutable std::string description;
 
 				/**
 				 * @brief line of the exception
@@ -153,13 +185,13 @@ namespace app {
 				 * @brief filename where the exception triggered
 				 *
 				 */
-				std::string filename;
+				const char * filename;
 
 				/**
 				 * @brief condition that caused the exception
 				 *
 				 */
-				std::string condition;
+				const char * condition;
 
 				/**
 				 * @brief message of the exception
@@ -10,6 +10,7 @@
 
 // Qt libraries
 #include <QtCore/QString>
+#include <QtCore/QJsonObject>
 
 #include "app/utility/json/wrapper.h"
 
@@ -119,6 +120,27 @@ namespace app {
 					 */
 					const QStringList getJsonKeys() const;
 
+					/**
+					 * @brief Function: const QJsonObject getJsonObject() const
+					 *
+					 * \return the content of the JSON file if it is of type object
+					 *
+					 * This function returns the content of a JSON file of type object in order to iterate over it in a single pass
+					 */
+					const QJsonObject getJsonObject() const;
+
+					/**
+					 * @brief Function: static QString valueToString(const QJsonValue & value, const QString & path)
+					 *
+					 * \param value: value to convert
+					 * \param path: path of the value in the JSON file. It is only used to report errors
+					 *
+					 * \return the value converted to a string
+					 *
+					 * This function converts a string, a number or a boolean to a string and throws an exception for any other type
+					 */
+					static QString valueToString(const QJsonValue & value, const QString & path);
+
 				protected:
 
 				private:
@@ -8,6 +8,8 @@
  * @brief Logging header file
 */
 
+#include <string>
+
 // Qt libraries
 #include <QtCore/QMessageLogContext>
 #include <QtCore/QString>
@@ -27,10 +29,20 @@ namespace app {
 		 * \param context: context fo the message (function, file and category)
 		 * \param message: message to be printed
 		 *
-		 * This function initialize graphics
+		 * This function formats the message and hands it over to the logger backend that writes it to the Qt log file
+		 * The Qt log file is kept open and it is flushed by the writer thread of the backend, on exit and when a fatal message is logged
 		 */
 		void handler(QtMsgType type, const QMessageLogContext & context, const QString & message);
 
+		/**
+		 * @brief Function: const std::string & getLogFilename()
+		 *
+		 * \return the name of the Qt log file
+		 *
+		 * This function returns the name of the file Qt messages are written into
+		 */
+		const std::string & getLogFilename();
+
 		/**
 		 * @brief Function: void set_default_category()
 		 *
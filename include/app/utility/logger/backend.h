@@ -0,0 +1,604 @@
+#ifndef LOGGER_BACKEND_H
+#define LOGGER_BACKEND_H
+/**
+ * @copyright
+ * @file backend.h
+ * @author Andrea Gianarda
+ * @date 10th June 2020
+ * @brief Logger backend header file
+*/
+
+#include <map>
+#include <set>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <condition_variable>
+
+// Qt libraries
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+#include "app/shared/constructor_macros.h"
+#include "app/utility/cpp/singleton.h"
+#include "app/utility/logger/enums.h"
+#include "app/utility/logger/types.h"
+#include "app/utility/logger/ring_buffer.h"
+
+/** @defgroup LoggerGroup Logger Doxygen Group
+ *  Logger functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace logger {
+
+		/**
+		 * @brief Backend class
+		 * Loggers push records into a lock-free queue and a dedicated thread formats and writes them to the output files
+		 * Output files are kept opened for the whole lifetime of the backend and they are flushed periodically or when a warning or a more severe message is logged
+		 * Output files are rotated by the thread writing to them, therefore no record can be written to a file while it is being rotated
+		 * Rotated segments are compressed and removed to fit the disk budget by a dedicated thread
+		 *
+		 */
+		class Backend : public app::utility::Singleton<app::logger::Backend> {
+
+			public:
+				/**
+				 * @brief Function: explicit Backend()
+				 *
+				 * Logger backend constructor
+				 */
+				explicit Backend();
+
+				/**
+				 * @brief Function: virtual ~Backend()
+				 *
+				 * Logger backend destructor
+				 */
+				virtual ~Backend();
+
+				/**
+				 * @brief Function: void push(app::logger::record_s && record)
+				 *
+				 * \param record: record to log
+				 *
+				 * This function hands over a record to the writer thread
+				 * If the writer thread is not running, the record is written straight away by the calling thread
+				 */
+				void push(app::logger::record_s && record);
+
+				/**
+				 * @brief Function: void flush()
+				 *
+				 * This function writes all pending records and flushes the output files
+				 * It is executed by the calling thread and it is safe to call it while the writer thread is running
+				 */
+				void flush();
+
+				/**
+				 * @brief Function: void start()
+				 *
+				 * This function starts the writer thread
+				 */
+				void start();
+
+				/**
+				 * @brief Function: void stop()
+				 *
+				 * This function drains the queue and stops the writer thread
+				 * Records pushed after the writer thread has stopped are written synchronously
+				 */
+				void stop();
+
+				/**
+				 * @brief Function: bool isRunning() const
+				 *
+				 * \return true if the writer thread is running
+				 *
+				 * This function returns whether the writer thread is running
+				 */
+				bool isRunning() const;
+
+				/**
+				 * @brief Function: void setQueuePolicy(const app::logger::queue_policy_e & value)
+				 *
+				 * \param value: policy to apply when the queue is full
+				 *
+				 * This function sets the policy to apply when the queue is full
+				 */
+				void setQueuePolicy(const app::logger::queue_policy_e & value);
+
+				/**
+				 * @brief Function: app::logger::queue_policy_e getQueuePolicy() const
+				 *
+				 * \return the policy applied when the queue is full
+				 *
+				 * This function returns the policy applied when the queue is full
+				 */
+				app::logger::queue_policy_e getQueuePolicy() const;
+
+				/**
+				 * @brief Function: void setFlushInterval(const int & value)
+				 *
+				 * \param value: maximum interval in milliseconds between two flushes of the output files
+				 *
+				 * This function sets the maximum interval in milliseconds between two flushes of the output files
+				 */
+				void setFlushInterval(const int & value);
+
+				/**
+				 * @brief Function: int getFlushInterval() const
+				 *
+				 * \return the maximum interval in milliseconds between two flushes of the output files
+				 *
+				 * This function returns the maximum interval in milliseconds between two flushes of the output files
+				 */
+				int getFlushInterval() const;
+
+				/**
+				 * @brief Function: std::uint64_t getDroppedRecords() const
+				 *
+				 * \return the number of records dropped because the queue was full
+				 *
+				 * This function returns the number of records dropped because the queue was full
+				 */
+				std::uint64_t getDroppedRecords() const;
+
+				/**
+				 * @brief Function: void setRotation(const app::logger::rotation_s & value)
+				 *
+				 * \param value: rotation of the output files
+				 *
+				 * This function sets how output files are rotated
+				 * If there is a disk budget, a file is rotated at the latest when it reaches half of the budget in order to always keep the previous segment
+				 */
+				void setRotation(const app::logger::rotation_s & value);
+
+				/**
+				 * @brief Function: app::logger::rotation_s getRotation() const
+				 *
+				 * \return the rotation of the output files
+				 *
+				 * This function returns how output files are rotated
+				 */
+				app::logger::rotation_s getRotation() const;
+
+				/**
+				 * @brief Function: void close(const std::string & filename)
+				 *
+				 * \param filename: name of the output file
+				 *
+				 * This function writes all pending records and closes the output file provided as argument
+				 * The file is opened again if a record is logged to it afterwards
+				 */
+				void close(const std::string & filename);
+
+				/**
+				 * @brief Function: void waitForSegments()
+				 *
+				 * This function waits for the rotated segments to be compressed and to fit the disk budget
+				 */
+				void waitForSegments();
+
+			protected:
+
+			private:
+
+				/**
+				 * @brief maximum number of records written before checking whether files must be flushed
+				 *
+				 */
+				static constexpr std::size_t batchSize = 256;
+
+				/**
+				 * @brief size in bytes of the buffer of every output file
+				 * Bursts of messages are written to the file with few system calls
+				 *
+				 */
+				static constexpr std::size_t streamBufferSize = 1 << 20;
+
+				/**
+				 * @brief opened output file
+				 *
+				 */
+				typedef struct output_file_t {
+					std::unique_ptr<char[]> buffer;           /**< buffer of the stream. It is declared before the stream so that it is destroyed after it */
+					std::unique_ptr<std::ofstream> stream;    /**< stream writing to the file */
+					std::uint64_t size;                       /**< size of the file in bytes */
+					std::int64_t creationTime;                /**< time in nanoseconds when the file was created or opened. It is monotonic for trace files */
+					bool traceStarted;                        /**< the header of the trace has been written since the file was opened */
+					std::vector<bool> tracedDescriptors;      /**< descriptors written to the trace since the file was opened, indexed by their identifier */
+					bool failed;                              /**< the file could not be opened therefore records written to it are dropped until it is closed */
+				} output_file_s;
+
+				/**
+				 * @brief Function: static QString getSegmentName(const std::string & filename, const int & index, const bool & compressed)
+				 *
+				 * \param filename: name of the output file
+				 * \param index: index of the segment starting from 1 for the most recent one
+				 * \param compressed: segment is compressed
+				 *
+				 * \return the name of the segment
+				 *
+				 * This function returns the name of a rotated segment of the output file provided as argument
+				 */
+				static QString getSegmentName(const std::string & filename, const int & index, const bool & compressed);
+
+				/**
+				 * @brief Function: static bool compress(QFile & source, const QString & destination)
+				 *
+				 * \param source: opened file to compress
+				 * \param destination: name of the gzip file to write
+				 *
+				 * \return true if the file was successfully compressed, false otherwise
+				 *
+				 * This function compresses the file provided as argument to a gzip file. The source file is closed but not removed
+				 */
+				static bool compress(QFile & source, const QString & destination);
+
+				/**
+				 * @brief Function: static void terminate()
+				 *
+				 * This function stops the writer thread when the program exits
+				 */
+				static void terminate();
+
+				/**
+				 * @brief queue of records waiting to be written
+				 *
+				 */
+				app::logger::RingBuffer<app::logger::record_s> queue;
+
+				/**
+				 * @brief thread writing records to the output files
+				 *
+				 */
+				std::thread writer;
+
+				/**
+				 * @brief flag stating whether the writer thread is running
+				 *
+				 */
+				std::atomic<bool> running;
+
+				/**
+				 * @brief flag stating whether the writer thread is waiting for records
+				 * Producers notify the writer thread only if this flag is set to true
+				 *
+				 */
+				std::atomic<bool> idle;
+
+				/**
+				 * @brief policy when the queue is full
+				 *
+				 */
+				std::atomic<app::logger::queue_policy_e> policy;
+
+				/**
+				 * @brief maximum interval in milliseconds between two flushes
+				 *
+				 */
+				std::atomic<int> flushInterval;
+
+				/**
+				 * @brief number of records dropped because the queue was full or their file could not be opened
+				 *
+				 */
+				std::atomic<std::uint64_t> droppedRecords;
+
+				/**
+				 * @brief number of dropped records already reported in the log
+				 *
+				 */
+				std::uint64_t reportedDroppedRecords;
+
+				/**
+				 * @brief mutex the writer thread waits on when the queue is empty
+				 *
+				 */
+				std::mutex wakeUpMutex;
+
+				/**
+				 * @brief condition variable to wake up the writer thread
+				 *
+				 */
+				std::condition_variable wakeUp;
+
+				/**
+				 * @brief mutex to handle concurrent access to the output files
+				 *
+				 */
+				mutable std::mutex streamMutex;
+
+				/**
+				 * @brief opened output files
+				 *
+				 */
+				std::map<std::string, app::logger::Backend::output_file_s> streams;
+
+				/**
+				 * @brief rotation of the output files
+				 * It is protected by the stream mutex
+				 *
+				 */
+				app::logger::rotation_s rotation;
+
+				/**
+				 * @brief line being written
+				 * It is reused across records in order to avoid an allocation for every record
+				 *
+				 */
+				std::string line;
+
+				/**
+				 * @brief thread compressing rotated segments and removing those that do not fit the disk budget
+				 *
+				 */
+				std::thread segmentWorker;
+
+				/**
+				 * @brief mutex protecting rotated segments
+				 * Segments are renamed and removed only while owning this mutex. They are compressed without owning it in order not to delay rotations
+				 *
+				 */
+				std::mutex segmentMutex;
+
+				/**
+				 * @brief condition variable to wake up the segment thread
+				 *
+				 */
+				std::condition_variable segmentWakeUp;
+
+				/**
+				 * @brief condition variable notified when the segment thread has processed all rotated files
+				 *
+				 */
+				std::condition_variable segmentsProcessed;
+
+				/**
+				 * @brief output files rotated since the segment thread last processed their segments
+				 *
+				 */
+				std::set<std::string> rotatedFiles;
+
+				/**
+				 * @brief number of times every output file has been rotated
+				 * It tells the segment thread how many positions a segment was shifted by while it was compressed
+				 *
+				 */
+				std::map<std::string, std::uint64_t> rotationCounts;
+
+				/**
+				 * @brief flag stating whether the segment thread is processing the segments of a file
+				 *
+				 */
+				bool processingSegments;
+
+				/**
+				 * @brief flag stating whether the segment thread must keep running
+				 *
+				 */
+				bool segmentWorkerRunning;
+
+				/**
+				 * @brief rotation used by the segment thread
+				 * It is protected by the segment mutex
+				 *
+				 */
+				app::logger::rotation_s segmentRotation;
+
+				/**
+				 * @brief flag stating whether data has been written since the last flush
+				 *
+				 */
+				bool dirty;
+
+				/**
+				 * @brief second of the last timestamp formatted
+				 *
+				 */
+				std::int64_t cachedDateSecond;
+
+				/**
+				 * @brief last date formatted
+				 * The date changes at most once per second therefore it is formatted only when the second changes
+				 *
+				 */
+				std::string cachedDate;
+
+				/**
+				 * @brief Function: void run()
+				 *
+				 * This function is the body of the writer thread
+				 */
+				void run();
+
+				/**
+				 * @brief Function: bool drain()
+				 *
+				 * \return true if a record requires the output files to be flushed
+				 *
+				 * This function writes records in the queue to the output files
+				 */
+				bool drain();
+
+				/**
+				 * @brief Function: void write(const app::logger::record_s & record)
+				 *
+				 * \param record: record to write
+				 *
+				 * This function formats the record and writes it to its output file
+				 * The caller must own the stream mutex
+				 */
+				void write(const app::logger::record_s & record);
+
+				/**
+				 * @brief Function: void writeLine(const std::string & filename, const std::int64_t & timestamp)
+				 *
+				 * \param filename: name of the output file
+				 * \param timestamp: nanoseconds elapsed since epoch when the line was logged
+				 *
+				 * This function writes the line being built to the output file and rotates the file beforehand if needed
+				 * The caller must own the stream mutex
+				 */
+				void writeLine(const std::string & filename, const std::int64_t & timestamp);
+
+				/**
+				 * @brief Function: void writeTrace(const app::logger::record_s & record)
+				 *
+				 * \param record: record of a binary trace
+				 *
+				 * This function writes the record to the trace file preceded by the header of the trace and the descriptor of the record if the file does not contain them yet
+				 * The caller must own the stream mutex
+				 */
+				void writeTrace(const app::logger::record_s & record);
+
+				/**
+				 * @brief Function: void rotateIfNeeded(const std::string & filename, app::logger::Backend::output_file_s & file, const std::uint64_t & size, const std::int64_t & timestamp)
+				 *
+				 * \param filename: name of the output file
+				 * \param file: output file
+				 * \param size: number of bytes about to be written
+				 * \param timestamp: time in nanoseconds of the data about to be written
+				 *
+				 * This function rotates the file if writing the data would exceed the maximum size or if the file is too old
+				 * The caller must own the stream mutex
+				 */
+				void rotateIfNeeded(const std::string & filename, app::logger::Backend::output_file_s & file, const std::uint64_t & size, const std::int64_t & timestamp);
+
+				/**
+				 * @brief Function: app::logger::Backend::output_file_s & getFile(const std::string & filename, const std::int64_t & timestamp)
+				 *
+				 * \param filename: name of the output file
+				 * \param timestamp: nanoseconds elapsed since epoch used as creation time if the file has to be opened
+				 *
+				 * \return the output file
+				 *
+				 * This function returns the output file provided as argument and opens it if needed
+				 * The caller must own the stream mutex
+				 */
+				app::logger::Backend::output_file_s & getFile(const std::string & filename, const std::int64_t & timestamp);
+
+				/**
+				 * @brief Function: void reportFailure(const std::string & filename, app::logger::Backend::output_file_s & file, const std::string & reason)
+				 *
+				 * \param filename: name of the output file
+				 * \param file: output file
+				 * \param reason: reason of the failure
+				 *
+				 * This function marks the file as failed and reports the failure to the standard error the first time it happens
+				 * The writer thread must never throw as it would terminate the program, therefore records written to a failed file are dropped
+				 * The caller must own the stream mutex
+				 */
+				void reportFailure(const std::string & filename, app::logger::Backend::output_file_s & file, const std::string & reason);
+
+				/**
+				 * @brief Function: void dropRecord()
+				 *
+				 * This function counts a record that could not be written to a failed file among the dropped records
+				 * The record is not reported in the log again as the failure has already been reported to the standard error
+				 * The caller must own the stream mutex
+				 */
+				void dropRecord();
+
+				/**
+				 * @brief Function: static std::uint64_t getMaxFileSize(const app::logger::rotation_s & settings)
+				 *
+				 * \param settings: rotation of the output files
+				 *
+				 * \return the size in bytes a file is rotated at or 0 if files are not rotated by size
+				 *
+				 * This function returns the size a file is rotated at taking into account the disk budget
+				 */
+				static std::uint64_t getMaxFileSize(const app::logger::rotation_s & settings);
+
+				/**
+				 * @brief Function: void rotate(const std::string & filename, app::logger::Backend::output_file_s & file, const std::int64_t & timestamp)
+				 *
+				 * \param filename: name of the output file
+				 * \param file: output file
+				 * \param timestamp: nanoseconds elapsed since epoch when the file is rotated
+				 *
+				 * This function shifts the segments of the file, renames the file to its most recent segment and opens a new file
+				 * The caller must own the stream mutex
+				 */
+				void rotate(const std::string & filename, app::logger::Backend::output_file_s & file, const std::int64_t & timestamp);
+
+				/**
+				 * @brief Function: void runSegmentWorker()
+				 *
+				 * This function is the body of the segment thread
+				 */
+				void runSegmentWorker();
+
+				/**
+				 * @brief Function: void compressSegments(const std::string & filename, std::unique_lock<std::mutex> & lock)
+				 *
+				 * \param filename: name of the output file
+				 * \param lock: lock owning the segment mutex
+				 *
+				 * This function compresses the segments of the file provided as argument that are not compressed yet
+				 * The segment mutex is released while a segment is compressed and owned again when the function returns
+				 */
+				void compressSegments(const std::string & filename, std::unique_lock<std::mutex> & lock);
+
+				/**
+				 * @brief Function: void processSegments(const std::string & filename)
+				 *
+				 * \param filename: name of the output file
+				 *
+				 * This function removes the oldest segments of the file provided as argument until they fit the disk budget and the maximum number of segments
+				 * The caller must own the segment mutex
+				 */
+				void processSegments(const std::string & filename);
+
+				/**
+				 * @brief Function: void flushStreams()
+				 *
+				 * This function flushes all opened output files
+				 * The caller must own the stream mutex
+				 */
+				void flushStreams();
+
+				/**
+				 * @brief Function: void reportDroppedRecords(const std::string & filename)
+				 *
+				 * \param filename: name of the output file
+				 *
+				 * This function writes a warning to the output file if records were dropped since the last report
+				 * The caller must own the stream mutex
+				 */
+				void reportDroppedRecords(const std::string & filename);
+
+				/**
+				 * @brief Function: const std::string & formatDate(const std::int64_t & timestamp)
+				 *
+				 * \param timestamp: nanoseconds elapsed since epoch
+				 *
+				 * \return the formatted date
+				 *
+				 * This function formats the timestamp provided as argument
+				 */
+				const std::string & formatDate(const std::int64_t & timestamp);
+
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class Backend
+				 *
+				 */
+				DISABLE_COPY_MOVE(Backend)
+
+		};
+
+	}
+
+}
+/** @} */ // End of LoggerGroup group
+
+#endif // LOGGER_BACKEND_H
@@ -12,6 +12,7 @@
 #include <memory>
 
 #include "app/utility/logger/enums.h"
+#include "app/utility/logger/types.h"
 #include "app/utility/cpp/singleton.h"
 
 /** @defgroup LoggerGroup Logger Doxygen Group
@@ -53,6 +54,42 @@ namespace app {
 				 */
 				const std::string & getDefaultContextName() const;
 
+				/**
+				 * @brief Function: const std::size_t & getQueueCapacity() const
+				 *
+				 * \return the number of records the log queue can hold
+				 *
+				 * This function returns the number of records the log queue can hold
+				 */
+				const std::size_t & getQueueCapacity() const;
+
+				/**
+				 * @brief Function: const app::logger::queue_policy_e & getDefaultQueuePolicy() const
+				 *
+				 * \return the default policy when the log queue is full
+				 *
+				 * This function returns the default policy applied when the log queue is full
+				 */
+				const app::logger::queue_policy_e & getDefaultQueuePolicy() const;
+
+				/**
+				 * @brief Function: const int & getDefaultFlushInterval() const
+				 *
+				 * \return the default interval in milliseconds between two flushes of the log files
+				 *
+				 * This function returns the default interval in milliseconds between two flushes of the log files
+				 */
+				const int & getDefaultFlushInterval() const;
+
+				/**
+				 * @brief Function: const app::logger::rotation_s & getDefaultRotation() const
+				 *
+				 * \return the default rotation of the log files
+				 *
+				 * This function returns the default rotation of the log files
+				 */
+				const app::logger::rotation_s & getDefaultRotation() const;
+
 				/**
 				 * @brief Function: explicit Config()
 				 *
@@ -89,6 +126,30 @@ namespace app {
 				 */
 				std::string defaultContextName;
 
+				/**
+				 * @brief number of records the log queue can hold
+				 *
+				 */
+				std::size_t queueCapacity;
+
+				/**
+				 * @brief default policy when the log queue is full
+				 *
+				 */
+				app::logger::queue_policy_e defaultQueuePolicy;
+
+				/**
+				 * @brief default interval in milliseconds between two flushes
+				 *
+				 */
+				int defaultFlushInterval;
+
+				/**
+				 * @brief default rotation of the log files
+				 *
+				 */
+				app::logger::rotation_s defaultRotation;
+
 		};
 
 	}
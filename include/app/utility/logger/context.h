@@ -8,7 +8,9 @@
  * @brief Logger context header file
 */
 
+#include <atomic>
 #include <string>
+#include <cstdint>
 
 #include <QtCore/QLoggingCategory>
 
@@ -26,6 +28,12 @@ namespace app {
 		class Context {
 
 			public:
+				/**
+				 * @brief Function returning a context declared with LOGGING_CONTEXT
+				 *
+				 */
+				typedef const app::logger::Context & (*context_getter_t)();
+
 				/**
 				 * @brief Function: static app::logger::Context getDefaultContext(const std::string contextName, const std::string contextFile, const int contextLine, const std::string contextFunction, const app::logger::msg_type_e contextType, const app::logger::info_level_e contextInfoVerbosity)
 				 *
@@ -134,6 +142,37 @@ namespace app {
 				 */
 				const app::logger::info_level_e & getInfoVerbosity() const;
 
+				/**
+				 * @brief Function: void setThreshold(const std::uint32_t & value) const
+				 *
+				 * \param value: runtime thresholds packed in a single word
+				 *
+				 * This function sets the runtime thresholds of the context
+				 * Contexts are declared as constant objects therefore the runtime thresholds are the only data that can change after construction
+				 */
+				void setThreshold(const std::uint32_t & value) const;
+
+				/**
+				 * @brief Function: const std::atomic<std::uint32_t> & getThreshold() const
+				 *
+				 * \return the runtime thresholds of the context packed in a single word
+				 *
+				 * This function returns the runtime thresholds of the context
+				 */
+				const std::atomic<std::uint32_t> & getThreshold() const;
+
+				/**
+				 * @brief Function: bool isEnabled(const app::logger::msg_type_e & msgType, const app::logger::info_level_e & verbosity) const
+				 *
+				 * \param msgType: type of the message
+				 * \param verbosity: verbosity of the message
+				 *
+				 * \return true if the message passes the runtime thresholds of the context
+				 *
+				 * This function checks whether a message passes the runtime thresholds of the context
+				 */
+				bool isEnabled(const app::logger::msg_type_e & msgType, const app::logger::info_level_e & verbosity) const;
+
 				/**
 				 * @brief Function: explicit Context(const std::string contextName, const app::logger::msg_type_e contextType, const app::logger::info_level_e contextInfoVerbosity, const std::string ologfilename)
 				 *
@@ -239,6 +278,13 @@ namespace app {
 				 */
 				app::logger::info_level_e infoVerbosity;
 
+				/**
+				 * @brief runtime thresholds
+				 * They are initialized with the minimum message type and the verbosity of the context restricted by the global runtime thresholds and they are overridden by the logging rules of the registry
+				 *
+				 */
+				mutable std::atomic<std::uint32_t> threshold;
+
 		};
 
 	}
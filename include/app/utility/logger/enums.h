@@ -74,6 +74,21 @@ namespace app {
 		 */
 		OVERLOAD_OPERATORS_CUSTOM_TYPE_FUNCTION_PROTOTYPE(state_list, app::logger::state_e)
 
+		/**
+		 * @brief Policy applied when the log queue is full
+		 *
+		 */
+		typedef enum class queue_policy_list {
+			BLOCK, /**< wait until the writer thread frees a slot */
+			DROP   /**< drop the message and count it */
+		} queue_policy_e;
+
+		/**
+		 * @brief Overload operators to ease print of the queue policy
+		 *
+		 */
+		OVERLOAD_OPERATORS_CUSTOM_TYPE_FUNCTION_PROTOTYPE(queue_policy_list, app::logger::queue_policy_e)
+
 	}
 
 }
@@ -0,0 +1,322 @@
+#ifndef LOGGER_FILTER_H
+#define LOGGER_FILTER_H
+/**
+ * @copyright
+ * @file filter.h
+ * @author Andrea Gianarda
+ * @date 10th June 2020
+ * @brief Logger filter header file
+*/
+
+#include <atomic>
+#include <cstdint>
+
+#include "app/utility/logger/enums.h"
+#include "app/utility/logger/context.h"
+
+/** @defgroup LoggerGroup Logger Doxygen Group
+ *  Logger functions and classes
+ *  @{
+ */
+
+/**
+ * @brief Maximum info verbosity level compiled in
+ *
+ */
+#if !defined(INFO_VERBOSITY)
+	#define INFO_VERBOSITY HIGH
+#endif // INFO_VERBOSITY
+
+/**
+ * @brief Minimum message type level compiled in
+ *
+ */
+#if !defined(TYPE_LEVEL)
+	#define TYPE_LEVEL DEBUG
+#endif // TYPE_LEVEL
+
+/**
+ * @brief Default info verbosity level of logging contexts at startup
+ *
+ */
+#if !defined(DEFAULT_INFO_VERBOSITY)
+	#define DEFAULT_INFO_VERBOSITY MEDIUM
+#endif // DEFAULT_INFO_VERBOSITY
+
+/**
+ * @brief Default message type level of logging contexts at startup
+ *
+ */
+#if !defined(DEFAULT_TYPE_LEVEL)
+	#define DEFAULT_TYPE_LEVEL INFO
+#endif // DEFAULT_TYPE_LEVEL
+
+namespace app {
+
+	namespace logger {
+
+		/**
+		 * @brief Filter class
+		 * Messages are filtered in two steps before a logger is constructed:
+		 * - at compile time against the message type and info verbosity the program is built with (TYPE_LEVEL and INFO_VERBOSITY). By default all messages are compiled in
+		 * - at runtime against a threshold that can only further restrict the compile time one. It is read with a single relaxed atomic load
+		 * Messages removed at compile time cannot be enabled at runtime, therefore the program must be rebuilt with a higher INFO_VERBOSITY or a lower TYPE_LEVEL to print them
+		 * Every context has its own runtime threshold that merges the global one with the logging rules of the registry, therefore a call site logging to a context only reads the threshold of the context
+		 * Contexts start from the thresholds they are declared with (DEFAULT_TYPE_LEVEL and DEFAULT_INFO_VERBOSITY unless stated otherwise) and rules can raise or lower them up to the compile time ones
+		 *
+		 */
+		class Filter {
+
+			public:
+				/**
+				 * @brief Function: static constexpr bool isAllowed(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity, const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity)
+				 *
+				 * \param type: type of the message
+				 * \param verbosity: verbosity of the message. It is only relevant to information messages
+				 * \param minimumType: minimum type of messages to print
+				 * \param maximumVerbosity: maximum verbosity of information messages to print
+				 *
+				 * \return true if the message has to be printed
+				 *
+				 * This function checks whether a message has to be printed based on the thresholds provided as argument
+				 */
+				static constexpr bool isAllowed(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity, const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity);
+
+				/**
+				 * @brief Function: static constexpr bool isCompiledIn(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity)
+				 *
+				 * \param type: type of the message
+				 * \param verbosity: verbosity of the message
+				 *
+				 * \return true if the message passes the compile time thresholds
+				 *
+				 * This function checks whether a message passes the compile time thresholds
+				 */
+				static constexpr bool isCompiledIn(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity);
+
+				/**
+				 * @brief Function: static constexpr app::logger::msg_type_e getCompiledMinimumType()
+				 *
+				 * \return the minimum type of messages compiled in the program
+				 *
+				 * This function returns the message type the program is built with (TYPE_LEVEL)
+				 */
+				static constexpr app::logger::msg_type_e getCompiledMinimumType();
+
+				/**
+				 * @brief Function: static constexpr app::logger::info_level_e getCompiledMaximumVerbosity()
+				 *
+				 * \return the maximum verbosity of information messages compiled in the program
+				 *
+				 * This function returns the info verbosity the program is built with (INFO_VERBOSITY)
+				 */
+				static constexpr app::logger::info_level_e getCompiledMaximumVerbosity();
+
+				/**
+				 * @brief Function: static bool isEnabled(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity)
+				 *
+				 * \param type: type of the message
+				 * \param verbosity: verbosity of the message
+				 *
+				 * \return true if the message passes the runtime thresholds
+				 *
+				 * This function checks whether a message passes the runtime thresholds
+				 */
+				static bool isEnabled(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity);
+
+				/**
+				 * @brief Function: static bool isEnabled(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity, const std::atomic<std::uint32_t> & packedThreshold)
+				 *
+				 * \param type: type of the message
+				 * \param verbosity: verbosity of the message
+				 * \param packedThreshold: runtime thresholds packed in a single word
+				 *
+				 * \return true if the message passes the runtime thresholds
+				 *
+				 * This function checks whether a message passes the runtime thresholds provided as argument
+				 */
+				static bool isEnabled(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity, const std::atomic<std::uint32_t> & packedThreshold);
+
+				/**
+				 * @brief Function: static const std::atomic<std::uint32_t> & getThreshold()
+				 *
+				 * \return the global runtime thresholds
+				 *
+				 * This function returns the runtime thresholds of messages logged without a context
+				 */
+				static const std::atomic<std::uint32_t> & getThreshold();
+
+				/**
+				 * @brief Function: static const std::atomic<std::uint32_t> & getThreshold(app::logger::Context::context_getter_t getter)
+				 *
+				 * \param getter: function returning the context
+				 *
+				 * \return the runtime thresholds of the context
+				 *
+				 * This function returns the runtime thresholds of the context returned by the function provided as argument
+				 */
+				static const std::atomic<std::uint32_t> & getThreshold(app::logger::Context::context_getter_t getter);
+
+				/**
+				 * @brief Function: static constexpr std::uint32_t pack(const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity)
+				 *
+				 * \param minimumType: minimum type of messages to print
+				 * \param maximumVerbosity: maximum verbosity of information messages to print
+				 *
+				 * \return the thresholds packed in a single word
+				 *
+				 * This function packs both thresholds in a single word so that they can be read with one atomic load
+				 */
+				static constexpr std::uint32_t pack(const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity);
+
+				/**
+				 * @brief Function: static constexpr app::logger::msg_type_e unpackType(const std::uint32_t & packedThreshold)
+				 *
+				 * \param packedThreshold: thresholds packed in a single word
+				 *
+				 * \return the minimum type of messages to print
+				 *
+				 * This function extracts the minimum type of messages to print from the packed thresholds
+				 */
+				static constexpr app::logger::msg_type_e unpackType(const std::uint32_t & packedThreshold);
+
+				/**
+				 * @brief Function: static constexpr app::logger::info_level_e unpackVerbosity(const std::uint32_t & packedThreshold)
+				 *
+				 * \param packedThreshold: thresholds packed in a single word
+				 *
+				 * \return the maximum verbosity of information messages to print
+				 *
+				 * This function extracts the maximum verbosity of information messages to print from the packed thresholds
+				 */
+				static constexpr app::logger::info_level_e unpackVerbosity(const std::uint32_t & packedThreshold);
+
+				/**
+				 * @brief Function: static constexpr std::uint32_t merge(const std::uint32_t & packedThreshold, const std::uint32_t & otherPackedThreshold)
+				 *
+				 * \param packedThreshold: thresholds packed in a single word
+				 * \param otherPackedThreshold: thresholds packed in a single word
+				 *
+				 * \return the packed thresholds that only allow messages allowed by both thresholds provided as argument
+				 *
+				 * This function merges two thresholds
+				 */
+				static constexpr std::uint32_t merge(const std::uint32_t & packedThreshold, const std::uint32_t & otherPackedThreshold);
+
+				/**
+				 * @brief Function: static void setThreshold(const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity)
+				 *
+				 * \param minimumType: minimum type of messages to print
+				 * \param maximumVerbosity: maximum verbosity of information messages to print
+				 *
+				 * This function sets the runtime thresholds and updates the thresholds of the registered contexts
+				 * Messages removed at compile time are not printed regardless of the runtime thresholds
+				 */
+				static void setThreshold(const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity);
+
+				/**
+				 * @brief Function: static app::logger::msg_type_e getMinimumType()
+				 *
+				 * \return the runtime minimum type of messages to print
+				 *
+				 * This function returns the runtime minimum type of messages to print
+				 */
+				static app::logger::msg_type_e getMinimumType();
+
+				/**
+				 * @brief Function: static app::logger::info_level_e getMaximumVerbosity()
+				 *
+				 * \return the runtime maximum verbosity of information messages to print
+				 *
+				 * This function returns the runtime maximum verbosity of information messages to print
+				 */
+				static app::logger::info_level_e getMaximumVerbosity();
+
+			protected:
+
+			private:
+				/**
+				 * @brief minimum type of messages compiled in the program
+				 *
+				 */
+				static constexpr app::logger::msg_type_e compiledMinimumType = app::logger::msg_type_e::TYPE_LEVEL;
+
+				/**
+				 * @brief maximum verbosity of information messages compiled in the program
+				 *
+				 */
+				static constexpr app::logger::info_level_e compiledMaximumVerbosity = app::logger::info_level_e::INFO_VERBOSITY;
+
+				/**
+				 * @brief runtime thresholds
+				 * Bits 7 to 0 store the maximum verbosity and bits 15 to 8 the minimum message type
+				 *
+				 */
+				static std::atomic<std::uint32_t> threshold;
+
+		};
+
+	}
+
+}
+/** @} */ // End of LoggerGroup group
+
+constexpr bool app::logger::Filter::isAllowed(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity, const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity) {
+	bool allowed = (type >= minimumType);
+	// For info messages, verbosity also must be checked
+	if (type == app::logger::msg_type_e::INFO) {
+		allowed &= (verbosity <= maximumVerbosity);
+	}
+	return allowed;
+}
+
+constexpr bool app::logger::Filter::isCompiledIn(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity) {
+	return app::logger::Filter::isAllowed(type, verbosity, app::logger::Filter::compiledMinimumType, app::logger::Filter::compiledMaximumVerbosity);
+}
+
+constexpr app::logger::msg_type_e app::logger::Filter::getCompiledMinimumType() {
+	return app::logger::Filter::compiledMinimumType;
+}
+
+constexpr app::logger::info_level_e app::logger::Filter::getCompiledMaximumVerbosity() {
+	return app::logger::Filter::compiledMaximumVerbosity;
+}
+
+constexpr std::uint32_t app::logger::Filter::pack(const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity) {
+	return ((static_cast<std::uint32_t>(minimumType) << 8) | static_cast<std::uint32_t>(maximumVerbosity));
+}
+
+constexpr app::logger::msg_type_e app::logger::Filter::unpackType(const std::uint32_t & packedThreshold) {
+	return static_cast<app::logger::msg_type_e>((packedThreshold >> 8) & 0xFF);
+}
+
+constexpr app::logger::info_level_e app::logger::Filter::unpackVerbosity(const std::uint32_t & packedThreshold) {
+	return static_cast<app::logger::info_level_e>(packedThreshold & 0xFF);
+}
+
+constexpr std::uint32_t app::logger::Filter::merge(const std::uint32_t & packedThreshold, const std::uint32_t & otherPackedThreshold) {
+	const app::logger::msg_type_e type = app::logger::Filter::unpackType(packedThreshold);
+	const app::logger::msg_type_e otherType = app::logger::Filter::unpackType(otherPackedThreshold);
+	const app::logger::info_level_e verbosity = app::logger::Filter::unpackVerbosity(packedThreshold);
+	const app::logger::info_level_e otherVerbosity = app::logger::Filter::unpackVerbosity(otherPackedThreshold);
+	return app::logger::Filter::pack(((type > otherType) ? type : otherType), ((verbosity < otherVerbosity) ? verbosity : otherVerbosity));
+}
+
+inline bool app::logger::Filter::isEnabled(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity, const std::atomic<std::uint32_t> & packedThreshold) {
+	const std::uint32_t currentThreshold = packedThreshold.load(std::memory_order_relaxed);
+	return app::logger::Filter::isAllowed(type, verbosity, app::logger::Filter::unpackType(currentThreshold), app::logger::Filter::unpackVerbosity(currentThreshold));
+}
+
+inline bool app::logger::Filter::isEnabled(const app::logger::msg_type_e & type, const app::logger::info_level_e & verbosity) {
+	return app::logger::Filter::isEnabled(type, verbosity, app::logger::Filter::threshold);
+}
+
+inline const std::atomic<std::uint32_t> & app::logger::Filter::getThreshold() {
+	return app::logger::Filter::threshold;
+}
+
+inline const std::atomic<std::uint32_t> & app::logger::Filter::getThreshold(app::logger::Context::context_getter_t getter) {
+	return getter().getThreshold();
+}
+
+#endif // LOGGER_FILTER_H
@@ -9,12 +9,13 @@
 */
 
 #include <string>
-#include <mutex>
-#include <fstream>
+#include <cstdint>
+#include <sstream>
 #include <iostream>
 
 #include "app/utility/log/logging.h"
 #include "app/utility/logger/enums.h"
+#include "app/utility/logger/types.h"
 #include "app/utility/logger/context.h"
 
 /** @defgroup LoggerGroup Logger Doxygen Group
@@ -43,6 +44,27 @@ namespace app {
 				 */
 				typedef std::function<const app::logger::Context &(void)> context_function_t;
 
+				/**
+				 * @brief Function: explicit Logger(const app::logger::metadata_s & loggerMetadata, const app::logger::info_level_e loggerInfoVerbosity, const std::string ologfilename = std::string())
+				 *
+				 * \param loggerMetadata: metadata of the call site. It must outlive the logger as only its address is stored
+				 * \param loggerInfoVerbosity: verbosity level of information messages
+				 * \param ologfilename: filename of the file where messages will be printed
+				 *
+				 * Logger constructor with call site metadata
+				 */
+				explicit Logger(const app::logger::metadata_s & loggerMetadata, const app::logger::info_level_e loggerInfoVerbosity, const std::string ologfilename = std::string());
+
+				/**
+				 * @brief Function: explicit Logger(const app::logger::metadata_s & loggerMetadata, const std::string ologfilename = std::string())
+				 *
+				 * \param loggerMetadata: metadata of the call site. It must outlive the logger as only its address is stored
+				 * \param ologfilename: filename of the file where messages will be printed
+				 *
+				 * Logger constructor with call site metadata
+				 */
+				explicit Logger(const app::logger::metadata_s & loggerMetadata, const std::string ologfilename = std::string());
+
 				/**
 				 * @brief Function: explicit Logger(const app::logger::msg_type_e loggerType, const std::string contextFile, const int line, const std::string function, const app::logger::Context & loggerContext, const app::logger::info_level_e loggerInfoVerbosity, const std::string ologfilename = std::string())
 				 *
@@ -197,6 +219,13 @@ namespace app {
 				template <typename lastType>
 				void append(lastType arg);
 
+				/**
+				 * @brief Function: void writeToStream(const textType & arg)
+				 *
+				 * \param arg: argument to append to the message
+				 *
+				 * This function appends the argument to the message that is handed over to the backend when logging ends
+				 */
 				template <typename textType>
 				void writeToStream(const textType & arg);
 
@@ -226,8 +255,6 @@ namespace app {
 
 			private:
 
-				constexpr static std::ios_base::openmode openMode = (std::ios::ate | std::ios::app | std::ios::out);
-
 				/**
 				 * @brief logger context
 				 *
@@ -235,28 +262,35 @@ namespace app {
 				app::logger::Context context;
 
 				/**
-				 * @brief Output stream ofile
+				 * @brief metadata of the call site
+				 * If it is null, the header is formatted by the logger itself
 				 *
 				 */
-				std::ofstream ofile;
+				const app::logger::metadata_s * metadata;
 
 				/**
-				 * @brief verbosity of info messages
+				 * @brief time the message was logged at in nanoseconds since epoch
 				 *
 				 */
-				app::logger::info_level_e infoVerbosity;
+				std::int64_t timestamp;
 
 				/**
-				 * @brief type of messages
+				 * @brief message being logged
 				 *
 				 */
-				app::logger::msg_type_e type;
+				std::ostringstream message;
+
+				/**
+				 * @brief verbosity of info messages
+				 *
+				 */
+				app::logger::info_level_e infoVerbosity;
 
 				/**
-				 * @brief mutex to handle concurrent access to logfile
+				 * @brief type of messages
 				 *
 				 */
-				std::mutex logMutex;
+				app::logger::msg_type_e type;
 
 				/**
 				 * @brief logger state
@@ -305,23 +339,9 @@ namespace app {
 				/**
 				 * @brief Function: void endLogging()
 				 *
-				 * This function ends logging
+				 * This function ends logging and hands over the message to the backend
 				 */
 				void endLogging();
-
-				/**
-				 * @brief Function: void openOFile()
-				 *
-				 * This function opens the output file
-				 */
-				void openOFile();
-
-				/**
-				 * @brief Function: void closeOFile()
-				 *
-				 * This function closes the output file
-				 */
-				void closeOFile();
 		};
 
 	}
@@ -330,10 +350,7 @@ namespace app {
 		template <typename type>
 		app::logger::Logger & operator<< (app::logger::Logger & log, const type & arg) {
 			if (log.isLogAllowed() == true) {
-				log.logMutex.lock();
-				log.openOFile();
 				log.writeToStream(arg);
-				log.logMutex.unlock();
 			}
 			return log;
 		}
@@ -376,11 +393,7 @@ void app::logger::Logger::append(firstType headArg, otherTypes ... otherArgs) {
 
 template <typename textType>
 void app::logger::Logger::writeToStream(const textType & arg) {
-	if (this->getLogFilename().compare(app::logger::stdoutStr) == 0) {
-		std::cout << arg;
-	} else {
-		this->ofile << arg;
-	}
+	this->message << arg;
 }
 
 /** @} */ // End of LoggerGroup group
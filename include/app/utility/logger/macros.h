@@ -9,29 +9,16 @@
 */
 
 #include "app/shared/utility_macros.h"
+#include "app/utility/logger/filter.h"
 #include "app/utility/logger/logger.h"
+#include "app/utility/logger/registry.h"
+#include "app/utility/logger/trace.h"
 
 /** @defgroup Logger Logging Macros Doxygen Group
  *  Logger Macros
  *  @{
  */
 
-/**
- * @brief Default info verbosity level
- *
- */
-#if !defined(INFO_VERBOSITY)
-	#define INFO_VERBOSITY MEDIUM
-#endif // INFO_VERBOSITY
-
-/**
- * @brief Default message type level
- *
- */
-#if !defined(TYPE_LEVEL)
-	#define TYPE_LEVEL INFO
-#endif // TYPE_LEVEL
-
 /**
  * @brief EXPORT_CONTEXT(CONTEXT)
  *
@@ -50,12 +37,40 @@
  * \param MINIMUM_TYPE : minimum type printed by the context
  * \param MINIMUM_INFO : minimum verbosity for info messages
  *
- * Declare context
+ * Declare context and register it by its name when the program is loaded so that its thresholds can be changed by the logging rules
+ * Messages whose type or verbosity do not pass the compile time thresholds are removed from the program regardless of the context they are logged to
  */
 #define LOGGING_CONTEXT(CONTEXT, NAME, MINIMUM_TYPE, MINIMUM_INFO) \
 	const app::logger::Context & CONTEXT() { \
-		static const app::logger::Context context(STRINGIFY(NAME), app::logger::msg_type_e::MINIMUM_TYPE, app::logger::info_level_e::INFO_VERBOSITY); \
+		static const app::logger::Context context(STRINGIFY(NAME), app::logger::msg_type_e::MINIMUM_TYPE, app::logger::info_level_e::MINIMUM_INFO); \
 		return context; \
+	} \
+	static const bool CONTEXT##Registered = app::logger::Registry::getInstance()->add(STRINGIFY(NAME), &CONTEXT);
+
+/**
+ * @brief LOG_STATEMENT(TYPE, VERBOSITY, CONTEXT, FILENAME, ...)
+ *
+ * \param TYPE      : message type
+ * \param VERBOSITY : verbosity level
+ * \param CONTEXT   : context of the print
+ * \param FILENAME  : file to print logs. If empty, the file of the context is used
+ * \param ...       : variable number of arguments to stream into the logger
+ *
+ * Log a message if it passes the compile time and runtime thresholds
+ * The logger is constructed and the arguments are evaluated only if the message passes both thresholds
+ * The runtime thresholds of the context are looked up once per call site, afterwards the check is a single atomic load
+ */
+#define LOG_STATEMENT(TYPE, VERBOSITY, CONTEXT, FILENAME, ...)\
+	{ \
+		if constexpr (app::logger::Filter::isCompiledIn(app::logger::msg_type_e::TYPE, VERBOSITY) == true) { \
+			static const std::atomic<std::uint32_t> & statementThreshold = app::logger::Filter::getThreshold(CONTEXT); \
+			if (app::logger::Filter::isEnabled(app::logger::msg_type_e::TYPE, VERBOSITY, statementThreshold) == true) { \
+				static const app::logger::metadata_s statementMetadata = { __FILE__, __LINE__, __func__, app::logger::msg_type_e::TYPE }; \
+				app::logger::Logger statementLogger(statementMetadata, VERBOSITY, FILENAME); \
+				statementLogger.initializeLogging(CONTEXT); \
+				statementLogger << __VA_ARGS__; \
+			} \
+		} \
 	}
 
 /**
@@ -68,11 +83,7 @@
  * Print a message to the log file if the chosen verbosity is less or equal to the default verbosity
  */
 #define LOG_INFO(VERBOSITY, CONTEXT, ...)\
-	{ \
-		app::logger::Logger infoLogger(app::logger::msg_type_e::INFO, __FILE__, __LINE__, __func__, VERBOSITY); \
-		infoLogger.initializeLogging(CONTEXT); \
-		infoLogger << __VA_ARGS__; \
-	}
+	LOG_STATEMENT(INFO, VERBOSITY, CONTEXT, std::string(), __VA_ARGS__)
 
 /**
  * @brief LOG_INFO_TO_FILE(VERBOSITY, CONTEXT, ...)
@@ -85,11 +96,7 @@
  * Print a message to the log file if the chosen verbosity is less or equal to the default verbosity
  */
 #define LOG_INFO_TO_FILE(VERBOSITY, CONTEXT, FILENAME, ...)\
-	{ \
-		app::logger::Logger infoLogger(app::logger::msg_type_e::INFO, __FILE__, __LINE__, __func__, VERBOSITY, FILENAME); \
-		infoLogger.initializeLogging(CONTEXT); \
-		infoLogger << __VA_ARGS__; \
-	}
+	LOG_STATEMENT(INFO, VERBOSITY, CONTEXT, FILENAME, __VA_ARGS__)
 
 /**
  * @brief LOG_WARNING(CONTEXT, ...)
@@ -100,11 +107,7 @@
  * Print a message to the warning file
  */
 #define LOG_WARNING(CONTEXT, ...)\
-	{ \
-		app::logger::Logger warningLogger(app::logger::msg_type_e::WARNING, __FILE__, __LINE__, __func__); \
-		warningLogger.initializeLogging(CONTEXT); \
-		warningLogger << __VA_ARGS__; \
-	}
+	LOG_STATEMENT(WARNING, app::logger::info_level_e::ZERO, CONTEXT, std::string(), __VA_ARGS__)
 
 /**
  * @brief LOG_ERROR(CONTEXT, ...)
@@ -115,11 +118,7 @@
  * Print a message to the error file
  */
 #define LOG_ERROR(CONTEXT, ...)\
-	{ \
-		app::logger::Logger errorLogger(app::logger::msg_type_e::ERROR, __FILE__, __LINE__, __func__); \
-		errorLogger.initializeLogging(CONTEXT); \
-		errorLogger << __VA_ARGS__; \
-	}
+	LOG_STATEMENT(ERROR, app::logger::info_level_e::ZERO, CONTEXT, std::string(), __VA_ARGS__)
 
 /**
  * @brief LOG_FATAL(CONTEXT, ...)
@@ -130,12 +129,65 @@
  * Print a message to the fatal file
  */
 #define LOG_FATAL(CONTEXT, ...)\
+	LOG_STATEMENT(FATAL, app::logger::info_level_e::ZERO, CONTEXT, std::string(), __VA_ARGS__)
+
+/**
+ * @brief TRACE_STATEMENT(TYPE, VERBOSITY, CONTEXT, ...)
+ *
+ * \param TYPE      : message type
+ * \param VERBOSITY : verbosity level
+ * \param CONTEXT   : name of the function declaring the context of the print
+ * \param ...       : format string followed by its arguments. Every {} in the format string is replaced by the next argument
+ *
+ * Log a message to the binary trace if it passes the compile time and runtime thresholds
+ * The call site registers its descriptor the first time it logs a message, afterwards only the arguments are recorded
+ */
+#define TRACE_STATEMENT(TYPE, VERBOSITY, CONTEXT, ...)\
 	{ \
-		app::logger::Logger fatalLogger(app::logger::msg_type_e::FATAL, __FILE__, __LINE__, __func__); \
-		fatalLogger.initializeLogging(CONTEXT); \
-		fatalLogger << __VA_ARGS__; \
+		if constexpr (app::logger::Filter::isCompiledIn(app::logger::msg_type_e::TYPE, VERBOSITY) == true) { \
+			static const std::atomic<std::uint32_t> & statementThreshold = app::logger::Filter::getThreshold(CONTEXT); \
+			if (app::logger::Filter::isEnabled(app::logger::msg_type_e::TYPE, VERBOSITY, statementThreshold) == true) { \
+				static const app::logger::metadata_s statementMetadata = { __FILE__, __LINE__, __func__, app::logger::msg_type_e::TYPE }; \
+				static std::atomic<std::uint32_t> statementTraceId(0); \
+				app::logger::Tracer::getInstance()->log(statementTraceId, statementMetadata, VERBOSITY, CONTEXT(), __VA_ARGS__); \
+			} \
+		} \
 	}
 
+/**
+ * @brief LOG_TRACE_INFO(VERBOSITY, CONTEXT, ...)
+ *
+ * \param VERBOSITY : verbosity level
+ * \param CONTEXT   : name of the function declaring the context of the print
+ * \param ...       : format string followed by its arguments
+ *
+ * Trace a message if the chosen verbosity is less or equal to the default verbosity
+ */
+#define LOG_TRACE_INFO(VERBOSITY, CONTEXT, ...)\
+	TRACE_STATEMENT(INFO, VERBOSITY, CONTEXT, __VA_ARGS__)
+
+/**
+ * @brief LOG_TRACE_WARNING(CONTEXT, ...)
+ *
+ * \param CONTEXT   : name of the function declaring the context of the print
+ * \param ...       : format string followed by its arguments
+ *
+ * Trace a warning
+ */
+#define LOG_TRACE_WARNING(CONTEXT, ...)\
+	TRACE_STATEMENT(WARNING, app::logger::info_level_e::ZERO, CONTEXT, __VA_ARGS__)
+
+/**
+ * @brief LOG_TRACE_ERROR(CONTEXT, ...)
+ *
+ * \param CONTEXT   : name of the function declaring the context of the print
+ * \param ...       : format string followed by its arguments
+ *
+ * Trace an error
+ */
+#define LOG_TRACE_ERROR(CONTEXT, ...)\
+	TRACE_STATEMENT(ERROR, app::logger::info_level_e::ZERO, CONTEXT, __VA_ARGS__)
+
 /** @} */ // End of LoggerMacrosGroup group
 
 #endif // LOGGER_MACROS_H
@@ -0,0 +1,191 @@
+#ifndef LOGGER_REGISTRY_H
+#define LOGGER_REGISTRY_H
+/**
+ * @copyright
+ * @file registry.h
+ * @author Andrea Gianarda
+ * @date 10th June 2020
+ * @brief Logger registry header file
+*/
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "app/shared/constructor_macros.h"
+#include "app/utility/cpp/singleton.h"
+#include "app/utility/logger/enums.h"
+#include "app/utility/logger/types.h"
+#include "app/utility/logger/context.h"
+
+/** @defgroup LoggerGroup Logger Doxygen Group
+ *  Logger functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace logger {
+
+		/**
+		 * @brief Registry class
+		 * Every context declared with LOGGING_CONTEXT is registered by its dotted name when the program is loaded
+		 * Logging rules change the thresholds of the contexts whose name matches their pattern without rebuilding the program
+		 *
+		 */
+		class Registry : public app::utility::Singleton<app::logger::Registry> {
+
+			public:
+				/**
+				 * @brief Function: explicit Registry()
+				 *
+				 * Registry constructor
+				 */
+				explicit Registry();
+
+				/**
+				 * @brief Function: virtual ~Registry()
+				 *
+				 * Registry destructor
+				 */
+				virtual ~Registry();
+
+				/**
+				 * @brief Function: static bool matches(const std::string & pattern, const std::string & name)
+				 *
+				 * \param pattern: glob pattern. * matches any sequence of characters and ? matches a single character
+				 * \param name: name to match
+				 *
+				 * \return true if the name matches the pattern
+				 *
+				 * This function checks whether the whole name matches the pattern
+				 */
+				static bool matches(const std::string & pattern, const std::string & name);
+
+				/**
+				 * @brief Function: bool add(const std::string & name, app::logger::Context::context_getter_t getter)
+				 *
+				 * \param name: dotted name of the context
+				 * \param getter: function returning the context
+				 *
+				 * \return true
+				 *
+				 * This function registers a context
+				 * The context is not constructed until the rules are applied as it may be registered while the program is loaded
+				 */
+				bool add(const std::string & name, app::logger::Context::context_getter_t getter);
+
+				/**
+				 * @brief Function: void setRules(const std::string & value)
+				 *
+				 * \param value: comma separated list of rules <pattern>=<type>[:<verbosity>]. If the verbosity is not given, all information messages compiled in are printed
+				 *
+				 * This function sets the logging rules and applies them to all registered contexts
+				 * If more than one rule matches a context, the last one is applied. Contexts not matching any rule keep the thresholds they are declared with
+				 * Rules can only select messages compiled in by TYPE_LEVEL and INFO_VERBOSITY. A rule asking for a lower message type or a higher verbosity is rejected
+				 */
+				void setRules(const std::string & value);
+
+				/**
+				 * @brief Function: const std::string & getRules() const
+				 *
+				 * \return the logging rules
+				 *
+				 * This function returns the logging rules
+				 */
+				const std::string & getRules() const;
+
+				/**
+				 * @brief Function: std::vector<std::string> getNames() const
+				 *
+				 * \return the dotted names of all registered contexts in alphabetical order
+				 *
+				 * This function returns the names of all registered contexts
+				 */
+				std::vector<std::string> getNames() const;
+
+				/**
+				 * @brief Function: const app::logger::Context & getContext(const std::string & name) const
+				 *
+				 * \param name: dotted name of the context
+				 *
+				 * \return the context
+				 *
+				 * This function returns the context whose name is provided as argument. If more contexts share the same name, the first one registered is returned
+				 */
+				const app::logger::Context & getContext(const std::string & name) const;
+
+				/**
+				 * @brief Function: void update()
+				 *
+				 * This function recomputes the runtime thresholds of all registered contexts
+				 * It must be called every time the global runtime thresholds change
+				 */
+				void update();
+
+			protected:
+
+			private:
+				/**
+				 * @brief Function: static app::logger::rule_s parseRule(const std::string & text)
+				 *
+				 * \param text: rule in the format <pattern>=<type>[:<verbosity>]
+				 *
+				 * \return the rule
+				 *
+				 * This function parses a rule
+				 * It throws an exception if the rule is malformed or if it selects messages removed at compile time
+				 */
+				static app::logger::rule_s parseRule(const std::string & text);
+
+				/**
+				 * @brief Function: std::uint32_t computeThreshold(const app::logger::Context & context) const
+				 *
+				 * \param context: context
+				 *
+				 * \return the runtime thresholds of the context packed in a single word
+				 *
+				 * This function computes the runtime thresholds of the context out of the rules and the global runtime thresholds
+				 */
+				std::uint32_t computeThreshold(const app::logger::Context & context) const;
+
+				/**
+				 * @brief mutex protecting contexts and rules
+				 *
+				 */
+				mutable std::mutex registryMutex;
+
+				/**
+				 * @brief registered contexts by dotted name
+				 *
+				 */
+				std::map<std::string, std::vector<app::logger::Context::context_getter_t>> contexts;
+
+				/**
+				 * @brief logging rules
+				 *
+				 */
+				std::vector<app::logger::rule_s> rules;
+
+				/**
+				 * @brief logging rules as provided to setRules
+				 *
+				 */
+				std::string rulesText;
+
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class Registry
+				 *
+				 */
+				DISABLE_COPY_MOVE(Registry)
+
+		};
+
+	}
+
+}
+/** @} */ // End of LoggerGroup group
+
+#endif // LOGGER_REGISTRY_H
@@ -0,0 +1,254 @@
+#ifndef LOGGER_RING_BUFFER_H
+#define LOGGER_RING_BUFFER_H
+/**
+ * @copyright
+ * @file ring_buffer.h
+ * @author Andrea Gianarda
+ * @date 10th June 2020
+ * @brief Logger ring buffer header file
+*/
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+#include "app/shared/constructor_macros.h"
+
+/** @defgroup LoggerGroup Logger Doxygen Group
+ *  Logger functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace logger {
+
+		/**
+		 * @brief Bounded lock-free queue
+		 * Multiple threads may push elements concurrently and one or more threads may pop them
+		 * Each cell carries a sequence number that tells producers and consumers whether the cell is free or holds data so that no lock is needed
+		 *
+		 */
+		template<typename type>
+		class RingBuffer {
+
+			public:
+				/**
+				 * @brief Function: explicit RingBuffer(const std::size_t bufferCapacity)
+				 *
+				 * \param bufferCapacity: minimum number of elements the buffer can hold. It is rounded up to the next power of 2
+				 *
+				 * Ring buffer constructor
+				 */
+				explicit RingBuffer(const std::size_t bufferCapacity);
+
+				/**
+				 * @brief Function: virtual ~RingBuffer()
+				 *
+				 * Ring buffer destructor
+				 */
+				virtual ~RingBuffer();
+
+				/**
+				 * @brief Function: bool push(type && element)
+				 *
+				 * \param element: element to add to the buffer
+				 *
+				 * \return true if the element has been added, false if the buffer is full
+				 *
+				 * This function adds an element to the tail of the buffer
+				 */
+				bool push(type && element);
+
+				/**
+				 * @brief Function: bool pop(type & element)
+				 *
+				 * \param element: element to move the head of the buffer into
+				 *
+				 * \return true if an element has been removed, false if the buffer is empty
+				 *
+				 * This function removes the element at the head of the buffer
+				 */
+				bool pop(type & element);
+
+				/**
+				 * @brief Function: bool empty() const
+				 *
+				 * \return true if the buffer has no element
+				 *
+				 * This function checks whether the buffer is empty
+				 * The result is only a snapshot as other threads may be pushing or popping elements at the same time
+				 */
+				bool empty() const;
+
+				/**
+				 * @brief Function: std::size_t getCapacity() const
+				 *
+				 * \return the maximum number of elements the buffer can hold
+				 *
+				 * This function returns the maximum number of elements the buffer can hold
+				 */
+				std::size_t getCapacity() const;
+
+			protected:
+
+			private:
+
+				/**
+				 * @brief size of a cache line
+				 *
+				 */
+				static constexpr std::size_t cacheLineSize = 64;
+
+				/**
+				 * @brief cell of the buffer
+				 *
+				 */
+				typedef struct cell_t {
+					std::atomic<std::size_t> sequence;   /**< sequence number of the cell */
+					type data;                           /**< data stored in the cell */
+				} cell_s;
+
+				/**
+				 * @brief Function: static std::size_t roundCapacity(const std::size_t bufferCapacity)
+				 *
+				 * \param bufferCapacity: requested capacity
+				 *
+				 * \return the smallest power of 2 greater or equal to the requested capacity
+				 *
+				 * This function rounds the capacity to a power of 2 in order to replace the modulo by a mask
+				 */
+				static std::size_t roundCapacity(const std::size_t bufferCapacity);
+
+				/**
+				 * @brief mask to convert a position into a cell index
+				 *
+				 */
+				const std::size_t mask;
+
+				/**
+				 * @brief cells of the buffer
+				 *
+				 */
+				std::unique_ptr<cell_s[]> cells;
+
+				/**
+				 * @brief position of the next element to be pushed
+				 * Aligned to a cache line to avoid false sharing between producers and consumers
+				 *
+				 */
+				alignas(cacheLineSize) std::atomic<std::size_t> enqueuePosition;
+
+				/**
+				 * @brief position of the next element to be popped
+				 *
+				 */
+				alignas(cacheLineSize) std::atomic<std::size_t> dequeuePosition;
+
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class RingBuffer
+				 *
+				 */
+				DISABLE_COPY_MOVE(RingBuffer)
+
+		};
+
+	}
+
+}
+/** @} */ // End of LoggerGroup group
+
+template<typename type>
+app::logger::RingBuffer<type>::RingBuffer(const std::size_t bufferCapacity) : mask(app::logger::RingBuffer<type>::roundCapacity(bufferCapacity) - 1), cells(new cell_s[app::logger::RingBuffer<type>::roundCapacity(bufferCapacity)]), enqueuePosition(0), dequeuePosition(0) {
+	for (std::size_t idx = 0; idx <= this->mask; idx++) {
+		this->cells[idx].sequence.store(idx, std::memory_order_relaxed);
+	}
+}
+
+template<typename type>
+app::logger::RingBuffer<type>::~RingBuffer() {
+
+}
+
+template<typename type>
+std::size_t app::logger::RingBuffer<type>::roundCapacity(const std::size_t bufferCapacity) {
+	std::size_t roundedCapacity = 2;
+	while (roundedCapacity < bufferCapacity) {
+		roundedCapacity <<= 1;
+	}
+	return roundedCapacity;
+}
+
+template<typename type>
+bool app::logger::RingBuffer<type>::push(type && element) {
+	std::size_t position = this->enqueuePosition.load(std::memory_order_relaxed);
+	cell_s * cell = nullptr;
+
+	while (true) {
+		cell = &this->cells[position & this->mask];
+		const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+		if (difference == 0) {
+			// Cell is free: try to reserve it
+			if (this->enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+				break;
+			}
+		} else if (difference < 0) {
+			// Cell still holds an element that has not been popped yet
+			return false;
+		} else {
+			// Another producer reserved the cell
+			position = this->enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	cell->data = std::move(element);
+	// Publish the element to consumers
+	cell->sequence.store(position + 1, std::memory_order_release);
+
+	return true;
+}
+
+template<typename type>
+bool app::logger::RingBuffer<type>::pop(type & element) {
+	std::size_t position = this->dequeuePosition.load(std::memory_order_relaxed);
+	cell_s * cell = nullptr;
+
+	while (true) {
+		cell = &this->cells[position & this->mask];
+		const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+		if (difference == 0) {
+			// Cell holds data: try to claim it
+			if (this->dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+				break;
+			}
+		} else if (difference < 0) {
+			// Cell has not been written yet
+			return false;
+		} else {
+			// Another consumer claimed the cell
+			position = this->dequeuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	element = std::move(cell->data);
+	// Hand the cell back to producers one lap later
+	cell->sequence.store(position + this->mask + 1, std::memory_order_release);
+
+	return true;
+}
+
+template<typename type>
+bool app::logger::RingBuffer<type>::empty() const {
+	const std::size_t position = this->dequeuePosition.load(std::memory_order_relaxed);
+	const std::size_t sequence = this->cells[position & this->mask].sequence.load(std::memory_order_acquire);
+	return (sequence != (position + 1));
+}
+
+template<typename type>
+std::size_t app::logger::RingBuffer<type>::getCapacity() const {
+	return (this->mask + 1);
+}
+
+#endif // LOGGER_RING_BUFFER_H
@@ -0,0 +1,200 @@
+#ifndef LOGGER_TRACE_H
+#define LOGGER_TRACE_H
+/**
+ * @copyright
+ * @file trace.h
+ * @author Andrea Gianarda
+ * @date 10th June 2020
+ * @brief Logger trace header file
+*/
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Qt libraries
+#include <QtCore/QString>
+
+#include "app/shared/constructor_macros.h"
+#include "app/utility/cpp/singleton.h"
+#include "app/utility/logger/enums.h"
+#include "app/utility/logger/types.h"
+#include "app/utility/logger/context.h"
+#include "app/utility/logger/filter.h"
+#include "app/utility/logger/trace_format.h"
+
+/** @defgroup LoggerGroup Logger Doxygen Group
+ *  Logger functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace logger {
+
+		namespace trace {
+
+			/**
+			 * @brief Function: void appendArgument(std::string & buffer, const QString & argument)
+			 *
+			 * \param buffer: buffer to append the argument to
+			 * \param argument: argument to append
+			 *
+			 * This function appends a Qt string encoded as UTF-8 to the buffer
+			 */
+			void appendArgument(std::string & buffer, const QString & argument);
+
+		}
+
+		/**
+		 * @brief Tracer class
+		 * Every call site registers a descriptor the first time it logs a message. From then on, a record only carries the identifier of the descriptor, a monotonic timestamp and the raw bytes of the arguments
+		 * Records are handed over to the backend that writes them to the trace file together with the descriptors they refer to
+		 * If no trace file is set, messages are formatted and written to the text log instead
+		 *
+		 */
+		class Tracer : public app::utility::Singleton<app::logger::Tracer> {
+
+			public:
+				/**
+				 * @brief Function: explicit Tracer()
+				 *
+				 * Tracer constructor
+				 */
+				explicit Tracer();
+
+				/**
+				 * @brief Function: virtual ~Tracer()
+				 *
+				 * Tracer destructor
+				 */
+				virtual ~Tracer();
+
+				/**
+				 * @brief Function: void log(std::atomic<std::uint32_t> & id, const app::logger::metadata_s & metadata, const app::logger::info_level_e & verbosity, const app::logger::Context & context, const char * format, const argumentTypes & ... arguments)
+				 *
+				 * \param id: identifier of the descriptor of the call site. It is 0 until the call site is registered
+				 * \param metadata: metadata of the call site
+				 * \param verbosity: verbosity of the message
+				 * \param context: context of the message
+				 * \param format: format string. Every {} is replaced by the next argument
+				 * \param arguments: arguments of the message
+				 *
+				 * This function logs a message if the context allows it
+				 */
+				template <typename... argumentTypes>
+				void log(std::atomic<std::uint32_t> & id, const app::logger::metadata_s & metadata, const app::logger::info_level_e & verbosity, const app::logger::Context & context, const char * format, const argumentTypes & ... arguments);
+
+				/**
+				 * @brief Function: void setFilename(const std::string & value)
+				 *
+				 * \param value: trace file. If empty, messages are written to the text log
+				 *
+				 * This function sets the file records are written to
+				 * It must be called while no thread is tracing
+				 */
+				void setFilename(const std::string & value);
+
+				/**
+				 * @brief Function: const std::string & getFilename() const
+				 *
+				 * \return the trace file
+				 *
+				 * This function returns the file records are written to
+				 */
+				const std::string & getFilename() const;
+
+				/**
+				 * @brief Function: bool getDescriptor(const std::uint32_t & id, app::logger::trace::descriptor_s & descriptor) const
+				 *
+				 * \param id: identifier of the descriptor
+				 * \param descriptor: descriptor
+				 *
+				 * \return true if the identifier matches a registered call site, false otherwise
+				 *
+				 * This function returns the descriptor matching the identifier provided as argument
+				 */
+				bool getDescriptor(const std::uint32_t & id, app::logger::trace::descriptor_s & descriptor) const;
+
+			protected:
+
+			private:
+				/**
+				 * @brief Function: std::uint32_t registerStatement(std::atomic<std::uint32_t> & id, const app::logger::metadata_s & metadata, const app::logger::Context & context, const char * format)
+				 *
+				 * \param id: identifier of the descriptor of the call site
+				 * \param metadata: metadata of the call site
+				 * \param context: context of the message
+				 * \param format: format string
+				 *
+				 * \return the identifier of the descriptor of the call site
+				 *
+				 * This function registers the descriptor of a call site unless another thread has already done it
+				 */
+				std::uint32_t registerStatement(std::atomic<std::uint32_t> & id, const app::logger::metadata_s & metadata, const app::logger::Context & context, const char * format);
+
+				/**
+				 * @brief Function: void push(const std::uint32_t & id, const app::logger::metadata_s & metadata, const app::logger::Context & context, const char * format, std::string && entry)
+				 *
+				 * \param id: identifier of the descriptor of the call site
+				 * \param metadata: metadata of the call site
+				 * \param context: context of the message
+				 * \param format: format string
+				 * \param entry: record whose arguments have been appended
+				 *
+				 * This function completes the record and hands it over to the backend
+				 */
+				void push(const std::uint32_t & id, const app::logger::metadata_s & metadata, const app::logger::Context & context, const char * format, std::string && entry);
+
+				/**
+				 * @brief mutex protecting the descriptors
+				 *
+				 */
+				mutable std::mutex descriptorMutex;
+
+				/**
+				 * @brief registered descriptors. The identifier of a descriptor is its position plus one
+				 *
+				 */
+				std::vector<app::logger::trace::descriptor_s> descriptors;
+
+				/**
+				 * @brief trace file
+				 *
+				 */
+				std::string filename;
+
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class Tracer
+				 *
+				 */
+				DISABLE_COPY_MOVE(Tracer)
+
+		};
+
+	}
+
+}
+/** @} */ // End of LoggerGroup group
+
+template <typename... argumentTypes>
+void app::logger::Tracer::log(std::atomic<std::uint32_t> & id, const app::logger::metadata_s & metadata, const app::logger::info_level_e & verbosity, const app::logger::Context & context, const char * format, const argumentTypes & ... arguments) {
+	if (context.isEnabled(metadata.type, verbosity) == false) {
+		return;
+	}
+
+	std::uint32_t statementId = id.load(std::memory_order_acquire);
+	if (statementId == 0) {
+		statementId = this->registerStatement(id, metadata, context, format);
+	}
+
+	std::string entry = std::string();
+	app::logger::trace::beginRecord(entry);
+	(app::logger::trace::appendArgument(entry, arguments), ...);
+	this->push(statementId, metadata, context, format, std::move(entry));
+}
+
+#endif // LOGGER_TRACE_H
@@ -0,0 +1,418 @@
+#ifndef LOGGER_TRACE_FORMAT_H
+#define LOGGER_TRACE_FORMAT_H
+/**
+ * @copyright
+ * @file trace_format.h
+ * @author Andrea Gianarda
+ * @date 10th June 2020
+ * @brief Logger trace format header file
+*/
+
+#include <map>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+/** @defgroup LoggerGroup Logger Doxygen Group
+ *  Logger functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace logger {
+
+		/**
+		 * @brief Binary trace format
+		 * A trace file is a sequence of entries made up of the type of the entry (1 byte), the size of its body (4 bytes) and the body itself
+		 * - a header stores the magic string, the version of the format and the system and monotonic times when the file was opened. It resets the descriptors known so far
+		 * - a descriptor stores the identifier, type, context, file, line, function and format string of a call site
+		 * - a record stores the identifier of the descriptor of its call site, the monotonic time in nanoseconds and the raw bytes of the arguments
+		 * Numbers are stored with the byte order of the machine writing the file
+		 * This file depends on the standard library only so that the decoder can be built without Qt
+		 *
+		 */
+		namespace trace {
+
+			/**
+			 * @brief type of an entry of a trace file
+			 *
+			 */
+			typedef enum class entry_type_list : std::uint8_t {
+				HEADER,        /**< start of the trace */
+				DESCRIPTOR,    /**< description of a call site */
+				RECORD         /**< message logged by a call site */
+			} entry_type_e;
+
+			/**
+			 * @brief type of an argument of a record
+			 *
+			 */
+			typedef enum class argument_type_list : std::uint8_t {
+				SIGNED,        /**< signed integer stored on 8 bytes */
+				UNSIGNED,      /**< unsigned integer stored on 8 bytes */
+				FLOATING,      /**< floating point number stored as a double */
+				BOOLEAN,       /**< boolean stored on 1 byte */
+				STRING         /**< string stored as its size on 4 bytes followed by its characters */
+			} argument_type_e;
+
+			/**
+			 * @brief description of a call site
+			 *
+			 */
+			typedef struct descriptor_t {
+				std::string type;                         /**< type of the message */
+				std::string context;                      /**< name of the context */
+				std::string file;                         /**< file of the call site */
+				int line;                                 /**< line of the call site */
+				std::string function;                     /**< function of the call site */
+				std::string format;                       /**< format string. Every {} is replaced by the next argument */
+			} descriptor_s;
+
+			/**
+			 * @brief magic string at the start of every header
+			 *
+			 */
+			static constexpr char magic[] = "BPPTRACE";
+
+			/**
+			 * @brief version of the format
+			 *
+			 */
+			static constexpr std::uint32_t version = 1;
+
+			/**
+			 * @brief size in bytes of the type and the size of an entry
+			 *
+			 */
+			static constexpr std::size_t entryHeaderSize = sizeof(std::uint8_t) + sizeof(std::uint32_t);
+
+			/**
+			 * @brief size in bytes of a record without its arguments
+			 *
+			 */
+			static constexpr std::size_t recordHeaderSize = app::logger::trace::entryHeaderSize + sizeof(std::uint32_t) + sizeof(std::int64_t);
+
+			/**
+			 * @brief maximum size in bytes of the body of an entry
+			 * Records exceeding it are written without their arguments and the decoder rejects larger entries as corrupted
+			 *
+			 */
+			static constexpr std::size_t maxBodySize = 16 * 1024 * 1024;
+
+			/**
+			 * @brief Function: void appendRaw(std::string & buffer, const valueType & value)
+			 *
+			 * \param buffer: buffer to append the value to
+			 * \param value: value to append
+			 *
+			 * This function appends the bytes of a value to the buffer
+			 */
+			template <typename valueType>
+			void appendRaw(std::string & buffer, const valueType & value);
+
+			/**
+			 * @brief Function: void writeRaw(std::string & buffer, const std::size_t & position, const valueType & value)
+			 *
+			 * \param buffer: buffer to write the value to
+			 * \param position: position of the value in the buffer
+			 * \param value: value to write
+			 *
+			 * This function overwrites bytes of the buffer with those of the value
+			 */
+			template <typename valueType>
+			void writeRaw(std::string & buffer, const std::size_t & position, const valueType & value);
+
+			/**
+			 * @brief Function: bool readRaw(const char * & data, const char * end, valueType & value)
+			 *
+			 * \param data: pointer to the bytes to read. It is moved past the value
+			 * \param end: end of the bytes to read
+			 * \param value: value read
+			 *
+			 * \return true if the value was read, false if there are not enough bytes
+			 *
+			 * This function reads a value from the bytes provided as argument
+			 */
+			template <typename valueType>
+			bool readRaw(const char * & data, const char * end, valueType & value);
+
+			/**
+			 * @brief Function: void appendString(std::string & buffer, const char * text, const std::size_t & size)
+			 *
+			 * \param buffer: buffer to append the string to
+			 * \param text: characters of the string
+			 * \param size: number of characters
+			 *
+			 * This function appends the size of a string followed by its characters to the buffer
+			 */
+			void appendString(std::string & buffer, const char * text, const std::size_t & size);
+
+			/**
+			 * @brief Function: void appendArgument(std::string & buffer, const argumentType & argument)
+			 *
+			 * \param buffer: buffer to append the argument to
+			 * \param argument: argument to append
+			 *
+			 * This function appends the type of an arithmetic argument followed by its value to the buffer
+			 */
+			template <typename argumentType>
+			std::enable_if_t<std::is_arithmetic<argumentType>::value> appendArgument(std::string & buffer, const argumentType & argument);
+
+			/**
+			 * @brief Function: void appendArgument(std::string & buffer, const char * argument)
+			 *
+			 * \param buffer: buffer to append the argument to
+			 * \param argument: argument to append
+			 *
+			 * This function appends a C string to the buffer
+			 */
+			void appendArgument(std::string & buffer, const char * argument);
+
+			/**
+			 * @brief Function: void appendArgument(std::string & buffer, const std::string & argument)
+			 *
+			 * \param buffer: buffer to append the argument to
+			 * \param argument: argument to append
+			 *
+			 * This function appends a string to the buffer
+			 */
+			void appendArgument(std::string & buffer, const std::string & argument);
+
+			/**
+			 * @brief Function: void appendHeader(std::string & buffer, const std::int64_t & systemTime, const std::int64_t & monotonicTime)
+			 *
+			 * \param buffer: buffer to append the header to
+			 * \param systemTime: nanoseconds elapsed since epoch
+			 * \param monotonicTime: monotonic time in nanoseconds at the same instant
+			 *
+			 * This function appends a header entry to the buffer
+			 */
+			void appendHeader(std::string & buffer, const std::int64_t & systemTime, const std::int64_t & monotonicTime);
+
+			/**
+			 * @brief Function: void appendDescriptor(std::string & buffer, const std::uint32_t & id, const app::logger::trace::descriptor_s & descriptor)
+			 *
+			 * \param buffer: buffer to append the descriptor to
+			 * \param id: identifier of the descriptor
+			 * \param descriptor: descriptor to append
+			 *
+			 * This function appends a descriptor entry to the buffer
+			 */
+			void appendDescriptor(std::string & buffer, const std::uint32_t & id, const app::logger::trace::descriptor_s & descriptor);
+
+			/**
+			 * @brief Function: void beginRecord(std::string & buffer)
+			 *
+			 * \param buffer: buffer the record is built into
+			 *
+			 * This function reserves room for the header of a record at the start of the buffer. Arguments are appended afterwards
+			 */
+			void beginRecord(std::string & buffer);
+
+			/**
+			 * @brief Function: void endRecord(std::string & buffer, const std::uint32_t & id, const std::int64_t & monotonicTime)
+			 *
+			 * \param buffer: buffer the record is built into
+			 * \param id: identifier of the descriptor of the call site
+			 * \param monotonicTime: monotonic time in nanoseconds when the message was logged
+			 *
+			 * This function fills the header of a record whose arguments have all been appended
+			 */
+			void endRecord(std::string & buffer, const std::uint32_t & id, const std::int64_t & monotonicTime);
+
+			/**
+			 * @brief Function: bool readRecordId(const std::string & buffer, std::uint32_t & id)
+			 *
+			 * \param buffer: buffer storing a record
+			 * \param id: identifier of the descriptor of the call site
+			 *
+			 * \return true if the buffer stores a record, false otherwise
+			 *
+			 * This function reads the identifier of the descriptor of a record
+			 */
+			bool readRecordId(const std::string & buffer, std::uint32_t & id);
+
+			/**
+			 * @brief Function: bool formatArguments(const std::string & format, const char * data, const char * end, std::string & text)
+			 *
+			 * \param format: format string
+			 * \param data: start of the arguments
+			 * \param end: end of the arguments
+			 * \param text: formatted message
+			 *
+			 * \return true if all arguments were successfully decoded, false otherwise
+			 *
+			 * This function replaces every {} of the format string with the next argument
+			 * Arguments without a matching {} are appended at the end of the message
+			 */
+			bool formatArguments(const std::string & format, const char * data, const char * end, std::string & text);
+
+			/**
+			 * @brief Decoder class
+			 * It converts a trace file back to the text format of the log
+			 *
+			 */
+			class Decoder {
+
+				public:
+					/**
+					 * @brief Function: explicit Decoder()
+					 *
+					 * Trace decoder constructor
+					 */
+					explicit Decoder();
+
+					/**
+					 * @brief Function: virtual ~Decoder()
+					 *
+					 * Trace decoder destructor
+					 */
+					virtual ~Decoder();
+
+					/**
+					 * @brief Function: bool decode(std::istream & input, std::ostream & output)
+					 *
+					 * \param input: stream to read the trace from
+					 * \param output: stream to write the text log to
+					 *
+					 * \return true if the whole trace was decoded, false if it is corrupted or truncated
+					 *
+					 * This function decodes all entries of a trace and writes a line for every record
+					 * Records before a truncated entry are still written to the output but the trace is reported as truncated
+					 */
+					bool decode(std::istream & input, std::ostream & output);
+
+					/**
+					 * @brief Function: std::uint64_t getDecodedRecords() const
+					 *
+					 * \return the number of records decoded
+					 *
+					 * This function returns the number of records decoded so far
+					 */
+					std::uint64_t getDecodedRecords() const;
+
+					/**
+					 * @brief Function: const std::string & getError() const
+					 *
+					 * \return the reason why the trace could not be decoded
+					 *
+					 * This function returns the reason why the trace could not be decoded
+					 */
+					const std::string & getError() const;
+
+				protected:
+
+				private:
+					/**
+					 * @brief Function: bool decodeEntry(const app::logger::trace::entry_type_e & type, const std::string & body, std::ostream & output)
+					 *
+					 * \param type: type of the entry
+					 * \param body: body of the entry
+					 * \param output: stream to write the text log to
+					 *
+					 * \return true if the entry was decoded, false otherwise
+					 *
+					 * This function decodes an entry
+					 */
+					bool decodeEntry(const app::logger::trace::entry_type_e & type, const std::string & body, std::ostream & output);
+
+					/**
+					 * @brief Function: std::string formatDate(const std::int64_t & monotonicTime) const
+					 *
+					 * \param monotonicTime: monotonic time in nanoseconds
+					 *
+					 * \return the local date and time
+					 *
+					 * This function converts a monotonic time to the local date and time using the origin of the last header
+					 */
+					std::string formatDate(const std::int64_t & monotonicTime) const;
+
+					/**
+					 * @brief descriptors declared since the last header
+					 *
+					 */
+					std::map<std::uint32_t, app::logger::trace::descriptor_s> descriptors;
+
+					/**
+					 * @brief nanoseconds elapsed since epoch when the trace was opened
+					 *
+					 */
+					std::int64_t systemOrigin;
+
+					/**
+					 * @brief monotonic time in nanoseconds when the trace was opened
+					 *
+					 */
+					std::int64_t monotonicOrigin;
+
+					/**
+					 * @brief number of records decoded
+					 *
+					 */
+					std::uint64_t decodedRecords;
+
+					/**
+					 * @brief reason why the trace could not be decoded
+					 *
+					 */
+					std::string error;
+
+					/**
+					 * @brief message being formatted
+					 *
+					 */
+					std::string text;
+
+			};
+
+		}
+
+	}
+
+}
+/** @} */ // End of LoggerGroup group
+
+template <typename valueType>
+void app::logger::trace::appendRaw(std::string & buffer, const valueType & value) {
+	static_assert(std::is_trivially_copyable<valueType>::value, "Only trivially copyable values can be appended");
+	buffer.append(reinterpret_cast<const char *>(&value), sizeof(valueType));
+}
+
+template <typename valueType>
+void app::logger::trace::writeRaw(std::string & buffer, const std::size_t & position, const valueType & value) {
+	static_assert(std::is_trivially_copyable<valueType>::value, "Only trivially copyable values can be written");
+	std::memcpy(&buffer[position], &value, sizeof(valueType));
+}
+
+template <typename valueType>
+bool app::logger::trace::readRaw(const char * & data, const char * end, valueType & value) {
+	static_assert(std::is_trivially_copyable<valueType>::value, "Only trivially copyable values can be read");
+	if (static_cast<std::size_t>(end - data) < sizeof(valueType)) {
+		return false;
+	}
+	std::memcpy(&value, data, sizeof(valueType));
+	data += sizeof(valueType);
+	return true;
+}
+
+template <typename argumentType>
+std::enable_if_t<std::is_arithmetic<argumentType>::value> app::logger::trace::appendArgument(std::string & buffer, const argumentType & argument) {
+	if constexpr (std::is_same<argumentType, bool>::value == true) {
+		app::logger::trace::appendRaw(buffer, app::logger::trace::argument_type_e::BOOLEAN);
+		app::logger::trace::appendRaw(buffer, static_cast<std::uint8_t>(argument));
+	} else if constexpr (std::is_floating_point<argumentType>::value == true) {
+		app::logger::trace::appendRaw(buffer, app::logger::trace::argument_type_e::FLOATING);
+		app::logger::trace::appendRaw(buffer, static_cast<double>(argument));
+	} else if constexpr (std::is_signed<argumentType>::value == true) {
+		app::logger::trace::appendRaw(buffer, app::logger::trace::argument_type_e::SIGNED);
+		app::logger::trace::appendRaw(buffer, static_cast<std::int64_t>(argument));
+	} else {
+		app::logger::trace::appendRaw(buffer, app::logger::trace::argument_type_e::UNSIGNED);
+		app::logger::trace::appendRaw(buffer, static_cast<std::uint64_t>(argument));
+	}
+}
+
+#endif // LOGGER_TRACE_FORMAT_H
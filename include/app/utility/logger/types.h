@@ -0,0 +1,88 @@
+#ifndef LOGGER_TYPES_H
+#define LOGGER_TYPES_H
+/**
+ * @copyright
+ * @file types.h
+ * @author Andrea Gianarda
+ * @date 10th June 2020
+ * @brief Logger types header file
+*/
+
+#include <string>
+#include <cstdint>
+
+#include "app/utility/logger/enums.h"
+
+/** @defgroup LoggerGroup Logger Doxygen Group
+ *  Logger functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace logger {
+
+		/**
+		 * @brief metadata of a call site
+		 * One instance is statically allocated at every call site so that records only need to carry a pointer to it
+		 *
+		 */
+		typedef struct metadata_t {
+			const char * file;                 /**< file of the call site */
+			int line;                          /**< line of the call site */
+			const char * function;             /**< function of the call site */
+			app::logger::msg_type_e type;      /**< type of the message */
+		} metadata_s;
+
+		/**
+		 * @brief format of the payload of a record
+		 *
+		 */
+		typedef enum class record_format_list {
+			TEXT,          /**< text line */
+			BINARY         /**< entry of a binary trace */
+		} record_format_e;
+
+		/**
+		 * @brief log record travelling from the thread logging a message to the writer thread
+		 *
+		 */
+		typedef struct record_t {
+			const app::logger::metadata_s * metadata;   /**< metadata of the call site. If null, the payload already contains the header */
+			app::logger::msg_type_e type;               /**< type of the message */
+			std::int64_t timestamp;                     /**< nanoseconds elapsed since epoch when the message was logged */
+			std::string context;                        /**< name of the context */
+			std::string filename;                       /**< file to write the message into */
+			std::string payload;                        /**< formatted message */
+			app::logger::record_format_e format;        /**< format of the payload */
+		} record_s;
+
+		/**
+		 * @brief rotation of the log files
+		 * The file being written is renamed to <file>.1 and the older segments are shifted by one position up to the maximum number of segments
+		 *
+		 */
+		typedef struct rotation_t {
+			std::uint64_t maxFileSize;                  /**< size in bytes a file is rotated at. If 0, files are not rotated by size */
+			std::int64_t maxFileAge;                    /**< age in seconds a file is rotated at. If 0, files are not rotated by age */
+			int segments;                               /**< maximum number of rotated segments of a file */
+			bool compress;                              /**< rotated segments are compressed with gzip */
+			std::uint64_t diskBudget;                   /**< maximum size in bytes of a file and its segments. If 0, there is no limit */
+		} rotation_s;
+
+		/**
+		 * @brief logging rule
+		 * Contexts whose dotted name matches the pattern print messages whose type and verbosity pass the thresholds of the rule
+		 *
+		 */
+		typedef struct rule_t {
+			std::string pattern;                        /**< glob pattern matching the dotted name of contexts. * matches any sequence of characters and ? matches a single character */
+			app::logger::msg_type_e type;               /**< minimum type of messages to print */
+			app::logger::info_level_e verbosity;        /**< maximum verbosity of information messages to print */
+		} rule_s;
+
+	}
+
+}
+/** @} */ // End of LoggerGroup group
+
+#endif // LOGGER_TYPES_H
@@ -0,0 +1,219 @@
+#ifndef STARTUP_PROFILER_H
+#define STARTUP_PROFILER_H
+/**
+ * @copyright
+ * @file startup_profiler.h
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Startup profiler header file
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <functional>
+
+// Qt libraries
+#include <QtCore/QObject>
+#include <QtCore/QEvent>
+#include <QtWidgets/QWidget>
+
+#include "app/shared/constructor_macros.h"
+#include "app/utility/cpp/singleton.h"
+
+/** @defgroup StartupProfilerGroup Startup Profiler Group
+ *  Startup profiler functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace utility {
+
+		/**
+		 * @brief phase of the startup of the program
+		 *
+		 */
+		typedef struct startup_phase_t {
+			std::string name;                                 /**< name of the phase */
+			std::chrono::steady_clock::time_point start;      /**< time the phase started */
+			std::chrono::steady_clock::time_point end;        /**< time the phase ended */
+			bool finished;                                    /**< the phase has ended */
+		} startup_phase_s;
+
+		/**
+		 * @brief StartupProfiler class
+		 * The profiler records the time taken by every phase of the startup of the program
+		 * Only the first occurrence of a phase is recorded so that windows created after the startup do not alter the results
+		 * The profiler must only be used from the GUI thread
+		 *
+		 */
+		class StartupProfiler final : public app::utility::Singleton<app::utility::StartupProfiler> {
+
+			public:
+				/**
+				 * @brief Function: explicit StartupProfiler()
+				 *
+				 * Startup profiler constructor
+				 */
+				explicit StartupProfiler();
+
+				/**
+				 * @brief Function: virtual ~StartupProfiler()
+				 *
+				 * Startup profiler destructor
+				 */
+				virtual ~StartupProfiler();
+
+				/**
+				 * @brief Function: void startPhase(const std::string & name)
+				 *
+				 * \param name: name of the phase
+				 *
+				 * This function records the time a phase starts unless the phase has already been recorded
+				 */
+				void startPhase(const std::string & name);
+
+				/**
+				 * @brief Function: void endPhase(const std::string & name)
+				 *
+				 * \param name: name of the phase
+				 *
+				 * This function records the time a phase ends if the phase was started and has not ended yet
+				 */
+				void endPhase(const std::string & name);
+
+				/**
+				 * @brief Function: const std::vector<app::utility::startup_phase_s> & getPhases() const
+				 *
+				 * \return the phases ordered by the time they started
+				 *
+				 * This function returns the phases recorded so far
+				 */
+				const std::vector<app::utility::startup_phase_s> & getPhases() const;
+
+				/**
+				 * @brief Function: std::string printTable() const
+				 *
+				 * \return a table with the start time and the duration of every phase
+				 *
+				 * This function prints the phases as a table whose times are relative to the start of the program
+				 */
+				std::string printTable() const;
+
+				/**
+				 * @brief Function: void writeTrace(const std::string & filename) const
+				 *
+				 * \param filename: file to write
+				 *
+				 * This function writes the phases to a JSON file in the Chrome trace event format
+				 */
+				void writeTrace(const std::string & filename) const;
+
+				/**
+				 * @brief Function: void report(const std::string & traceFilename) const
+				 *
+				 * \param traceFilename: file to write the trace to. No trace is written if it is empty
+				 *
+				 * This function prints the table of the phases to the standard output and writes the trace
+				 */
+				void report(const std::string & traceFilename) const;
+
+				/**
+				 * @brief Function: static const std::chrono::steady_clock::time_point & getOrigin()
+				 *
+				 * \return the time the program started
+				 *
+				 * This function returns the time the static objects of the program were initialized
+				 */
+				static const std::chrono::steady_clock::time_point & getOrigin();
+
+			protected:
+
+			private:
+				/**
+				 * @brief phases ordered by the time they started
+				 *
+				 */
+				std::vector<app::utility::startup_phase_s> phases;
+
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class StartupProfiler
+				 *
+				 */
+				DISABLE_COPY_MOVE(StartupProfiler)
+
+		};
+
+		/**
+		 * @brief FirstPaintWatcher class
+		 * The watcher runs a callback once the widgets of a window are painted for the first time
+		 *
+		 */
+		class FirstPaintWatcher final : public QObject {
+
+			public:
+				/**
+				 * @brief Function: explicit FirstPaintWatcher(QWidget * watchedWindow, const std::function<void()> & paintCallback)
+				 *
+				 * \param watchedWindow: window to watch
+				 * \param paintCallback: function to run after the window is painted for the first time
+				 *
+				 * First paint watcher constructor
+				 */
+				explicit FirstPaintWatcher(QWidget * watchedWindow, const std::function<void()> & paintCallback);
+
+				/**
+				 * @brief Function: virtual ~FirstPaintWatcher()
+				 *
+				 * First paint watcher destructor
+				 */
+				virtual ~FirstPaintWatcher();
+
+			protected:
+				/**
+				 * @brief Function: virtual bool eventFilter(QObject * watched, QEvent * event) override
+				 *
+				 * \param watched: object receiving the event
+				 * \param event: event
+				 *
+				 * \return false as events are never filtered out
+				 *
+				 * This function detects the first paint event of a widget of the watched window
+				 */
+				virtual bool eventFilter(QObject * watched, QEvent * event) override;
+
+			private:
+				/**
+				 * @brief window to watch
+				 *
+				 */
+				QWidget * window;
+
+				/**
+				 * @brief function to run after the window is painted for the first time
+				 *
+				 */
+				std::function<void()> callback;
+
+				/**
+				 * @brief flag stating whether the window has been painted
+				 *
+				 */
+				bool painted;
+
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class FirstPaintWatcher
+				 *
+				 */
+				DISABLE_COPY_MOVE(FirstPaintWatcher)
+
+		};
+
+	}
+
+}
+/** @} */ // End of StartupProfilerGroup group
+
+#endif // STARTUP_PROFILER_H
@@ -9,11 +9,14 @@
  * @brief Command Menu file
 */
 
+#include <vector>
+
 // Qt libraries
 #include <QtWidgets/QAbstractItemView>
 #include <QtWidgets/QWidget>
 #include <QtCore/QRect>
 #include <QtCore/QModelIndex>
+#include <QtCore/QEvent>
 #include <QtGui/QRegion>
 #include <QtGui/QResizeEvent>
 #include <QtGui/QMouseEvent>
@@ -56,6 +59,15 @@ namespace app {
 				 */
 				virtual ~CommandMenu();
 
+				/**
+				 * @brief Function: app::command_menu::CommandMenuModel * getMenuModel() const
+				 *
+				 * \return the model of the command menu
+				 *
+				 * This function returns the model listing the commands
+				 */
+				app::command_menu::CommandMenuModel * getMenuModel() const;
+
 			protected:
 
 			private:
@@ -69,7 +81,7 @@ namespace app {
 				 * @brief Height to be displayed without the need of a scrollbar
 				 *
 				 */
-				mutable int visibleHeight;
+				int visibleHeight;
 
 				/**
 				 * @brief Width to be displayed without the need of a scrollbar
@@ -78,10 +90,18 @@ namespace app {
 				mutable int visibleWidth;
 
 				/**
-				 * @brief Hash of rectangles of every single row
+				 * @brief Vertical offset of the top side of every row
+				 * The last element is the height of all rows hence row i spans from rowOffsets[i] to rowOffsets[i + 1]
+				 *
+				 */
+				std::vector<int> rowOffsets;
+
+				/**
+				 * @brief Width of every row
+				 * Widths are measured the first time a row is displayed and they are set to a negative value until then
 				 *
 				 */
-				mutable QHash<int, QRect> itemRect;
+				mutable std::vector<int> rowWidths;
 
 				/**
 				 * @brief Function: void setProperties()
@@ -91,13 +111,14 @@ namespace app {
 				void setProperties();
 
 				/**
-				 * @brief Function: void setModel(app::command_menu::CommandMenuModel * model)
+				 * @brief Function: virtual void setModel(QAbstractItemModel * model) override
 				 *
 				 * \param model: model to set for the command menu
 				 *
 				 * Set command menu model
+				 * The geometry of the rows is computed again every time rows are added, removed or changed
 				 */
-				void setModel(app::command_menu::CommandMenuModel * model);
+				virtual void setModel(QAbstractItemModel * model) override;
 
 				/**
 				 * @brief Function: QRect visualRect(const QModelIndex & index) const
@@ -192,11 +213,34 @@ namespace app {
 				QRegion visualRegionForSelection(const QItemSelection & selection) const;
 
 				/**
-				 * @brief Function: void updateHashTable() const
+				 * @brief Function: void updateRowGeometry()
 				 *
-				 * This function updates the hash table where all rows are stored
+				 * This function computes the vertical offset of all rows of the model
+				 * It must be called only when the rows of the model or the font change
 				 */
-				void updateHashTable() const;
+				void updateRowGeometry();
+
+				/**
+				 * @brief Function: int getRowWidth(const int & row) const
+				 *
+				 * \param row: row of the model
+				 *
+				 * \return the width of the row
+				 *
+				 * This function returns the width of the row and measures its text if it has not been done yet
+				 */
+				int getRowWidth(const int & row) const;
+
+				/**
+				 * @brief Function: int rowAt(const int & y) const
+				 *
+				 * \param y: vertical coordinate accounting for scrolling
+				 *
+				 * \return the row spanning across coordinate y or -1 if no row is found
+				 *
+				 * This function searches the row spanning across coordinate y by bisecting the row offsets
+				 */
+				int rowAt(const int & y) const;
 
 				/**
 				 * @brief Function: QRect viewportRectangle(const int row) const
@@ -237,6 +281,15 @@ namespace app {
 				 */
 				void resizeEvent(QResizeEvent * event);
 
+				/**
+				 * @brief Function: void changeEvent(QEvent * event)
+				 *
+				 * \param event: change event
+				 *
+				 * This function is called when the state of the widget changes
+				 */
+				void changeEvent(QEvent * event);
+
 				/**
 				 * @brief Function: void mousePressEvent(QMouseEvent * event)
 				 *
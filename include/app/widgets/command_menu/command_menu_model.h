@@ -9,10 +9,15 @@
  * @brief Command Menu Model file
 */
 
+#include <string>
+#include <vector>
+#include <cstdint>
+
 // Qt libraries
 #include <QtCore/QAbstractItemModel>
 #include <QtCore/QModelIndex>
 #include <QtCore/QVariant>
+#include <QtCore/QString>
 
 #include "app/shared/constructor_macros.h"
 
@@ -22,9 +27,22 @@
  */
 namespace app {
 
+	namespace main_window {
+
+		namespace json {
+
+			class Action;
+
+		}
+
+	}
+
 	namespace command_menu {
 		/**
 		 * @brief CommandMenuModel class
+		 * The model lists the long commands matching a filter typed by the user
+		 * A command matches the filter if it contains all characters of the filter in the same order, regardless of their case
+		 * Every time characters are appended to the filter, only the commands that matched the previous filter are scored again
 		 *
 		 */
 		class CommandMenuModel final : public QAbstractItemModel {
@@ -49,11 +67,56 @@ namespace app {
 				 */
 				virtual ~CommandMenuModel();
 
-			protected:
+				/**
+				 * @brief Function: void setActions(const app::main_window::json::Action & actions)
+				 *
+				 * \param actions: actions whose long commands are listed in the model
+				 *
+				 * This function replaces the commands listed in the model and clears the filter
+				 */
+				void setActions(const app::main_window::json::Action & actions);
+
+				/**
+				 * @brief Function: void setFilter(const QString & value)
+				 *
+				 * \param value: text typed by the user
+				 *
+				 * This function filters the commands and sorts them by decreasing score
+				 */
+				void setFilter(const QString & value);
 
-			private:
 				/**
-				 * @brief Function: QModelIndex index(int row, int column, const QModelIndex & parent = QModelIndex()) const
+				 * @brief Function: const QString & getFilter() const
+				 *
+				 * \return the text the commands are filtered by
+				 *
+				 * This function returns the text the commands are filtered by
+				 */
+				const QString & getFilter() const;
+
+				/**
+				 * @brief Function: std::size_t getScoredCommandCount() const
+				 *
+				 * \return the number of commands scored since the commands were set
+				 *
+				 * This function returns the number of commands scored since the commands were set
+				 */
+				std::size_t getScoredCommandCount() const;
+
+				/**
+				 * @brief Function: static int score(const QString & command, const QString & filter)
+				 *
+				 * \param command: command to score
+				 * \param filter: text typed by the user
+				 *
+				 * \return the score of the command or a negative value if the command does not match the filter
+				 *
+				 * This function scores a command against a filter without using any precomputed data
+				 */
+				static int score(const QString & command, const QString & filter);
+
+				/**
+				 * @brief Function: virtual QModelIndex index(int row, int column, const QModelIndex & parent = QModelIndex()) const override
 				 *
 				 * \param row: row of the item
 				 * \param column: column of the item
@@ -64,10 +127,10 @@ namespace app {
 				 * This function returns the index of the item specified by the input arguments row, column and parent
 				 *
 				 */
-				QModelIndex index(int row, int column, const QModelIndex & parent = QModelIndex()) const;
+				virtual QModelIndex index(int row, int column, const QModelIndex & parent = QModelIndex()) const override;
 
 				/**
-				 * @brief Function: QModelIndex parent(const QModelIndex & child) const
+				 * @brief Function: virtual QModelIndex parent(const QModelIndex & child) const override
 				 *
 				 * \param child: model item to search
 				 * 
@@ -75,10 +138,10 @@ namespace app {
 				 *
 				 * This function returns the parent of the model item child
 				 */
-				QModelIndex parent(const QModelIndex & child) const;
+				virtual QModelIndex parent(const QModelIndex & child) const override;
 
 				/**
-				 * @brief Function: int rowCount(const QModelIndex & parent = QModelIndex()) const
+				 * @brief Function: virtual int rowCount(const QModelIndex & parent = QModelIndex()) const override
 				 *
 				 * \param parent: model item to search
 				 *
@@ -86,10 +149,10 @@ namespace app {
 				 *
 				 * This function returns the number of row of the model item parent
 				 */
-				int rowCount(const QModelIndex & parent = QModelIndex()) const;
+				virtual int rowCount(const QModelIndex & parent = QModelIndex()) const override;
 
 				/**
-				 * @brief Function: int columnCount(const QModelIndex & parent = QModelIndex()) const
+				 * @brief Function: virtual int columnCount(const QModelIndex & parent = QModelIndex()) const override
 				 *
 				 * \param parent: model item to search
 				 *
@@ -97,10 +160,10 @@ namespace app {
 				 *
 				 * This function returns the number of column of the model item parent
 				 */
-				int columnCount(const QModelIndex & parent = QModelIndex()) const;
+				virtual int columnCount(const QModelIndex & parent = QModelIndex()) const override;
 
 				/**
-				 * @brief Function: QVariant data(const QModelIndex & index, int role = Qt::DisplayRole) const
+				 * @brief Function: virtual QVariant data(const QModelIndex & index, int role = Qt::DisplayRole) const override
 				 *
 				 * \param index: model item to search
 				 * \param role: model item to search
@@ -110,7 +173,88 @@ namespace app {
 				 * This function returns the data stored under the given role for item referred by index index
 				 * An invalid QVariant is returned if there is no value to be returned
 				 */
-				QVariant data(const QModelIndex & index, int role = Qt::DisplayRole) const;
+				virtual QVariant data(const QModelIndex & index, int role = Qt::DisplayRole) const override;
+
+			protected:
+
+			private:
+				/**
+				 * @brief command listed in the model
+				 *
+				 */
+				typedef struct command_entry_t {
+					QString name;               /**< long command */
+					QString help;               /**< help of the command */
+					std::string lowercaseName;  /**< long command in lowercase */
+					std::uint64_t characters;   /**< bitmask of the characters in the long command */
+				} command_entry_s;
+
+				/**
+				 * @brief result of a filter
+				 *
+				 */
+				typedef struct filter_step_t {
+					std::string filter;         /**< filter in lowercase */
+					std::vector<int> rows;      /**< commands matching the filter sorted by decreasing score */
+				} filter_step_s;
+
+				/**
+				 * @brief Function: static std::uint64_t getCharacterMask(const std::string & text)
+				 *
+				 * \param text: lowercase text
+				 *
+				 * \return the bitmask of the characters in the text
+				 *
+				 * This function computes a bitmask where every bit is set if the text contains a given character
+				 */
+				static std::uint64_t getCharacterMask(const std::string & text);
+
+				/**
+				 * @brief Function: static int scoreLowercase(const std::string & command, const std::string & filter)
+				 *
+				 * \param command: lowercase command to score
+				 * \param filter: lowercase filter
+				 *
+				 * \return the score of the command or a negative value if the command does not match the filter
+				 *
+				 * This function scores a command by matching the characters of the filter from left to right
+				 * Characters matched right after the previous one or at the beginning of a word increase the score
+				 */
+				static int scoreLowercase(const std::string & command, const std::string & filter);
+
+				/**
+				 * @brief commands listed in the model
+				 *
+				 */
+				std::vector<app::command_menu::CommandMenuModel::command_entry_s> commands;
+
+				/**
+				 * @brief results of the filters that are a prefix of the current filter
+				 * The last element is the result of the current filter
+				 *
+				 */
+				std::vector<app::command_menu::CommandMenuModel::filter_step_s> filterSteps;
+
+				/**
+				 * @brief text the commands are filtered by
+				 *
+				 */
+				QString filter;
+
+				/**
+				 * @brief number of commands scored since the commands were set
+				 *
+				 */
+				std::size_t scoredCommandCount;
+
+				/**
+				 * @brief Function: const std::vector<int> & getRows() const
+				 *
+				 * \return the commands matching the current filter
+				 *
+				 * This function returns the rows of the commands matching the current filter
+				 */
+				const std::vector<int> & getRows() const;
 
 				// Move and copy constructor
 				/**
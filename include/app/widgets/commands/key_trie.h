@@ -0,0 +1,253 @@
+#ifndef KEY_TRIE_H
+#define KEY_TRIE_H
+/**
+ * @copyright
+ * @file key_trie.h
+ * @author Andrea Gianarda
+ * @date 07th September 2020
+ * @brief Key Trie header file
+*/
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+// Qt libraries
+#include <QtGui/QKeySequence>
+
+#include "app/widgets/commands/key_sequence.h"
+
+/** @defgroup KeyTrieGroup Key Trie Doxygen Group
+ *  Key Trie functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace commands {
+
+		/**
+		 * @brief KeyTrie class
+		 * Key sequences bound to a value are compiled into a table of transitions between nodes of a trie
+		 * Keys are consumed one at a time and every key is resolved with a single lookup in the transition table regardless of the number of bindings
+		 * A key sequence cannot be bound if it begins with another binding or another binding begins with it, therefore an exact match is never ambiguous
+		 *
+		 */
+		class KeyTrie {
+
+			public:
+				/**
+				 * @brief Function: explicit KeyTrie(const std::chrono::milliseconds & timeout = std::chrono::milliseconds(1000))
+				 *
+				 * \param timeout: maximum time between two keys of the same sequence
+				 *
+				 * Key Trie constructor
+				 */
+				explicit KeyTrie(const std::chrono::milliseconds & timeout = std::chrono::milliseconds(1000));
+
+				/**
+				 * @brief Function: virtual ~KeyTrie()
+				 *
+				 * Key Trie destructor
+				 */
+				virtual ~KeyTrie();
+
+				/**
+				 * @brief Function: void addBinding(const app::commands::KeySequence & sequence, const int & value)
+				 *
+				 * \param sequence: key sequence to bind
+				 * \param value: non-negative value returned when the key sequence is typed
+				 *
+				 * This function binds a key sequence to a value
+				 * An exception is thrown if the key sequence is empty or it conflicts with an existing binding
+				 */
+				void addBinding(const app::commands::KeySequence & sequence, const int & value);
+
+				/**
+				 * @brief Function: bool hasConflict(const app::commands::KeySequence & sequence) const
+				 *
+				 * \param sequence: key sequence to check
+				 *
+				 * \return true if the key sequence is already bound, it begins with a binding or a binding begins with it
+				 *
+				 * This function returns whether the key sequence cannot be bound without shadowing an existing binding
+				 */
+				bool hasConflict(const app::commands::KeySequence & sequence) const;
+
+				/**
+				 * @brief Function: void clear()
+				 *
+				 * This function removes all bindings
+				 */
+				void clear();
+
+				/**
+				 * @brief Function: QKeySequence::SequenceMatch feed(const int & key, const std::chrono::steady_clock::time_point & time)
+				 *
+				 * \param key: key pressed, including its modifiers
+				 * \param time: time the key has been pressed at
+				 *
+				 * \return match of the keys typed so far
+				 *
+				 * This function consumes a key and returns:
+				 * - QKeySequence::ExactMatch if the keys typed so far are bound to a value. The value can be retrieved through getMatchedValue
+				 * - QKeySequence::PartialMatch if the keys typed so far are the beginning of at least one binding
+				 * - QKeySequence::NoMatch otherwise
+				 * The keys typed so far are discarded after an exact match or no match or if the previous key was typed more than the timeout earlier
+				 * A key that does not continue the keys typed so far is matched again as the first key of a new sequence
+				 * As bindings cannot begin with another binding, an exact match cannot be extended by further keys
+				 */
+				QKeySequence::SequenceMatch feed(const int & key, const std::chrono::steady_clock::time_point & time);
+
+				/**
+				 * @brief Function: QKeySequence::SequenceMatch feed(const int & key)
+				 *
+				 * \param key: key pressed, including its modifiers
+				 *
+				 * \return match of the keys typed so far
+				 *
+				 * This function consumes a key pressed now
+				 */
+				QKeySequence::SequenceMatch feed(const int & key);
+
+				/**
+				 * @brief Function: bool isExpected(const int & key, const std::chrono::steady_clock::time_point & time) const
+				 *
+				 * \param key: key pressed, including its modifiers
+				 * \param time: time the key has been pressed at
+				 *
+				 * \return true if feeding the key would return an exact or a partial match
+				 *
+				 * This function checks a key without consuming it
+				 */
+				bool isExpected(const int & key, const std::chrono::steady_clock::time_point & time) const;
+
+				/**
+				 * @brief Function: void reset()
+				 *
+				 * This function discards the keys typed so far
+				 */
+				void reset();
+
+				/**
+				 * @brief Function: bool isPending() const
+				 *
+				 * \return true if the keys typed so far are the beginning of a binding
+				 *
+				 * This function returns whether the trie is waiting for more keys to complete a binding
+				 */
+				bool isPending() const;
+
+				/**
+				 * @brief Function: const int & getMatchedValue() const
+				 *
+				 * \return the value of the last exact match or -1 if the last key did not complete a binding
+				 *
+				 * This function returns the value bound to the last sequence matched
+				 */
+				const int & getMatchedValue() const;
+
+				/**
+				 * @brief Function: std::size_t getBindingCount() const
+				 *
+				 * \return the number of bindings
+				 *
+				 * This function returns the number of key sequences bound to a value
+				 */
+				std::size_t getBindingCount() const;
+
+				/**
+				 * @brief Function: void setTimeout(const std::chrono::milliseconds & value)
+				 *
+				 * \param value: maximum time between two keys of the same sequence
+				 *
+				 * This function sets the maximum time between two keys of the same sequence
+				 */
+				void setTimeout(const std::chrono::milliseconds & value);
+
+				/**
+				 * @brief Function: const std::chrono::milliseconds & getTimeout() const
+				 *
+				 * \return the maximum time between two keys of the same sequence
+				 *
+				 * This function returns the maximum time between two keys of the same sequence
+				 */
+				const std::chrono::milliseconds & getTimeout() const;
+
+			protected:
+
+			private:
+
+				/**
+				 * @brief Function: static std::uint64_t getTransitionKey(const std::size_t & node, const int & key)
+				 *
+				 * \param node: node the transition starts from
+				 * \param key: key of the transition
+				 *
+				 * \return the key of the transition in the transition table
+				 *
+				 * This function packs a node and a key into the key of the transition table
+				 */
+				static std::uint64_t getTransitionKey(const std::size_t & node, const int & key);
+
+				/**
+				 * @brief Function: std::size_t getStartNode(const std::chrono::steady_clock::time_point & time) const
+				 *
+				 * \param time: time the key has been pressed at
+				 *
+				 * \return the node the key pressed at the given time starts from
+				 *
+				 * This function returns the root if the previous key was typed more than the timeout earlier and the node reached by the keys typed so far otherwise
+				 */
+				std::size_t getStartNode(const std::chrono::steady_clock::time_point & time) const;
+
+				/**
+				 * @brief values bound to the nodes of the trie or -1 if the node is not bound to any value. The root is the first node
+				 *
+				 */
+				std::vector<int> nodes;
+
+				/**
+				 * @brief transitions between nodes
+				 *
+				 */
+				std::unordered_map<std::uint64_t, std::size_t> transitions;
+
+				/**
+				 * @brief node reached by the keys typed so far
+				 *
+				 */
+				std::size_t currentNode;
+
+				/**
+				 * @brief value of the last exact match
+				 *
+				 */
+				int matchedValue;
+
+				/**
+				 * @brief time the last key was pressed at
+				 *
+				 */
+				std::chrono::steady_clock::time_point lastKeyTime;
+
+				/**
+				 * @brief maximum time between two keys of the same sequence
+				 *
+				 */
+				std::chrono::milliseconds timeout;
+
+				/**
+				 * @brief number of bindings
+				 *
+				 */
+				std::size_t bindingCount;
+
+		};
+
+	}
+
+}
+/** @} */ // End of KeyTrieGroup group
+
+#endif // KEY_TRIE_H
@@ -8,6 +8,8 @@
  * @brief Elided label class header file
 */
 
+#include <cstdint>
+
 // Qt libraries
 #include <QtCore/QPoint>
 #include <QtGui/QResizeEvent>
@@ -105,6 +107,24 @@ namespace app {
 				 */
 				void setOrigin(const QPoint & value);
 
+				/**
+				 * @brief Function: const std::uint64_t & getTextUpdateCount() const
+				 *
+				 * \return number of times the text of the label changed
+				 *
+				 * This functions returns the number of times the text of the label changed
+				 */
+				const std::uint64_t & getTextUpdateCount() const;
+
+				/**
+				 * @brief Function: const std::uint64_t & getPaintEventCount() const
+				 *
+				 * \return number of times the label has been painted
+				 *
+				 * This functions returns the number of times the label has been painted
+				 */
+				const std::uint64_t & getPaintEventCount() const;
+
 			public slots:
 				/**
 				 * @brief Function: void setText(const QString & text)
@@ -112,6 +132,7 @@ namespace app {
 				 * \param text: text to write into QLabel
 				 *
 				 * Overload setText of base QLabel to account for elision
+				 * Nothing is done if the text doesn't change
 				 */
 				void setText(const QString & text);
 
@@ -137,6 +158,18 @@ namespace app {
 				 */
 				QPoint origin;
 
+				/**
+				 * @brief number of times the text of the label changed
+				 *
+				 */
+				std::uint64_t textUpdateCount;
+
+				/**
+				 * @brief number of times the label has been painted
+				 *
+				 */
+				std::uint64_t paintEventCount;
+
 				/**
 				 * @brief Function: void updateElidedText(const int & width)
 				 *
@@ -61,6 +61,39 @@ namespace app {
 					 */
 					virtual ~Action();
 
+					/**
+					 * @brief Function: const std::unique_ptr<app::main_window::json::Data> & findByLongCmd(const std::string & longCmd) const
+					 *
+					 * \param longCmd: long command to search
+					 *
+					 * \return action having the long command provided as argument or the invalid data if no match
+					 *
+					 * This functions searches in constant time the action having the long command provided as argument
+					 */
+					const std::unique_ptr<app::main_window::json::Data> & findByLongCmd(const std::string & longCmd) const;
+
+					/**
+					 * @brief Function: const std::unique_ptr<app::main_window::json::Data> & findByState(const app::main_window::state_e & state) const
+					 *
+					 * \param state: state to search
+					 *
+					 * \return action having the state provided as argument or the invalid data if no match
+					 *
+					 * This functions searches in constant time the action having the state provided as argument
+					 */
+					const std::unique_ptr<app::main_window::json::Data> & findByState(const app::main_window::state_e & state) const;
+
+					/**
+					 * @brief Function: const std::unique_ptr<app::main_window::json::Data> & findByShortcut(const int & shortcut) const
+					 *
+					 * \param shortcut: shortcut to search. It is the bitwise or of the key and the modifier
+					 *
+					 * \return action having the shortcut provided as argument or the invalid data if no match
+					 *
+					 * This functions searches in constant time the action having the shortcut provided as argument
+					 */
+					const std::unique_ptr<app::main_window::json::Data> & findByShortcut(const int & shortcut) const;
+
 				protected:
 
 					/**
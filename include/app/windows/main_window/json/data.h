@@ -8,6 +8,7 @@
  * @brief Main Window Json Data header file
 */
 
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -220,6 +221,56 @@ namespace app {
 					 */
 					virtual const void * getValueFromMemberName(const std::string & name) const override;
 
+					/**
+					 * @brief indexed parameters
+					 *
+					 */
+					typedef enum class indexed_parameter_list {
+						STATE,    /**< State */
+						SHORTCUT, /**< Shortcut */
+						LONG_CMD  /**< Long command */
+					} indexed_parameter_e;
+
+					/**
+					 * @brief map of indexed parameters
+					 * key is the name of the parameter
+					 * value is the parameter
+					 *
+					 */
+					typedef std::map<std::string, indexed_parameter_e> indexed_parameter_map_t;
+
+					/**
+					 * @brief Function: static const indexed_parameter_map_t & getIndexedParameters()
+					 *
+					 * \return the parameters to be indexed
+					 *
+					 * This functions returns the parameters whose value is indexed in order to search actions in constant time
+					 */
+					static const indexed_parameter_map_t & getIndexedParameters();
+
+					/**
+					 * @brief Function: static app::base::json::Data::index_key_t toIndexKey(const indexed_parameter_e & parameter, const void * value)
+					 *
+					 * \param parameter: indexed parameter
+					 * \param value: value of the parameter
+					 *
+					 * \return the key of the value in the index of the parameter
+					 *
+					 * This functions converts the value of an indexed parameter to the key of its index
+					 */
+					static app::base::json::Data::index_key_t toIndexKey(const indexed_parameter_e & parameter, const void * value);
+
+					/**
+					 * @brief Function: app::base::json::Data::index_key_t getIndexKey(const indexed_parameter_e & parameter) const
+					 *
+					 * \param parameter: indexed parameter
+					 *
+					 * \return the key of the action in the index of the parameter
+					 *
+					 * This functions returns the value of an indexed parameter of the action as a key of its index
+					 */
+					app::base::json::Data::index_key_t getIndexKey(const indexed_parameter_e & parameter) const;
+
 				private:
 					/**
 					 * @brief key under which the JSON object is
@@ -0,0 +1,312 @@
+#ifndef MAIN_WINDOW_SESSION_STORE_H
+#define MAIN_WINDOW_SESSION_STORE_H
+/**
+ * @copyright
+ * @file store.h
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Main Window Session Store header file
+*/
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <condition_variable>
+
+// Qt libraries
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+#include "app/shared/constructor_macros.h"
+#include "app/windows/main_window/shared/shared_types.h"
+
+/** @defgroup MainWindowGroup Main Window Doxygen Group
+ *  Main Window functions and class
+ *  @{
+ */
+namespace app {
+
+	namespace main_window {
+
+		namespace tab {
+
+			class TabWidget;
+
+		}
+
+		namespace session {
+
+			/**
+			 * @brief state of a tab in a session
+			 *
+			 */
+			typedef struct tab_state_t {
+				app::main_window::page_type_e type;       /**< type of the page */
+				QString source;                           /**< source of the page */
+				int verticalScrollPercentage;             /**< vertical position of the scrollbar */
+				QByteArray history;                       /**< history serialized through a QDataStream */
+			} tab_state_s;
+
+			/**
+			 * @brief state of the tabs of a window
+			 *
+			 */
+			typedef struct session_state_t {
+				int currentIndex;                         /**< index of the current tab */
+				std::vector<app::main_window::session::tab_state_s> tabs;  /**< tabs ordered as in the tab bar */
+			} session_state_s;
+
+			/**
+			 * @brief Store class
+			 * The store snapshots the tabs of a window and writes them into a binary file
+			 * Snapshots are taken on the GUI thread a short time after the tabs change in order to coalesce bursts of changes whereas the file is written by a dedicated thread
+			 * The file is replaced atomically therefore it is never left half written
+			 *
+			 */
+			class Store final {
+
+				public:
+					/**
+					 * @brief Function: explicit Store(app::main_window::tab::TabWidget * tabWidget, const QString & sessionFile, const std::chrono::milliseconds & saveDelay)
+					 *
+					 * \param tabWidget: tabs whose session is stored
+					 * \param sessionFile: file storing the session. The store is disabled if it is empty
+					 * \param saveDelay: time between a change of the tabs and the snapshot of the session
+					 *
+					 * Main window session store constructor
+					 */
+					explicit Store(app::main_window::tab::TabWidget * tabWidget, const QString & sessionFile, const std::chrono::milliseconds & saveDelay);
+
+					/**
+					 * @brief Function: virtual ~Store()
+					 *
+					 * Main window session store destructor
+					 * It writes the latest session and waits for the file to be written
+					 */
+					virtual ~Store();
+
+					/**
+					 * @brief Function: void scheduleSave()
+					 *
+					 * This function requests a snapshot of the session once the save delay expires
+					 * Requests received before the snapshot is taken are coalesced
+					 */
+					void scheduleSave();
+
+					/**
+					 * @brief Function: void save()
+					 *
+					 * This function takes a snapshot of the session and hands it over to the writer thread
+					 */
+					void save();
+
+					/**
+					 * @brief Function: void save(const app::main_window::session::session_state_s & session)
+					 *
+					 * \param session: session to write
+					 *
+					 * This function hands over the session provided as argument to the writer thread
+					 * If the writer thread has not written the previous session yet, it is replaced by this one
+					 */
+					void save(const app::main_window::session::session_state_s & session);
+
+					/**
+					 * @brief Function: void flush()
+					 *
+					 * This function waits for the writer thread to write the sessions handed over to it
+					 */
+					void flush();
+
+					/**
+					 * @brief Function: app::main_window::session::session_state_s snapshot() const
+					 *
+					 * \return the state of the tabs
+					 *
+					 * This function collects the state of the tabs of the window
+					 */
+					app::main_window::session::session_state_s snapshot() const;
+
+					/**
+					 * @brief Function: bool load(app::main_window::session::session_state_s & session) const
+					 *
+					 * \param session: session read from the file
+					 *
+					 * \return true if the session was successfully read, false otherwise
+					 *
+					 * This function reads the session from the file
+					 */
+					bool load(app::main_window::session::session_state_s & session) const;
+
+					/**
+					 * @brief Function: int restore()
+					 *
+					 * \return the number of restored tabs
+					 *
+					 * This function reads the session from the file and restores its tabs
+					 */
+					int restore();
+
+					/**
+					 * @brief Function: int restore(const app::main_window::session::session_state_s & session)
+					 *
+					 * \param session: session to restore
+					 *
+					 * \return the number of restored tabs
+					 *
+					 * This function appends the tabs of the session as placeholders and materializes only the current tab of the session
+					 */
+					int restore(const app::main_window::session::session_state_s & session);
+
+					/**
+					 * @brief Function: static QByteArray serialize(const app::main_window::session::session_state_s & session)
+					 *
+					 * \param session: session to serialize
+					 *
+					 * \return the binary representation of the session
+					 *
+					 * This function converts the session to its binary representation
+					 */
+					static QByteArray serialize(const app::main_window::session::session_state_s & session);
+
+					/**
+					 * @brief Function: static bool deserialize(const QByteArray & data, app::main_window::session::session_state_s & session)
+					 *
+					 * \param data: binary representation of the session
+					 * \param session: decoded session
+					 *
+					 * \return true if the data is a valid session, false otherwise
+					 *
+					 * This function decodes the binary representation of a session
+					 */
+					static bool deserialize(const QByteArray & data, app::main_window::session::session_state_s & session);
+
+					/**
+					 * @brief Function: const QString & getFilename() const
+					 *
+					 * \return the file storing the session
+					 *
+					 * This function returns the file storing the session
+					 */
+					const QString & getFilename() const;
+
+					/**
+					 * @brief Function: std::uint64_t getWrittenSessions() const
+					 *
+					 * \return the number of sessions written to the file
+					 *
+					 * This function returns the number of sessions written to the file
+					 */
+					std::uint64_t getWrittenSessions() const;
+
+				protected:
+
+				private:
+					/**
+					 * @brief tabs whose session is stored
+					 *
+					 */
+					app::main_window::tab::TabWidget * tabs;
+
+					/**
+					 * @brief file storing the session
+					 *
+					 */
+					QString filename;
+
+					/**
+					 * @brief timer delaying snapshots
+					 *
+					 */
+					std::unique_ptr<QTimer> saveTimer;
+
+					/**
+					 * @brief thread writing sessions to the file
+					 *
+					 */
+					std::thread writer;
+
+					/**
+					 * @brief mutex protecting the data shared with the writer thread
+					 *
+					 */
+					mutable std::mutex writerMutex;
+
+					/**
+					 * @brief condition variable to wake up the writer thread
+					 *
+					 */
+					std::condition_variable wakeUp;
+
+					/**
+					 * @brief condition variable notified when the writer thread has written a session
+					 *
+					 */
+					std::condition_variable written;
+
+					/**
+					 * @brief session waiting to be written
+					 *
+					 */
+					QByteArray pendingData;
+
+					/**
+					 * @brief flag stating whether a session is waiting to be written
+					 *
+					 */
+					bool pending;
+
+					/**
+					 * @brief flag stating whether the writer thread is writing a session
+					 *
+					 */
+					bool writing;
+
+					/**
+					 * @brief flag stating whether the writer thread must keep running
+					 *
+					 */
+					bool running;
+
+					/**
+					 * @brief number of sessions written to the file
+					 *
+					 */
+					std::uint64_t writtenSessions;
+
+					/**
+					 * @brief Function: void run()
+					 *
+					 * This function is the body of the writer thread
+					 */
+					void run();
+
+					/**
+					 * @brief Function: void write(const QByteArray & data) const
+					 *
+					 * \param data: binary representation of the session
+					 *
+					 * This function writes the session to a temporary file and renames it to the session file
+					 */
+					void write(const QByteArray & data) const;
+
+					// Move and copy constructor
+					/**
+					 * @brief Disable move and copy constructors and operator= overloading for class Store
+					 *
+					 */
+					DISABLE_COPY_MOVE(Store)
+
+			};
+
+		}
+
+	}
+
+}
+/** @} */ // End of MainWindowGroup group
+
+#endif // MAIN_WINDOW_SESSION_STORE_H
@@ -0,0 +1,218 @@
+#ifndef MAIN_WINDOW_TEXT_CLASSIFIER_H
+#define MAIN_WINDOW_TEXT_CLASSIFIER_H
+/**
+ * @copyright
+ * @file text_classifier.h
+ * @author Andrea Gianarda
+ * @date 10th September 2020
+ * @brief Main Window Text Classifier header file
+*/
+
+#include <list>
+#include <chrono>
+#include <cstdint>
+
+// Qt libraries
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
+#include "app/shared/constructor_macros.h"
+#include "app/utility/cpp/singleton.h"
+
+/** @defgroup MainWindowGroup Main Window Doxygen Group
+ *  Main Window functions and class
+ *  @{
+ */
+namespace app {
+
+	namespace main_window {
+
+		/**
+		 * @brief TextClassifier class
+		 * The classifier remembers whether the most recently classified texts are URLs or files
+		 * Whether a text is a URL only depends on the text whereas whether it is a file depends on the filesystem, therefore the latter is checked again when it is older than the file check timeout
+		 * The classifier must only be used from the GUI thread
+		 *
+		 */
+		class TextClassifier : public app::utility::Singleton<app::main_window::TextClassifier> {
+
+			public:
+				/**
+				 * @brief Function: explicit TextClassifier()
+				 *
+				 * Text classifier constructor
+				 */
+				explicit TextClassifier();
+
+				/**
+				 * @brief Function: virtual ~TextClassifier()
+				 *
+				 * Text classifier destructor
+				 */
+				virtual ~TextClassifier();
+
+				/**
+				 * @brief Function: bool isUrl(const QString & text)
+				 *
+				 * \param text: text to check
+				 *
+				 * \return true if the text is a valid URL, false otherwise
+				 *
+				 * This function check whether input string is a URL and caches the result
+				 */
+				bool isUrl(const QString & text);
+
+				/**
+				 * @brief Function: bool isFile(const QString & text)
+				 *
+				 * \param text: text to check
+				 *
+				 * \return true if the text is an existing file, false otherwise
+				 *
+				 * This function check whether input string is a file and caches the result
+				 */
+				bool isFile(const QString & text);
+
+				/**
+				 * @brief Function: static bool checkUrl(const QString & text)
+				 *
+				 * \param text: text to check
+				 *
+				 * \return true if the text is a valid URL, false otherwise
+				 *
+				 * This function parses the text to check whether it is a URL without looking up the cache
+				 */
+				static bool checkUrl(const QString & text);
+
+				/**
+				 * @brief Function: static bool checkFile(const QString & text)
+				 *
+				 * \param text: text to check
+				 *
+				 * \return true if the text is an existing file, false otherwise
+				 *
+				 * This function queries the filesystem to check whether the text is a file without looking up the cache
+				 */
+				static bool checkFile(const QString & text);
+
+				/**
+				 * @brief Function: void clear()
+				 *
+				 * This function removes all texts from the cache
+				 */
+				void clear();
+
+				/**
+				 * @brief Function: void setFileCheckTimeout(const std::chrono::milliseconds & value)
+				 *
+				 * \param value: time after which a text must be checked again against the filesystem
+				 *
+				 * This function sets the time after which a text must be checked again against the filesystem
+				 */
+				void setFileCheckTimeout(const std::chrono::milliseconds & value);
+
+				/**
+				 * @brief Function: const std::chrono::milliseconds & getFileCheckTimeout() const
+				 *
+				 * \return the time after which a text must be checked again against the filesystem
+				 *
+				 * This function returns the time after which a text must be checked again against the filesystem
+				 */
+				const std::chrono::milliseconds & getFileCheckTimeout() const;
+
+				/**
+				 * @brief Function: std::uint64_t getHits() const
+				 *
+				 * \return the number of lookups served by the cache
+				 *
+				 * This function returns the number of lookups served by the cache
+				 */
+				std::uint64_t getHits() const;
+
+				/**
+				 * @brief Function: std::uint64_t getMisses() const
+				 *
+				 * \return the number of lookups that required to classify the text
+				 *
+				 * This function returns the number of lookups that required to classify the text
+				 */
+				std::uint64_t getMisses() const;
+
+			protected:
+
+			private:
+				/**
+				 * @brief classification of a text
+				 *
+				 */
+				typedef struct classification_t {
+					QString text;                                         /**< classified text */
+					bool url;                                             /**< text is a URL */
+					bool file;                                            /**< text is an existing file */
+					bool fileChecked;                                     /**< filesystem was queried for the text */
+					std::chrono::steady_clock::time_point fileCheckTime;  /**< time the filesystem was queried */
+				} classification_s;
+
+				/**
+				 * @brief maximum number of texts in the cache
+				 *
+				 */
+				static constexpr int capacity = 256;
+
+				/**
+				 * @brief Function: app::main_window::TextClassifier::classification_s & classify(const QString & text)
+				 *
+				 * \param text: text to classify
+				 *
+				 * \return the classification of the text
+				 *
+				 * This function returns the classification of the text from the cache and checks whether the text is a URL if it is not cached
+				 * The filesystem is not queried and the text becomes the most recently used one
+				 */
+				app::main_window::TextClassifier::classification_s & classify(const QString & text);
+
+				/**
+				 * @brief texts ordered from the most to the least recently used
+				 *
+				 */
+				std::list<app::main_window::TextClassifier::classification_s> recentTexts;
+
+				/**
+				 * @brief position of every text in the list of recently used texts
+				 *
+				 */
+				QHash<QString, std::list<app::main_window::TextClassifier::classification_s>::iterator> textPositions;
+
+				/**
+				 * @brief time after which a text must be checked again against the filesystem
+				 *
+				 */
+				std::chrono::milliseconds fileCheckTimeout;
+
+				/**
+				 * @brief number of lookups served by the cache
+				 *
+				 */
+				std::uint64_t hits;
+
+				/**
+				 * @brief number of lookups that required to classify the text
+				 *
+				 */
+				std::uint64_t misses;
+
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class TextClassifier
+				 *
+				 */
+				DISABLE_COPY_MOVE(TextClassifier)
+
+		};
+
+	}
+
+}
+/** @} */ // End of MainWindowGroup group
+
+#endif // MAIN_WINDOW_TEXT_CLASSIFIER_H
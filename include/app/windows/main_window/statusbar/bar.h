@@ -8,9 +8,12 @@
  * @brief Main Window statusbar class header file
 */
 
+#include <map>
 #include <memory>
+#include <cstdint>
 
 // Qt libraries
+#include <QtCore/QTimer>
 #include <QtWidgets/QWidget>
 
 #include "app/shared/constructor_macros.h"
@@ -198,6 +201,24 @@ namespace app {
 					 */
 					void setSearchResultText(const QString & text);
 
+					/**
+					 * Function: std::uint64_t getLabelUpdateCount() const
+					 *
+					 * \return number of times the text of a label changed
+					 *
+					 * This function returns the number of times the text of any label of the status bar changed
+					 */
+					std::uint64_t getLabelUpdateCount() const;
+
+					/**
+					 * Function: std::uint64_t getPaintEventCount() const
+					 *
+					 * \return number of times a label has been painted
+					 *
+					 * This function returns the number of times any label of the status bar has been painted
+					 */
+					std::uint64_t getPaintEventCount() const;
+
 					/**
 					 * @brief Function: virtual void keyPressEvent(QKeyEvent * event) override final
 					 *
@@ -338,6 +359,66 @@ namespace app {
 					 */
 					std::unique_ptr<app::progress_bar::Bar> loadBar;
 
+					/**
+					 * @brief timer applying pending changes to the widgets
+					 * Frequent changes such as scroll and load progress are recorded and applied at most once per frame
+					 *
+					 */
+					std::unique_ptr<QTimer> updateTimer;
+
+					/**
+					 * @brief text of labels not yet applied
+					 *
+					 */
+					std::map<app::elided_label::ElidedLabel *, QString> pendingTexts;
+
+					/**
+					 * @brief load progress not yet applied
+					 *
+					 */
+					int pendingProgressValue;
+
+					/**
+					 * @brief flag stating whether the load progress has changed since the last update
+					 *
+					 */
+					bool progressValueDirty;
+
+					/**
+					 * @brief Function: void setPendingText(app::elided_label::ElidedLabel * label, const QString & text)
+					 *
+					 * \param label: label to change the text of
+					 * \param text: new text of the label
+					 *
+					 * This function records the new text of the label and schedules an update of the status bar
+					 */
+					void setPendingText(app::elided_label::ElidedLabel * label, const QString & text);
+
+					/**
+					 * @brief Function: QString getLabelText(const std::unique_ptr<app::elided_label::ElidedLabel> & label) const
+					 *
+					 * \param label: label to get the text of
+					 *
+					 * \return the text of the label including changes not yet applied
+					 *
+					 * This function returns the text of the label including changes not yet applied
+					 */
+					QString getLabelText(const std::unique_ptr<app::elided_label::ElidedLabel> & label) const;
+
+					/**
+					 * @brief Function: void scheduleUpdate()
+					 *
+					 * This function starts the update timer if it is not already running
+					 */
+					void scheduleUpdate();
+
+					/**
+					 * @brief Function: void applyPendingUpdates()
+					 *
+					 * This function applies all pending changes to the widgets of the status bar and schedules a repaint
+					 */
+					void applyPendingUpdates();
+
 					/**
 					 * @brief Function: std::unique_ptr<app::elided_label::ElidedLabel> newWindowLabel()
 					 *
@@ -0,0 +1,218 @@
+#ifndef MAIN_WINDOW_TAB_DISCARD_MANAGER_H
+#define MAIN_WINDOW_TAB_DISCARD_MANAGER_H
+/**
+ * @copyright
+ * @file discard_manager.h
+ * @author Andrea Gianarda
+ * @date 02nd September 2020
+ * @brief Main Window Tab Discard Manager header file
+*/
+
+#include <list>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+#include <utility>
+
+#include "app/shared/constructor_macros.h"
+
+/** @defgroup MainWindowGroup Main Window Doxygen Group
+ *  Main Window functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace main_window {
+
+		namespace tab {
+
+			class Tab;
+
+			/**
+			 * @brief DiscardManager class
+			 * It keeps track of when tabs were last activated and hibernates the least recently used ones when the number of tabs with web engine objects or the memory of their renderer processes exceed their budget
+			 * The current tab is never hibernated
+			 *
+			 */
+			class DiscardManager final {
+
+				public:
+					/**
+					 * @brief Function: explicit DiscardManager(const int & maxLiveTabs, const std::int64_t & memoryBudget)
+					 *
+					 * \param maxLiveTabs: maximum number of tabs with web engine objects. 0 means no limit
+					 * \param memoryBudget: maximum resident memory in bytes of the renderer processes of live tabs. 0 means no limit
+					 *
+					 * Main Window Tab Discard Manager constructor
+					 */
+					explicit DiscardManager(const int & maxLiveTabs, const std::int64_t & memoryBudget);
+
+					/**
+					 * @brief Function: virtual ~DiscardManager()
+					 *
+					 * Main Window Tab Discard Manager destructor
+					 */
+					virtual ~DiscardManager();
+
+					/**
+					 * @brief Function: void activate(const std::shared_ptr<app::main_window::tab::Tab> & tab)
+					 *
+					 * \param tab: tab activated
+					 *
+					 * This function records the time the tab was activated at and starts tracking it if needed
+					 */
+					void activate(const std::shared_ptr<app::main_window::tab::Tab> & tab);
+
+					/**
+					 * @brief Function: void remove(const std::shared_ptr<app::main_window::tab::Tab> & tab)
+					 *
+					 * \param tab: tab to stop tracking
+					 *
+					 * This function stops tracking a tab
+					 */
+					void remove(const std::shared_ptr<app::main_window::tab::Tab> & tab);
+
+					/**
+					 * @brief Function: void enforceBudget(const std::shared_ptr<app::main_window::tab::Tab> & currentTab)
+					 *
+					 * \param currentTab: current tab
+					 *
+					 * This function hibernates the least recently used tabs until the number of tabs with web engine objects and the memory used by live tabs are within budget
+					 * It stops hibernating tabs for the memory budget as soon as hibernating one does not reduce the memory used, for example because its renderer process is shared with other live tabs
+					 */
+					void enforceBudget(const std::shared_ptr<app::main_window::tab::Tab> & currentTab);
+
+					/**
+					 * @brief Function: int getLiveTabs() const
+					 *
+					 * \return number of tracked tabs with web engine objects
+					 *
+					 * This function returns the number of tracked tabs with web engine objects
+					 */
+					int getLiveTabs() const;
+
+					/**
+					 * @brief Function: void setMaxLiveTabs(const int & value)
+					 *
+					 * \param value: maximum number of tabs with web engine objects. 0 means no limit
+					 *
+					 * This function sets the maximum number of tabs with web engine objects
+					 */
+					void setMaxLiveTabs(const int & value);
+
+					/**
+					 * @brief Function: const int & getMaxLiveTabs() const
+					 *
+					 * \return maximum number of tabs with web engine objects
+					 *
+					 * This function returns the maximum number of tabs with web engine objects
+					 */
+					const int & getMaxLiveTabs() const;
+
+					/**
+					 * @brief Function: void setMemoryBudget(const std::int64_t & value)
+					 *
+					 * \param value: maximum resident memory in bytes of the process and the renderer processes of live tabs. 0 means no limit
+					 *
+					 * This function sets the maximum memory used by the browser
+					 */
+					void setMemoryBudget(const std::int64_t & value);
+
+					/**
+					 * @brief Function: const std::int64_t & getMemoryBudget() const
+					 *
+					 * \return maximum resident memory in bytes of the process and the renderer processes of live tabs
+					 *
+					 * This function returns the maximum memory used by the browser
+					 */
+					const std::int64_t & getMemoryBudget() const;
+
+					/**
+					 * @brief Function: const std::uint64_t & getDiscardedTabs() const
+					 *
+					 * \return number of tabs hibernated since the manager was created
+					 *
+					 * This function returns the number of tabs hibernated since the manager was created
+					 */
+					const std::uint64_t & getDiscardedTabs() const;
+
+				protected:
+
+				private:
+					/**
+					 * @brief tab and time it was last activated at
+					 *
+					 */
+					typedef std::pair<std::weak_ptr<app::main_window::tab::Tab>, std::chrono::steady_clock::time_point> tab_activation_t;
+
+					/**
+					 * @brief maximum number of tabs with web engine objects
+					 *
+					 */
+					int maxLiveTabs;
+
+					/**
+					 * @brief maximum resident memory in bytes of the process and the renderer processes of live tabs
+					 *
+					 */
+					std::int64_t memoryBudget;
+
+					/**
+					 * @brief number of tabs hibernated
+					 *
+					 */
+					std::uint64_t discardedTabs;
+
+					/**
+					 * @brief tracked tabs sorted from the least to the most recently activated
+					 *
+					 */
+					std::list<tab_activation_t> activations;
+
+					/**
+					 * @brief Function: std::shared_ptr<app::main_window::tab::Tab> leastRecentlyUsed(const std::shared_ptr<app::main_window::tab::Tab> & currentTab)
+					 *
+					 * \param currentTab: current tab
+					 *
+					 * \return the least recently activated tab with web engine objects other than the current tab or a nullptr if there is none
+					 *
+					 * This function searches the tab to hibernate and stops tracking tabs that have been destroyed
+					 */
+					std::shared_ptr<app::main_window::tab::Tab> leastRecentlyUsed(const std::shared_ptr<app::main_window::tab::Tab> & currentTab);
+
+					/**
+					 * @brief Function: std::int64_t getUsedMemory() const
+					 *
+					 * \return resident memory in bytes of the renderer processes of live tabs or -1 if it cannot be read
+					 *
+					 * This function returns the memory used by live tabs
+					 * A renderer process shared by several live tabs is accounted for once. The memory of the browser process is not accounted for as it does not depend on the tabs
+					 */
+					std::int64_t getUsedMemory() const;
+
+					/**
+					 * @brief Function: void discard(const std::shared_ptr<app::main_window::tab::Tab> & tab)
+					 *
+					 * \param tab: tab to hibernate
+					 *
+					 * This function hibernates a tab
+					 */
+					void discard(const std::shared_ptr<app::main_window::tab::Tab> & tab);
+
+					// Move and copy constructor
+					/**
+					 * @brief Disable move and copy constructors and operator= overloading for class DiscardManager
+					 *
+					 */
+					DISABLE_COPY_MOVE(DiscardManager)
+
+			};
+
+		}
+
+	}
+
+}
+/** @} */ // End of MainWindowGroup group
+
+#endif // MAIN_WINDOW_TAB_DISCARD_MANAGER_H
@@ -24,6 +24,7 @@ namespace app {
 		namespace tab {
 
 			class WebEnginePage;
+			class Tab;
 
 			/**
 			 * @brief PageData class
@@ -31,6 +32,7 @@ namespace app {
 			 */
 			class PageData final : public app::printable_object::PrintableObject {
 				friend class app::main_window::tab::WebEnginePage;
+				friend class app::main_window::tab::Tab;
 
 				public:
 
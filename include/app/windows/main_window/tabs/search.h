@@ -8,8 +8,14 @@
  * @brief Main Window Tab Search header file
 */
 
+#include <list>
+#include <memory>
+#include <cstddef>
+
 // Qt libraries
 #include <QtCore/QtGlobal>
+#include <QtCore/QHash>
+#include <QtCore/QString>
 
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
 #include <QtWebEngineCore/QWebEngineFindTextResult>
@@ -17,6 +23,7 @@
 
 #include "app/base/tabs/search.h"
 #include "app/windows/main_window/tabs/types.h"
+#include "app/windows/main_window/tabs/text_match_index.h"
 #include "app/shared/enums.h"
 #include "app/shared/constructor_macros.h"
 
@@ -31,6 +38,7 @@ namespace app {
 		namespace tab {
 
 			class Tab;
+			class WebEnginePage;
 			class WebEngineProfile;
 
 			/**
@@ -87,7 +95,53 @@ namespace app {
 					 */
 					virtual void setCallback() override;
 
+					/**
+					 * @brief Function: virtual void search() override
+					 *
+					 * This function searches text in the page
+					 * Matches in TEXT pages are looked up in an index of the file whereas other pages are searched by the web engine
+					 */
+					virtual void search() override;
+
 				private:
+					/**
+					 * @brief maximum number of indexes of matches in the text file kept by the search
+					 *
+					 */
+					static constexpr std::size_t textIndexCapacity = 8;
+
+					/**
+					 * @brief indexes of matches in the text file ordered from the most to the least recently used
+					 *
+					 */
+					std::list<app::main_window::tab::TextMatchIndex> textIndexes;
+
+					/**
+					 * @brief last result of the web engine for every query since the page was last loaded
+					 * Only queries with no match are answered from it because moving to another match requires the web engine to highlight it
+					 *
+					 */
+					QHash<QString, app::main_window::tab::search_data_s> webResults;
+
+					/**
+					 * @brief Function: void searchTextFile(const std::shared_ptr<app::main_window::tab::WebEnginePage> & page)
+					 *
+					 * \param page: TEXT page to search
+					 *
+					 * This function moves to the next or previous match in the text file building the index of the matches if it is a new query
+					 */
+					void searchTextFile(const std::shared_ptr<app::main_window::tab::WebEnginePage> & page);
+
+					/**
+					 * @brief Function: QString getQueryKey() const
+					 *
+					 * \return the key identifying the query in the results of the web engine
+					 *
+					 * This function returns the key identifying the current query in the results of the web engine
+					 * Queries differing only by the full word setting share the same key as the web engine does not support it
+					 */
+					QString getQueryKey() const;
+
 					/**
 					 * @brief Function: void connectSignals()
 					 *
@@ -8,7 +8,12 @@
  * @brief Main Window Tab header file
 */
 
+#include <memory>
+
 // Qt libraries
+#include <QtCore/QPointF>
+#include <QtCore/QByteArray>
+#include <QtCore/QUrl>
 #include <QtWidgets/QWidget>
 
 #include "app/base/tabs/tab.h"
@@ -16,6 +21,7 @@
 #include "app/shared/constructor_macros.h"
 #include "app/windows/main_window/tabs/types.h"
 #include "app/windows/main_window/shared/shared_types.h"
+#include "app/windows/shared/find_settings.h"
 
 /** @defgroup MainWindowGroup Main Window Doxygen Group
  *  Main Window functions and classes
@@ -28,6 +34,7 @@ namespace app {
 		namespace tab {
 
 			class TabWidget;
+			class PageData;
 			class WebEngineView;
 			class WebEnginePage;
 			class WebEngineSettings;
@@ -104,10 +111,39 @@ namespace app {
 					 *
 					 * \return the vertical position of the scrollbar
 					 *
-					 * This function returns the vertical position of the scrollbar
+					 * This function returns the vertical position of the scrollbar, regardless of whether the tab is a placeholder or not
 					 */
 					int getVerticalScrollPercentage() const;
 
+					/**
+					 * @brief Function: const QString getCurrentSource() const
+					 *
+					 * \return the source the tab has to be reopened with
+					 *
+					 * This function returns the URL web pages navigated to or the source of the page for any other page type
+					 */
+					const QString getCurrentSource() const;
+
+					/**
+					 * @brief Function: QByteArray getHistoryData() const
+					 *
+					 * \return the serialized history of the tab
+					 *
+					 * This function returns the history of the tab serialized through a QDataStream, regardless of whether the tab is a placeholder or not
+					 * The array is empty if the tab has no history to restore
+					 */
+					QByteArray getHistoryData() const;
+
+					/**
+					 * @brief Function: void setRestoredState(const QByteArray & history, const int & verticalScrollPercentage)
+					 *
+					 * \param history: serialized history of the tab
+					 * \param verticalScrollPercentage: vertical position of the scrollbar
+					 *
+					 * This function sets the history and the scroll position a placeholder tab is restored with when it is materialized
+					 */
+					void setRestoredState(const QByteArray & history, const int & verticalScrollPercentage);
+
 					/**
 					 * @brief Function: void configure(const std::shared_ptr<app::base::tab::TabBar> & tabBar, const app::main_window::page_type_e & type, const QString & src, const void * data)
 					 *
@@ -120,6 +156,63 @@ namespace app {
 					 */
 					void configure(const std::shared_ptr<app::base::tab::TabBar> & tabBar, const app::main_window::page_type_e & type, const QString & src, const void * data);
 
+					/**
+					 * @brief Function: void configurePlaceholder(const std::shared_ptr<app::base::tab::TabBar> & tabBar, const app::main_window::page_type_e & type, const QString & src, const void * data)
+					 *
+					 * \param type: tab type
+					 * \param src: source of the tab
+					 * \param data: tab extra data
+					 * \param tabBar: tab bar
+					 *
+					 * This function configures the main window tab as a placeholder
+					 * Only the page data is stored and web engine objects are created when the tab is materialized
+					 */
+					void configurePlaceholder(const std::shared_ptr<app::base::tab::TabBar> & tabBar, const app::main_window::page_type_e & type, const QString & src, const void * data);
+
+					/**
+					 * @brief Function: bool isPlaceholder() const
+					 *
+					 * \return true if the web engine objects of the tab have not been created yet
+					 *
+					 * This function returns whether the tab is a placeholder
+					 */
+					bool isPlaceholder() const;
+
+					/**
+					 * @brief Function: void materialize()
+					 *
+					 * This function creates the web engine objects of a placeholder tab using the page data it stores
+					 * The page data is loaded while the objects are created therefore no further navigation is needed. A hibernated tab loads the page data only if it differs from the current item of its restored history
+					 * It does nothing if the tab is not a placeholder
+					 */
+					void materialize();
+
+					/**
+					 * @brief Function: void hibernate()
+					 *
+					 * This function destroys the web engine objects of the tab and turns it back into a placeholder
+					 * The source of the page, the scroll position, the history and the find settings are kept in order to restore them when the tab is materialized
+					 */
+					void hibernate();
+
+					/**
+					 * @brief Function: const app::windows::shared::FindSettings getFindSettings() const
+					 *
+					 * \return settings of the last search in the tab
+					 *
+					 * This function returns the settings of the last search in the tab, regardless of whether the tab is hibernated or not
+					 */
+					const app::windows::shared::FindSettings getFindSettings() const;
+
+					/**
+					 * @brief Function: const std::shared_ptr<app::main_window::tab::PageData> getPageData() const
+					 *
+					 * \return data of the page
+					 *
+					 * This function returns the data of the page, regardless of whether the tab is a placeholder or not
+					 */
+					const std::shared_ptr<app::main_window::tab::PageData> getPageData() const;
+
 					/**
 					 * @brief Function: virtual void keyReleaseEvent(QKeyEvent * event) override final
 					 *
@@ -176,6 +269,15 @@ namespace app {
 					 */
 					void findTextFinished(const bool & found);
 
+					/**
+					 * @brief Function: void backgroundTabRequested(const QUrl & url)
+					 *
+					 * \param url: url to open
+					 *
+					 * This signal notifies that the page requested to open a link in a background tab
+					 */
+					void backgroundTabRequested(const QUrl & url);
+
 				protected:
 
 				private:
@@ -185,6 +287,67 @@ namespace app {
 					 */
 					QString searchText;
 
+					/**
+					 * @brief tab bar the tab is configured with
+					 *
+					 */
+					std::shared_ptr<app::base::tab::TabBar> bar;
+
+					/**
+					 * @brief data of the page while the tab is a placeholder
+					 * It is a nullptr once web engine objects have been created
+					 *
+					 */
+					std::shared_ptr<app::main_window::tab::PageData> placeholderData;
+
+					/**
+					 * @brief history of a hibernated tab
+					 * It is empty if the tab has never been hibernated or if its history has already been restored
+					 *
+					 */
+					QByteArray hibernatedHistory;
+
+					/**
+					 * @brief scroll position of a hibernated tab
+					 *
+					 */
+					QPointF hibernatedScrollPosition;
+
+					/**
+					 * @brief vertical scroll percentage of a hibernated or restored tab
+					 *
+					 */
+					int hibernatedScrollPercentage;
+
+					/**
+					 * @brief find settings of a hibernated tab
+					 * It is a nullptr if there is no find settings to restore
+					 *
+					 */
+					std::unique_ptr<app::windows::shared::FindSettings> hibernatedFindSettings;
+
+					/**
+					 * @brief flag stating whether the scroll position has to be restored when the page finishes loading
+					 *
+					 */
+					bool restoreScrollPosition;
+
+					/**
+					 * @brief flag stating whether the vertical scroll percentage has to be restored when the page finishes loading
+					 * It is used by tabs restored from a session as the size of the window may have changed since the session was saved
+					 *
+					 */
+					bool restoreScrollPercentage;
+
+					/**
+					 * @brief Function: void setPlaceholderData(const std::shared_ptr<app::main_window::tab::PageData> & value)
+					 *
+					 * \param value: data of the page
+					 *
+					 * This function sets the data of the page while the tab is a placeholder
+					 */
+					void setPlaceholderData(const std::shared_ptr<app::main_window::tab::PageData> & value);
+
 					/**
 					 * @brief Function: void connectSignals() override
 					 *
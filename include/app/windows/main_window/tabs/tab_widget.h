@@ -9,8 +9,10 @@
 */
 
 #include <list>
+#include <memory>
 
 // Qt libraries
+#include <QtCore/QByteArray>
 #include <QtWidgets/QWidget>
 
 #include "app/windows/main_window/shared/shared_types.h"
@@ -42,6 +44,7 @@ namespace app {
 			class WebEnginePage;
 			class PageData;
 			class Tab;
+			class DiscardManager;
 
 			/**
 			 * @brief TabWidget class
@@ -259,6 +262,71 @@ namespace app {
 					 */
 					void goToHistoryItem(const int & index, const app::main_window::navigation_type_e & direction);
 
+					/**
+					 * @brief Function: int openTabInBackground(const app::main_window::page_type_e & type, const QString & userInput, const void * data = nullptr)
+					 *
+					 * \param type: type of the tab page
+					 * \param userInput: search keywords or path of the file to print
+					 * \param data: extra data to be passed through
+					 *
+					 * \return tab index
+					 *
+					 * This function appends a tab without moving to it
+					 * If lazy tabs are enabled, the tab is a placeholder until it becomes the current tab or a command targets it
+					 */
+					int openTabInBackground(const app::main_window::page_type_e & type, const QString & userInput, const void * data = nullptr);
+
+					/**
+					 * @brief Function: int restoreTab(const app::main_window::page_type_e & type, const QString & source, const QByteArray & history, const int & verticalScrollPercentage)
+					 *
+					 * \param type: type of the tab page
+					 * \param source: source of the page
+					 * \param history: serialized history of the tab
+					 * \param verticalScrollPercentage: vertical position of the scrollbar
+					 *
+					 * \return tab index
+					 *
+					 * This function appends a placeholder tab restored from a session in the same way as tabs opened in the background without notifying any listener
+					 * Function restoreCurrentTab must be called once all tabs of the session have been restored
+					 */
+					int restoreTab(const app::main_window::page_type_e & type, const QString & source, const QByteArray & history, const int & verticalScrollPercentage);
+
+					/**
+					 * @brief Function: void restoreCurrentTab(const int & index)
+					 *
+					 * \param index: index of the tab to move to
+					 *
+					 * This function moves to the tab at the index provided as argument and materializes it once tabs have been restored from a session
+					 */
+					void restoreCurrentTab(const int & index);
+
+					/**
+					 * @brief Function: void setLazyTabs(const bool & value)
+					 *
+					 * \param value: whether tabs opened in the background are placeholders
+					 *
+					 * This function sets whether web engine objects of tabs opened in the background are created only when needed
+					 */
+					void setLazyTabs(const bool & value);
+
+					/**
+					 * @brief Function: const bool & isLazyTabs() const
+					 *
+					 * \return true if tabs opened in the background are placeholders
+					 *
+					 * This function returns whether web engine objects of tabs opened in the background are created only when needed
+					 */
+					const bool & isLazyTabs() const;
+
+					/**
+					 * @brief Function: const std::unique_ptr<app::main_window::tab::DiscardManager> & getDiscardManager() const
+					 *
+					 * \return manager hibernating least recently used tabs
+					 *
+					 * This function returns the manager hibernating least recently used tabs
+					 */
+					const std::unique_ptr<app::main_window::tab::DiscardManager> & getDiscardManager() const;
+
 				public slots:
 					/**
 					 * @brief Function: void openFileInCurrentTab(const QString & filepath, const void * data)
@@ -395,6 +463,42 @@ namespace app {
 					 */
 					QMetaObject::Connection tabHistoryItemChangedConnection;
 
+					/**
+					 * @brief create web engine objects of tabs opened in the background only when needed
+					 *
+					 */
+					bool lazyTabs;
+
+					/**
+					 * @brief manager hibernating least recently used tabs
+					 *
+					 */
+					std::unique_ptr<app::main_window::tab::DiscardManager> discardManager;
+
+					/**
+					 * @brief Function: std::shared_ptr<app::main_window::tab::Tab> materializeTab(const int & index)
+					 *
+					 * \param index: index of the tab
+					 *
+					 * \return tab at the given index
+					 *
+					 * This function creates the web engine objects of the tab at the given index if it is a placeholder
+					 */
+					std::shared_ptr<app::main_window::tab::Tab> materializeTab(const int & index);
+
+					/**
+					 * @brief Function: int insertBackgroundTab(const std::shared_ptr<app::main_window::tab::Tab> & tab, const QString & label)
+					 *
+					 * \param tab: tab to append
+					 * \param label: label of the tab
+					 *
+					 * \return tab index
+					 *
+					 * This function appends a tab without moving to it and starts tracking it in the discard manager
+					 * If it is the first tab, it becomes the current one without notifying any listener
+					 */
+					int insertBackgroundTab(const std::shared_ptr<app::main_window::tab::Tab> & tab, const QString & label);
+
 					/**
 					 * @brief Function: void disconnectTab(const int & index)
 					 *
@@ -524,6 +628,24 @@ namespace app {
 					 */
 					void processHistoryItemChanged(const app::shared::element_position_e & position);
 
+					/**
+					 * @brief Function: void processCurrentChanged(const int & index)
+					 *
+					 * \param index: index of the current tab
+					 *
+					 * This function is a slot that receives a notification that the current tab changed and materializes it if it is a placeholder
+					 */
+					void processCurrentChanged(const int & index);
+
+					/**
+					 * @brief Function: void processBackgroundTabRequest(const QUrl & url)
+					 *
+					 * \param url: url to open
+					 *
+					 * This function is a slot that receives a request from a page to open a link in a background tab
+					 */
+					void processBackgroundTabRequest(const QUrl & url);
+
 			};
 
 		}
@@ -0,0 +1,210 @@
+#ifndef MAIN_WINDOW_TEXT_MATCH_INDEX_H
+#define MAIN_WINDOW_TEXT_MATCH_INDEX_H
+/**
+ * @copyright
+ * @file text_match_index.h
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Main Window Text Match Index header file
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <string_view>
+
+// Qt libraries
+#include <QtCore/QString>
+
+#include "app/shared/enums.h"
+#include "app/shared/constructor_macros.h"
+#include "app/utility/cpp/mapped_file.h"
+
+/** @defgroup MainWindowGroup Main Window Doxygen Group
+ *  Main Window functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace main_window {
+
+		namespace tab {
+
+			/**
+			 * @brief TextMatchIndex class
+			 * The index stores the offset of every match of a text in a file so that moving to the next or previous match does not require to search the file again
+			 * Texts are compared byte by byte in UTF-8 therefore case insensitive searches only fold the case of ASCII letters
+			 *
+			 */
+			class TextMatchIndex final {
+
+				public:
+					/**
+					 * @brief Function: explicit TextMatchIndex(const std::shared_ptr<app::utility::MappedFile> & textFile, const QString & searchedText, const bool & caseSensitiveSearch, const bool & fullWordSearch)
+					 *
+					 * \param textFile: file to search
+					 * \param searchedText: text to search
+					 * \param caseSensitiveSearch: whether the case of letters must match
+					 * \param fullWordSearch: whether matches must be full words
+					 *
+					 * Main window text match index constructor
+					 * It searches all matches of the text in the file
+					 */
+					explicit TextMatchIndex(const std::shared_ptr<app::utility::MappedFile> & textFile, const QString & searchedText, const bool & caseSensitiveSearch, const bool & fullWordSearch);
+
+					/**
+					 * @brief Function: virtual ~TextMatchIndex()
+					 *
+					 * Main window text match index destructor
+					 */
+					virtual ~TextMatchIndex();
+
+					/**
+					 * @brief Function: bool isQuery(const std::shared_ptr<app::utility::MappedFile> & textFile, const QString & searchedText, const bool & caseSensitiveSearch, const bool & fullWordSearch) const
+					 *
+					 * \param textFile: file to search
+					 * \param searchedText: text to search
+					 * \param caseSensitiveSearch: whether the case of letters must match
+					 * \param fullWordSearch: whether matches must be full words
+					 *
+					 * \return true if the index holds the matches of the query, false otherwise
+					 *
+					 * This function checks whether the index was built for the query provided as argument
+					 */
+					bool isQuery(const std::shared_ptr<app::utility::MappedFile> & textFile, const QString & searchedText, const bool & caseSensitiveSearch, const bool & fullWordSearch) const;
+
+					/**
+					 * @brief Function: int step(const app::shared::offset_type_e & direction)
+					 *
+					 * \param direction: DOWN to move to the next match and UP to move to the previous one
+					 *
+					 * \return the index of the active match or -1 if there is no match
+					 *
+					 * This function moves the active match wrapping around at both ends of the file
+					 */
+					int step(const app::shared::offset_type_e & direction);
+
+					/**
+					 * @brief Function: int getActiveMatch() const
+					 *
+					 * \return the index of the active match or -1 if no match is active
+					 *
+					 * This function returns the index of the active match
+					 */
+					int getActiveMatch() const;
+
+					/**
+					 * @brief Function: int getNumberOfMatches() const
+					 *
+					 * \return the number of matches
+					 *
+					 * This function returns the number of matches
+					 */
+					int getNumberOfMatches() const;
+
+					/**
+					 * @brief Function: std::size_t getActiveOffset() const
+					 *
+					 * \return the offset of the active match in the file
+					 *
+					 * This function returns the offset in bytes of the active match in the file
+					 * It throws an exception if no match is active
+					 */
+					std::size_t getActiveOffset() const;
+
+					/**
+					 * @brief Function: std::size_t getMatchLength() const
+					 *
+					 * \return the length of a match
+					 *
+					 * This function returns the length in bytes of every match
+					 */
+					std::size_t getMatchLength() const;
+
+					/**
+					 * @brief Function: const std::vector<std::size_t> & getOffsets() const
+					 *
+					 * \return the offsets of the matches
+					 *
+					 * This function returns the offsets in bytes of the matches sorted in increasing order
+					 */
+					const std::vector<std::size_t> & getOffsets() const;
+
+					/**
+					 * @brief Function: static std::vector<std::size_t> findMatches(const std::string_view & content, const std::string & pattern, const bool & caseSensitive, const bool & matchFullWord)
+					 *
+					 * \param content: content to search
+					 * \param pattern: UTF-8 text to search
+					 * \param caseSensitive: whether the case of letters must match
+					 * \param matchFullWord: whether matches must be full words
+					 *
+					 * \return the offsets of the matches sorted in increasing order
+					 *
+					 * This function searches all non overlapping matches of the pattern in the content
+					 * Candidates are located by looking for the first byte of the pattern with memchr which is vectorized by the C library
+					 */
+					static std::vector<std::size_t> findMatches(const std::string_view & content, const std::string & pattern, const bool & caseSensitive, const bool & matchFullWord);
+
+				protected:
+
+				private:
+					/**
+					 * @brief file searched
+					 *
+					 */
+					std::weak_ptr<app::utility::MappedFile> file;
+
+					/**
+					 * @brief text searched
+					 *
+					 */
+					QString text;
+
+					/**
+					 * @brief whether the case of letters must match
+					 *
+					 */
+					bool caseSensitive;
+
+					/**
+					 * @brief whether matches must be full words
+					 *
+					 */
+					bool matchFullWord;
+
+					/**
+					 * @brief length in bytes of a match
+					 *
+					 */
+					std::size_t matchLength;
+
+					/**
+					 * @brief offsets of the matches
+					 *
+					 */
+					std::vector<std::size_t> offsets;
+
+					/**
+					 * @brief index of the active match
+					 *
+					 */
+					int activeMatch;
+
+					// Move and copy constructor
+					/**
+					 * @brief Disable move and copy constructors and operator= overloading for class TextMatchIndex
+					 *
+					 */
+					DISABLE_COPY_MOVE(TextMatchIndex)
+
+			};
+
+		}
+
+	}
+
+}
+/** @} */ // End of MainWindowGroup group
+
+#endif // MAIN_WINDOW_TEXT_MATCH_INDEX_H
@@ -8,6 +8,8 @@
  * @brief Main Window Tab Types header file
 */
 
+#include <cstddef>
+
 /** @defgroup MainWindowGroup Main Window Doxygen Group
  *  Main Window functions and classes
  *  @{
@@ -23,10 +25,22 @@ namespace app {
 			 *
 			 */
 			typedef struct search_data_t {
-				const int activeMatch;       /**< active match */
-				const int numberOfMatches;   /**< total number of matches */
+				int activeMatch;       /**< active match */
+				int numberOfMatches;   /**< total number of matches */
 			} search_data_s;
 
+			/**
+			 * @brief portion of a text file rendered in the page
+			 *
+			 */
+			typedef struct text_window_t {
+				std::size_t begin;           /**< offset of the first byte of the window in the file */
+				std::size_t end;             /**< offset following the last byte of the window in the file */
+				int top;                     /**< vertical position in pixels of the top of the window in the page */
+				int bottom;                  /**< vertical position in pixels of the bottom of the window in the page */
+				int pageHeight;              /**< height in pixels of the whole page */
+			} text_window_s;
+
 		}
 
 	}
@@ -8,8 +8,17 @@
  * @brief Main Window Web Engine Page header file
 */
 
+#include <memory>
+#include <cstdint>
+
+// Qt libraries
+#include <QtCore/QPointF>
+#include <QtCore/QUrl>
+
 #include "app/base/tabs/web_engine_page.h"
+#include "app/utility/cpp/mapped_file.h"
 #include "app/windows/main_window/shared/shared_types.h"
+#include "app/windows/main_window/tabs/types.h"
 #include "app/windows/main_window/tabs/web_engine_profile.h"
 #include "app/shared/enums.h"
 #include "app/shared/constructor_macros.h"
@@ -52,7 +61,7 @@ namespace app {
 					 *
 					 * Main window web engine page constructor
 					 */
-					explicit WebEnginePage(QWidget * parent, const app::main_window::page_type_e & type = app::main_window::page_type_e::UNKNOWN, const QString & src = QString(), app::main_window::tab::WebEngineProfile * profile = app::main_window::tab::WebEngineProfile::defaultProfile(), const void * data = nullptr);
+					explicit WebEnginePage(QWidget * parent, const app::main_window::page_type_e & type = app::main_window::page_type_e::UNKNOWN, const QString & src = QString(), app::base::tab::WebEngineProfile * profile = app::main_window::tab::WebEngineProfile::defaultProfile(), const void * data = nullptr);
 
 					/**
 					 * @brief Function: virtual ~WebEnginePage()
@@ -97,6 +106,34 @@ namespace app {
 					 */
 					const QString getSource() const;
 
+					/**
+					 * @brief Function: const std::uint64_t & getScrollRequestCount() const
+					 *
+					 * \return number of scroll requests applied to the page
+					 *
+					 * This function returns the number of scroll requests applied to the page, i.e. the number of scripts run to scroll it
+					 */
+					const std::uint64_t & getScrollRequestCount() const;
+
+					/**
+					 * @brief Function: const std::shared_ptr<app::utility::MappedFile> & getTextFile() const
+					 *
+					 * \return file set as source of the page
+					 *
+					 * This function returns the file set as source of the page or a nullptr if the page is not a TEXT page
+					 */
+					const std::shared_ptr<app::utility::MappedFile> & getTextFile() const;
+
+					/**
+					 * @brief Function: void showTextMatch(const std::size_t & offset, const std::size_t & length)
+					 *
+					 * \param offset: offset in bytes of the match in the text file
+					 * \param length: length in bytes of the match
+					 *
+					 * This function renders the portion of the text file around the match if needed, selects the match and scrolls it into view
+					 */
+					void showTextMatch(const std::size_t & offset, const std::size_t & length);
+
 				signals:
 					/**
 					 * @brief Function: void sourceChanged(const QString & src)
@@ -107,7 +144,26 @@ namespace app {
 					 */
 					void sourceChanged(const QString & src);
 
+					/**
+					 * @brief Function: void backgroundTabRequested(const QUrl & url)
+					 *
+					 * \param url: url to open
+					 *
+					 * This signal notifies that the user requested to open a link in a background tab
+					 */
+					void backgroundTabRequested(const QUrl & url);
+
 				protected:
+					/**
+					 * @brief Function: virtual QWebEnginePage * createWindow(QWebEnginePage::WebWindowType type) override
+					 *
+					 * \param type: type of window requested
+					 *
+					 * \return page the web engine loads the requested URL into
+					 *
+					 * This function catches links opened in a background tab: the URL is forwarded through signal backgroundTabRequested as tabs are owned by the tab widget
+					 */
+					virtual QWebEnginePage * createWindow(QWebEnginePage::WebWindowType type) override;
 
 				private slots:
 					/**
@@ -120,6 +176,15 @@ namespace app {
 					 */
 					void applyScrollRequest(const int & x, const int & y);
 
+					/**
+					 * @brief Function: void updateTextWindow(const QPointF & position)
+					 *
+					 * \param position: new scroll position
+					 *
+					 * This function renders a new portion of the text file if the viewport moves close to the edges of the portion currently rendered
+					 */
+					void updateTextWindow(const QPointF & position);
+
 				private:
 					/**
 					 * @brief custom page data
@@ -128,13 +193,60 @@ namespace app {
 					std::shared_ptr<app::main_window::tab::PageData> pageData;
 
 					/**
-					 * @brief Function: QByteArray getTextFileBody() const
+					 * @brief file set as source of the page
+					 * It is only set for TEXT pages
+					 *
+					 */
+					std::shared_ptr<app::utility::MappedFile> textFile;
+
+					/**
+					 * @brief portion of the text file currently rendered in the page
+					 * It is only relevant if the text file is too big to be rendered at once
+					 *
+					 */
+					app::main_window::tab::text_window_s textWindow;
+
+					/**
+					 * @brief number of scroll requests applied to the page
+					 *
+					 */
+					std::uint64_t scrollRequestCount;
+
+					/**
+					 * @brief Function: void setTextFileBody()
+					 *
+					 * This function maps the file set as source of the page in memory and renders it
+					 * Small files are printed as plain text whereas only the portion of large files close to the viewport is pushed into the page
+					 */
+					void setTextFileBody();
+
+					/**
+					 * @brief Function: bool isTextWindowed() const
+					 *
+					 * \return true if only a portion of the text file is rendered in the page
+					 *
+					 * This function returns whether only a portion of the text file is rendered in the page
+					 */
+					bool isTextWindowed() const;
+
+					/**
+					 * @brief Function: void moveTextWindow(const std::size_t & offset, const int & position)
+					 *
+					 * \param offset: offset in the file of the line to show at the vertical position provided as argument
+					 * \param position: vertical position in pixels
+					 *
+					 * This function computes the portion of the text file around the offset provided as argument
+					 */
+					void moveTextWindow(const std::size_t & offset, const int & position);
+
+					/**
+					 * @brief Function: QString getTextWindowContent() const
 					 *
-					 * \return content of the file set as sounce of the page
+					 * \return content of the text window
 					 *
-					 * This function reads a file set as sounce of the page and returns its content as a QByteArray
+					 * This function returns the content of the text file within the current text window
 					 */
-					QByteArray getTextFileBody() const;
+					QString getTextWindowContent() const;
 
 					/**
 					 * @brief Function: void setBody()
@@ -30,13 +30,14 @@ namespace app {
 
 				public:
 					/**
-					 * @brief Function: static app::main_window::tab::WebEngineProfile * defaultProfile()
+					 * @brief Function: static app::base::tab::WebEngineProfile * defaultProfile()
 					 *
 					 * \return the default profile
 					 *
-					 * this function constructs the default web engine profile
+					 * this function returns the default web engine profile shared by all pages
+					 * Only one profile is created for the storage configured in the browser settings as two profiles cannot use the same storage at the same time
 					 */
-					static app::main_window::tab::WebEngineProfile * defaultProfile();
+					static app::base::tab::WebEngineProfile * defaultProfile();
 
 					/**
 					 * @brief Function: explicit WebEngineProfile(const QString & storageName, QObject * parent)
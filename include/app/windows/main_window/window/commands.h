@@ -8,7 +8,13 @@
  * @brief Main window commands header file 
  */
 
+// Qt libraries
+#include <QtCore/QString>
+
+#include <vector>
+
 #include "app/shared/constructor_macros.h"
+#include "app/widgets/commands/key_trie.h"
 #include "app/windows/main_window/json/action.h"
 
 /** @defgroup MainWindowGroup Main Window Doxygen Group
@@ -23,6 +29,7 @@ namespace app {
 
 			/**
 			 * @brief Commands class
+			 * Commands typed by the user are looked up through the index of long commands of the JSON action
 			 *
 			 */
 			class Commands : public app::main_window::json::Action::Action {
@@ -85,9 +92,60 @@ namespace app {
 					 */
 					void clear();
 
+					/**
+					 * @brief Function: QString findClosestCommand(const QString & name) const
+					 *
+					 * \param name: long command to search
+					 *
+					 * \return the long command closest to the one provided as argument or an empty string if no command is close enough
+					 *
+					 * This function searches the long command that is the fewest edits away from the one provided as argument
+					 * It is meant to suggest a command when the user mistypes one therefore it walks through all commands
+					 */
+					QString findClosestCommand(const QString & name) const;
+
+					/**
+					 * @brief Function: app::commands::KeyTrie & getShortcutTrie()
+					 *
+					 * \return the trie of the shortcuts of the commands
+					 *
+					 * This function returns the trie of the shortcuts of the commands
+					 * Values of exact matches can be converted to commands using getShortcutCommand
+					 */
+					app::commands::KeyTrie & getShortcutTrie();
+
+					/**
+					 * @brief Function: const app::main_window::json::Data * getShortcutCommand(const int & value) const
+					 *
+					 * \param value: value of an exact match of the shortcut trie
+					 *
+					 * \return the command bound to the value or nullptr if the value is not bound to any command
+					 *
+					 * This function returns the command bound to a value of the shortcut trie
+					 */
+					const app::main_window::json::Data * getShortcutCommand(const int & value) const;
+
 				protected:
 
 				private:
+					/**
+					 * @brief trie of the shortcuts of the commands
+					 *
+					 */
+					app::commands::KeyTrie shortcutTrie;
+
+					/**
+					 * @brief commands bound to the values of the shortcut trie
+					 *
+					 */
+					std::vector<const app::main_window::json::Data *> shortcutCommands;
+
+					/**
+					 * @brief Function: void buildShortcutTrie()
+					 *
+					 * This function fills the shortcut trie with the commands read from the JSON files and sets its timeout to the chord timeout of the settings
+					 */
+					void buildShortcutTrie();
 
 					// Move and copy constructor
 					/**
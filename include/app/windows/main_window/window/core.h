@@ -47,6 +47,12 @@ namespace app {
 
 		}
 
+		namespace session {
+
+			class Store;
+
+		}
+
 		namespace popup {
 
 			class PopupContainer;
@@ -66,13 +72,14 @@ namespace app {
 				public:
 
 					/**
-					 * @brief Function: explicit Core()
+					 * @brief Function: explicit Core(QWidget * parent, const QString & sessionFile)
 					 *
 					 * \param parent: parent widget
+					 * \param sessionFile: file the tabs of the window are saved to and restored from. An empty string disables sessions
 					 *
 					 * Main window core constructor
 					 */
-					explicit Core(QWidget * parent);
+					explicit Core(QWidget * parent, const QString & sessionFile);
 
 					// Move constructor
 					/**
@@ -239,6 +246,12 @@ namespace app {
 					 */
 					std::unique_ptr<app::main_window::window::Commands> commands;
 
+					/**
+					 * @brief Session of the tabs
+					 *
+					 */
+					std::unique_ptr<app::main_window::session::Store> session;
+
 				private:
 
 					/**
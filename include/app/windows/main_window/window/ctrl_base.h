@@ -26,6 +26,7 @@ namespace app {
 		namespace json {
 
 			class Action;
+			class Data;
 
 		}
 
@@ -78,18 +79,32 @@ namespace app {
 					 */
 					virtual void keyReleaseEvent(QKeyEvent * event) override final;
 
+					/**
+					 * @brief Function: const app::main_window::json::Data * findCommand(const QString & userCommand, QString & arguments) const
+					 *
+					 * \param userCommand: command typed by the user. It may be followed by its arguments
+					 * \param arguments: arguments following the command in the user input
+					 *
+					 * \return the command whose long command is the first word of the user input or nullptr if no match
+					 *
+					 * This function splits the user input at the first space and looks the command up among the long commands of the window
+					 * If no command matches the user input, the closest one is suggested in the logs
+					 */
+					const app::main_window::json::Data * findCommand(const QString & userCommand, QString & arguments) const;
+
 				signals:
 
 					/**
-					 * @brief Function: void windowStateChangeRequested(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key = Qt::Key_unknown)
+					 * @brief Function: void windowStateChangeRequested(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key = Qt::Key_unknown, const QString & argument = QString())
 					 *
 					 * \param nextState: state the window is requested to go into.
 					 * \param postprocess: flag to execute post process after chaning state.
 					 * \param key: key pressed that supports the request for a state change.
+					 * \param argument: argument typed by the user after the command.
 					 *
 					 * This function is a signal to request a change of the state of window
 					 */
-					void windowStateChangeRequested(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key = Qt::Key_unknown);
+					void windowStateChangeRequested(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key = Qt::Key_unknown, const QString & argument = QString());
 
 					/**
 					 * @brief Function: void saveCurrentState()
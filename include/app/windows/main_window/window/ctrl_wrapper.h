@@ -111,6 +111,49 @@ namespace app {
 					 */
 					const app::main_window::window::ctrl_data_s & getSavedData() const;
 
+					/**
+					 * @brief Function: const app::main_window::json::Data * findCommand(const QString & userCommand, QString & arguments) const
+					 *
+					 * \param userCommand: command typed by the user. It may be followed by its arguments
+					 * \param arguments: arguments following the command in the user input
+					 *
+					 * \return the command matching the user input or nullptr if no match
+					 *
+					 * This function returns the command the window would execute if the user typed the text provided as argument
+					 */
+					const app::main_window::json::Data * findCommand(const QString & userCommand, QString & arguments) const;
+
+					/**
+					 * @brief Function: void setAllShortcutEnabledProperty(const bool enabled)
+					 *
+					 * \param enabled: value of enabled property
+					 *
+					 * This function sets the enabled property of all shortcuts of the main window and menus of the main window
+					 * Shortcuts are toggled only if their enabled property differs from the requested one
+					 */
+					void setAllShortcutEnabledProperty(const bool enabled);
+
+					/**
+					 * @brief Function: const bool & getShortcutEnabledProperty() const
+					 *
+					 * \return value of the enabled property of the shortcuts
+					 *
+					 * This function returns whether the shortcuts of the commands of the main window are dispatched
+					 */
+					const bool & getShortcutEnabledProperty() const;
+
+					/**
+					 * @brief Function: virtual bool eventFilter(QObject * watched, QEvent * event) override
+					 *
+					 * \param watched: object receiving the event
+					 * \param event: event sent to the object
+					 *
+					 * \return true if the event is a key of a shortcut and it must not reach the object
+					 *
+					 * This function feeds the keys pressed in the main window to the shortcut trie and executes the command bound to the shortcut when the trie reports an exact match
+					 */
+					virtual bool eventFilter(QObject * watched, QEvent * event) override;
+
 				signals:
 					/**
 					 * @brief Function: void windowStateChanged(const app::main_window::state_e & nextState)
@@ -143,6 +186,13 @@ namespace app {
 					 */
 					app::main_window::window::ctrl_data_s savedData;
 
+					/**
+					 * @brief value of the enabled property of the shortcuts
+					 * Shortcuts are resolved by the shortcut trie of the commands therefore no object has to be toggled when the window changes state
+					 *
+					 */
+					bool shortcutsEnabled;
+
 					/**
 					 * @brief Function: virtual void connectSignals() final
 					 *
@@ -169,14 +219,14 @@ namespace app {
 					virtual void postprocessWindowStateChange(const app::main_window::state_e & previousState) final;
 
 					/**
-					 * @brief Function: virtual void changeWindowStateWrapper(const std::unique_ptr<app::main_window::json::Data> & commandData, const app::main_window::state_postprocessing_e & postprocess) final
+					 * @brief Function: virtual void changeWindowStateWrapper(const app::main_window::json::Data * commandData, const app::main_window::state_postprocessing_e & postprocess) final
 					 *
 					 * \param commandData: data relative to a command.
 					 * \param postprocess: flag to execute post process after chaning state.
 					 *
 					 * This function is a wrapper to change the state of window
 					 */
-					virtual void changeWindowStateWrapper(const std::unique_ptr<app::main_window::json::Data> & commandData, const app::main_window::state_postprocessing_e & postprocess) final;
+					virtual void changeWindowStateWrapper(const app::main_window::json::Data * commandData, const app::main_window::state_postprocessing_e & postprocess) final;
 
 					/**
 					 * @brief Function: virtual bool isValidWindowState(const app::main_window::state_e & windowState) final
@@ -190,15 +240,6 @@ namespace app {
 					 */
 					virtual bool isValidWindowState(const app::main_window::state_e & windowState) final;
 
-					/**
-					 * @brief Function: void setAllShortcutEnabledProperty(const bool enabled)
-					 *
-					 * \param enabled: value of enabled property
-					 *
-					 * This function sets the enabled property of all shortcuts of the main window and menus of the main window
-					 */
-					void setAllShortcutEnabledProperty(const bool enabled);
-
 					/**
 					 * @brief Function: virtual void executeAction(const app::main_window::state_e & windowState) final 
 					 *
@@ -219,15 +260,26 @@ namespace app {
 				private slots:
 
 					/**
-					 * @brief Function: virtual void changeWindowState(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key = Qt::Key_unknown) final
+					 * @brief Function: void followFocus(QWidget * previous, QWidget * current)
+					 *
+					 * \param previous: widget losing the focus
+					 * \param current: widget gaining the focus
+					 *
+					 * This function moves the shortcut event filter to the widget gaining the focus if it belongs to the main window
+					 */
+					void followFocus(QWidget * previous, QWidget * current);
+
+					/**
+					 * @brief Function: virtual void changeWindowState(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key = Qt::Key_unknown, const QString & argument = QString()) final
 					 *
 					 * \param nextState: state the window is requested to go into.
 					 * \param postprocess: flag to execute post process after chaning state.
 					 * \param key: key pressed that supports the request for a state change.
+					 * \param argument: argument typed by the user after the command. It becomes the user text of the new state
 					 *
 					 * This function changes the state of window
 					 */
-					virtual void changeWindowState(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key = Qt::Key_unknown) final;
+					virtual void changeWindowState(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key = Qt::Key_unknown, const QString & argument = QString()) final;
 
 					/**
 					 * @brief Function: void saveData()
@@ -49,14 +49,15 @@ namespace app {
 				public:
 
 					/**
-					 * @brief Function: explicit MainWindow(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags())
+					 * @brief Function: explicit MainWindow(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags(), const QString & sessionFile = QString())
 					 *
 					 * \param parent: parent window
 					 * \param flags: window flags
+					 * \param sessionFile: file the tabs of the window are saved to and restored from. An empty string disables sessions
 					 *
 					 * Main window constructor
 					 */
-					explicit MainWindow(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags());
+					explicit MainWindow(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags(), const QString & sessionFile = QString());
 
 					/**
 					 * @brief Function: virtual ~MainWindow()
@@ -30,14 +30,15 @@ namespace app {
 
 				public:
 					/**
-					 * @brief Function: explicit Wrapper(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags())
+					 * @brief Function: explicit Wrapper(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags(), const QString & sessionFile = QString())
 					 *
 					 * \param parent: parent window
 					 * \param flags: window flags
+					 * \param sessionFile: file the tabs of the window are saved to and restored from. An empty string disables sessions
 					 *
 					 * Main window wrapper constructor
 					 */
-					explicit Wrapper(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags());
+					explicit Wrapper(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags(), const QString & sessionFile = QString());
 
 					// Move constructor
 					/**
@@ -10,7 +10,9 @@
 
 #include <memory>
 #include <map>
+#include <chrono>
 
+#include <QtCore/QString>
 #include <QtTest/QTest>
 
 #include "tester/shared/enums.h"
@@ -204,6 +206,42 @@ namespace tester {
 				 */
 				const test_error_container_t & getExpectedErrors() const;
 
+				/**
+				 * @brief Function: const std::chrono::nanoseconds & getSetupDuration() const
+				 *
+				 * \return time spent setting up the test
+				 *
+				 * This function returns the time spent setting up the test
+				 */
+				const std::chrono::nanoseconds & getSetupDuration() const;
+
+				/**
+				 * @brief Function: const std::chrono::nanoseconds & getBodyDuration() const
+				 *
+				 * \return time spent running the body of the test
+				 *
+				 * This function returns the time spent running the body of the test
+				 */
+				const std::chrono::nanoseconds & getBodyDuration() const;
+
+				/**
+				 * @brief Function: const std::chrono::nanoseconds & getWrapupDuration() const
+				 *
+				 * \return time spent wrapping up the test
+				 *
+				 * This function returns the time spent wrapping up the test
+				 */
+				const std::chrono::nanoseconds & getWrapupDuration() const;
+
+				/**
+				 * @brief Function: const std::chrono::nanoseconds & getDuration() const
+				 *
+				 * \return time spent running the test
+				 *
+				 * This function returns the time spent running the test including the creation of the window
+				 */
+				const std::chrono::nanoseconds & getDuration() const;
+
 				/**
 				 * @brief Function: const std::unique_ptr<app::main_window::window::MainWindow> & getWindow() const
 				 *
@@ -340,6 +378,16 @@ namespace tester {
 				 */
 				virtual void testBody() = 0;
 
+				/**
+				 * @brief Function: virtual QString getSessionFile() const
+				 *
+				 * \return file the tabs of the window of the test are saved to and restored from
+				 *
+				 * This function returns the session file of the window the test runs in
+				 * Sessions are disabled by default in order not to read or overwrite the session of the user
+				 */
+				virtual QString getSessionFile() const;
+
 			private:
 				/**
 				 * @brief Suite the test belongs to
@@ -377,6 +425,30 @@ namespace tester {
 				 */
 				tester::shared::test_status_e status;
 
+				/**
+				 * @brief time spent setting up the test
+				 *
+				 */
+				std::chrono::nanoseconds setupDuration;
+
+				/**
+				 * @brief time spent running the body of the test
+				 *
+				 */
+				std::chrono::nanoseconds bodyDuration;
+
+				/**
+				 * @brief time spent wrapping up the test
+				 *
+				 */
+				std::chrono::nanoseconds wrapupDuration;
+
+				/**
+				 * @brief time spent running the test. It is measured by the test runner in order to account for tests that throw an exception
+				 *
+				 */
+				std::chrono::nanoseconds duration;
+
 				/**
 				 * @brief Function: void test()
 				 *
@@ -25,14 +25,15 @@ namespace tester {
 		 *
 		 */
 		typedef enum class error_type_list {
-			UNKNOWN,   /**< Unknown error */
-			TEST,      /**< Test error */
-			EXCEPTION, /**< Exception thrown */
-			COMMAND,   /**< Command error */
-			STATUSBAR, /**< Statusbar error */
-			WINDOW,    /**< Window errors */
-			TABS,      /**< Tab errors */
-			POPUP      /**< Popup errors */
+			UNKNOWN,    /**< Unknown error */
+			TEST,       /**< Test error */
+			EXCEPTION,  /**< Exception thrown */
+			COMMAND,    /**< Command error */
+			STATUSBAR,  /**< Statusbar error */
+			WINDOW,     /**< Window errors */
+			TABS,       /**< Tab errors */
+			POPUP,      /**< Popup errors */
+			PERFORMANCE /**< Performance errors */
 		} error_type_e;
 
 		/**
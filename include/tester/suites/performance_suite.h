@@ -0,0 +1,74 @@
+#ifndef PERFORMANCE_SUITE_H
+#define PERFORMANCE_SUITE_H
+/**
+ * @copyright
+ * @file performance_suite.h
+ * @author Andrea Gianarda
+ * @date 15th September 2020
+ * @brief Performance suite header file
+ */
+
+#include <memory>
+
+#include "app/shared/constructor_macros.h"
+#include "app/utility/log/printable_object.h"
+#include "tester/base/suite.h"
+
+/** @defgroup SuiteGroup Suite Doxygen Group
+ *  Suite functions and classes
+ *  @{
+ */
+
+namespace tester {
+
+	namespace suite {
+
+		/**
+		 * @brief PerformanceSuite class
+		 *
+		 */
+		class PerformanceSuite : public tester::base::Suite {
+
+			public:
+				/**
+				 * @brief Function: explicit PerformanceSuite(const std::shared_ptr<tester::base::Factory> & testFactory, const tester::base::Suite::tests_container_t & testList = tester::base::Suite::tests_container_t())
+				 *
+				 * \param testFactory: test factory
+				 * \param testList: initial collection of tests
+				 *
+				 * Performance suite constructor
+				 */
+				explicit PerformanceSuite(const std::shared_ptr<tester::base::Factory> & testFactory, const tester::base::Suite::tests_container_t & testList = tester::base::Suite::tests_container_t());
+
+				/**
+				 * @brief Function: virtual ~PerformanceSuite()
+				 *
+				 * Performance suite destructor
+				 */
+				virtual ~PerformanceSuite();
+
+				/**
+				 * @brief Function: virtual void populate() override
+				 *
+				 * This function populates the suite
+				 */
+				virtual void populate() override;
+
+			protected:
+
+			private:
+				// Move and copy constructor
+				/**
+				 * @brief Disable move and copy constructors and operator= overloading for class PerformanceSuite
+				 *
+				 */
+				DISABLE_COPY_MOVE(PerformanceSuite)
+
+		};
+
+	}
+
+}
+/** @} */ // End of SuiteGroup group
+
+#endif // PERFORMANCE_SUITE_H
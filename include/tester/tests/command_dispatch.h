@@ -0,0 +1,103 @@
+#ifndef COMMAND_DISPATCH_TEST_H
+#define COMMAND_DISPATCH_TEST_H
+/**
+ * @copyright
+ * @file command_dispatch.h
+ * @author Andrea Gianarda
+ * @date 05th September 2020
+ * @brief Command dispatch header file
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <QtCore/QString>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace main_window {
+
+		namespace json {
+
+			class Data;
+
+		}
+
+	}
+
+}
+
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief CommandDispatch class
+		 *
+		 */
+		class CommandDispatch : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit CommandDispatch(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Command dispatch constructor
+				 */
+				explicit CommandDispatch(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~CommandDispatch()
+				 *
+				 * Command dispatch destructor
+				 */
+				virtual ~CommandDispatch();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: const app::main_window::json::Data * linearDispatch(const QString & userCommand) const
+				 *
+				 * \param userCommand: command typed by the user
+				 *
+				 * \return the command matching the user input or nullptr if no match
+				 *
+				 * This function searches the command matching the user input by visiting every command of the window
+				 */
+				const app::main_window::json::Data * linearDispatch(const QString & userCommand) const;
+
+				/**
+				 * @brief Function: void reportLatencies(const std::string & mode, std::vector<std::int64_t> & latencies) const
+				 *
+				 * \param mode: description of the dispatch method
+				 * \param latencies: latency in nanoseconds of every command
+				 *
+				 * This function prints the percentiles of the latencies provided as argument
+				 */
+				void reportLatencies(const std::string & mode, std::vector<std::int64_t> & latencies) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // COMMAND_DISPATCH_TEST_H
@@ -0,0 +1,131 @@
+#ifndef COMMAND_INDEX_TEST_H
+#define COMMAND_INDEX_TEST_H
+/**
+ * @copyright
+ * @file command_index.h
+ * @author Andrea Gianarda
+ * @date 31st August 2020
+ * @brief Command index header file
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "app/windows/main_window/shared/shared_types.h"
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace main_window {
+
+		namespace json {
+
+			class Action;
+
+		}
+
+	}
+
+}
+
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief CommandIndex class
+		 *
+		 */
+		class CommandIndex : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit CommandIndex(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Command index constructor
+				 */
+				explicit CommandIndex(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~CommandIndex()
+				 *
+				 * Command index destructor
+				 */
+				virtual ~CommandIndex();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: void writeCommandFile(const std::string & filename) const
+				 *
+				 * \param filename: path of the JSON file
+				 *
+				 * This function writes a JSON file with a large number of synthetic commands
+				 */
+				void writeCommandFile(const std::string & filename) const;
+
+				/**
+				 * @brief Function: std::int64_t linearSearch(const app::main_window::json::Action & actions, const std::string & name, const std::vector<const void *> & values, std::vector<const void *> & matches) const
+				 *
+				 * \param actions: actions to search
+				 * \param name: name of the field to search
+				 * \param values: values to search
+				 * \param matches: actions found
+				 *
+				 * \return the time in nanoseconds taken to search all values
+				 *
+				 * This function searches the values provided as argument by visiting every action
+				 */
+				std::int64_t linearSearch(const app::main_window::json::Action & actions, const std::string & name, const std::vector<const void *> & values, std::vector<const void *> & matches) const;
+
+				/**
+				 * @brief Function: std::int64_t indexedSearch(const app::main_window::json::Action & actions, const std::string & name, const std::vector<const void *> & values, std::vector<const void *> & matches) const
+				 *
+				 * \param actions: actions to search
+				 * \param name: name of the field to search
+				 * \param values: values to search
+				 * \param matches: actions found
+				 *
+				 * \return the time in nanoseconds taken to search all values
+				 *
+				 * This function searches the values provided as argument through the typed lookups of the action
+				 */
+				std::int64_t indexedSearch(const app::main_window::json::Action & actions, const std::string & name, const std::vector<const void *> & values, std::vector<const void *> & matches) const;
+
+				/**
+				 * @brief Function: void compare(const std::string & name, const std::int64_t & linearTime, const std::int64_t & indexedTime, const std::vector<const void *> & linearMatches, const std::vector<const void *> & indexedMatches)
+				 *
+				 * \param name: name of the field searched
+				 * \param linearTime: time in nanoseconds taken by the linear search
+				 * \param indexedTime: time in nanoseconds taken by the indexed search
+				 * \param linearMatches: actions found by the linear search
+				 * \param indexedMatches: actions found by the indexed search
+				 *
+				 * This function prints the search latencies and checks that both searches found the same actions
+				 */
+				void compare(const std::string & name, const std::int64_t & linearTime, const std::int64_t & indexedTime, const std::vector<const void *> & linearMatches, const std::vector<const void *> & indexedMatches);
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // COMMAND_INDEX_TEST_H
@@ -0,0 +1,106 @@
+#ifndef COMMAND_MENU_FILTERING_TEST_H
+#define COMMAND_MENU_FILTERING_TEST_H
+/**
+ * @copyright
+ * @file command_menu_filtering.h
+ * @author Andrea Gianarda
+ * @date 08th September 2020
+ * @brief Command menu filtering header file
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <QtCore/QString>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace command_menu {
+
+		class CommandMenuModel;
+
+	}
+
+}
+
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief CommandMenuFiltering class
+		 *
+		 */
+		class CommandMenuFiltering : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit CommandMenuFiltering(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Command menu filtering constructor
+				 */
+				explicit CommandMenuFiltering(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~CommandMenuFiltering()
+				 *
+				 * Command menu filtering destructor
+				 */
+				virtual ~CommandMenuFiltering();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: void writeCommandFile() const
+				 *
+				 * This function writes the synthetic commands to a JSON file
+				 */
+				void writeCommandFile() const;
+
+				/**
+				 * @brief Function: std::vector<QString> createQueries(const app::command_menu::CommandMenuModel & model) const
+				 *
+				 * \param model: model listing all synthetic commands
+				 *
+				 * \return the queries typed by the user
+				 *
+				 * This function creates queries made up of characters of the listed commands as well as queries matching no command
+				 */
+				std::vector<QString> createQueries(const app::command_menu::CommandMenuModel & model) const;
+
+				/**
+				 * @brief Function: void reportLatencies(const std::string & mode, const std::vector<std::vector<std::int64_t>> & latencies) const
+				 *
+				 * \param mode: description of the filtering method
+				 * \param latencies: latency in nanoseconds of every keystroke grouped by position of the keystroke in the query
+				 *
+				 * This function prints the average latency of every keystroke as well as the percentiles of all latencies
+				 */
+				void reportLatencies(const std::string & mode, const std::vector<std::vector<std::int64_t>> & latencies) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // COMMAND_MENU_FILTERING_TEST_H
@@ -0,0 +1,76 @@
+#ifndef COMMAND_MENU_GEOMETRY_TEST_H
+#define COMMAND_MENU_GEOMETRY_TEST_H
+/**
+ * @copyright
+ * @file command_menu_geometry.h
+ * @author Andrea Gianarda
+ * @date 09th September 2020
+ * @brief Command menu geometry header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief CommandMenuGeometry class
+		 *
+		 */
+		class CommandMenuGeometry : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit CommandMenuGeometry(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Command menu geometry constructor
+				 */
+				explicit CommandMenuGeometry(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~CommandMenuGeometry()
+				 *
+				 * Command menu geometry destructor
+				 */
+				virtual ~CommandMenuGeometry();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: void reportLatency(const std::string & name, const std::int64_t & elapsedTime, const std::size_t & calls) const
+				 *
+				 * \param name: name of the function
+				 * \param elapsedTime: time in nanoseconds spent in the function
+				 * \param calls: number of calls of the function
+				 *
+				 * This function prints the time per call of a function
+				 */
+				void reportLatency(const std::string & name, const std::int64_t & elapsedTime, const std::size_t & calls) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // COMMAND_MENU_GEOMETRY_TEST_H
@@ -0,0 +1,105 @@
+#ifndef COMMAND_MENU_RESULTS_TEST_H
+#define COMMAND_MENU_RESULTS_TEST_H
+/**
+ * @copyright
+ * @file command_menu_results.h
+ * @author Andrea Gianarda
+ * @date 08th September 2020
+ * @brief Command menu results header file
+ */
+
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace command_menu {
+
+		class CommandMenuModel;
+
+	}
+
+}
+
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief CommandMenuResults class
+		 *
+		 */
+		class CommandMenuResults : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit CommandMenuResults(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Command menu results constructor
+				 */
+				explicit CommandMenuResults(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~CommandMenuResults()
+				 *
+				 * Command menu results destructor
+				 */
+				virtual ~CommandMenuResults();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: void writeCommandFile() const
+				 *
+				 * This function writes the commands to a JSON file
+				 */
+				void writeCommandFile() const;
+
+				/**
+				 * @brief Function: std::vector<QString> getResults(const app::command_menu::CommandMenuModel & model) const
+				 *
+				 * \param model: model to read the commands from
+				 *
+				 * \return the commands listed by the model
+				 *
+				 * This function returns the commands listed by the model in the order they are displayed
+				 */
+				std::vector<QString> getResults(const app::command_menu::CommandMenuModel & model) const;
+
+				/**
+				 * @brief Function: std::vector<QString> getExpectedResults(const QString & filter) const
+				 *
+				 * \param filter: text typed by the user
+				 *
+				 * \return the commands expected to match the filter
+				 *
+				 * This function scores every command against the filter from scratch and sorts the matches by decreasing score, increasing length and name
+				 */
+				std::vector<QString> getExpectedResults(const QString & filter) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // COMMAND_MENU_RESULTS_TEST_H
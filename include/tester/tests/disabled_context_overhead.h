@@ -0,0 +1,90 @@
+#ifndef DISABLED_CONTEXT_OVERHEAD_TEST_H
+#define DISABLED_CONTEXT_OVERHEAD_TEST_H
+/**
+ * @copyright
+ * @file disabled_context_overhead.h
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Disabled context overhead header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief DisabledContextOverhead class
+		 *
+		 */
+		class DisabledContextOverhead : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit DisabledContextOverhead(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Disabled context overhead constructor
+				 */
+				explicit DisabledContextOverhead(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~DisabledContextOverhead()
+				 *
+				 * Disabled context overhead destructor
+				 */
+				virtual ~DisabledContextOverhead();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+				/**
+				 * @brief Function: std::int64_t logMessages(const std::uint64_t & messages, const std::string & filename)
+				 *
+				 * \param messages: number of messages to log
+				 * \param filename: file messages are logged to
+				 *
+				 * \return the time in nanoseconds spent logging the messages
+				 *
+				 * This function logs messages to the context whose thresholds are changed by the test
+				 */
+				std::int64_t logMessages(const std::uint64_t & messages, const std::string & filename);
+
+				/**
+				 * @brief Function: std::uint64_t evaluateArgument()
+				 *
+				 * \return the number of times the argument has been evaluated
+				 *
+				 * This function counts how many times the argument of a message has been evaluated
+				 */
+				std::uint64_t evaluateArgument();
+
+				/**
+				 * @brief number of times the argument of a message has been evaluated
+				 *
+				 */
+				std::uint64_t evaluations;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // DISABLED_CONTEXT_OVERHEAD_TEST_H
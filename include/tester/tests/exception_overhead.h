@@ -0,0 +1,81 @@
+#ifndef EXCEPTION_OVERHEAD_TEST_H
+#define EXCEPTION_OVERHEAD_TEST_H
+/**
+ * @copyright
+ * @file exception_overhead.h
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Exception overhead header file
+ */
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief ExceptionOverhead class
+		 *
+		 */
+		class ExceptionOverhead : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit ExceptionOverhead(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Exception overhead constructor
+				 */
+				explicit ExceptionOverhead(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~ExceptionOverhead()
+				 *
+				 * Exception overhead destructor
+				 */
+				virtual ~ExceptionOverhead();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+				/**
+				 * @brief Function: void checkExceptionFormatting()
+				 *
+				 * This function measures the cost of throwing an exception and checks that it is formatted only when it is printed
+				 */
+				void checkExceptionFormatting();
+
+				/**
+				 * @brief Function: void checkReadFile()
+				 *
+				 * This function counts the exceptions thrown while reading files
+				 */
+				void checkReadFile();
+
+				/**
+				 * @brief Function: void checkScroll()
+				 *
+				 * This function counts the exceptions thrown while scrolling pages
+				 */
+				void checkScroll();
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // EXCEPTION_OVERHEAD_TEST_H
@@ -0,0 +1,80 @@
+#ifndef FILTERED_LOGGING_TEST_H
+#define FILTERED_LOGGING_TEST_H
+/**
+ * @copyright
+ * @file filtered_logging.h
+ * @author Andrea Gianarda
+ * @date 30th August 2020
+ * @brief Filtered logging header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "app/utility/logger/enums.h"
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief FilteredLogging class
+		 *
+		 */
+		class FilteredLogging : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit FilteredLogging(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Filtered logging constructor
+				 */
+				explicit FilteredLogging(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~FilteredLogging()
+				 *
+				 * Filtered logging destructor
+				 */
+				virtual ~FilteredLogging();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: std::int64_t loadActions(const std::string & rule, const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity, std::size_t & numberOfActions) const
+				 *
+				 * \param rule: logging rule applied to all contexts while loading the JSON files
+				 * \param minimumType: runtime minimum type of messages to print
+				 * \param maximumVerbosity: runtime maximum verbosity of information messages to print
+				 * \param numberOfActions: number of actions loaded from the JSON files
+				 *
+				 * \return the time in nanoseconds taken to load the JSON files
+				 *
+				 * This function loads the command JSON files multiple times with the runtime thresholds and the logging rule provided as argument
+				 */
+				std::int64_t loadActions(const std::string & rule, const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity, std::size_t & numberOfActions) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // FILTERED_LOGGING_TEST_H
@@ -0,0 +1,103 @@
+#ifndef FIND_IN_PAGE_TEST_H
+#define FIND_IN_PAGE_TEST_H
+/**
+ * @copyright
+ * @file find_in_page.h
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Find in page header file
+ */
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include <QtCore/QString>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief FindInPage class
+		 *
+		 */
+		class FindInPage : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit FindInPage(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Find in page constructor
+				 */
+				explicit FindInPage(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~FindInPage()
+				 *
+				 * Find in page destructor
+				 */
+				virtual ~FindInPage();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+				/**
+				 * @brief Function: std::string createContent(std::vector<std::string> & vocabulary) const
+				 *
+				 * \param vocabulary: words the content is made of
+				 *
+				 * \return the content of the text file
+				 *
+				 * This function creates the content of the text file out of random words some of which are capitalized or joined together
+				 */
+				std::string createContent(std::vector<std::string> & vocabulary) const;
+
+				/**
+				 * @brief Function: std::size_t referenceCount(const std::string & content, const std::string & lowerContent, const std::string & term, const bool & caseSensitive, const bool & matchFullWord) const
+				 *
+				 * \param content: content of the text file
+				 * \param lowerContent: content of the text file with all letters in lower case
+				 * \param term: text to search
+				 * \param caseSensitive: whether the case of letters must match
+				 * \param matchFullWord: whether matches must be full words
+				 *
+				 * \return the number of matches of the term
+				 *
+				 * This function counts the matches of the term using std::string::find
+				 */
+				std::size_t referenceCount(const std::string & content, const std::string & lowerContent, const std::string & term, const bool & caseSensitive, const bool & matchFullWord) const;
+
+				/**
+				 * @brief Function: void findInTab(const QString & path, const QString & term, const int & expectedMatches)
+				 *
+				 * \param path: path of the text file
+				 * \param term: text to search
+				 * \param expectedMatches: number of matches of the term in the file
+				 *
+				 * This function opens the text file in a tab and checks the results of searching the term forward and backward
+				 */
+				void findInTab(const QString & path, const QString & term, const int & expectedMatches);
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // FIND_IN_PAGE_TEST_H
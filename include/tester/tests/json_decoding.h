@@ -0,0 +1,84 @@
+#ifndef JSON_DECODING_TEST_H
+#define JSON_DECODING_TEST_H
+/**
+ * @copyright
+ * @file json_decoding.h
+ * @author Andrea Gianarda
+ * @date 1st September 2020
+ * @brief JSON decoding header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief JsonDecoding class
+		 *
+		 */
+		class JsonDecoding : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit JsonDecoding(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * JSON decoding constructor
+				 */
+				explicit JsonDecoding(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~JsonDecoding()
+				 *
+				 * JSON decoding destructor
+				 */
+				virtual ~JsonDecoding();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: std::int64_t loadFile(const std::string & filename, std::size_t & numberOfActions) const
+				 *
+				 * \param filename: JSON file to load
+				 * \param numberOfActions: number of actions decoded from the JSON file
+				 *
+				 * \return the time in nanoseconds taken to load the JSON file
+				 *
+				 * This function loads a command JSON file multiple times
+				 */
+				std::int64_t loadFile(const std::string & filename, std::size_t & numberOfActions) const;
+
+				/**
+				 * @brief Function: void checkSchemaError()
+				 *
+				 * This function checks that a schema error is reported with the path of the offending value
+				 */
+				void checkSchemaError();
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // JSON_DECODING_TEST_H
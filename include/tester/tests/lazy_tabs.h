@@ -0,0 +1,74 @@
+#ifndef LAZY_TABS_TEST_H
+#define LAZY_TABS_TEST_H
+/**
+ * @copyright
+ * @file lazy_tabs.h
+ * @author Andrea Gianarda
+ * @date 01st September 2020
+ * @brief Lazy tabs header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief LazyTabs class
+		 *
+		 */
+		class LazyTabs : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit LazyTabs(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Lazy tabs constructor
+				 */
+				explicit LazyTabs(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~LazyTabs()
+				 *
+				 * Lazy tabs destructor
+				 */
+				virtual ~LazyTabs();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: void openTabs(const bool & lazy)
+				 *
+				 * \param lazy: whether tabs are placeholders until they are needed
+				 *
+				 * This function opens tabs in the background, reports the time taken and the memory used and closes them
+				 */
+				void openTabs(const bool & lazy);
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // LAZY_TABS_TEST_H
@@ -0,0 +1,87 @@
+#ifndef LOG_ROTATION_TEST_H
+#define LOG_ROTATION_TEST_H
+/**
+ * @copyright
+ * @file log_rotation.h
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Log rotation header file
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief LogRotation class
+		 *
+		 */
+		class LogRotation : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit LogRotation(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Log rotation constructor
+				 */
+				explicit LogRotation(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~LogRotation()
+				 *
+				 * Log rotation destructor
+				 */
+				virtual ~LogRotation();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+				/**
+				 * @brief Function: std::uint64_t getUsedSpace(const std::string & directory) const
+				 *
+				 * \param directory: directory storing the log file and its segments
+				 *
+				 * \return the size in bytes of all files in the directory
+				 *
+				 * This function returns the disk space used by the log file and its segments
+				 */
+				std::uint64_t getUsedSpace(const std::string & directory) const;
+
+				/**
+				 * @brief Function: std::vector<std::uint64_t> readSequence(const std::string & filename, const int & segments) const
+				 *
+				 * \param filename: log file
+				 * \param segments: maximum number of segments of the log file
+				 *
+				 * \return the sequence numbers of the records ordered from the oldest to the newest
+				 *
+				 * This function reads the sequence numbers of the records in the uncompressed segments and in the log file
+				 */
+				std::vector<std::uint64_t> readSequence(const std::string & filename, const int & segments) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // LOG_ROTATION_TEST_H
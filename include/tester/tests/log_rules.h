@@ -0,0 +1,84 @@
+#ifndef LOG_RULES_TEST_H
+#define LOG_RULES_TEST_H
+/**
+ * @copyright
+ * @file log_rules.h
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Log rules header file
+ */
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief LogRules class
+		 *
+		 */
+		class LogRules : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit LogRules(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Log rules constructor
+				 */
+				explicit LogRules(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~LogRules()
+				 *
+				 * Log rules destructor
+				 */
+				virtual ~LogRules();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+				/**
+				 * @brief Function: void checkPatterns()
+				 *
+				 * This function checks that names are matched by glob patterns
+				 */
+				void checkPatterns();
+
+				/**
+				 * @brief Function: void checkRules()
+				 *
+				 * This function checks that rules change the thresholds of the registered contexts
+				 */
+				void checkRules();
+
+				/**
+				 * @brief Function: void checkRejectedRule(const std::string & rule, const std::string & reason)
+				 *
+				 * \param rule: rule expected to be rejected
+				 * \param reason: reason why the rule is expected to be rejected
+				 *
+				 * This function checks that setting the rule throws an exception and leaves the current rules untouched
+				 */
+				void checkRejectedRule(const std::string & rule, const std::string & reason);
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // LOG_RULES_TEST_H
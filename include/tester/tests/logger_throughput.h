@@ -0,0 +1,97 @@
+#ifndef LOGGER_THROUGHPUT_TEST_H
+#define LOGGER_THROUGHPUT_TEST_H
+/**
+ * @copyright
+ * @file logger_throughput.h
+ * @author Andrea Gianarda
+ * @date 30th August 2020
+ * @brief Logger throughput header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief LoggerThroughput class
+		 *
+		 */
+		class LoggerThroughput : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit LoggerThroughput(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Logger throughput constructor
+				 */
+				explicit LoggerThroughput(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~LoggerThroughput()
+				 *
+				 * Logger throughput destructor
+				 */
+				virtual ~LoggerThroughput();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: std::int64_t logMessages(const int & numberOfThreads) const
+				 *
+				 * \param numberOfThreads: number of threads logging messages concurrently
+				 *
+				 * \return the time in nanoseconds taken to log all messages
+				 *
+				 * This function logs messages from the given number of threads and measures the time spent by the threads logging them
+				 */
+				std::int64_t logMessages(const int & numberOfThreads) const;
+
+				/**
+				 * @brief Function: std::int64_t logMessagesLegacy(const int & numberOfThreads) const
+				 *
+				 * \param numberOfThreads: number of threads logging messages concurrently
+				 *
+				 * \return the time in nanoseconds taken to log all messages
+				 *
+				 * This function logs the same messages as logMessages through the write path of the logger the backend replaced in order to compare against it
+				 */
+				std::int64_t logMessagesLegacy(const int & numberOfThreads) const;
+
+				/**
+				 * @brief Function: void reportThroughput(const std::string & mode, const std::int64_t & elapsedTime) const
+				 *
+				 * \param mode: description of the logger configuration
+				 * \param elapsedTime: time in nanoseconds taken to log all messages
+				 *
+				 * This function prints the time per message and the number of messages per second
+				 */
+				void reportThroughput(const std::string & mode, const std::int64_t & elapsedTime) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // LOGGER_THROUGHPUT_TEST_H
@@ -0,0 +1,104 @@
+#ifndef PROFILE_CACHE_TEST_H
+#define PROFILE_CACHE_TEST_H
+/**
+ * @copyright
+ * @file profile_cache.h
+ * @author Andrea Gianarda
+ * @date 11th September 2020
+ * @brief Profile cache header file
+ */
+
+#include <cstdint>
+
+#include <QtCore/QString>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace app {
+
+	namespace base {
+
+		namespace tab {
+
+			class WebEngineProfile;
+
+		}
+
+	}
+
+}
+
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief ProfileCache class
+		 *
+		 */
+		class ProfileCache : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit ProfileCache(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Profile cache constructor
+				 */
+				explicit ProfileCache(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~ProfileCache()
+				 *
+				 * Profile cache destructor
+				 */
+				virtual ~ProfileCache();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: QString writePage(const QString & directory) const
+				 *
+				 * \param directory: directory where the page and its sub-resources are written
+				 *
+				 * \return the path of the page
+				 *
+				 * This function writes a HTML page referencing many stylesheets, scripts and images stored in the same directory
+				 */
+				QString writePage(const QString & directory) const;
+
+				/**
+				 * @brief Function: std::int64_t loadPage(app::base::tab::WebEngineProfile * profile, const QString & path, bool & success) const
+				 *
+				 * \param profile: profile of the page
+				 * \param path: path of the page to load
+				 * \param success: set to true if the page was loaded successfully
+				 *
+				 * \return the time in nanoseconds taken to load the page
+				 *
+				 * This function loads the page in a new web engine page using the profile provided as argument and waits for the load to finish
+				 */
+				std::int64_t loadPage(app::base::tab::WebEngineProfile * profile, const QString & path, bool & success) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // PROFILE_CACHE_TEST_H
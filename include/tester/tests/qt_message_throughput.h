@@ -0,0 +1,76 @@
+#ifndef QT_MESSAGE_THROUGHPUT_TEST_H
+#define QT_MESSAGE_THROUGHPUT_TEST_H
+/**
+ * @copyright
+ * @file qt_message_throughput.h
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Qt message throughput header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief QtMessageThroughput class
+		 *
+		 */
+		class QtMessageThroughput : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit QtMessageThroughput(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Qt message throughput constructor
+				 */
+				explicit QtMessageThroughput(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~QtMessageThroughput()
+				 *
+				 * Qt message throughput destructor
+				 */
+				virtual ~QtMessageThroughput();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+				/**
+				 * @brief Function: std::uint64_t countMessages(const std::string & filename, const std::uint64_t & offset, const std::string & tag) const
+				 *
+				 * \param filename: Qt log file
+				 * \param offset: position in the file to start counting from
+				 * \param tag: text identifying the messages to count
+				 *
+				 * \return the number of lines containing the tag
+				 *
+				 * This function counts the messages of the test written to the Qt log file
+				 */
+				std::uint64_t countMessages(const std::string & filename, const std::uint64_t & offset, const std::string & tag) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // QT_MESSAGE_THROUGHPUT_TEST_H
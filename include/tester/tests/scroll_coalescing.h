@@ -0,0 +1,60 @@
+#ifndef SCROLL_COALESCING_TEST_H
+#define SCROLL_COALESCING_TEST_H
+/**
+ * @copyright
+ * @file scroll_coalescing.h
+ * @author Andrea Gianarda
+ * @date 04th September 2020
+ * @brief Scroll coalescing header file
+ */
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief ScrollCoalescing class
+		 *
+		 */
+		class ScrollCoalescing : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit ScrollCoalescing(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Scroll coalescing constructor
+				 */
+				explicit ScrollCoalescing(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~ScrollCoalescing()
+				 *
+				 * Scroll coalescing destructor
+				 */
+				virtual ~ScrollCoalescing();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // SCROLL_COALESCING_TEST_H
@@ -0,0 +1,87 @@
+#ifndef SESSION_RESTORE_TEST_H
+#define SESSION_RESTORE_TEST_H
+/**
+ * @copyright
+ * @file session_restore.h
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Session restore header file
+ */
+
+#include <QtCore/QString>
+#include <QtCore/QTemporaryDir>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief SessionRestore class
+		 *
+		 */
+		class SessionRestore : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit SessionRestore(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Session restore constructor
+				 */
+				explicit SessionRestore(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~SessionRestore()
+				 *
+				 * Session restore destructor
+				 */
+				virtual ~SessionRestore();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+				/**
+				 * @brief Function: virtual QString getSessionFile() const override
+				 *
+				 * \return session file in the temporary directory of the test
+				 *
+				 * This function returns the session file of the window the test runs in
+				 */
+				virtual QString getSessionFile() const override;
+
+			private:
+				/**
+				 * @brief temporary directory storing the session file and the pages of the tabs
+				 *
+				 */
+				QTemporaryDir directory;
+
+				/**
+				 * @brief Function: void restoreTabs(const int & numberOfTabs)
+				 *
+				 * \param numberOfTabs: number of tabs in the session
+				 *
+				 * This function writes a session with the given number of tabs through the session store of the window, restores it and reports the time taken until the current tab is interactive and the memory used
+				 */
+				void restoreTabs(const int & numberOfTabs);
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // SESSION_RESTORE_TEST_H
@@ -0,0 +1,97 @@
+#ifndef SHORTCUT_TOGGLING_TEST_H
+#define SHORTCUT_TOGGLING_TEST_H
+/**
+ * @copyright
+ * @file shortcut_toggling.h
+ * @author Andrea Gianarda
+ * @date 06th September 2020
+ * @brief Shortcut toggling header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief ShortcutToggling class
+		 *
+		 */
+		class ShortcutToggling : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit ShortcutToggling(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Shortcut toggling constructor
+				 */
+				explicit ShortcutToggling(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~ShortcutToggling()
+				 *
+				 * Shortcut toggling destructor
+				 */
+				virtual ~ShortcutToggling();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: int findUnboundKey() const
+				 *
+				 * \return a key that is not the first key of any shortcut or Qt::Key_unknown if all candidate keys are bound
+				 *
+				 * This function searches a key the shortcut trie does not expect when no shortcut has been typed
+				 */
+				int findUnboundKey() const;
+
+				/**
+				 * @brief Function: std::int64_t dispatchKeys(const int & numberOfEvents, const int & key, int & filteredEvents)
+				 *
+				 * \param numberOfEvents: number of key presses dispatched
+				 * \param key: key pressed
+				 * \param filteredEvents: number of key presses the main window filtered out
+				 *
+				 * \return the time in nanoseconds taken to dispatch all key presses
+				 *
+				 * This function sends key presses through the shortcut event filter of the main window as the focus widget would receive them
+				 */
+				std::int64_t dispatchKeys(const int & numberOfEvents, const int & key, int & filteredEvents);
+
+				/**
+				 * @brief Function: void benchmark(const int & numberOfTabs, const int & key)
+				 *
+				 * \param numberOfTabs: number of tabs opened while dispatching keys
+				 * \param key: key pressed
+				 *
+				 * This function opens tabs and measures the time taken by the main window to dispatch a key press
+				 */
+				void benchmark(const int & numberOfTabs, const int & key);
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // SHORTCUT_TOGGLING_TEST_H
@@ -0,0 +1,118 @@
+#ifndef SHORTCUT_TRIE_TEST_H
+#define SHORTCUT_TRIE_TEST_H
+/**
+ * @copyright
+ * @file shortcut_trie.h
+ * @author Andrea Gianarda
+ * @date 07th September 2020
+ * @brief Shortcut trie header file
+ */
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+#include <QtGui/QKeySequence>
+
+#include "tester/base/test.h"
+#include "app/widgets/commands/key_sequence.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief ShortcutTrie class
+		 *
+		 */
+		class ShortcutTrie : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit ShortcutTrie(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Shortcut trie constructor
+				 */
+				explicit ShortcutTrie(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~ShortcutTrie()
+				 *
+				 * Shortcut trie destructor
+				 */
+				virtual ~ShortcutTrie();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: std::int64_t linearMatch(const std::vector<app::commands::KeySequence> & bindings, const std::vector<int> & keys, const std::vector<std::chrono::steady_clock::time_point> & times, std::vector<int> & results) const
+				 *
+				 * \param bindings: key sequences bound to their index in the vector
+				 * \param keys: keys pressed
+				 * \param times: time every key is pressed at
+				 * \param results: value matched by every key, -1 for partial matches and -2 if no binding matches
+				 *
+				 * \return the time in nanoseconds taken to consume all keys
+				 *
+				 * This function matches the keys typed so far against every binding after every key
+				 */
+				std::int64_t linearMatch(const std::vector<app::commands::KeySequence> & bindings, const std::vector<int> & keys, const std::vector<std::chrono::steady_clock::time_point> & times, std::vector<int> & results) const;
+
+				/**
+				 * @brief Function: std::int64_t trieMatch(const std::vector<app::commands::KeySequence> & bindings, const std::vector<int> & keys, const std::vector<std::chrono::steady_clock::time_point> & times, std::vector<int> & results) const
+				 *
+				 * \param bindings: key sequences bound to their index in the vector
+				 * \param keys: keys pressed
+				 * \param times: time every key is pressed at
+				 * \param results: value matched by every key, -1 for partial matches and -2 if no binding matches
+				 *
+				 * \return the time in nanoseconds taken to consume all keys
+				 *
+				 * This function feeds the keys to a trie compiled from the bindings
+				 */
+				std::int64_t trieMatch(const std::vector<app::commands::KeySequence> & bindings, const std::vector<int> & keys, const std::vector<std::chrono::steady_clock::time_point> & times, std::vector<int> & results) const;
+
+				/**
+				 * @brief Function: void checkCommandShortcuts()
+				 *
+				 * This function checks that the shortcut of every command of the window is resolved to the command by the trie of the window
+				 */
+				void checkCommandShortcuts();
+
+				/**
+				 * @brief Function: void checkPrefixConflicts()
+				 *
+				 * This function checks that the trie rejects key sequences that begin with a binding or that a binding begins with
+				 */
+				void checkPrefixConflicts();
+
+				/**
+				 * @brief Function: void checkSequenceRestart()
+				 *
+				 * This function checks that a key that does not continue the sequence typed so far is matched as the first key of a new sequence
+				 */
+				void checkSequenceRestart();
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // SHORTCUT_TRIE_TEST_H
@@ -0,0 +1,87 @@
+#ifndef STARTUP_PROFILE_TEST_H
+#define STARTUP_PROFILE_TEST_H
+/**
+ * @copyright
+ * @file startup_profile.h
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Startup profile header file
+ */
+
+#include <map>
+#include <string>
+
+#include <QtCore/QString>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief StartupProfile class
+		 *
+		 */
+		class StartupProfile : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit StartupProfile(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Startup profile constructor
+				 */
+				explicit StartupProfile(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~StartupProfile()
+				 *
+				 * Startup profile destructor
+				 */
+				virtual ~StartupProfile();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+				/**
+				 * @brief Function: std::map<std::string, double> readTrace(const QString & filename) const
+				 *
+				 * \param filename: file storing the trace of the startup
+				 *
+				 * \return the duration in milliseconds of every phase
+				 *
+				 * This function reads the duration of the phases from a file in the Chrome trace event format
+				 */
+				std::map<std::string, double> readTrace(const QString & filename) const;
+
+				/**
+				 * @brief Function: std::map<std::string, double> readBaseline(const QString & filename) const
+				 *
+				 * \param filename: file storing the baseline
+				 *
+				 * \return the expected duration in milliseconds of every phase
+				 *
+				 * This function reads the expected duration of the phases from a JSON object mapping the name of a phase to its duration
+				 */
+				std::map<std::string, double> readBaseline(const QString & filename) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // STARTUP_PROFILE_TEST_H
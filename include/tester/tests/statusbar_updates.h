@@ -0,0 +1,60 @@
+#ifndef STATUSBAR_UPDATES_TEST_H
+#define STATUSBAR_UPDATES_TEST_H
+/**
+ * @copyright
+ * @file statusbar_updates.h
+ * @author Andrea Gianarda
+ * @date 05th September 2020
+ * @brief Statusbar updates header file
+ */
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief StatusbarUpdates class
+		 *
+		 */
+		class StatusbarUpdates : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit StatusbarUpdates(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Statusbar updates constructor
+				 */
+				explicit StatusbarUpdates(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~StatusbarUpdates()
+				 *
+				 * Statusbar updates destructor
+				 */
+				virtual ~StatusbarUpdates();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // STATUSBAR_UPDATES_TEST_H
@@ -0,0 +1,103 @@
+#ifndef TAB_HIBERNATION_TEST_H
+#define TAB_HIBERNATION_TEST_H
+/**
+ * @copyright
+ * @file tab_hibernation.h
+ * @author Andrea Gianarda
+ * @date 02nd September 2020
+ * @brief Tab hibernation header file
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <QtCore/QString>
+
+#include "app/windows/main_window/shared/shared_types.h"
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief TabHibernation class
+		 *
+		 */
+		class TabHibernation : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit TabHibernation(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Tab hibernation constructor
+				 */
+				explicit TabHibernation(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~TabHibernation()
+				 *
+				 * Tab hibernation destructor
+				 */
+				virtual ~TabHibernation();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: void hibernateTabs(const app::main_window::page_type_e & type, const QString & source)
+				 *
+				 * \param type: type of the tabs
+				 * \param source: source of every tab
+				 *
+				 * This function opens tabs with the same source and checks that their state survives hibernation
+				 */
+				void hibernateTabs(const app::main_window::page_type_e & type, const QString & source);
+
+				/**
+				 * @brief Function: std::int64_t cycleTabs(const QString & source, const bool & restore)
+				 *
+				 * \param source: expected source of every tab
+				 * \param restore: true if the state of the tabs is expected to be restored, false if the state of the tabs has to be set
+				 *
+				 * \return the peak resident memory of the process while cycling through tabs
+				 *
+				 * This function makes every tab current in turn and either scrolls and searches text in it or checks that the state set in a previous cycle is restored
+				 */
+				std::int64_t cycleTabs(const QString & source, const bool & restore);
+
+				/**
+				 * @brief vertical scroll of every tab
+				 *
+				 */
+				std::vector<int> verticalScrolls;
+
+				/**
+				 * @brief text searched in every tab
+				 *
+				 */
+				std::vector<std::string> searchedTexts;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // TAB_HIBERNATION_TEST_H
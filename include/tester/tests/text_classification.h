@@ -0,0 +1,100 @@
+#ifndef TEXT_CLASSIFICATION_TEST_H
+#define TEXT_CLASSIFICATION_TEST_H
+/**
+ * @copyright
+ * @file text_classification.h
+ * @author Andrea Gianarda
+ * @date 10th September 2020
+ * @brief Text classification header file
+ */
+
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "app/windows/main_window/shared/shared_types.h"
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief TextClassification class
+		 *
+		 */
+		class TextClassification : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit TextClassification(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Text classification constructor
+				 */
+				explicit TextClassification(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~TextClassification()
+				 *
+				 * Text classification destructor
+				 */
+				virtual ~TextClassification();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: std::vector<QString> createInputs(const QString & directory) const
+				 *
+				 * \param directory: directory where files are created
+				 *
+				 * \return the distinct texts to classify
+				 *
+				 * This function creates existing and missing file paths, URLs and words to classify
+				 */
+				std::vector<QString> createInputs(const QString & directory) const;
+
+				/**
+				 * @brief Function: bool referenceIsUrl(const QString & text) const
+				 *
+				 * \param text: text to check
+				 *
+				 * \return true if the text is a valid URL, false otherwise
+				 *
+				 * This function checks whether the text is a URL by always parsing it
+				 */
+				bool referenceIsUrl(const QString & text) const;
+
+				/**
+				 * @brief Function: app::main_window::page_type_e referenceTextToPageType(const QString & text) const
+				 *
+				 * \param text: text to deduce type from
+				 *
+				 * \return the page type deduced for the text provided as argument
+				 *
+				 * This function deduces the page type by querying the filesystem and parsing the text every time
+				 */
+				app::main_window::page_type_e referenceTextToPageType(const QString & text) const;
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // TEXT_CLASSIFICATION_TEST_H
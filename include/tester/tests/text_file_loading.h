@@ -0,0 +1,85 @@
+#ifndef TEXT_FILE_LOADING_TEST_H
+#define TEXT_FILE_LOADING_TEST_H
+/**
+ * @copyright
+ * @file text_file_loading.h
+ * @author Andrea Gianarda
+ * @date 03rd September 2020
+ * @brief Text file loading header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief TextFileLoading class
+		 *
+		 */
+		class TextFileLoading : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit TextFileLoading(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Text file loading constructor
+				 */
+				explicit TextFileLoading(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~TextFileLoading()
+				 *
+				 * Text file loading destructor
+				 */
+				virtual ~TextFileLoading();
+
+			protected:
+
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+
+				/**
+				 * @brief Function: void generateFile(const std::string & filename, const std::int64_t & size) const
+				 *
+				 * \param filename: name of the file to generate
+				 * \param size: size of the file in bytes
+				 *
+				 * This function generates a text file made of numbered lines
+				 */
+				void generateFile(const std::string & filename, const std::int64_t & size) const;
+
+				/**
+				 * @brief Function: void loadFile(const std::string & filename, const std::int64_t & size)
+				 *
+				 * \param filename: name of the file to load
+				 * \param size: size of the file in bytes
+				 *
+				 * This function opens the file in a new tab and measures the time taken to show it as well as the memory used by the process
+				 */
+				void loadFile(const std::string & filename, const std::int64_t & size);
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // TEXT_FILE_LOADING_TEST_H
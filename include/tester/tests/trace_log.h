@@ -0,0 +1,84 @@
+#ifndef TRACE_LOG_TEST_H
+#define TRACE_LOG_TEST_H
+/**
+ * @copyright
+ * @file trace_log.h
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Trace log header file
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "tester/base/test.h"
+
+/** @defgroup TesterTestGroup Test Doxygen Group
+ *  Test functions and classes
+ *  @{
+ */
+namespace tester {
+
+	namespace test {
+
+		/**
+		 * @brief TraceLog class
+		 *
+		 */
+		class TraceLog : public tester::base::Test {
+
+			public:
+				/**
+				 * @brief Function: explicit TraceLog(const std::shared_ptr<tester::base::Suite> & testSuite)
+				 *
+				 * \param testSuite: test suite
+				 *
+				 * Trace log constructor
+				 */
+				explicit TraceLog(const std::shared_ptr<tester::base::Suite> & testSuite);
+
+				/**
+				 * @brief Function: virtual ~TraceLog()
+				 *
+				 * Trace log destructor
+				 */
+				virtual ~TraceLog();
+
+			protected:
+				/**
+				 * @brief Function: virtual void testBody() override
+				 *
+				 * This function contains the body of the test
+				 */
+				virtual void testBody() override;
+
+			private:
+				/**
+				 * @brief Function: std::string getExpectedMessage(const std::uint64_t & iteration) const
+				 *
+				 * \param iteration: iteration the message is logged at
+				 *
+				 * \return the text of the message logged at the iteration
+				 *
+				 * This function returns the text the decoder is expected to reconstruct for the message logged at the iteration provided as argument
+				 */
+				std::string getExpectedMessage(const std::uint64_t & iteration) const;
+
+				/**
+				 * @brief Function: void checkCorruptedTrace(const std::string & trace, const std::string & corruption)
+				 *
+				 * \param trace: content of the corrupted trace
+				 * \param corruption: description of the corruption
+				 *
+				 * This function checks that the decoder reports an error when decoding a corrupted trace
+				 */
+				void checkCorruptedTrace(const std::string & trace, const std::string & corruption);
+
+		};
+
+	}
+
+}
+/** @} */ // End of TesterTestGroup group
+
+#endif // TRACE_LOG_TEST_H
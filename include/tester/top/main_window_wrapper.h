@@ -56,14 +56,15 @@ namespace tester {
 
 			public:
 				/**
-				 * @brief Function: explicit MainWindowWrapper(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags())
+				 * @brief Function: explicit MainWindowWrapper(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags(), const QString & sessionFile = QString())
 				 *
 				 * \param parent: parent window
 				 * \param flags: window flags
+				 * \param sessionFile: file the tabs of the window are saved to and restored from. An empty string disables sessions so that tests never touch the session of the user
 				 *
 				 * Main window tester wrapper constructor
 				 */
-				explicit MainWindowWrapper(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags());
+				explicit MainWindowWrapper(QWidget * parent, Qt::WindowFlags flags = Qt::WindowFlags(), const QString & sessionFile = QString());
 
 				// Move constructor
 				/**
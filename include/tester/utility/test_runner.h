@@ -8,7 +8,10 @@
  * @brief Test runner header file
  */
 
+#include <map>
 #include <list>
+#include <string>
+#include <chrono>
 
 #include "tester/base/suite.h"
 #include "tester/shared/enums.h"
@@ -69,6 +72,23 @@ namespace tester {
 				 */
 				void printResults() const;
 
+				/**
+				 * @brief Function: void writeReports() const
+				 *
+				 * This function writes the JUnit and timing reports requested on the command line
+				 * Reports only access files therefore they can be written regardless of the Qt platform the tests run on, e.g. offscreen
+				 */
+				void writeReports() const;
+
+				/**
+				 * @brief Function: bool isSuccessful() const
+				 *
+				 * \return true if no test failed, false otherwise
+				 *
+				 * This function returns whether all the selected tests passed
+				 */
+				bool isSuccessful() const;
+
 				/**
 				 * @brief Function: const std::string print() const override
 				 *
@@ -97,6 +117,18 @@ namespace tester {
 				 */
 				tester::base::Suite::tests_container_t failedTests;
 
+				/**
+				 * @brief median durations of the tests in the baseline by suite and test name
+				 *
+				 */
+				std::map<std::string, std::chrono::nanoseconds> baseline;
+
+				/**
+				 * @brief percentage a test can be slower than its baseline before failing
+				 *
+				 */
+				double baselineTolerance;
+
 				/**
 				 * @brief Function: void fillTestList()
 				 *
@@ -127,6 +159,39 @@ namespace tester {
 				 */
 				void addTestFromSuiteToTestList(const std::shared_ptr<tester::base::Suite> & suite, const std::string & testName, bool strictSearch);
 
+				/**
+				 * @brief Function: void loadBaseline()
+				 *
+				 * This function reads the durations of the tests recorded in the baseline provided on the command line and stores their median
+				 * It is called before running any test in order not to find out that the baseline is not valid only at the end of the run
+				 */
+				void loadBaseline();
+
+				/**
+				 * @brief Function: void checkBaseline()
+				 *
+				 * This function fails all tests run that are slower than their baseline by more than the baseline tolerance
+				 */
+				void checkBaseline();
+
+				/**
+				 * @brief Function: void writeJUnitReport(const std::string & filename) const
+				 *
+				 * \param filename: file to write the report to
+				 *
+				 * This function writes the results of the tests run in JUnit XML format
+				 */
+				void writeJUnitReport(const std::string & filename) const;
+
+				/**
+				 * @brief Function: void writeTimingReport(const std::string & filename) const
+				 *
+				 * \param filename: file to write the report to
+				 *
+				 * This function writes the time spent in every phase of the tests run in JSON format
+				 */
+				void writeTimingReport(const std::string & filename) const;
+
 				// Move and copy constructor
 				/**
 				 * @brief Disable move and copy constructors and operator= overloading for class TestRunner
@@ -8,4 +8,4 @@
 
 #include "app/base/json/action.h"
 
-LOGGING_CONTEXT(jsonActionOverall, jsonAction.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonActionOverall, jsonAction.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
@@ -14,7 +14,7 @@
 #include "app/base/json/data.h"
 
 // Categories
-LOGGING_CONTEXT(jsonDataOverall, jsonData.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonDataOverall, jsonData.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::json::Data::Data(const app::base::json::Data::parameter_t & jsonParameters) : app::printable_object::PrintableObject(), parameters(jsonParameters) {
 
@@ -13,7 +13,7 @@
 #include "app/base/menu/menu.h"
 
 // Categories
-LOGGING_CONTEXT(menuOverall, menu.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(menuOverall, menu.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::menu::Menu::Menu(QWidget * parent, std::weak_ptr<QMenuBar> menuBar, const char* menuName, const app::commands::KeySequence & key) : QWidget(parent), app::printable_object::PrintableObject(), menuBar(menuBar), menuName(menuName), key(key) {
 
@@ -12,7 +12,7 @@
 #include "app/shared/enums.h"
 #include "app/utility/logger/macros.h"
 
-LOGGING_CONTEXT(menuBarOverall, menuBar.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(menuBarOverall, menuBar.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::menu::MenuBar::MenuBar(QWidget * parent) : QMenuBar(parent) {
 	LOG_INFO(app::logger::info_level_e::ZERO, menuBarOverall, "Menu bar constructor");
@@ -16,7 +16,7 @@
 #include "app/shared/enums.h"
 
 // Categories
-LOGGING_CONTEXT(overlayedWidgetOverall, overlayedWidget.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(overlayedWidgetOverall, overlayedWidget.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::overlayed_widget::OverlayedWidget::OverlayedWidget(QWidget * parent, Qt::WindowFlags flags) : QWidget(parent, flags) {
 
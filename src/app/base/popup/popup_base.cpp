@@ -16,7 +16,7 @@
 #include "app/shared/enums.h"
 
 // Categories
-LOGGING_CONTEXT(popupBaseOverall, PopupBase.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(popupBaseOverall, PopupBase.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::popup::PopupBase::PopupBase(QWidget * parent, const bool & centerWidget, const int & widgetPadding, Qt::WindowFlags flags) : QWidget(parent, flags), app::base::popup::PopupProperties(centerWidget, widgetPadding) {
 
@@ -14,7 +14,7 @@
 #include "app/shared/enums.h"
 
 // Categories
-LOGGING_CONTEXT(popupContainerOverall, popupContainer.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(popupContainerOverall, popupContainer.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
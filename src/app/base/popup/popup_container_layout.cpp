@@ -13,7 +13,7 @@
 #include "app/utility/logger/macros.h"
 
 // Categories
-LOGGING_CONTEXT(popupContainerLayoutOverall, popupContainerLayout.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(popupContainerLayoutOverall, popupContainerLayout.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::popup::PopupContainerLayout::PopupContainerLayout(QWidget * parent) : QStackedLayout(parent) {
 
@@ -16,7 +16,7 @@
 #include "app/shared/enums.h"
 
 // Categories
-LOGGING_CONTEXT(popupPropertiesOverall, popupProperties.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(popupPropertiesOverall, popupProperties.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::popup::PopupProperties::PopupProperties(const bool & center, const int & sidePadding) : centered(center), padding(sidePadding) {
 
@@ -14,7 +14,7 @@
 #include "app/base/tabs/history.h"
 
 // Categories
-LOGGING_CONTEXT(tabHistoryOverall, tabHistory.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(tabHistoryOverall, tabHistory.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::tab::History::History(QWidget * parent, std::weak_ptr<app::base::tab::Tab> browserTab, QWebEngineHistory * newHistory): app::base::tab::TabComponentWidget<app::base::tab::stepping_e>(parent, browserTab), history(newHistory) {
 	LOG_INFO(app::logger::info_level_e::ZERO, tabHistoryOverall, "Tab history constructor");
@@ -14,8 +14,8 @@
 #include "app/base/tabs/load_manager.h"
 
 // Categories
-LOGGING_CONTEXT(tabLoadManagerOverall, tabLoadManager.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabLoadManagerStatus, tabLoadManager.status, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(tabLoadManagerOverall, tabLoadManager.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabLoadManagerStatus, tabLoadManager.status, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::tab::LoadManager::LoadManager(QWidget * parent): QWidget(parent), status(app::base::tab::load_status_e::IDLE), progress(0) {
 	LOG_INFO(app::logger::info_level_e::ZERO, tabLoadManagerOverall, "LoadManager constructor");
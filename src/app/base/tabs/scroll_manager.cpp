@@ -6,18 +6,19 @@
  * @brief Tab Scroll Manager functions
  */
 
+#include <algorithm>
+
 // Qt libraries
 #include <QtWidgets/QTabBar>
 
 #include "app/utility/cpp/cpp_operator.h"
 #include "app/utility/logger/macros.h"
-#include "app/shared/exception.h"
 #include "app/shared/setters_getters.h"
 #include "app/base/tabs/tab_bar.h"
 #include "app/base/tabs/scroll_manager.h"
 
 // Categories
-LOGGING_CONTEXT(tabScrollManagerOverall, tabScrollManager.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(tabScrollManagerOverall, tabScrollManager.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 	namespace base {
@@ -48,6 +49,13 @@ namespace app {
 					 *
 					 */
 					static constexpr int hScrollStep = 100;
+
+					/**
+					 * @brief minimum interval in milliseconds between two scroll requests sent to the page
+					 * Requests are sent at most once per frame
+					 *
+					 */
+					static constexpr int dispatchInterval = 16;
 				}
 
 			}
@@ -55,8 +63,12 @@ namespace app {
 	}
 }
 
-app::base::tab::ScrollManager::ScrollManager(QWidget * parent, std::weak_ptr<app::base::tab::Tab> browserTab, const std::shared_ptr<app::base::tab::TabBar> & tabBar): app::base::tab::TabComponentWidget<app::base::tab::direction_e>(parent, browserTab), horizontalScroll(0), verticalScroll(0), scrollPosition(QPointF(0.0, 0.0)), contentsSize(QSizeF(0.0, 0.0)), bar(tabBar) {
+app::base::tab::ScrollManager::ScrollManager(QWidget * parent, std::weak_ptr<app::base::tab::Tab> browserTab, const std::shared_ptr<app::base::tab::TabBar> & tabBar): app::base::tab::TabComponentWidget<app::base::tab::direction_e>(parent, browserTab), horizontalScroll(0), verticalScroll(0), scrollPosition(QPointF(0.0, 0.0)), contentsSize(QSizeF(0.0, 0.0)), bar(tabBar), dispatchTimer(std::make_unique<QTimer>(this)), pendingScroll(0, 0), scrollTarget(0, 0), scrollTargetValid(false) {
 	LOG_INFO(app::logger::info_level_e::ZERO, tabScrollManagerOverall, "ScrollManager constructor");
+
+	this->dispatchTimer->setSingleShot(true);
+	this->dispatchTimer->setInterval(app::base::tab::scroll_manager::dispatchInterval);
+	connect(this->dispatchTimer.get(), &QTimer::timeout, this, &app::base::tab::ScrollManager::dispatchScrollRequest);
 }
 
 app::base::tab::ScrollManager::~ScrollManager() {
@@ -75,6 +87,10 @@ void app::base::tab::ScrollManager::updateContentsSize(const QSizeF & value) {
 
 void app::base::tab::ScrollManager::updateScrollPosition(const QPointF & value) {
 	this->scrollPosition = value;
+	// While requests are being sent, the page may report positions older than the last request therefore the last target is kept
+	if (this->dispatchTimer->isActive() == false) {
+		this->scrollTargetValid = false;
+	}
 	this->updateVerticalScrollPercentage();
 	this->updateHorizontalScrollPercentage();
 }
@@ -90,10 +106,8 @@ void app::base::tab::ScrollManager::updateVerticalScrollPercentage() {
 		}
 		const qreal scrollableHeight = height - this->parentWidget()->size().rheight() - tabBarHeight;
 		const qreal & vScroll = this->scrollPosition.ry();
-		const qreal vScrollPercentage = 100.0 * vScroll/scrollableHeight;
-		this->verticalScroll = qRound(vScrollPercentage);
-
-		this->checkScrollValue(this->verticalScroll, "vertical");
+		// A page shorter than the viewport cannot be scrolled
+		this->verticalScroll = this->computeScrollPercentage(vScroll, scrollableHeight, "vertical").value_or(app::base::tab::scroll_manager::minScrollPercentage);
 
 		emit this->verticalScrollChanged(this->verticalScroll);
 	}
@@ -108,10 +122,8 @@ void app::base::tab::ScrollManager::updateHorizontalScrollPercentage() {
 	}
 	const qreal scrollableWidth = width - this->parentWidget()->size().rwidth() - tabBarWidth;
 	const qreal & hScroll = this->scrollPosition.rx();
-	const qreal hScrollPercentage = 100.0 * hScroll/scrollableWidth;
-	this->horizontalScroll = qRound(hScrollPercentage);
-
-	this->checkScrollValue(this->horizontalScroll, "horizontal");
+	// A page narrower than the viewport cannot be scrolled
+	this->horizontalScroll = this->computeScrollPercentage(hScroll, scrollableWidth, "horizontal").value_or(app::base::tab::scroll_manager::minScrollPercentage);
 
 	emit this->horizontalScrollChanged(this->horizontalScroll);
 }
@@ -124,45 +136,110 @@ const int & app::base::tab::ScrollManager::getHorizontalScrollPercentage() const
 	return this->horizontalScroll;
 }
 
-void app::base::tab::ScrollManager::checkScrollValue(const int & scroll, const QString & direction) const {
-	EXCEPTION_ACTION_COND(((scroll < app::base::tab::scroll_manager::minScrollPercentage) || (scroll > app::base::tab::scroll_manager::maxScrollPercentage)), throw, "Invalid value of " << direction << " scroll: " << scroll << ". Valid range is between " << app::base::tab::scroll_manager::minScrollPercentage << " and " << app::base::tab::scroll_manager::maxScrollPercentage);
+std::optional<int> app::base::tab::ScrollManager::computeScrollPercentage(const qreal & position, const qreal & scrollableSize, const QString & direction) const {
+	if (scrollableSize <= 0.0) {
+		return std::nullopt;
+	}
+
+	const int scroll = qRound(100.0 * position/scrollableSize);
+	if ((scroll < app::base::tab::scroll_manager::minScrollPercentage) || (scroll > app::base::tab::scroll_manager::maxScrollPercentage)) {
+		LOG_INFO(app::logger::info_level_e::MEDIUM, tabScrollManagerOverall, "Value of " << direction << " scroll " << scroll << " is outside the valid range between " << app::base::tab::scroll_manager::minScrollPercentage << " and " << app::base::tab::scroll_manager::maxScrollPercentage << " therefore it is clamped");
+		return std::clamp(scroll, app::base::tab::scroll_manager::minScrollPercentage, app::base::tab::scroll_manager::maxScrollPercentage);
+	}
+
+	return scroll;
 }
 
 void app::base::tab::ScrollManager::execute(const app::base::tab::direction_e & direction) {
 
+	int xAxisFactor = 0;
+	switch (direction) {
+		case app::base::tab::direction_e::LEFT:
+			xAxisFactor = -1;
+			break;
+		case app::base::tab::direction_e::RIGHT:
+			xAxisFactor = 1;
+			break;
+		default:
+			xAxisFactor = 0;
+			break;
+	}
+
+	int yAxisFactor = 0;
+	switch (direction) {
+		case app::base::tab::direction_e::UP:
+			yAxisFactor = -1;
+			break;
+		case app::base::tab::direction_e::DOWN:
+			yAxisFactor = 1;
+			break;
+		default:
+			yAxisFactor = 0;
+			break;
+	}
+
+	// Consecutive requests are merged into a single offset and sent to the page at most once per frame
+	this->pendingScroll += QPoint(xAxisFactor * app::base::tab::scroll_manager::hScrollStep, yAxisFactor * app::base::tab::scroll_manager::vScrollStep);
+
 	if (this->canProcessRequests() == true) {
-		int xAxisFactor = 0;
-		switch (direction) {
-			case app::base::tab::direction_e::LEFT:
-				xAxisFactor = -1;
-				break;
-			case app::base::tab::direction_e::RIGHT:
-				xAxisFactor = 1;
-				break;
-			default:
-				xAxisFactor = 0;
-				break;
-		}
-		const int xScroll = static_cast<int>(this->scrollPosition.rx()) + (xAxisFactor * app::base::tab::scroll_manager::hScrollStep);
-
-		int yAxisFactor = 0;
-		switch (direction) {
-			case app::base::tab::direction_e::UP:
-				yAxisFactor = -1;
-				break;
-			case app::base::tab::direction_e::DOWN:
-				yAxisFactor = 1;
-				break;
-			default:
-				yAxisFactor = 0;
-				break;
+		if (this->dispatchTimer->isActive() == false) {
+			this->dispatchScrollRequest();
 		}
-		const int yScroll = static_cast<int>(this->scrollPosition.ry()) + (yAxisFactor * app::base::tab::scroll_manager::vScrollStep);
+	} else if (this->requestQueue.empty() == true) {
+		// While the page is loading, the net offset keeps growing and a single idle request is queued in order to send it once the page has loaded
+		this->pushRequestQueue(app::base::tab::direction_e::IDLE);
+	}
+}
+
+void app::base::tab::ScrollManager::dispatchScrollRequest() {
+	if (this->pendingScroll.isNull() == true) {
+		// No request since the last one was sent: the timer is left stopped
+		return;
+	}
+
+	if (this->canProcessRequests() == false) {
+		// The offset is sent when the request queued while the page is loading is executed
+		return;
+	}
+
+	const QPoint startPosition = (this->scrollTargetValid == true) ? this->scrollTarget : this->scrollPosition.toPoint();
+	const QPoint position = this->clampScrollPosition(startPosition + this->pendingScroll);
+
+	this->pendingScroll = QPoint(0, 0);
+	this->scrollTarget = position;
+	this->scrollTargetValid = true;
 
-		emit this->scrollRequest(xScroll, yScroll);
+	this->dispatchTimer->start();
+
+	emit this->scrollRequest(position.x(), position.y());
+}
+
+QSize app::base::tab::ScrollManager::getViewportSize() const {
+	QSize viewportSize(this->parentWidget()->size());
+
+	const QTabBar::Shape & barShape = this->bar->shape();
+	if ((barShape == QTabBar::RoundedNorth) || (barShape == QTabBar::RoundedSouth) || (barShape == QTabBar::TriangularNorth) || (barShape == QTabBar::TriangularSouth)) {
+		viewportSize.rheight() -= this->bar->size().height();
 	} else {
-		this->pushRequestQueue(direction);
+		viewportSize.rwidth() -= this->bar->size().width();
 	}
+
+	return viewportSize;
+}
+
+QPoint app::base::tab::ScrollManager::clampScrollPosition(const QPoint & position) const {
+	QPoint clampedPosition(std::max(0, position.x()), std::max(0, position.y()));
+
+	// The size of the content is not known before the page reports it
+	if (this->contentsSize.isEmpty() == false) {
+		const QSize viewportSize(this->getViewportSize());
+		const int maxX = std::max(0, qRound(this->contentsSize.width()) - viewportSize.width());
+		const int maxY = std::max(0, qRound(this->contentsSize.height()) - viewportSize.height());
+		clampedPosition.setX(std::min(clampedPosition.x(), maxX));
+		clampedPosition.setY(std::min(clampedPosition.y(), maxY));
+	}
+
+	return clampedPosition;
 }
 
 bool app::base::tab::ScrollManager::canProcessRequests() const {
@@ -17,11 +17,12 @@
 #include "app/base/tabs/web_engine_page.h"
 #include "app/shared/enums.h"
 #include "app/shared/exception.h"
+#include "app/shared/setters_getters.h"
 #include "app/utility/logger/macros.h"
 
 // Categories
-LOGGING_CONTEXT(tabSearchOverall, tabSearch.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabSearchFind, tabSearch.find, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(tabSearchOverall, tabSearch.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabSearchFind, tabSearch.find, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::tab::Search::Search(QWidget * parent, std::weak_ptr<app::base::tab::Tab> attachedTab): app::base::tab::TabComponentWidget<app::windows::shared::FindSettings>(parent, attachedTab), settings(QString(), app::shared::offset_type_e::IDLE, false, false), callback(nullptr) {
 	LOG_INFO(app::logger::info_level_e::ZERO, tabSearchOverall, "Tab search constructor");
@@ -32,6 +33,8 @@ app::base::tab::Search::~Search() {
 
 }
 
+CONST_SETTER_GETTER(app::base::tab::Search::setSettings, app::base::tab::Search::getSettings, app::windows::shared::FindSettings &, this->settings)
+
 void app::base::tab::Search::execute(const app::windows::shared::FindSettings & newSettings) {
 
 	this->settings = newSettings;
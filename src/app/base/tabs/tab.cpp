@@ -21,8 +21,8 @@
 #include "app/base/tabs/history.h"
 
 // Categories
-LOGGING_CONTEXT(tabOverall, tab.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabSize, tab.size, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(tabOverall, tab.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabSize, tab.size, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::tab::Tab::Tab(QWidget * parent): QWidget(parent), view(Q_NULLPTR), loadManager(Q_NULLPTR), search(Q_NULLPTR), history(Q_NULLPTR), settings(Q_NULLPTR), scrollManager(Q_NULLPTR) {
 	LOG_INFO(app::logger::info_level_e::ZERO, tabOverall, "Tab constructor");
@@ -118,6 +118,34 @@ CONST_GETTER(app::base::tab::Tab::getScrollManager, std::shared_ptr<app::base::t
 CONST_GETTER(app::base::tab::Tab::getSettings, std::shared_ptr<app::base::tab::WebEngineSettings>, this->settings)
 CONST_REF_SETTER(app::base::tab::Tab::setSettings, std::shared_ptr<app::base::tab::WebEngineSettings>, this->settings)
 
+void app::base::tab::Tab::releaseComponents() {
+	LOG_INFO(app::logger::info_level_e::ZERO, tabOverall, "Release view and components of tab");
+
+	if (this->progressValueConnection) {
+		disconnect(this->progressValueConnection);
+	}
+
+	if (this->vScrollValueConnection) {
+		disconnect(this->vScrollValueConnection);
+	}
+
+	if (this->hScrollValueConnection) {
+		disconnect(this->hScrollValueConnection);
+	}
+
+	if (this->historyItemChangedConnection) {
+		disconnect(this->historyItemChangedConnection);
+	}
+
+	// Components refer to the view and its page therefore they must be destroyed first
+	this->scrollManager.reset();
+	this->search.reset();
+	this->history.reset();
+	this->settings.reset();
+	this->loadManager.reset();
+	this->view.reset();
+}
+
 void app::base::tab::Tab::resize(const QSize size) {
 	// Resize view
 	if (this->view != Q_NULLPTR) {
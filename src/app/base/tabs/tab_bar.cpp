@@ -15,9 +15,9 @@
 #include "app/utility/cpp/cpp_operator.h"
 
 // Categories
-LOGGING_CONTEXT(tabBarOverall, tabBar.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabBarSize, tabBar.size, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabBarSearch, tabBar.search, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(tabBarOverall, tabBar.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabBarSize, tabBar.size, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabBarSearch, tabBar.search, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 	namespace base {
@@ -12,4 +12,4 @@
 #include "app/shared/exception.h"
 
 // Categories
-LOGGING_CONTEXT(tabComponentWidgetOverall, tabComponentWidget.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(tabComponentWidgetOverall, tabComponentWidget.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
@@ -19,11 +19,11 @@
 #include "app/base/tabs/tab_widget.h"
 
 // Categories
-LOGGING_CONTEXT(tabWidgetOverall, tabWidget.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabWidgetSize, tabWidget.size, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabWidgetSearch, tabWidget.search, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabWidgetVisibility, tabWidget.visibility, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(tabWidgetTabs, tabWidget.tabs, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(tabWidgetOverall, tabWidget.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabWidgetSize, tabWidget.size, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabWidgetSearch, tabWidget.search, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabWidgetVisibility, tabWidget.visibility, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabWidgetTabs, tabWidget.tabs, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 	namespace base {
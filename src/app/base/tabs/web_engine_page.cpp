@@ -14,7 +14,7 @@
 #include "app/base/tabs/web_engine_page.h"
 
 // Categories
-LOGGING_CONTEXT(webEnginePageOverall, webEnginePage.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(webEnginePageOverall, webEnginePage.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::tab::WebEnginePage::WebEnginePage(QWidget * parent, app::base::tab::WebEngineProfile * profile): QWebEnginePage(profile, parent) {
 	LOG_INFO(app::logger::info_level_e::ZERO, webEnginePageOverall, "Web engine page constructor");
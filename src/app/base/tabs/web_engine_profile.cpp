@@ -6,27 +6,81 @@
  * @brief Web engine profile functions
  */
 
+#include <limits>
+#include <stdexcept>
+
 // Qt libraries
 #include <QtGui/QKeyEvent>
 
 #include "app/utility/logger/macros.h"
 #include "app/base/tabs/web_engine_profile.h"
 #include "app/shared/exception.h"
+#include "app/settings/global.h"
 
 // Categories
-LOGGING_CONTEXT(webEngineProfileOverall, webEngineProfile.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(webEngineProfileOverall, webEngineProfile.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(webEngineProfileSettings, webEngineProfile.settings, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::base::tab::WebEngineProfile * app::base::tab::WebEngineProfile::defaultProfile() {
+namespace app {
+
+	namespace base {
+
+		namespace tab {
+
+			namespace web_engine_profile {
+
+				namespace {
+					/**
+					 * @brief value of the profile storage setting keeping the profile in memory
+					 *
+					 */
+					static const std::string memoryStorage("memory");
+
+					/**
+					 * @brief number of bytes in a MB
+					 *
+					 */
+					static constexpr int bytesInMB = 1024 * 1024;
+
+				}
+
+			}
+
+		}
 
-	try {
-		static app::base::tab::WebEngineProfile * profile = dynamic_cast<app::base::tab::WebEngineProfile *>(QWebEngineProfile::defaultProfile());
-		return profile;
-	} catch (const std::bad_cast & badCastE) {
-		EXCEPTION_ACTION(throw, badCastE.what());
 	}
 
-	return Q_NULLPTR;
+}
 
+app::base::tab::WebEngineProfile * app::base::tab::WebEngineProfile::defaultProfile() {
+	// The profile is never deleted as pages may still be using it while the application shuts down
+	static app::base::tab::WebEngineProfile * profile = [] () {
+		app::base::tab::WebEngineProfile * newProfile = new app::base::tab::WebEngineProfile(app::base::tab::WebEngineProfile::getDefaultStorageName(), nullptr);
+		newProfile->applySettings();
+		return newProfile;
+	}();
+
+	return profile;
+}
+
+std::string app::base::tab::WebEngineProfile::getSetting(const std::string & name, const bool & allowEmpty) {
+	const app::command_line::argument_map_t & settingsMap = app::settings::Global::getInstance()->getSettingsMap();
+	const auto & argument = settingsMap.find(name);
+	EXCEPTION_ACTION_COND((argument == settingsMap.cend()), throw, "Unable to find setting " << name << " of the web engine profile");
+	const std::string & value = argument->second;
+	EXCEPTION_ACTION_COND(((allowEmpty == false) && (value.empty() == true)), throw, "Setting " << name << " of the web engine profile cannot be an empty string");
+	return value;
+}
+
+QString app::base::tab::WebEngineProfile::getDefaultStorageName() {
+	const std::string storage(app::base::tab::WebEngineProfile::getSetting("Profile Storage", false));
+
+	// A profile without storage name is off-the-record therefore nothing is written to disk
+	if (storage.compare(app::base::tab::web_engine_profile::memoryStorage) == 0) {
+		return QString();
+	}
+
+	return QString::fromStdString(app::base::tab::WebEngineProfile::getSetting("Profile Name", false));
 }
 
 app::base::tab::WebEngineProfile::WebEngineProfile(const QString & storageName, QObject * parent): QWebEngineProfile(storageName, parent) {
@@ -38,3 +92,44 @@ app::base::tab::WebEngineProfile::~WebEngineProfile() {
 	LOG_INFO(app::logger::info_level_e::ZERO, webEngineProfileOverall, "Web engine profile destructor");
 
 }
+
+void app::base::tab::WebEngineProfile::applySettings() {
+	const std::string cacheSize(app::base::tab::WebEngineProfile::getSetting("Profile Cache Size", false));
+	int cacheSizeMB = 0;
+	std::size_t parsedCharacters = 0;
+	try {
+		cacheSizeMB = std::stoi(cacheSize, &parsedCharacters);
+	} catch (const std::logic_error &) {
+		// std::stoi throws std::invalid_argument if no number is found and std::out_of_range if the number does not fit into an int
+		EXCEPTION_ACTION(throw, "Profile cache size must be an integer number of MB. Got " << cacheSize);
+	}
+	EXCEPTION_ACTION_COND((parsedCharacters != cacheSize.size()), throw, "Profile cache size must be an integer number of MB. Got " << cacheSize);
+	EXCEPTION_ACTION_COND(((cacheSizeMB < 0) || (cacheSizeMB > (std::numeric_limits<int>::max() / app::base::tab::web_engine_profile::bytesInMB))), throw, "Profile cache size must be a value between 0 and " << (std::numeric_limits<int>::max() / app::base::tab::web_engine_profile::bytesInMB) << " MB. Got " << cacheSizeMB << " MB");
+	// A size of 0 lets the web engine choose the size of the cache
+	this->setHttpCacheMaximumSize(cacheSizeMB * app::base::tab::web_engine_profile::bytesInMB);
+
+	if (this->isOffTheRecord() == true) {
+		// Off-the-record profiles keep the HTTP cache and all cookies in memory regardless of the settings
+		this->setHttpCacheType(QWebEngineProfile::MemoryHttpCache);
+		this->setPersistentCookiesPolicy(QWebEngineProfile::NoPersistentCookies);
+	} else {
+		const std::string cacheDirectory(app::base::tab::WebEngineProfile::getSetting("Profile Cache Directory", true));
+		if (cacheDirectory.empty() == false) {
+			this->setCachePath(QString::fromStdString(cacheDirectory));
+		}
+		this->setHttpCacheType(QWebEngineProfile::DiskHttpCache);
+
+		const std::string cookies(app::base::tab::WebEngineProfile::getSetting("Profile Persistent Cookies", false));
+		if (cookies.compare("no") == 0) {
+			this->setPersistentCookiesPolicy(QWebEngineProfile::NoPersistentCookies);
+		} else if (cookies.compare("allow") == 0) {
+			this->setPersistentCookiesPolicy(QWebEngineProfile::AllowPersistentCookies);
+		} else if (cookies.compare("force") == 0) {
+			this->setPersistentCookiesPolicy(QWebEngineProfile::ForcePersistentCookies);
+		} else {
+			EXCEPTION_ACTION(throw, "Unknown persistent cookie policy " << cookies);
+		}
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, webEngineProfileSettings, "Web engine profile " << this->storageName() << " (off-the-record " << this->isOffTheRecord() << ") stores the HTTP cache in " << this->cachePath() << " with maximum size " << this->httpCacheMaximumSize() << " bytes");
+}
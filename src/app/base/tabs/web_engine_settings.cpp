@@ -13,7 +13,7 @@
 #include "app/base/tabs/web_engine_settings.h"
 
 // Categories
-LOGGING_CONTEXT(webEngineSettingsOverall, webEngineSettings.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(webEngineSettingsOverall, webEngineSettings.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::tab::WebEngineSettings::WebEngineSettings(QWebEngineSettings * newSettings): settings(newSettings) {
 	LOG_INFO(app::logger::info_level_e::ZERO, webEngineSettingsOverall, "Web engine settings constructor");
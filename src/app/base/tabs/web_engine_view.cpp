@@ -15,18 +15,21 @@
 #include "app/base/tabs/web_engine_view.h"
 
 // Categories
-LOGGING_CONTEXT(webEngineViewOverall, webEngineView.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(webEngineViewOverall, webEngineView.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::base::tab::WebEngineView::WebEngineView(QWidget * parent, std::weak_ptr<app::base::tab::Tab> attachedTab): QWebEngineView(parent) {
+// Use deleteLater to schedule a destruction event in the event loop
+app::base::tab::WebEngineView::WebEngineView(QWidget * parent, std::weak_ptr<app::base::tab::Tab> attachedTab): app::base::tab::WebEngineView(parent, attachedTab, std::shared_ptr<app::base::tab::WebEnginePage>(new app::base::tab::WebEnginePage(parent, app::base::tab::WebEngineProfile::defaultProfile()), [] (app::base::tab::WebEnginePage * p) {
+	p->deleteLater();
+})) {
+
+}
+
+app::base::tab::WebEngineView::WebEngineView(QWidget * parent, std::weak_ptr<app::base::tab::Tab> attachedTab, const std::shared_ptr<app::base::tab::WebEnginePage> & newPage): QWebEngineView(parent) {
 	LOG_INFO(app::logger::info_level_e::ZERO, webEngineViewOverall, "Web engine view constructor");
 
 	this->browserTab.reset();
 	this->setTab(attachedTab);
 
-	// Use deleteLater to schedule a destruction event in the event loop
-	std::shared_ptr<app::base::tab::WebEnginePage> newPage = std::shared_ptr<app::base::tab::WebEnginePage>(new app::base::tab::WebEnginePage(parent, app::base::tab::WebEngineProfile::defaultProfile()), [] (app::base::tab::WebEnginePage * p) {
-		p->deleteLater();
-	});
 	this->updatePage(newPage);
 }
 
@@ -22,7 +22,7 @@
 #include "app/windows/secondary_windows/shared/utility.h"
 
 // Categories
-LOGGING_CONTEXT(fileHandlingWidgetsOverall, fileHandlingWidgets.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(fileHandlingWidgetsOverall, fileHandlingWidgets.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::window::FileHandlingWidgets::FileHandlingWidgets(QWidget *widgetParent) :
 	pathToOpen(Q_NULLPTR),
@@ -16,7 +16,7 @@
 #include "app/widgets/commands/key_sequence.h"
 
 // Categories
-LOGGING_CONTEXT(openContentOverall, openContent.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(openContentOverall, openContent.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::base::window::OpenContent::OpenContent(QWidget *widgetParent) : app::base::window::FileHandlingWidgets(widgetParent) {
 
@@ -24,6 +24,15 @@ namespace app {
 				 *
 				 */
 				static const std::vector<std::string> keyNames{"Key", "Name", "ShortCmd", "LongCmd", "DefaultValue", "ValidValues", "NumberArguments", "Help"};
+
+				/**
+				 * @brief parameters whose value is indexed
+				 *
+				 */
+				static const app::command_line::Argument::indexed_parameter_map_t indexedParameters = {
+					{ "ShortCmd", app::command_line::Argument::indexed_parameter_e::SHORT_CMD },
+					{ "LongCmd", app::command_line::Argument::indexed_parameter_e::LONG_CMD }
+				};
 			}
 
 		}
@@ -33,7 +42,7 @@ namespace app {
 }
 
 // Categories
-LOGGING_CONTEXT(commandLineArgumentOverall, commandLineArgument.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(commandLineArgumentOverall, commandLineArgument.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 std::shared_ptr<app::command_line::Argument> app::command_line::Argument::makeArgument(const std::string & jsonKey, const std::string & nameKeyValue, const std::string & shortCmdKeyValue, const std::string & longCmdKeyValue, const std::string & defaultValueKeyValue, const std::list<std::string> & validValuesKeyValue, const int & numberOfArgumentsKeyValue, const std::string & helpKeyValue) {
 	std::shared_ptr<app::command_line::Argument> newData = std::make_shared<app::command_line::Argument>(jsonKey, nameKeyValue, shortCmdKeyValue, longCmdKeyValue, defaultValueKeyValue, validValuesKeyValue, numberOfArgumentsKeyValue, helpKeyValue);
@@ -250,6 +259,33 @@ bool app::command_line::Argument::isSameFieldValue(const std::string & name, con
 	return isSame;
 }
 
+const app::command_line::Argument::indexed_parameter_map_t & app::command_line::Argument::getIndexedParameters() {
+	return app::command_line::argument::indexedParameters;
+}
+
+app::base::json::Data::index_key_t app::command_line::Argument::toIndexKey(const app::command_line::Argument::indexed_parameter_e & parameter, const void * value) {
+	app::base::json::Data::index_key_t indexKey = 0;
+
+	// All indexed parameters are strings
+	if ((parameter == app::command_line::Argument::indexed_parameter_e::SHORT_CMD) || (parameter == app::command_line::Argument::indexed_parameter_e::LONG_CMD)) {
+		indexKey = std::string_view(*static_cast<const std::string *>(value));
+	}
+
+	return indexKey;
+}
+
+app::base::json::Data::index_key_t app::command_line::Argument::getIndexKey(const app::command_line::Argument::indexed_parameter_e & parameter) const {
+	app::base::json::Data::index_key_t indexKey = 0;
+
+	if (parameter == app::command_line::Argument::indexed_parameter_e::SHORT_CMD) {
+		indexKey = std::string_view(this->shortCmd);
+	} else if (parameter == app::command_line::Argument::indexed_parameter_e::LONG_CMD) {
+		indexKey = std::string_view(this->longCmd);
+	}
+
+	return indexKey;
+}
+
 bool app::command_line::Argument::operator==(const app::command_line::Argument & rhs) {
 	bool isSame = true;
 	isSame &= app::base::json::Data::operator==(rhs);
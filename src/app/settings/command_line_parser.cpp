@@ -15,7 +15,7 @@
 #include "app/shared/exception.h"
 #include "app/settings/command_line_parser.h"
 
-LOGGING_CONTEXT(commandLineParserOverall, commandLineParser.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(commandLineParserOverall, commandLineParser.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::command_line::Parser::Parser(int & argc, char** argv) : app::base::json::Action<app::command_line::Argument>(), argc(argc), argv(argv), decodedArguments(app::command_line::argument_map_t()) {
 
@@ -108,8 +108,8 @@ void app::command_line::Parser::extractArguments() {
 		const std::string replacingString("");
 		const std::string prunedOption(app::utility::findAndReplaceString(option, searchString, replacingString));
 
-		const std::unique_ptr<app::command_line::Argument> & shortCmdMatch = this->findDataWithFieldValue("ShortCmd", &prunedOption);
-		const std::unique_ptr<app::command_line::Argument> & longCmdMatch = this->findDataWithFieldValue("LongCmd", &prunedOption);
+		const std::unique_ptr<app::command_line::Argument> & shortCmdMatch = this->findByShortCmd(prunedOption);
+		const std::unique_ptr<app::command_line::Argument> & longCmdMatch = this->findByLongCmd(prunedOption);
 
 		// An option cannot match a short and long command at the same time
 		EXCEPTION_ACTION_COND(((shortCmdMatch != this->getInvalidData()) && (longCmdMatch != this->getInvalidData())), throw, "Option " << option << " matches a short or long command");
@@ -200,6 +200,14 @@ void app::command_line::Parser::addItemToActionData(std::unique_ptr<app::command
 	data->setValueFromMemberName(key, valuePtr);
 }
 
+const std::unique_ptr<app::command_line::Argument> & app::command_line::Parser::findByShortCmd(const std::string & shortCmd) const {
+	return this->findIndexedData(app::command_line::Argument::indexed_parameter_e::SHORT_CMD, std::string_view(shortCmd));
+}
+
+const std::unique_ptr<app::command_line::Argument> & app::command_line::Parser::findByLongCmd(const std::string & longCmd) const {
+	return this->findIndexedData(app::command_line::Argument::indexed_parameter_e::LONG_CMD, std::string_view(longCmd));
+}
+
 void app::command_line::Parser::populateDefaultDecodedArguments() {
 	for (const auto & item : this->actionData) {
 		const auto & argument = item.second;
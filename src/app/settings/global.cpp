@@ -6,13 +6,20 @@
  * @brief Browser settings functions
  */
 
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+
 #include "app/shared/enums.h"
 #include "app/shared/exception.h"
 #include "app/shared/setters_getters.h"
 #include "app/utility/logger/macros.h"
+#include "app/utility/logger/backend.h"
+#include "app/utility/logger/trace.h"
+#include "app/utility/logger/registry.h"
 #include "app/settings/global.h"
 
-LOGGING_CONTEXT(browserSettingsOverall, browserSettings.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(browserSettingsOverall, browserSettings.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 /**
  * @brief log filename
@@ -52,6 +59,18 @@ namespace app {
 				 *
 				 */
 				static const std::string jsonFullPath(jsonPath + jsonName);
+
+				/**
+				 * @brief Number of bytes in a megabyte, the unit of the sizes of log files on the command line
+				 *
+				 */
+				static const std::uint64_t bytesInMegabyte = 1024 * 1024;
+
+				/**
+				 * @brief Environment variable storing the logging rules if they are not given on the command line
+				 *
+				 */
+				static const std::string logRulesVariable("BROWSER_LOG_RULES");
 			}
 
 		}
@@ -129,6 +148,83 @@ void app::settings::Global::initialize() {
 		this->overrideArgumentValue("Log", app::settings::Global::getLogFilePath());
 	}
 
+	const app::command_line::argument_map_t & settingsMap = this->getSettingsMap();
+
+	const auto & queuePolicyArgument = settingsMap.find("Log Queue Policy");
+	if (queuePolicyArgument != settingsMap.cend()) {
+		const std::string & queuePolicy = queuePolicyArgument->second;
+		if (queuePolicy.compare("drop") == 0) {
+			app::logger::Backend::getInstance()->setQueuePolicy(app::logger::queue_policy_e::DROP);
+		} else {
+			app::logger::Backend::getInstance()->setQueuePolicy(app::logger::queue_policy_e::BLOCK);
+		}
+	}
+
+	const auto & flushIntervalArgument = settingsMap.find("Log Flush Interval");
+	if (flushIntervalArgument != settingsMap.cend()) {
+		const std::string & flushInterval = flushIntervalArgument->second;
+		EXCEPTION_ACTION_COND((flushInterval.empty() == true), throw, "Log flush interval cannot be an empty string");
+		app::logger::Backend::getInstance()->setFlushInterval(std::stoi(flushInterval));
+	}
+
+	app::logger::rotation_s rotation(app::logger::Backend::getInstance()->getRotation());
+
+	const auto & maxSizeArgument = settingsMap.find("Log Max Size");
+	if (maxSizeArgument != settingsMap.cend()) {
+		const std::string & maxSize = maxSizeArgument->second;
+		EXCEPTION_ACTION_COND((maxSize.empty() == true), throw, "Log max size cannot be an empty string");
+		rotation.maxFileSize = static_cast<std::uint64_t>(std::stoull(maxSize)) * app::settings::global::bytesInMegabyte;
+	}
+
+	const auto & maxAgeArgument = settingsMap.find("Log Max Age");
+	if (maxAgeArgument != settingsMap.cend()) {
+		const std::string & maxAge = maxAgeArgument->second;
+		EXCEPTION_ACTION_COND((maxAge.empty() == true), throw, "Log max age cannot be an empty string");
+		rotation.maxFileAge = static_cast<std::int64_t>(std::stoll(maxAge));
+	}
+
+	const auto & segmentsArgument = settingsMap.find("Log Segments");
+	if (segmentsArgument != settingsMap.cend()) {
+		const std::string & segments = segmentsArgument->second;
+		EXCEPTION_ACTION_COND((segments.empty() == true), throw, "Log segments cannot be an empty string");
+		rotation.segments = std::stoi(segments);
+	}
+
+	const auto & compressionArgument = settingsMap.find("Log Compression");
+	if (compressionArgument != settingsMap.cend()) {
+		rotation.compress = (compressionArgument->second.compare("1") == 0);
+	}
+
+	const auto & diskBudgetArgument = settingsMap.find("Log Disk Budget");
+	if (diskBudgetArgument != settingsMap.cend()) {
+		const std::string & diskBudget = diskBudgetArgument->second;
+		EXCEPTION_ACTION_COND((diskBudget.empty() == true), throw, "Log disk budget cannot be an empty string");
+		rotation.diskBudget = static_cast<std::uint64_t>(std::stoull(diskBudget)) * app::settings::global::bytesInMegabyte;
+	}
+
+	app::logger::Backend::getInstance()->setRotation(rotation);
+
+	const auto & traceLogArgument = settingsMap.find("Trace Log");
+	if (traceLogArgument != settingsMap.cend()) {
+		app::logger::Tracer::getInstance()->setFilename(traceLogArgument->second);
+	}
+
+	std::string logRules = std::string();
+	const auto & logRulesArgument = settingsMap.find("Log Rules");
+	if (logRulesArgument != settingsMap.cend()) {
+		logRules = logRulesArgument->second;
+	}
+	if (logRules.empty() == true) {
+		const char * logRulesVariable = std::getenv(app::settings::global::logRulesVariable.c_str());
+		if (logRulesVariable != nullptr) {
+			logRules = logRulesVariable;
+		}
+	}
+	app::logger::Registry::getInstance()->setRules(logRules);
+
+	LOG_INFO(app::logger::info_level_e::ZERO, browserSettingsOverall, "Log queue policy set to " << app::logger::Backend::getInstance()->getQueuePolicy() << " and flush interval set to " << app::logger::Backend::getInstance()->getFlushInterval() << "ms");
+	LOG_INFO(app::logger::info_level_e::ZERO, browserSettingsOverall, "Logging rules set to \"" << logRules << "\"");
+	LOG_INFO(app::logger::info_level_e::ZERO, browserSettingsOverall, "Log files rotated at " << rotation.maxFileSize << " bytes or " << rotation.maxFileAge << " s keeping " << rotation.segments << " segments within " << rotation.diskBudget << " bytes - compression " << rotation.compress);
 }
 
 const std::string app::settings::Global::print() const {
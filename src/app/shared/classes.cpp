@@ -10,7 +10,7 @@
 #include "app/utility/cpp/cpp_operator.h"
 #include "app/utility/logger/macros.h"
 
-LOGGING_CONTEXT(qactionCompare, qaction.compare, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(qactionCompare, qaction.compare, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 bool app::shared::StringCompare::operator() (const std::string & rhs, const std::string & lhs) const {
 	return (rhs.compare(lhs) < 0);
@@ -12,10 +12,14 @@
 #include "app/shared/logging.h"
 
 QString app::shared::getDateTime() {
+	return app::shared::getDateTime(QDateTime::currentMSecsSinceEpoch());
+}
+
+QString app::shared::getDateTime(const qint64 & msecsSinceEpoch) {
 	QString datetimeStr = QString();
 
 	QLocale locale(QLocale::AnyLanguage, QLocale::AnyScript, QLocale::AnyCountry);
-	QDateTime datetime = QDateTime::currentDateTime();
+	QDateTime datetime = QDateTime::fromMSecsSinceEpoch(msecsSinceEpoch);
 	datetime.setTimeSpec(Qt::TimeZone);
 	datetimeStr.append(locale.toString(datetime, QLocale::ShortFormat));
 	datetimeStr.append(" ");
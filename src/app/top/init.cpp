@@ -6,32 +6,92 @@
  * @brief Initialization functions of the program
  */
 #include <memory>
+#include <string>
 
 // Qt libraries
 #include <QtWidgets/QApplication>
 
 #include "app/utility/logger/macros.h"
+#include "app/utility/profiler/startup_profiler.h"
 #include "app/shared/enums.h"
+#include "app/shared/exception.h"
 #include "app/windows/main_window/window/wrapper.h"
+#include "app/windows/main_window/window/main_window.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/session/store.h"
 #include "app/top/init.h"
 #include "app/settings/global.h"
 
 // Categories
-LOGGING_CONTEXT(initGraphicsOverall, init.graphics.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(initGraphicsOverall, init.graphics.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 void app::init::initializeSettings(int & argc, char** argv) {
 	app::settings::Global::getInstance()->initialize(argc, argv);
 }
 
 void app::init::initializeGraphics(int & argc, char** argv) {
+	app::utility::StartupProfiler * profiler = app::utility::StartupProfiler::getInstance();
+
+	profiler->startPhase("Application construction");
 	QApplication app(argc, argv);
 	app.setQuitOnLastWindowClosed(true);
+	profiler->endPhase("Application construction");
 
 	LOG_INFO(app::logger::info_level_e::ZERO, initGraphicsOverall, "Create Application");
 
-	std::unique_ptr<app::main_window::window::Wrapper> window = std::make_unique<app::main_window::window::Wrapper>(Q_NULLPTR, Qt::Window);
+	const app::command_line::argument_map_t & settingsMap = app::settings::Global::getInstance()->getSettingsMap();
+	QString sessionFile = QString();
+	const auto & sessionFileArgument = settingsMap.find("Session File");
+	if (sessionFileArgument != settingsMap.cend()) {
+		sessionFile = QString::fromStdString(sessionFileArgument->second);
+	}
+
+	profiler->startPhase("Window construction");
+	std::unique_ptr<app::main_window::window::Wrapper> window = std::make_unique<app::main_window::window::Wrapper>(Q_NULLPTR, Qt::Window, sessionFile);
+	profiler->endPhase("Window construction");
+
+	const auto & restoreSessionArgument = settingsMap.find("Restore Session");
+	if (restoreSessionArgument != settingsMap.cend()) {
+		const std::string & restoreSessionValue = restoreSessionArgument->second;
+		EXCEPTION_ACTION_COND((restoreSessionValue.empty() == true), throw, "Restore session setting cannot be an empty string");
+		if (std::stoi(restoreSessionValue) != 0) {
+			// Tabs are restored before the window is shown in order to show the current tab of the session straight away
+			profiler->startPhase("Session restore");
+			const int restoredTabs = window->getWindow()->getCore()->session->restore();
+			profiler->endPhase("Session restore");
+			LOG_INFO(app::logger::info_level_e::ZERO, initGraphicsOverall, "Restored " << restoredTabs << " tabs from the last session");
+		}
+	}
+
+	std::string startupProfile("none");
+	const auto & startupProfileArgument = settingsMap.find("Startup Profile");
+	if (startupProfileArgument != settingsMap.cend()) {
+		startupProfile = startupProfileArgument->second;
+	}
+
+	std::string startupTrace = std::string();
+	const auto & startupTraceArgument = settingsMap.find("Startup Trace");
+	if (startupTraceArgument != settingsMap.cend()) {
+		startupTrace = startupTraceArgument->second;
+	}
+
+	std::unique_ptr<app::utility::FirstPaintWatcher> paintWatcher = nullptr;
+	if (startupProfile.compare("none") != 0) {
+		const bool exitAfterReport = (startupProfile.compare("exit") == 0);
+		paintWatcher = std::make_unique<app::utility::FirstPaintWatcher>(window->getWindow().get(), [profiler, startupTrace, exitAfterReport] () {
+			profiler->endPhase("First paint");
+			profiler->report(startupTrace);
+			if (exitAfterReport == true) {
+				QCoreApplication::quit();
+			}
+		});
+	}
+
+	profiler->startPhase("First show");
 	window->show();
+	profiler->endPhase("First show");
 
+	profiler->startPhase("First paint");
 	app.exec();
 }
 
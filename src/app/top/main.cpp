@@ -13,6 +13,7 @@
 #include "app/utility/logger/macros.h"
 #include "app/utility/exception/exception.h"
 #include "app/utility/log/logging.h"
+#include "app/utility/profiler/startup_profiler.h"
 #include "app/settings/global.h"
 
 /** @addtogroup MainGroup
@@ -32,16 +33,22 @@
 int main (int argc, char* argv[]) {
 
 	try {
+		app::utility::StartupProfiler * profiler = app::utility::StartupProfiler::getInstance();
+
+		profiler->startPhase("Logger initialization");
 		app::logging::set_default_category();
 		qInstallMessageHandler(app::logging::handler);
 
 		app::settings::Global::setLogPath(argc, argv);
+		profiler->endPhase("Logger initialization");
 
 		LOG_INFO(app::logger::info_level_e::ZERO, , "Starting browser");
 		LOG_INFO(app::logger::info_level_e::ZERO, , "Built on " << __DATE__ << " at " << __TIME__);
 		LOG_INFO(app::logger::info_level_e::ZERO, , "QT version " << QT_VERSION_STR);
 
+		profiler->startPhase("Argument parsing");
 		app::init::initializeSettings(argc, argv);
+		profiler->endPhase("Argument parsing");
 
 		const app::command_line::argument_map_t & settingsMap = app::settings::Global::getInstance()->getSettingsMap();
 
@@ -9,4 +9,4 @@
 #include "app/utility/cpp/inherited_enable_shared_from_this.h"
 
 // Categories
-LOGGING_CONTEXT(inheritedEnableSharedFromThisOverall, inheritedEnableSharedFromThis.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(inheritedEnableSharedFromThisOverall, inheritedEnableSharedFromThis.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
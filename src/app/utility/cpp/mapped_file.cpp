@@ -0,0 +1,135 @@
+/**
+ * @copyright
+ * @file mapped_file.cpp
+ * @author Andrea Gianarda
+ * @date 03rd September 2020
+ * @brief Mapped file functions
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <algorithm>
+#include <cstring>
+
+#include "app/utility/cpp/mapped_file.h"
+#include "app/utility/logger/macros.h"
+#include "app/shared/exception.h"
+
+LOGGING_CONTEXT(mappedFileOverall, mappedFile.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+app::utility::MappedFile::MappedFile(const std::string & name) : filename(name), mapping(nullptr), buffer(), fileSize(0) {
+
+	EXCEPTION_ACTION_COND((this->filename.empty() == true), throw, "Provided an empty filename therefore it is not possible to open it and read its content");
+
+	const int descriptor = ::open(this->filename.c_str(), O_RDONLY);
+	EXCEPTION_ACTION_COND((descriptor < 0), throw, "Unable to open file " << this->filename << ": " << std::strerror(errno));
+
+	struct stat fileStat;
+	if (::fstat(descriptor, &fileStat) != 0) {
+		const int errorCode = errno;
+		::close(descriptor);
+		EXCEPTION_ACTION(throw, "Unable to get the size of file " << this->filename << ": " << std::strerror(errorCode));
+	}
+	this->fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+	// Empty files cannot be mapped
+	if (this->fileSize > 0) {
+		void * content = ::mmap(nullptr, this->fileSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if (content == MAP_FAILED) {
+			LOG_WARNING(mappedFileOverall, "Unable to map file " << this->filename << " in memory: " << std::strerror(errno) << ". Its content is read into a buffer");
+			try {
+				this->readContent(descriptor);
+			} catch (...) {
+				::close(descriptor);
+				throw;
+			}
+		} else {
+			this->mapping = content;
+			::madvise(this->mapping, this->fileSize, MADV_SEQUENTIAL);
+		}
+	}
+
+	// The mapping stays valid after the file descriptor is closed
+	::close(descriptor);
+
+	LOG_INFO(app::logger::info_level_e::ZERO, mappedFileOverall, "Opened file " << this->filename << " of " << this->fileSize << " bytes");
+}
+
+app::utility::MappedFile::~MappedFile() {
+	if (this->mapping != nullptr) {
+		::munmap(this->mapping, this->fileSize);
+	}
+}
+
+void app::utility::MappedFile::readContent(const int & descriptor) {
+	this->buffer.resize(this->fileSize);
+
+	std::size_t bytesRead = 0;
+	while (bytesRead < this->fileSize) {
+		const ssize_t count = ::read(descriptor, this->buffer.data() + bytesRead, this->fileSize - bytesRead);
+		if (count < 0) {
+			if (errno != EINTR) {
+				EXCEPTION_ACTION(throw, "Unable to read content from file " << this->filename << ": " << std::strerror(errno));
+			}
+		} else if (count == 0) {
+			// File has been truncated since its size was read
+			break;
+		} else {
+			bytesRead += static_cast<std::size_t>(count);
+		}
+	}
+
+	this->buffer.resize(bytesRead);
+	this->fileSize = bytesRead;
+}
+
+const char * app::utility::MappedFile::data() const {
+	if (this->mapping != nullptr) {
+		return static_cast<const char *>(this->mapping);
+	}
+
+	return this->buffer.data();
+}
+
+std::size_t app::utility::MappedFile::size() const {
+	return this->fileSize;
+}
+
+std::string_view app::utility::MappedFile::view() const {
+	return std::string_view(this->data(), this->fileSize);
+}
+
+bool app::utility::MappedFile::isMapped() const {
+	return (this->mapping != nullptr);
+}
+
+const std::string & app::utility::MappedFile::getFilename() const {
+	return this->filename;
+}
+
+std::size_t app::utility::MappedFile::findLineStart(const std::size_t & offset) const {
+	const std::string_view content(this->view());
+	if ((offset == 0) || (content.empty() == true)) {
+		return 0;
+	}
+
+	const std::size_t position = std::min(offset, content.size()) - 1;
+	const std::size_t newline = content.rfind('\n', position);
+
+	return (newline == std::string_view::npos) ? 0 : (newline + 1);
+}
+
+std::size_t app::utility::MappedFile::findLineEnd(const std::size_t & offset) const {
+	const std::string_view content(this->view());
+	if (offset >= content.size()) {
+		return content.size();
+	}
+
+	const std::size_t newline = content.find('\n', offset);
+
+	return (newline == std::string_view::npos) ? content.size() : (newline + 1);
+}
@@ -0,0 +1,40 @@
+/**
+ * @copyright
+ * @file process_memory.cpp
+ * @author Andrea Gianarda
+ * @date 02nd of September 2020
+ * @brief Process memory functions
+ */
+
+#include <fstream>
+#include <sstream>
+
+#include "app/utility/cpp/process_memory.h"
+
+std::int64_t app::utility::getMemoryStatus(const std::string & field, const std::string & process) {
+	std::ifstream status("/proc/" + process + "/status");
+	if (status.is_open() == false) {
+		return -1;
+	}
+
+	const std::string key(field + ":");
+	std::string line;
+	while (std::getline(status, line)) {
+		if (line.compare(0, key.size(), key) == 0) {
+			std::istringstream value(line.substr(key.size()));
+			std::int64_t kilobytes = 0;
+			value >> kilobytes;
+			return (kilobytes * 1024);
+		}
+	}
+
+	return -1;
+}
+
+std::int64_t app::utility::getResidentMemory() {
+	return app::utility::getMemoryStatus("VmRSS");
+}
+
+std::int64_t app::utility::getPeakResidentMemory() {
+	return app::utility::getMemoryStatus("VmHWM");
+}
@@ -38,3 +38,24 @@ const std::string app::utility::removeTrailingCharacter(std::string text, const
 
 	return text;
 }
+
+std::size_t app::utility::editDistance(const std::string & lhs, const std::string & rhs) {
+	// Only the previous row of the distance matrix is needed to compute the current one
+	std::vector<std::size_t> previousRow(rhs.size() + 1);
+	std::vector<std::size_t> currentRow(rhs.size() + 1);
+
+	for (std::size_t rhsIdx = 0; rhsIdx <= rhs.size(); rhsIdx++) {
+		previousRow[rhsIdx] = rhsIdx;
+	}
+
+	for (std::size_t lhsIdx = 0; lhsIdx < lhs.size(); lhsIdx++) {
+		currentRow[0] = lhsIdx + 1;
+		for (std::size_t rhsIdx = 0; rhsIdx < rhs.size(); rhsIdx++) {
+			const std::size_t substitutionCost = (lhs[lhsIdx] == rhs[rhsIdx]) ? 0 : 1;
+			currentRow[rhsIdx + 1] = std::min({ previousRow[rhsIdx + 1] + 1, currentRow[rhsIdx] + 1, previousRow[rhsIdx] + substitutionCost });
+		}
+		std::swap(previousRow, currentRow);
+	}
+
+	return previousRow[rhs.size()];
+}
@@ -6,19 +6,25 @@
  * @brief Browser exception functions
  */
 
+#include <chrono>
+#include <utility>
 #include <iostream>
 
 #include "app/shared/setters_getters.h"
+#include "app/shared/logging.h"
 #include "app/utility/logger/macros.h"
 #include "app/shared/enums.h"
 #include "app/utility/qt/qt_operator.h"
 #include "app/utility/exception/exception.h"
 
 // Categories
-LOGGING_CONTEXT(browserExceptionOverall, browserException.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(browserExceptionPrint, browserException.print, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(browserExceptionOverall, browserException.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(browserExceptionPrint, browserException.print, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::exception::Exception::Exception(const std::string exceptionTimestamp, const int & exceptionLine, const std::string & exceptionFile, const std::string & exceptionCondition, const std::string & exceptionMsg) : timestamp(exceptionTimestamp), line(exceptionLine), filename(exceptionFile), condition(exceptionCondition), message(exceptionMsg) {
+std::atomic<std::uint64_t> app::exception::Exception::createdExceptions(0);
+
+app::exception::Exception::Exception(const int & exceptionLine, const char * exceptionFile, const char * exceptionCondition, std::string && exceptionMsg) : time(static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count())), timestamp(), description(), line(exceptionLine), filename((exceptionFile != nullptr) ? exceptionFile : ""), condition((exceptionCondition != nullptr) ? exceptionCondition : ""), message(std::move(exceptionMsg)) {
+	app::exception::Exception::createdExceptions.fetch_add(1, std::memory_order_relaxed);
 	//LOG_INFO(app::logger::info_level_e::ZERO, browserExceptionOverall, "Browser exception is being created with message " << this->message);
 }
 
@@ -38,8 +44,8 @@ app::exception::Exception * app::exception::Exception::clone() const {
 std::string app::exception::Exception::print() const {
 	//LOG_INFO(app::logger::info_level_e::ZERO, browserExceptionPrint, "Print exception message: " << this->message);
 	std::stringstream msgStream;
-	msgStream << "[" << this->timestamp << "] Exception caught on file " << this->filename << " at line " << this->line;
-	if (this->condition.empty() == false) {
+	msgStream << "[" << this->getTimestamp() << "] Exception caught on file " << this->filename << " at line " << this->line;
+	if (this->condition[0] != '\0') {
 		msgStream << " for condition" << this->condition;
 	}
 	msgStream << ": " << this->message;
@@ -47,13 +53,37 @@ std::string app::exception::Exception::print() const {
 }
 
 const char * app::exception::Exception::what() const noexcept {
-	return this->print().c_str();
+	if (this->description.empty() == true) {
+		try {
+			this->description = this->print();
+		} catch (...) {
+			// Formatting failed (e.g. out of memory) therefore fall back to the message that is already available
+			return this->message.c_str();
+		}
+	}
+	return this->description.c_str();
+}
+
+const std::string & app::exception::Exception::getTimestamp() const {
+	if (this->timestamp.empty() == true) {
+		this->timestamp = app::shared::getDateTime(static_cast<qint64>(this->time)).toStdString();
+	}
+	return this->timestamp;
+}
+
+std::uint64_t app::exception::Exception::getCreatedExceptions() {
+	return app::exception::Exception::createdExceptions.load(std::memory_order_relaxed);
+}
+
+const char * app::exception::Exception::getFilename() const {
+	return this->filename;
+}
+
+const char * app::exception::Exception::getCondition() const {
+	return this->condition;
 }
 
 CONST_GETTER(app::exception::Exception::getLine, int &, this->line)
-CONST_GETTER(app::exception::Exception::getFilename, std::string &, this->filename)
-CONST_GETTER(app::exception::Exception::getCondition, std::string &, this->condition)
-CONST_GETTER(app::exception::Exception::getTimestamp, std::string &, this->timestamp)
 CONST_GETTER(app::exception::Exception::getMessage, std::string &, this->message)
 
 void app::exception::printException(std::string message) {
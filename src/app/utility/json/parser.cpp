@@ -16,9 +16,9 @@
 #include "app/shared/exception.h"
 #include "app/utility/json/parser.h"
 
-LOGGING_CONTEXT(jsonParserOverall, jsonParser.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(jsonParserFileContent, jsonParser.file_content, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(jsonParserValue, jsonParser.value, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonParserOverall, jsonParser.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonParserFileContent, jsonParser.file_content, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonParserValue, jsonParser.value, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::utility::json::Parser::Parser(QString fileName, QIODevice::OpenModeFlag openFlags) : app::utility::json::Wrapper::Wrapper(fileName,openFlags) {
 
@@ -83,6 +83,30 @@ const QStringList app::utility::json::Parser::getJsonKeys() const {
 	return QStringList();
 }
 
+const QJsonObject app::utility::json::Parser::getJsonObject() const {
+	EXCEPTION_ACTION_COND((this->jsonContent.type() != QJsonValue::Object), throw, "JSON file content is of type " << this->jsonContent.type() << ". Expected the content of the file to be an object");
+	return this->jsonContent.toObject();
+}
+
+QString app::utility::json::Parser::valueToString(const QJsonValue & value, const QString & path) {
+	QString valueStr = QString();
+	if (value.isString() == true) {
+		valueStr = value.toString();
+	} else if (value.isDouble() == true) {
+		valueStr.setNum(value.toDouble(), 'f', 6);
+	} else if (value.isBool() == true) {
+		if (value.toBool() == true) {
+			valueStr = "true";
+		} else {
+			valueStr = "false";
+		}
+	} else {
+		EXCEPTION_ACTION(throw, "Unable to convert value of type "  << value.type() << " at " << path << " to string");
+	}
+
+	return valueStr;
+}
+
 const std::pair<bool, QString> app::utility::json::Parser::findKeyValue(const QString & treeRoot, const QString & key) const {
 
 	std::pair<bool, QString> found = std::make_pair(false, QString());
@@ -98,7 +122,7 @@ const std::pair<bool, QString> app::utility::json::Parser::findKeyValue(const QS
 
 	// Log only if search has been successful
 	if (found.first == true) {
-		LOG_INFO(app::logger::info_level_e::ZERO, jsonParserFileContent, "JSON tree root: " << treeRoot << " key: " << key << " value " << found.second);
+		LOG_INFO(app::logger::info_level_e::HIGH, jsonParserFileContent, "JSON tree root: " << treeRoot << " key: " << key << " value " << found.second);
 	}
 
 	return found;
@@ -115,7 +139,7 @@ QMap<QString, QString> app::utility::json::Parser::findKeyAllValues(const QStrin
 		const QStringList jsonKeys (jsonObject.keys());
 		// Iterate over all key of the object
 		for (QStringList::const_iterator keyIter = jsonKeys.cbegin(); keyIter != jsonKeys.cend(); keyIter++) {
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonParserFileContent, "Searching key: " << key << " under tree " << *keyIter);
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonParserFileContent, "Searching key: " << key << " under tree " << *keyIter);
 			const auto found = this->findKeyValue(*keyIter, key);
 
 			// Add value only if it is not empty
@@ -138,7 +162,7 @@ std::pair<bool, QString> app::utility::json::Parser::searchJson(const QJsonValue
 	switch (content.type()) {
 		case QJsonValue::Object:
 		{
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonParserFileContent, "Searching in JSON Object");
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonParserFileContent, "Searching in JSON Object");
 			const QJsonObject jsonObject (content.toObject());
 
 			// search key in current JSON object or keep looking for it
@@ -148,7 +172,7 @@ std::pair<bool, QString> app::utility::json::Parser::searchJson(const QJsonValue
 		}
 		case QJsonValue::Array:
 		{
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonParserFileContent, "Searching in JSON Array");
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonParserFileContent, "Searching in JSON Array");
 			const QJsonArray & jsonArray (content.toArray());
 			// Iterate over all elements of array
 			for (QJsonArray::const_iterator arrayIter = jsonArray.begin(); arrayIter != jsonArray.end(); arrayIter++) {
@@ -157,7 +181,7 @@ std::pair<bool, QString> app::utility::json::Parser::searchJson(const QJsonValue
 			break;
 		}
 		default:
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonParserFileContent, "Cannot find key in type " << content.type() << ". Expected values are array (" << QJsonValue::Array << ") or object (" << QJsonValue::Object << ")");
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonParserFileContent, "Cannot find key in type " << content.type() << ". Expected values are array (" << QJsonValue::Array << ") or object (" << QJsonValue::Object << ")");
 			break;
 	}
 
@@ -168,34 +192,14 @@ std::pair<bool, QString> app::utility::json::Parser::searchJsonObject(const QJso
 	std::pair<bool, QString> found = std::make_pair(false, QString());
 	if (object.contains(key) == true) {
 		QJsonObject::const_iterator iter = object.constFind(key);
-		QJsonValue value(iter.value());
-		QString valueStr = QString();
-		bool match = false;
-		if (value.isString() == true) {
-			match = true;
-			valueStr = value.toString();
-		} else if (value.isDouble() == true) {
-			match = true;
-			valueStr.setNum(value.toDouble(), 'f', 6);
-		} else if (value.isBool() == true) {
-			match = true;
-			if (value.toBool() == true) {
-				valueStr = "true";
-			} else {
-				valueStr = "false";
-			}
-		} else {
-			EXCEPTION_ACTION(throw, "Unable to convert value of type "  << value.type() << " of key " << key << " to string");
-		}
-		if (match == true) {
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonParserValue, "Found key " << key << " with value " << valueStr);
-			found = std::make_pair(match, valueStr);
-		}
+		const QString valueStr(app::utility::json::Parser::valueToString(iter.value(), key));
+		LOG_INFO(app::logger::info_level_e::HIGH, jsonParserValue, "Found key " << key << " with value " << valueStr);
+		found = std::make_pair(true, valueStr);
 	} else {
 		const QStringList jsonKeys (object.keys());
 		// Iterate over all key of the object
 		for (QStringList::const_iterator keyIter = jsonKeys.cbegin(); keyIter != jsonKeys.cend(); keyIter++) {
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonParserFileContent, "JSON key: " << *keyIter);
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonParserFileContent, "JSON key: " << *keyIter);
 			const QJsonValue value(object.value(*keyIter));
 			found = this->searchJson(value, key);
 			if (found.first == true) {
@@ -19,9 +19,9 @@
 #include "app/shared/enums.h"
 #include "app/shared/exception.h"
 
-LOGGING_CONTEXT(jsonWrapperOverall, jsonWrapper.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(jsonWrapperFile, jsonWrapper.file, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(jsonWrapperFileContent, jsonWrapper.file_content, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonWrapperOverall, jsonWrapper.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonWrapperFile, jsonWrapper.file, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonWrapperFileContent, jsonWrapper.file_content, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -126,13 +126,11 @@ void app::utility::json::Wrapper::readJson() {
 	bool openSuccess = this->jsonFile->open(this->openFlags);
 	EXCEPTION_ACTION_COND((!openSuccess), throw, "Unable to open JSON file " << this->jsonFile->fileName() << " for read");
 
-	// Copy content into QString
-	QString content(this->jsonFile->readAll());
+	// The file is expected to be UTF8 encoded therefore it can be converted to a JSON document straight away
+	const QByteArray contentUtf8(this->jsonFile->readAll());
 
 	this->jsonFile->close();
 
-	// Convert JSON file content to UTF8 in order to create a JSON document
-	QByteArray contentUtf8(content.toUtf8());
 	QJsonParseError jsonParseError;
 
 	QJsonDocument jsonDoc = QJsonDocument(QJsonDocument::fromJson(contentUtf8, &jsonParseError));
@@ -149,7 +147,7 @@ void app::utility::json::Wrapper::readJson() {
 			pos = jsonParseError.offset - ErrorCharToPrint/2;
 		}
 
-		const QString errorInFile(content.mid(pos, ErrorCharToPrint));
+		const QString errorInFile(QString::fromUtf8(contentUtf8.mid(pos, ErrorCharToPrint)));
 		// Check if JSON parsing is successful
 		EXCEPTION_ACTION_COND((jsonDoc.isNull() == true), throw, "Unable to convert content of file " << this->jsonFile->fileName() << " as UTF8 QString to JSON document because of error " << jsonParseError.errorString() << " (error type " << jsonParseError.error << ") in the following file fragment " << errorInFile);
 	}
@@ -172,7 +170,10 @@ void app::utility::json::Wrapper::readJson() {
 		EXCEPTION_ACTION(throw, "Invalid data type");
 	}
 
-	this->walkJson(this->jsonContent);
+	// Walking the JSON tree only prints its content therefore it is skipped if messages with high verbosity are filtered out of the context it prints to
+	if ((app::logger::Filter::isCompiledIn(app::logger::msg_type_e::INFO, app::logger::info_level_e::HIGH) == true) && (jsonWrapperFileContent().isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::HIGH) == true)) {
+		this->walkJson(this->jsonContent);
+	}
 
 }
 
@@ -181,13 +182,13 @@ void app::utility::json::Wrapper::walkJson(const QJsonValue & content) const {
 	switch (content.type()) {
 		case QJsonValue::Object:
 		{
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "Printing JSON Object");
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "Printing JSON Object");
 			const QJsonObject & jsonObject (content.toObject());
 			const QStringList & jsonKeys (jsonObject.keys());
 
 			// Iterate over all key of the object
 			for (QStringList::const_iterator keyIter = jsonKeys.cbegin(); keyIter != jsonKeys.cend(); keyIter++) {
-				LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "JSON key: " << *keyIter);
+				LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "JSON key: " << *keyIter);
 				const QJsonValue value(jsonObject.value(*keyIter));
 				this->walkJson(value);
 			}
@@ -195,7 +196,7 @@ void app::utility::json::Wrapper::walkJson(const QJsonValue & content) const {
 		}
 		case QJsonValue::Array:
 		{
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "Printing JSON Array");
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "Printing JSON Array");
 			const QJsonArray & jsonArray (content.toArray());
 			// Iterate over all elements of array
 			for (QJsonArray::const_iterator arrayIter = jsonArray.begin(); arrayIter != jsonArray.end(); arrayIter++) {
@@ -204,19 +205,19 @@ void app::utility::json::Wrapper::walkJson(const QJsonValue & content) const {
 			break;
 		}
 		case QJsonValue::Null:
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "Value is null");
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "Value is null");
 			break;
 		case QJsonValue::Bool:
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "Value is of type boolean: " << content.toBool());
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "Value is of type boolean: " << content.toBool());
 			break;
 		case QJsonValue::Double:
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "Value is of type double: " << content.toDouble());
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "Value is of type double: " << content.toDouble());
 			break;
 		case QJsonValue::String:
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "Value is of type string: " << content.toString());
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "Value is of type string: " << content.toString());
 			break;
 		case QJsonValue::Undefined:
-			LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "Value is undefined");
+			LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "Value is undefined");
 			break;
 		default:
 			EXCEPTION_ACTION(throw, "Unknown type " << content.type());
@@ -305,7 +306,7 @@ void app::utility::json::Wrapper::appendJsonObject(QJsonObject & jsonObj, const
 			QJsonObject::const_iterator objIter = jsonObj.find(*keyIter);
 			this->walkJson(*objIter);
 		}
-		LOG_INFO(app::logger::info_level_e::ZERO, jsonWrapperFileContent, "Adding JSON key: " << *keyIter);
+		LOG_INFO(app::logger::info_level_e::HIGH, jsonWrapperFileContent, "Adding JSON key: " << *keyIter);
 		const QJsonValue value(newObj.value(*keyIter));
 		this->walkJson(value);
 		jsonObj.insert(*keyIter, value);
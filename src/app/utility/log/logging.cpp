@@ -6,12 +6,13 @@
  * @brief Logging functions
  */
 
-#include <mutex>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <utility>
 
 // Qt libraries
 #include <QtCore/QtGlobal>
-#include <QtCore/QTextStream>
-#include <QtCore/QFile>
 
 // Get pointer to default category
 #include <QtCore/QLoggingCategory>
@@ -20,6 +21,8 @@
 #include "app/shared/logging.h"
 #include "app/shared/exception.h"
 #include "app/shared/logging_macros.h"
+#include "app/utility/logger/types.h"
+#include "app/utility/logger/backend.h"
 #include "app/utility/log/logging.h"
 
 /**
@@ -63,16 +66,78 @@ namespace app {
 
 		namespace {
 			/**
-			 * @brief Global variable logfile
+			 * @brief Qt log filename
 			 *
 			 */
-			QFile logfile(QT_STRINGIFY(QT_LOGFILE));
+			static const std::string logFilename(QT_STRINGIFY(QT_LOGFILE));
 
 			/**
-			 * @brief mutex to handle concurrent access to logfile
+			 * @brief second of the last date formatted by this thread
 			 *
 			 */
-			std::mutex logfile_mutex;
+			thread_local std::int64_t cachedDateSecond = -1;
+
+			/**
+			 * @brief last date formatted by this thread
+			 * The date changes at most once per second therefore it is formatted only when the second changes
+			 *
+			 */
+			thread_local std::string cachedDate;
+
+			/**
+			 * @brief Function: const std::string & formatDate(const std::int64_t & timestamp)
+			 *
+			 * \param timestamp: nanoseconds elapsed since epoch
+			 *
+			 * \return the formatted date
+			 *
+			 * This function formats the timestamp provided as argument
+			 * Every thread has its own cache therefore no lock is required
+			 */
+			const std::string & formatDate(const std::int64_t & timestamp) {
+				const std::int64_t nanosecondsInSecond = 1000000000;
+				const std::int64_t second = timestamp / nanosecondsInSecond;
+				if (second != cachedDateSecond) {
+					const std::int64_t nanosecondsInMillisecond = 1000000;
+					cachedDate = app::shared::getDateTime(static_cast<qint64>(timestamp / nanosecondsInMillisecond)).toStdString();
+					cachedDateSecond = second;
+				}
+				return cachedDate;
+			}
+
+			/**
+			 * @brief Function: app::logger::msg_type_e toMsgType(const QtMsgType & type)
+			 *
+			 * \param type: Qt message type
+			 *
+			 * \return the logger message type
+			 *
+			 * This function converts a Qt message type to the logger message type deciding how urgently the message is flushed
+			 */
+			app::logger::msg_type_e toMsgType(const QtMsgType & type) {
+				app::logger::msg_type_e msgType = app::logger::msg_type_e::DEBUG;
+				switch(type) {
+					case QtDebugMsg:
+						msgType = app::logger::msg_type_e::DEBUG;
+						break;
+					case QtInfoMsg:
+						msgType = app::logger::msg_type_e::INFO;
+						break;
+					case QtWarningMsg:
+						msgType = app::logger::msg_type_e::WARNING;
+						break;
+					case QtCriticalMsg:
+						msgType = app::logger::msg_type_e::ERROR;
+						break;
+					case QtFatalMsg:
+						msgType = app::logger::msg_type_e::FATAL;
+						break;
+					default:
+						msgType = app::logger::msg_type_e::WARNING;
+						break;
+				}
+				return msgType;
+			}
 		}
 
 	}
@@ -81,12 +146,14 @@ namespace app {
 
 void app::logging::handler(QtMsgType type, const QMessageLogContext & context, const QString & message) {
 
-	logfile_mutex.lock();
+	const std::chrono::nanoseconds now = std::chrono::system_clock::now().time_since_epoch();
+	const std::int64_t timestamp = static_cast<std::int64_t>(now.count());
 
-	QString info_str("");
+	// The line is formatted by the calling thread as the file and the function of the context are not guaranteed to outlive this call
+	std::string info_str = std::string();
 
 	info_str.append("[");
-	info_str.append(app::shared::getDateTime());
+	info_str.append(app::logging::formatDate(timestamp));
 	info_str.append("] ");
 
 	switch(type) {
@@ -129,22 +196,23 @@ void app::logging::handler(QtMsgType type, const QMessageLogContext & context, c
 		info_str.append(context.function);
 	}
 
-	bool success = logfile.open(QIODevice::Append | QIODevice::WriteOnly | QIODevice::Text);
-	EXCEPTION_ACTION_COND((!success), throw, "Unable to open file " << logfile.fileName());
-
-	QTextStream ologfile(&logfile);
+	info_str.append(" ");
+	info_str.append(message.toStdString());
 
-	ologfile << info_str << " " << message;
-	#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
-	ologfile << Qt::endl;
-	#else
-	ologfile << endl;
-	#endif
+	// The backend writes the message to the file from its writer thread
+	app::logger::Backend * backend = app::logger::Backend::getInstance();
+	app::logger::record_s record = { nullptr, app::logging::toMsgType(type), timestamp, std::string(), app::logging::logFilename, std::move(info_str), app::logger::record_format_e::TEXT };
+	backend->push(std::move(record));
 
-	logfile.close();
+	// Qt aborts the program as soon as this function returns and functions registered with atexit are not executed
+	if (type == QtFatalMsg) {
+		backend->flush();
+	}
 
-	logfile_mutex.unlock();
+}
 
+const std::string & app::logging::getLogFilename() {
+	return app::logging::logFilename;
 }
 
 void app::logging::set_default_category() {
@@ -11,7 +11,7 @@
 #include "app/utility/log/printable_object.h"
 
 // Categories
-LOGGING_CONTEXT(printableObjectOverall, printableObject.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(printableObjectOverall, printableObject.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
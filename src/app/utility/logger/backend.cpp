@@ -0,0 +1,598 @@
+/**
+ * @copyright
+ * @file backend.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Logger backend functions
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+// Compression of rotated segments
+#include <zlib.h>
+
+// Qt libraries
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+
+#include "app/shared/logging.h"
+#include "app/shared/qt_functions.h"
+#include "app/shared/exception.h"
+#include "app/utility/logger/config.h"
+#include "app/utility/logger/logger.h"
+#include "app/utility/logger/backend.h"
+#include "app/utility/logger/trace.h"
+#include "app/utility/logger/trace_format.h"
+
+namespace app {
+
+	namespace logger {
+
+		namespace backend {
+
+			namespace {
+				/**
+				 * @brief number of nanoseconds in a second
+				 *
+				 */
+				static constexpr std::int64_t nanosecondsInSecond = 1000000000;
+
+				/**
+				 * @brief number of bytes read at once while compressing a segment
+				 *
+				 */
+				static constexpr qint64 compressionChunkSize = 1 << 20;
+
+			}
+
+		}
+
+	}
+
+}
+
+app::logger::Backend::Backend() : queue(app::logger::Config::getInstance()->getQueueCapacity()), writer(), running(false), idle(false), policy(app::logger::Config::getInstance()->getDefaultQueuePolicy()), flushInterval(app::logger::Config::getInstance()->getDefaultFlushInterval()), droppedRecords(0), reportedDroppedRecords(0), wakeUpMutex(), wakeUp(), streamMutex(), streams(), rotation(app::logger::Config::getInstance()->getDefaultRotation()), line(), segmentWorker(), segmentMutex(), segmentWakeUp(), segmentsProcessed(), rotatedFiles(), rotationCounts(), processingSegments(false), segmentWorkerRunning(false), segmentRotation(app::logger::Config::getInstance()->getDefaultRotation()), dirty(false), cachedDateSecond(-1), cachedDate() {
+	this->start();
+	// Singletons are never deleted therefore records still in the queue must be written when the program exits
+	std::atexit(app::logger::Backend::terminate);
+}
+
+app::logger::Backend::~Backend() {
+	this->stop();
+}
+
+void app::logger::Backend::terminate() {
+	app::logger::Backend::getInstance()->stop();
+}
+
+void app::logger::Backend::start() {
+	{
+		std::lock_guard<std::mutex> lock(this->segmentMutex);
+		if (this->segmentWorkerRunning == false) {
+			this->segmentWorkerRunning = true;
+			this->segmentWorker = std::thread(&app::logger::Backend::runSegmentWorker, this);
+		}
+	}
+
+	if (this->running.exchange(true) == false) {
+		this->writer = std::thread(&app::logger::Backend::run, this);
+	}
+}
+
+void app::logger::Backend::stop() {
+	if (this->running.exchange(false) == true) {
+		{
+			std::lock_guard<std::mutex> lock(this->wakeUpMutex);
+			this->wakeUp.notify_one();
+		}
+		if (this->writer.joinable() == true) {
+			this->writer.join();
+		}
+	}
+	// Write records pushed while the writer thread was shutting down
+	this->flush();
+
+	// Segments of files rotated so far are processed before the segment thread exits
+	bool segmentWorkerStopped = false;
+	{
+		std::lock_guard<std::mutex> lock(this->segmentMutex);
+		segmentWorkerStopped = this->segmentWorkerRunning;
+		this->segmentWorkerRunning = false;
+		this->segmentWakeUp.notify_one();
+	}
+	if ((segmentWorkerStopped == true) && (this->segmentWorker.joinable() == true)) {
+		this->segmentWorker.join();
+	}
+}
+
+bool app::logger::Backend::isRunning() const {
+	return this->running.load();
+}
+
+void app::logger::Backend::push(app::logger::record_s && record) {
+	if (this->running.load(std::memory_order_acquire) == true) {
+		bool pushed = this->queue.push(std::move(record));
+		if (pushed == false) {
+			if (this->policy.load(std::memory_order_relaxed) == app::logger::queue_policy_e::DROP) {
+				this->droppedRecords.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			// Queue is full: make sure the writer thread is awake and wait for a free slot
+			while (pushed == false) {
+				{
+					std::lock_guard<std::mutex> lock(this->wakeUpMutex);
+					this->wakeUp.notify_one();
+				}
+				std::this_thread::yield();
+				if (this->running.load(std::memory_order_acquire) == false) {
+					std::lock_guard<std::mutex> lock(this->streamMutex);
+					this->write(record);
+					this->flushStreams();
+					return;
+				}
+				pushed = this->queue.push(std::move(record));
+			}
+		}
+
+		// Notify the writer only if it is waiting for records in order to avoid a system call for every message
+		if (this->idle.load() == true) {
+			std::lock_guard<std::mutex> lock(this->wakeUpMutex);
+			this->wakeUp.notify_one();
+		}
+	} else {
+		std::lock_guard<std::mutex> lock(this->streamMutex);
+		this->write(record);
+		this->flushStreams();
+	}
+}
+
+void app::logger::Backend::flush() {
+	std::lock_guard<std::mutex> lock(this->streamMutex);
+	app::logger::record_s record;
+	while (this->queue.pop(record) == true) {
+		this->write(record);
+	}
+	this->flushStreams();
+}
+
+void app::logger::Backend::run() {
+	std::chrono::steady_clock::time_point lastFlush = std::chrono::steady_clock::now();
+
+	while (this->running.load() == true) {
+		const bool urgent = this->drain();
+
+		const std::chrono::milliseconds interval(this->flushInterval.load(std::memory_order_relaxed));
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if ((urgent == true) || ((now - lastFlush) >= interval)) {
+			std::lock_guard<std::mutex> lock(this->streamMutex);
+			this->flushStreams();
+			lastFlush = now;
+		}
+
+		if (this->queue.empty() == true) {
+			std::unique_lock<std::mutex> lock(this->wakeUpMutex);
+			this->idle.store(true);
+			this->wakeUp.wait_for(lock, interval, [this] () {
+				return ((this->queue.empty() == false) || (this->running.load() == false));
+			});
+			this->idle.store(false);
+		}
+	}
+
+	this->flush();
+}
+
+bool app::logger::Backend::drain() {
+	bool urgent = false;
+	std::lock_guard<std::mutex> lock(this->streamMutex);
+	app::logger::record_s record;
+	for (std::size_t count = 0; count < app::logger::Backend::batchSize; count++) {
+		if (this->queue.pop(record) == false) {
+			break;
+		}
+		this->write(record);
+		// Warnings and errors must reach the file as soon as possible
+		urgent |= (record.type >= app::logger::msg_type_e::WARNING);
+	}
+	return urgent;
+}
+
+void app::logger::Backend::write(const app::logger::record_s & record) {
+	this->reportDroppedRecords(record.filename);
+
+	if (record.format == app::logger::record_format_e::BINARY) {
+		this->writeTrace(record);
+		return;
+	}
+
+	this->line.clear();
+
+	const app::logger::metadata_s * metadata = record.metadata;
+	if (metadata != nullptr) {
+		this->line.append("[");
+		this->line.append(this->formatDate(record.timestamp));
+		this->line.append("] ");
+		this->line.append(app::shared::qEnumToQString(record.type, true).toStdString());
+
+		if (record.context.empty() == false) {
+			this->line.append(" [");
+			this->line.append(record.context);
+			this->line.append("]");
+		}
+
+		if ((metadata->file != nullptr) && (metadata->file[0] != '\0')) {
+			this->line.append(" File ");
+			this->line.append(metadata->file);
+		}
+
+		if ((metadata->function != nullptr) && (metadata->function[0] != '\0')) {
+			this->line.append(" in function ");
+			this->line.append(metadata->function);
+		}
+
+		this->line.append(" ");
+	}
+
+	this->line.append(record.payload);
+	this->line.append("\n");
+	this->writeLine(record.filename, record.timestamp);
+}
+
+void app::logger::Backend::writeLine(const std::string & filename, const std::int64_t & timestamp) {
+	const std::streamsize lineSize = static_cast<std::streamsize>(this->line.size());
+
+	if (filename.compare(app::logger::stdoutStr) == 0) {
+		std::cout.write(this->line.data(), lineSize);
+	} else {
+		app::logger::Backend::output_file_s & file = this->getFile(filename, timestamp);
+		this->rotateIfNeeded(filename, file, static_cast<std::uint64_t>(lineSize), timestamp);
+		if (file.failed == true) {
+			this->dropRecord();
+			return;
+		}
+		file.stream->write(this->line.data(), lineSize);
+		file.size += static_cast<std::uint64_t>(lineSize);
+	}
+
+	this->dirty = true;
+}
+
+void app::logger::Backend::writeTrace(const app::logger::record_s & record) {
+	std::uint32_t id = 0;
+	if (app::logger::trace::readRecordId(record.payload, id) == false) {
+		return;
+	}
+
+	app::logger::Backend::output_file_s & file = this->getFile(record.filename, record.timestamp);
+	this->rotateIfNeeded(record.filename, file, static_cast<std::uint64_t>(record.payload.size()), record.timestamp);
+	if (file.failed == true) {
+		this->dropRecord();
+		return;
+	}
+
+	this->line.clear();
+
+	// Every time a trace file is opened, a header is written and descriptors are written again before the first record referring to them
+	if (file.traceStarted == false) {
+		const std::chrono::nanoseconds systemTime = std::chrono::system_clock::now().time_since_epoch();
+		const std::chrono::nanoseconds monotonicTime = std::chrono::steady_clock::now().time_since_epoch();
+		app::logger::trace::appendHeader(this->line, static_cast<std::int64_t>(systemTime.count()), static_cast<std::int64_t>(monotonicTime.count()));
+		file.tracedDescriptors.clear();
+		file.traceStarted = true;
+	}
+
+	const std::size_t descriptorIdx = static_cast<std::size_t>(id);
+	if (descriptorIdx >= file.tracedDescriptors.size()) {
+		file.tracedDescriptors.resize((descriptorIdx + 1), false);
+	}
+	if (file.tracedDescriptors.at(descriptorIdx) == false) {
+		app::logger::trace::descriptor_s descriptor;
+		if (app::logger::Tracer::getInstance()->getDescriptor(id, descriptor) == true) {
+			app::logger::trace::appendDescriptor(this->line, id, descriptor);
+		}
+		file.tracedDescriptors.at(descriptorIdx) = true;
+	}
+
+	this->line.append(record.payload);
+
+	const std::streamsize entrySize = static_cast<std::streamsize>(this->line.size());
+	file.stream->write(this->line.data(), entrySize);
+	file.size += static_cast<std::uint64_t>(entrySize);
+	this->dirty = true;
+}
+
+void app::logger::Backend::rotateIfNeeded(const std::string & filename, app::logger::Backend::output_file_s & file, const std::uint64_t & size, const std::int64_t & timestamp) {
+	const std::uint64_t maxFileSize = app::logger::Backend::getMaxFileSize(this->rotation);
+	const bool tooLarge = ((maxFileSize != 0) && ((file.size + size) > maxFileSize));
+	const bool tooOld = ((this->rotation.maxFileAge != 0) && ((timestamp - file.creationTime) >= (this->rotation.maxFileAge * app::logger::backend::nanosecondsInSecond)));
+	if ((file.size != 0) && ((tooLarge == true) || (tooOld == true))) {
+		this->rotate(filename, file, timestamp);
+	}
+}
+
+app::logger::Backend::output_file_s & app::logger::Backend::getFile(const std::string & filename, const std::int64_t & timestamp) {
+	std::map<std::string, app::logger::Backend::output_file_s>::iterator fileIt = this->streams.find(filename);
+	if (fileIt == this->streams.end()) {
+		app::logger::Backend::output_file_s file;
+		// The buffer must be provided before the file is opened in order to be used by the stream
+		file.buffer = std::make_unique<char[]>(app::logger::Backend::streamBufferSize);
+		file.stream = std::make_unique<std::ofstream>();
+		file.stream->rdbuf()->pubsetbuf(file.buffer.get(), static_cast<std::streamsize>(app::logger::Backend::streamBufferSize));
+		file.stream->open(filename, (std::ios::ate | std::ios::app | std::ios::out));
+		file.size = 0;
+		file.creationTime = timestamp;
+		file.traceStarted = false;
+		file.failed = false;
+		if ((file.stream->rdstate() & std::ostream::failbit) != 0) {
+			this->reportFailure(filename, file, "it cannot be opened");
+		} else {
+			// Messages are appended to the file therefore its size counts towards the rotation
+			const QFileInfo fileInfo(QString::fromStdString(filename));
+			file.size = static_cast<std::uint64_t>(fileInfo.size());
+		}
+		fileIt = this->streams.emplace(filename, std::move(file)).first;
+	}
+
+	return fileIt->second;
+}
+
+std::uint64_t app::logger::Backend::getMaxFileSize(const app::logger::rotation_s & settings) {
+	std::uint64_t maxFileSize = settings.maxFileSize;
+	if (settings.diskBudget != 0) {
+		// The file being written and its most recent segment must both fit the budget so that the latest messages are never removed
+		const std::uint64_t budgetFileSize = settings.diskBudget / 2;
+		if ((maxFileSize == 0) || (maxFileSize > budgetFileSize)) {
+			maxFileSize = budgetFileSize;
+		}
+	}
+	return maxFileSize;
+}
+
+QString app::logger::Backend::getSegmentName(const std::string & filename, const int & index, const bool & compressed) {
+	QString segmentName(QString::fromStdString(filename) + "." + QString::number(index));
+	if (compressed == true) {
+		segmentName.append(".gz");
+	}
+	return segmentName;
+}
+
+void app::logger::Backend::rotate(const std::string & filename, app::logger::Backend::output_file_s & file, const std::int64_t & timestamp) {
+	file.stream->close();
+
+	{
+		std::lock_guard<std::mutex> lock(this->segmentMutex);
+
+		// The oldest segment is removed and the others are shifted by one position
+		const int segments = this->rotation.segments;
+		QFile::remove(app::logger::Backend::getSegmentName(filename, segments, false));
+		QFile::remove(app::logger::Backend::getSegmentName(filename, segments, true));
+		for (int index = (segments - 1); index > 0; index--) {
+			for (const bool compressed : { false, true }) {
+				const QString segmentName(app::logger::Backend::getSegmentName(filename, index, compressed));
+				if (QFile::exists(segmentName) == true) {
+					QFile::rename(segmentName, app::logger::Backend::getSegmentName(filename, (index + 1), compressed));
+				}
+			}
+		}
+		QFile::rename(QString::fromStdString(filename), app::logger::Backend::getSegmentName(filename, 1, false));
+
+		// The budget is enforced straight away whereas compression is left to the segment thread
+		this->processSegments(filename);
+		this->rotationCounts[filename]++;
+		this->rotatedFiles.insert(filename);
+		this->segmentWakeUp.notify_one();
+	}
+
+	file.stream->rdbuf()->pubsetbuf(file.buffer.get(), static_cast<std::streamsize>(app::logger::Backend::streamBufferSize));
+	file.stream->clear();
+	file.stream->open(filename, (std::ios::trunc | std::ios::out));
+	file.size = 0;
+	file.creationTime = timestamp;
+	file.traceStarted = false;
+	if ((file.stream->rdstate() & std::ostream::failbit) != 0) {
+		this->reportFailure(filename, file, "it cannot be opened after rotating it");
+	}
+}
+
+void app::logger::Backend::reportFailure(const std::string & filename, app::logger::Backend::output_file_s & file, const std::string & reason) {
+	if (file.failed == false) {
+		std::cerr << "Log file " << filename << " is not written because " << reason << ". Its messages are dropped" << std::endl;
+		file.failed = true;
+	}
+}
+
+void app::logger::Backend::dropRecord() {
+	this->droppedRecords.fetch_add(1, std::memory_order_relaxed);
+	this->reportedDroppedRecords++;
+}
+
+void app::logger::Backend::runSegmentWorker() {
+	std::unique_lock<std::mutex> lock(this->segmentMutex);
+
+	while ((this->segmentWorkerRunning == true) || (this->rotatedFiles.empty() == false)) {
+		if (this->rotatedFiles.empty() == true) {
+			this->segmentWakeUp.wait(lock, [this] () {
+				return ((this->rotatedFiles.empty() == false) || (this->segmentWorkerRunning == false));
+			});
+		} else {
+			const std::string filename(*(this->rotatedFiles.begin()));
+			this->rotatedFiles.erase(this->rotatedFiles.begin());
+			this->processingSegments = true;
+			if (this->segmentRotation.compress == true) {
+				this->compressSegments(filename, lock);
+			}
+			this->processSegments(filename);
+			this->processingSegments = false;
+			if (this->rotatedFiles.empty() == true) {
+				this->segmentsProcessed.notify_all();
+			}
+		}
+	}
+
+	this->segmentsProcessed.notify_all();
+}
+
+void app::logger::Backend::compressSegments(const std::string & filename, std::unique_lock<std::mutex> & lock) {
+	for (int index = 1; index <= this->segmentRotation.segments; index++) {
+		// The segment is opened while owning the mutex so that a rotation cannot replace it before it is read
+		QFile segment(app::logger::Backend::getSegmentName(filename, index, false));
+		if (segment.open(QIODevice::ReadOnly) == true) {
+			const std::uint64_t rotations = this->rotationCounts[filename];
+			// The compressed file is written under a temporary name so that a partially written segment is never mistaken for a complete one
+			const QString temporary(app::logger::Backend::getSegmentName(filename, index, true) + ".tmp");
+
+			lock.unlock();
+			const bool compressed = app::logger::Backend::compress(segment, temporary);
+			lock.lock();
+
+			// Rotations done while compressing shifted the segment by one position each
+			const int shiftedIndex = index + static_cast<int>(this->rotationCounts[filename] - rotations);
+			const QString plainName(app::logger::Backend::getSegmentName(filename, shiftedIndex, false));
+			// The segment may have been removed by a rotation to fit the disk budget or the maximum number of segments
+			if ((compressed == true) && (shiftedIndex <= this->segmentRotation.segments) && (QFile::exists(plainName) == true)) {
+				const QString compressedName(app::logger::Backend::getSegmentName(filename, shiftedIndex, true));
+				QFile::remove(compressedName);
+				if (QFile::rename(temporary, compressedName) == true) {
+					QFile::remove(plainName);
+				}
+			}
+			QFile::remove(temporary);
+			index = shiftedIndex;
+		}
+	}
+}
+
+void app::logger::Backend::processSegments(const std::string & filename) {
+	const std::uint64_t diskBudget = this->segmentRotation.diskBudget;
+	const std::uint64_t segmentBudget = (diskBudget == 0) ? 0 : (diskBudget - app::logger::Backend::getMaxFileSize(this->segmentRotation));
+
+	// Segments are visited from the most recent to the oldest one and all segments after the first one that does not fit are removed
+	bool keep = true;
+	std::uint64_t usedSpace = 0;
+	for (int index = 1; ; index++) {
+		const QString plainName(app::logger::Backend::getSegmentName(filename, index, false));
+		const QString compressedName(app::logger::Backend::getSegmentName(filename, index, true));
+		const bool plainExists = QFile::exists(plainName);
+		if ((plainExists == false) && (QFile::exists(compressedName) == false)) {
+			break;
+		}
+
+		keep &= (index <= this->segmentRotation.segments);
+
+		const std::uint64_t segmentSize = static_cast<std::uint64_t>(QFileInfo(plainName).size() + QFileInfo(compressedName).size());
+		keep &= ((segmentBudget == 0) || ((usedSpace + segmentSize) <= segmentBudget));
+
+		if (keep == true) {
+			usedSpace += segmentSize;
+		} else {
+			QFile::remove(plainName);
+			QFile::remove(compressedName);
+		}
+	}
+}
+
+bool app::logger::Backend::compress(QFile & source, const QString & destination) {
+	gzFile ofile = gzopen(QFile::encodeName(destination).constData(), "wb1");
+	if (ofile == Q_NULLPTR) {
+		source.close();
+		return false;
+	}
+
+	bool success = true;
+	while ((success == true) && (source.atEnd() == false)) {
+		const QByteArray data(source.read(app::logger::backend::compressionChunkSize));
+		success = ((data.isEmpty() == false) && (gzwrite(ofile, data.constData(), static_cast<unsigned int>(data.size())) == data.size()));
+	}
+	success &= (gzclose(ofile) == Z_OK);
+	source.close();
+
+	return success;
+}
+
+void app::logger::Backend::flushStreams() {
+	if (this->dirty == true) {
+		std::cout.flush();
+		for (auto & file : this->streams) {
+			file.second.stream->flush();
+		}
+		this->dirty = false;
+	}
+}
+
+void app::logger::Backend::reportDroppedRecords(const std::string & filename) {
+	const std::uint64_t dropped = this->droppedRecords.load(std::memory_order_relaxed);
+	if (dropped != this->reportedDroppedRecords) {
+		const std::chrono::nanoseconds now = std::chrono::system_clock::now().time_since_epoch();
+		const std::int64_t timestamp = static_cast<std::int64_t>(now.count());
+		this->line.clear();
+		this->line.append("[");
+		this->line.append(this->formatDate(timestamp));
+		this->line.append("] WARNING [logger.backend] ");
+		this->line.append(std::to_string(dropped - this->reportedDroppedRecords));
+		this->line.append(" records were dropped because the log queue was full\n");
+		this->reportedDroppedRecords = dropped;
+		this->writeLine(filename, timestamp);
+	}
+}
+
+const std::string & app::logger::Backend::formatDate(const std::int64_t & timestamp) {
+	const std::int64_t second = timestamp / app::logger::backend::nanosecondsInSecond;
+	if (second != this->cachedDateSecond) {
+		const std::int64_t nanosecondsInMillisecond = 1000000;
+		this->cachedDate = app::shared::getDateTime(static_cast<qint64>(timestamp / nanosecondsInMillisecond)).toStdString();
+		this->cachedDateSecond = second;
+	}
+	return this->cachedDate;
+}
+
+void app::logger::Backend::setQueuePolicy(const app::logger::queue_policy_e & value) {
+	this->policy.store(value);
+}
+
+app::logger::queue_policy_e app::logger::Backend::getQueuePolicy() const {
+	return this->policy.load();
+}
+
+void app::logger::Backend::setFlushInterval(const int & value) {
+	EXCEPTION_ACTION_COND((value <= 0), throw, "Flush interval must be greater than 0 ms. Got " << value << " ms");
+	this->flushInterval.store(value);
+}
+
+int app::logger::Backend::getFlushInterval() const {
+	return this->flushInterval.load();
+}
+
+std::uint64_t app::logger::Backend::getDroppedRecords() const {
+	return this->droppedRecords.load();
+}
+
+void app::logger::Backend::setRotation(const app::logger::rotation_s & value) {
+	EXCEPTION_ACTION_COND((value.segments <= 0), throw, "Log files must be rotated to at least 1 segment. Got " << value.segments << " segments");
+	EXCEPTION_ACTION_COND((value.maxFileAge < 0), throw, "Maximum age of log files must not be negative. Got " << value.maxFileAge << " s");
+	std::lock_guard<std::mutex> streamLock(this->streamMutex);
+	std::lock_guard<std::mutex> segmentLock(this->segmentMutex);
+	this->rotation = value;
+	this->segmentRotation = value;
+}
+
+app::logger::rotation_s app::logger::Backend::getRotation() const {
+	std::lock_guard<std::mutex> lock(this->streamMutex);
+	return this->rotation;
+}
+
+void app::logger::Backend::close(const std::string & filename) {
+	this->flush();
+	std::lock_guard<std::mutex> lock(this->streamMutex);
+	this->streams.erase(filename);
+}
+
+void app::logger::Backend::waitForSegments() {
+	std::unique_lock<std::mutex> lock(this->segmentMutex);
+	this->segmentsProcessed.wait(lock, [this] () {
+		return (((this->rotatedFiles.empty() == true) && (this->processingSegments == false)) || (this->segmentWorkerRunning == false));
+	});
+}
@@ -16,9 +16,9 @@
 #include "app/utility/logger/config.h"
 
 // Categories
-LOGGING_CONTEXT(loggerConfigOverall, loggerConfig.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(loggerConfigOverall, loggerConfig.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::logger::Config::Config() : defaultType(app::logger::msg_type_e::TYPE_LEVEL), defaultVerbosity(app::logger::info_level_e::INFO_VERBOSITY), defaultContextName("default") {
+app::logger::Config::Config() : defaultType(app::logger::msg_type_e::DEFAULT_TYPE_LEVEL), defaultVerbosity(app::logger::info_level_e::DEFAULT_INFO_VERBOSITY), defaultContextName("default"), queueCapacity(8192), defaultQueuePolicy(app::logger::queue_policy_e::BLOCK), defaultFlushInterval(100), defaultRotation({ 0, 0, 5, false, 0 }) {
 
 }
 
@@ -29,3 +29,7 @@ app::logger::Config::~Config() {
 CONST_GETTER(app::logger::Config::getDefaultType, app::logger::msg_type_e &, this->defaultType)
 CONST_GETTER(app::logger::Config::getDefaultVerbosity, app::logger::info_level_e &, this->defaultVerbosity)
 CONST_GETTER(app::logger::Config::getDefaultContextName, std::string &, this->defaultContextName)
+CONST_GETTER(app::logger::Config::getQueueCapacity, std::size_t &, this->queueCapacity)
+CONST_GETTER(app::logger::Config::getDefaultQueuePolicy, app::logger::queue_policy_e &, this->defaultQueuePolicy)
+CONST_GETTER(app::logger::Config::getDefaultFlushInterval, int &, this->defaultFlushInterval)
+CONST_GETTER(app::logger::Config::getDefaultRotation, app::logger::rotation_s &, this->defaultRotation)
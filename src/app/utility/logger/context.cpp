@@ -17,11 +17,10 @@
 #include "app/utility/logger/context.h"
 
 app::logger::Context app::logger::Context::getDefaultContext() {
-	app::logger::Context context(app::logger::Config::getInstance()->getDefaultContextName(), std::string(), 0, std::string(), app::logger::Config::getInstance()->getDefaultType(), app::logger::Config::getInstance()->getDefaultVerbosity(), app::settings::Global::getLogFilePath());
-	return context;
+	return app::logger::Context(app::logger::Config::getInstance()->getDefaultContextName(), std::string(), 0, std::string(), app::logger::Config::getInstance()->getDefaultType(), app::logger::Config::getInstance()->getDefaultVerbosity(), app::settings::Global::getLogFilePath());
 }
 
-app::logger::Context::Context(const std::string contextName, const std::string contextFile, const int contextLine, const std::string contextFunction, const app::logger::msg_type_e contextType, const app::logger::info_level_e contextInfoVerbosity, const std::string ologfilename) : name(contextName), file(contextFile), line(contextLine), function(contextFunction), logFilename(ologfilename), type(contextType), infoVerbosity(contextInfoVerbosity) {
+app::logger::Context::Context(const std::string contextName, const std::string contextFile, const int contextLine, const std::string contextFunction, const app::logger::msg_type_e contextType, const app::logger::info_level_e contextInfoVerbosity, const std::string ologfilename) : name(contextName), file(contextFile), line(contextLine), function(contextFunction), logFilename(ologfilename), type(contextType), infoVerbosity(contextInfoVerbosity), threshold(app::logger::Filter::merge(app::logger::Filter::pack(contextType, contextInfoVerbosity), app::logger::Filter::getThreshold().load(std::memory_order_relaxed))) {
 
 }
 
@@ -48,3 +47,15 @@ CONST_SETTER_GETTER(app::logger::Context::setInfoVerbosity, app::logger::Context
 CONST_GETTER(app::logger::Context::getFile, std::string &, this->file)
 CONST_GETTER(app::logger::Context::getLine, int &, this->line)
 CONST_GETTER(app::logger::Context::getFunction, std::string &, this->function)
+
+void app::logger::Context::setThreshold(const std::uint32_t & value) const {
+	this->threshold.store(value, std::memory_order_relaxed);
+}
+
+const std::atomic<std::uint32_t> & app::logger::Context::getThreshold() const {
+	return this->threshold;
+}
+
+bool app::logger::Context::isEnabled(const app::logger::msg_type_e & msgType, const app::logger::info_level_e & verbosity) const {
+	return app::logger::Filter::isEnabled(msgType, verbosity, this->threshold);
+}
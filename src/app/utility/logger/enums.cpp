@@ -20,6 +20,8 @@ namespace app {
 
 		OVERLOAD_OPERATORS_CUSTOM_TYPE(app::logger::state_e)
 
+		OVERLOAD_OPERATORS_CUSTOM_TYPE(app::logger::queue_policy_e)
+
 	}
 
 }
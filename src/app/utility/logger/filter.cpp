@@ -0,0 +1,25 @@
+/**
+ * @copyright
+ * @file filter.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Logger filter functions
+ */
+
+#include "app/utility/logger/filter.h"
+#include "app/utility/logger/registry.h"
+
+std::atomic<std::uint32_t> app::logger::Filter::threshold(app::logger::Filter::pack(app::logger::Filter::compiledMinimumType, app::logger::Filter::compiledMaximumVerbosity));
+
+void app::logger::Filter::setThreshold(const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity) {
+	app::logger::Filter::threshold.store(app::logger::Filter::pack(minimumType, maximumVerbosity), std::memory_order_relaxed);
+	app::logger::Registry::getInstance()->update();
+}
+
+app::logger::msg_type_e app::logger::Filter::getMinimumType() {
+	return app::logger::Filter::unpackType(app::logger::Filter::threshold.load(std::memory_order_relaxed));
+}
+
+app::logger::info_level_e app::logger::Filter::getMaximumVerbosity() {
+	return app::logger::Filter::unpackVerbosity(app::logger::Filter::threshold.load(std::memory_order_relaxed));
+}
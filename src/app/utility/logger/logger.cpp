@@ -7,16 +7,26 @@
  */
 
 #include <string>
+#include <chrono>
 
-#include "app/settings/global.h"
 #include "app/shared/setters_getters.h"
 #include "app/utility/cpp/cpp_operator.h"
 #include "app/utility/logger/macros.h"
 #include "app/utility/logger/config.h"
+#include "app/utility/logger/filter.h"
+#include "app/utility/logger/backend.h"
 #include "app/utility/logger/logger.h"
 
 // Categories
-LOGGING_CONTEXT(loggerOverall, logger.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(loggerOverall, logger.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+app::logger::Logger::Logger(const app::logger::metadata_s & loggerMetadata, const app::logger::info_level_e loggerInfoVerbosity, const std::string ologfilename) : context(app::logger::Config::getInstance()->getDefaultContextName(), app::logger::Config::getInstance()->getDefaultType(), app::logger::Config::getInstance()->getDefaultVerbosity(), ologfilename), metadata(&loggerMetadata), timestamp(0), message(), infoVerbosity(loggerInfoVerbosity), type(loggerMetadata.type), state(app::logger::state_e::CONSTRUCTED) {
+
+}
+
+app::logger::Logger::Logger(const app::logger::metadata_s & loggerMetadata, const std::string ologfilename) : app::logger::Logger(loggerMetadata, app::logger::Config::getInstance()->getDefaultVerbosity(), ologfilename) {
+
+}
 
 app::logger::Logger::Logger(const app::logger::msg_type_e loggerType, const std::string contextFile, const int line, const std::string function, app::logger::Logger::context_function_t loggerContextConstRef, const app::logger::info_level_e loggerInfoVerbosity, const std::string ologfilename) : app::logger::Logger(loggerType, contextFile, line, function, loggerContextConstRef(), loggerInfoVerbosity, ologfilename) {
 
@@ -26,7 +36,7 @@ app::logger::Logger::Logger(const app::logger::msg_type_e loggerType, const std:
 	this->initializeLogging(loggerContext);
 }
 
-app::logger::Logger::Logger(const app::logger::msg_type_e loggerType, const std::string contextFile, const int line, const std::string function, const app::logger::info_level_e loggerInfoVerbosity, const std::string ologfilename) : context(app::logger::Config::getInstance()->getDefaultContextName(), contextFile, line, function, app::logger::Config::getInstance()->getDefaultType(), app::logger::Config::getInstance()->getDefaultVerbosity(), ologfilename), ofile(), infoVerbosity(loggerInfoVerbosity), type(loggerType), state(app::logger::state_e::CONSTRUCTED) {
+app::logger::Logger::Logger(const app::logger::msg_type_e loggerType, const std::string contextFile, const int line, const std::string function, const app::logger::info_level_e loggerInfoVerbosity, const std::string ologfilename) : context(app::logger::Config::getInstance()->getDefaultContextName(), contextFile, line, function, app::logger::Config::getInstance()->getDefaultType(), app::logger::Config::getInstance()->getDefaultVerbosity(), ologfilename), metadata(nullptr), timestamp(0), message(), infoVerbosity(loggerInfoVerbosity), type(loggerType), state(app::logger::state_e::CONSTRUCTED) {
 
 }
 
@@ -37,10 +47,10 @@ app::logger::Logger::Logger(const app::logger::msg_type_e loggerType, const std:
 app::logger::Logger::~Logger() {
 	this->endLogging();
 	this->setState(app::logger::state_e::TERMINATING);
-	// Close ofile when destroying the logger
-	this->closeOFile();
 
 	if (this->type == app::logger::msg_type_e::FATAL) {
+		// Make sure the fatal message reaches the log before terminating
+		app::logger::Backend::getInstance()->flush();
 		std::terminate();
 	}
 }
@@ -50,6 +60,7 @@ void app::logger::Logger::copyContextData(const app::logger::Context & otherCont
 	this->context.setName(otherContext.getName());
 	this->context.setType(otherContext.getType());
 	this->context.setInfoVerbosity(otherContext.getInfoVerbosity());
+	this->context.setThreshold(otherContext.getThreshold().load(std::memory_order_relaxed));
 	const std::string & currentCtxtLogFilename = this->context.getLogFilename();
 	// Copy log filename from context only if no filename was passed to the logger at the time of construction
 	if (currentCtxtLogFilename.empty() == true) {
@@ -70,81 +81,55 @@ void app::logger::Logger::initializeLogging(app::logger::Logger::context_functio
 
 void app::logger::Logger::createHeader() {
 	EXCEPTION_ACTION_COND((this->state != app::logger::state_e::INITIALIZED), throw, "Function " << __func__ << " can only be executed if the logger is in state app::logger::state_e::INITIALIZED. Current state is " << this->state);
-	std::string header = std::string();
-	header = header + "[" + app::shared::getDateTime().toStdString() + "] ";
-	header = header + app::shared::qEnumToQString(this->type, true).toStdString();
-
-	// CategoryFunction
-	const std::string & contextName = this->context.getName();
-	if (contextName.empty() == false) {
-		header = header + " [" + contextName + "]";
-	}
-
-	// Filename
-	const std::string & contextFile = this->context.getFile();
-	if (contextFile.empty() == false) {
-		header = header + " File " + contextFile;
-	}
-
-	// Function
-	const std::string & contextFunction = this->context.getFunction();
-	if (contextFunction.empty() == false) {
-		header = header + " in function " + contextFunction;
-	}
 
 	this->setState(app::logger::state_e::WRITING_HEADER);
-	*this << header << " ";
-	this->setState(app::logger::state_e::LOGGING_MESSAGE);
-}
 
-void app::logger::Logger::endLogging() {
-	// End logging only if logging is allowed and stream file is opened or writing to standard out
-	if ((this->isLogAllowed() == true) && ((this->ofile.is_open() == true) || (this->getLogFilename().compare(app::logger::stdoutStr) == 0))) {
-		this->logMutex.lock();
-		// Append endl at the end of the message
-		if (this->getLogFilename().compare(app::logger::stdoutStr) == 0) {
-			std::cout << std::endl;
-		} else {
-			this->ofile << std::endl;
+	if (this->metadata != nullptr) {
+		// The header is formatted by the backend out of the metadata, therefore only the time is captured here
+		const std::chrono::nanoseconds now = std::chrono::system_clock::now().time_since_epoch();
+		this->timestamp = static_cast<std::int64_t>(now.count());
+	} else {
+		std::string header = std::string();
+		header = header + "[" + app::shared::getDateTime().toStdString() + "] ";
+		header = header + app::shared::qEnumToQString(this->type, true).toStdString();
+
+		// CategoryFunction
+		const std::string & contextName = this->context.getName();
+		if (contextName.empty() == false) {
+			header = header + " [" + contextName + "]";
 		}
-		this->logMutex.unlock();
-	}
-	this->setState(app::logger::state_e::LOGGING_ENDED);
-}
 
-void app::logger::Logger::openOFile() {
-	if (this->getLogFilename().compare(app::logger::stdoutStr) != 0) {
-		// Do not open the file if it is stdout
-		if (this->ofile.is_open() == false) {
-			if (this->getLogFilename().empty() == true) {
-				this->context.setLogFilename(app::settings::Global::getLogFilePath());
-			}
-			this->ofile.open(this->getLogFilename(), app::logger::Logger::openMode);
-			if ((this->ofile.rdstate() & std::ostream::failbit) != 0) {
-				EXCEPTION_ACTION(throw, "Unable to open file " << this->getLogFilename());
-			}
+		// Filename
+		const std::string & contextFile = this->context.getFile();
+		if (contextFile.empty() == false) {
+			header = header + " File " + contextFile;
 		}
+
+		// Function
+		const std::string & contextFunction = this->context.getFunction();
+		if (contextFunction.empty() == false) {
+			header = header + " in function " + contextFunction;
+		}
+
+		*this << header << " ";
 	}
+
+	this->setState(app::logger::state_e::LOGGING_MESSAGE);
 }
 
-void app::logger::Logger::closeOFile() {
-	// Do nto close the file if it is not opened or if it is stdout
-	if ((this->getLogFilename().compare(app::logger::stdoutStr) != 0) && (this->ofile.is_open() == true)){
-		this->logMutex.lock();
-		this->ofile.close();
-		this->logMutex.unlock();
+void app::logger::Logger::endLogging() {
+	// Hand over the message to the backend only if logging is allowed
+	if (this->isLogAllowed() == true) {
+		app::logger::record_s record = { this->metadata, this->type, this->timestamp, this->context.getName(), this->getLogFilename(), this->message.str(), app::logger::record_format_e::TEXT };
+		app::logger::Backend::getInstance()->push(std::move(record));
 	}
+	this->setState(app::logger::state_e::LOGGING_ENDED);
 }
 
 bool app::logger::Logger::isLogAllowed() const {
 	bool allowed = ((this->state == app::logger::state_e::WRITING_HEADER) || (this->state == app::logger::state_e::LOGGING_MESSAGE));
-	if (this->type <= this->context.getType()) {
-		// For info messages, verbosity also must be checked
-		if (this->type == app::logger::msg_type_e::INFO) {
-			// if verbosity of the context is higher than the requested verbosity
-			allowed &= (this->infoVerbosity <= this->context.getInfoVerbosity());
-		}
-	}
+	// Message type must be at least the minimum type of the context and, for info messages, verbosity of the context must be higher than the requested verbosity. Both thresholds may have been changed at runtime by the logging rules
+	allowed &= this->context.isEnabled(this->type, this->infoVerbosity);
 	return allowed;
 }
 
@@ -0,0 +1,241 @@
+/**
+ * @copyright
+ * @file registry.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Logger registry functions
+ */
+
+#include <cctype>
+#include <utility>
+
+#include "app/shared/exception.h"
+#include "app/utility/logger/filter.h"
+#include "app/utility/logger/registry.h"
+
+namespace app {
+
+	namespace logger {
+
+		namespace registry {
+
+			namespace {
+
+				/**
+				 * @brief Message types that can be set by a rule
+				 *
+				 */
+				static const std::map<std::string, app::logger::msg_type_e> types = {
+					{ "debug", app::logger::msg_type_e::DEBUG },
+					{ "info", app::logger::msg_type_e::INFO },
+					{ "warning", app::logger::msg_type_e::WARNING },
+					{ "error", app::logger::msg_type_e::ERROR },
+					{ "fatal", app::logger::msg_type_e::FATAL }
+				};
+
+				/**
+				 * @brief Verbosities that can be set by a rule
+				 *
+				 */
+				static const std::map<std::string, app::logger::info_level_e> verbosities = {
+					{ "zero", app::logger::info_level_e::ZERO },
+					{ "low", app::logger::info_level_e::LOW },
+					{ "medium", app::logger::info_level_e::MEDIUM },
+					{ "high", app::logger::info_level_e::HIGH }
+				};
+
+				/**
+				 * @brief Characters separating rules
+				 *
+				 */
+				static const std::string ruleSeparators(",;");
+
+				/**
+				 * @brief Function: std::string trim(const std::string & text)
+				 *
+				 * \param text: text to trim
+				 *
+				 * \return the text without leading and trailing whitespaces
+				 *
+				 * This function removes leading and trailing whitespaces from a field of a rule
+				 */
+				std::string trim(const std::string & text) {
+					std::size_t first = 0;
+					std::size_t last = text.size();
+					while ((first < last) && (std::isspace(static_cast<unsigned char>(text.at(first))) != 0)) {
+						first++;
+					}
+					while ((last > first) && (std::isspace(static_cast<unsigned char>(text.at(last - 1))) != 0)) {
+						last--;
+					}
+					return text.substr(first, (last - first));
+				}
+
+				/**
+				 * @brief Function: std::string toLower(const std::string & text)
+				 *
+				 * \param text: text to convert
+				 *
+				 * \return the text converted to lowercase
+				 *
+				 * This function converts a text to lowercase
+				 */
+				std::string toLower(const std::string & text) {
+					std::string lower(text);
+					for (char & character : lower) {
+						character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+					}
+					return lower;
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+app::logger::Registry::Registry() : registryMutex(), contexts(), rules(), rulesText() {
+
+}
+
+app::logger::Registry::~Registry() {
+
+}
+
+bool app::logger::Registry::matches(const std::string & pattern, const std::string & name) {
+	std::size_t patternIdx = 0;
+	std::size_t nameIdx = 0;
+	// Position of the last * in the pattern and of the character of the name it is matched up to
+	std::size_t starIdx = std::string::npos;
+	std::size_t starNameIdx = 0;
+
+	while (nameIdx < name.size()) {
+		if ((patternIdx < pattern.size()) && ((pattern.at(patternIdx) == '?') || (pattern.at(patternIdx) == name.at(nameIdx)))) {
+			patternIdx++;
+			nameIdx++;
+		} else if ((patternIdx < pattern.size()) && (pattern.at(patternIdx) == '*')) {
+			starIdx = patternIdx;
+			starNameIdx = nameIdx;
+			patternIdx++;
+		} else if (starIdx != std::string::npos) {
+			// Let the last * match one more character
+			patternIdx = starIdx + 1;
+			starNameIdx++;
+			nameIdx = starNameIdx;
+		} else {
+			return false;
+		}
+	}
+
+	while ((patternIdx < pattern.size()) && (pattern.at(patternIdx) == '*')) {
+		patternIdx++;
+	}
+
+	return (patternIdx == pattern.size());
+}
+
+bool app::logger::Registry::add(const std::string & name, app::logger::Context::context_getter_t getter) {
+	std::lock_guard<std::mutex> lock(this->registryMutex);
+	this->contexts[name].push_back(getter);
+	if (this->rules.empty() == false) {
+		// Rules are set once the program has started therefore the context can be safely constructed
+		const app::logger::Context & context = getter();
+		context.setThreshold(this->computeThreshold(context));
+	}
+	return true;
+}
+
+app::logger::rule_s app::logger::Registry::parseRule(const std::string & text) {
+	const std::size_t equalPosition = text.find('=');
+	EXCEPTION_ACTION_COND((equalPosition == std::string::npos), throw, "Logging rule " << text << " must be in the format <pattern>=<type>[:<verbosity>]");
+
+	app::logger::rule_s rule = { app::logger::registry::trim(text.substr(0, equalPosition)), app::logger::msg_type_e::INFO, app::logger::Filter::getCompiledMaximumVerbosity() };
+	EXCEPTION_ACTION_COND((rule.pattern.empty() == true), throw, "Pattern of logging rule " << text << " is empty");
+
+	const std::string level(app::logger::registry::toLower(app::logger::registry::trim(text.substr(equalPosition + 1))));
+	const std::size_t colonPosition = level.find(':');
+	const std::string typeName(app::logger::registry::trim(level.substr(0, colonPosition)));
+	const std::map<std::string, app::logger::msg_type_e>::const_iterator typeIt = app::logger::registry::types.find(typeName);
+	EXCEPTION_ACTION_COND((typeIt == app::logger::registry::types.cend()), throw, "Message type " << typeName << " of logging rule " << text << " is not valid. Valid types are debug, info, warning, error and fatal");
+	rule.type = typeIt->second;
+	// Messages removed at compile time cannot be enabled by a rule
+	EXCEPTION_ACTION_COND((rule.type < app::logger::Filter::getCompiledMinimumType()), throw, "Message type " << typeName << " of logging rule " << text << " is lower than the minimum message type " << app::logger::Filter::getCompiledMinimumType() << " the program is built with. Rebuild the program with a lower TYPE_LEVEL to print these messages");
+
+	if (colonPosition != std::string::npos) {
+		const std::string verbosityName(app::logger::registry::trim(level.substr(colonPosition + 1)));
+		const std::map<std::string, app::logger::info_level_e>::const_iterator verbosityIt = app::logger::registry::verbosities.find(verbosityName);
+		EXCEPTION_ACTION_COND((verbosityIt == app::logger::registry::verbosities.cend()), throw, "Verbosity " << verbosityName << " of logging rule " << text << " is not valid. Valid verbosities are zero, low, medium and high");
+		rule.verbosity = verbosityIt->second;
+		EXCEPTION_ACTION_COND((rule.verbosity > app::logger::Filter::getCompiledMaximumVerbosity()), throw, "Verbosity " << verbosityName << " of logging rule " << text << " is higher than the maximum verbosity " << app::logger::Filter::getCompiledMaximumVerbosity() << " the program is built with. Rebuild the program with a higher INFO_VERBOSITY to print these messages");
+	}
+
+	return rule;
+}
+
+void app::logger::Registry::setRules(const std::string & value) {
+	// Parse all rules before applying any of them so that an invalid rule leaves the current ones untouched
+	std::vector<app::logger::rule_s> newRules;
+	std::size_t start = 0;
+	while (start <= value.size()) {
+		std::size_t end = value.find_first_of(app::logger::registry::ruleSeparators, start);
+		if (end == std::string::npos) {
+			end = value.size();
+		}
+		const std::string text(app::logger::registry::trim(value.substr(start, (end - start))));
+		if (text.empty() == false) {
+			newRules.push_back(app::logger::Registry::parseRule(text));
+		}
+		start = end + 1;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->registryMutex);
+		this->rules = std::move(newRules);
+		this->rulesText = value;
+	}
+
+	this->update();
+}
+
+const std::string & app::logger::Registry::getRules() const {
+	return this->rulesText;
+}
+
+std::vector<std::string> app::logger::Registry::getNames() const {
+	std::lock_guard<std::mutex> lock(this->registryMutex);
+	std::vector<std::string> names;
+	names.reserve(this->contexts.size());
+	for (std::map<std::string, std::vector<app::logger::Context::context_getter_t>>::const_iterator contextIt = this->contexts.cbegin(); contextIt != this->contexts.cend(); contextIt++) {
+		names.push_back(contextIt->first);
+	}
+	return names;
+}
+
+const app::logger::Context & app::logger::Registry::getContext(const std::string & name) const {
+	std::lock_guard<std::mutex> lock(this->registryMutex);
+	const std::map<std::string, std::vector<app::logger::Context::context_getter_t>>::const_iterator contextIt = this->contexts.find(name);
+	EXCEPTION_ACTION_COND((contextIt == this->contexts.cend()), throw, "No context named " << name << " has been registered");
+	return contextIt->second.front()();
+}
+
+std::uint32_t app::logger::Registry::computeThreshold(const app::logger::Context & context) const {
+	std::uint32_t packedThreshold = app::logger::Filter::pack(context.getType(), context.getInfoVerbosity());
+	for (const app::logger::rule_s & rule : this->rules) {
+		if (app::logger::Registry::matches(rule.pattern, context.getName()) == true) {
+			packedThreshold = app::logger::Filter::pack(rule.type, rule.verbosity);
+		}
+	}
+	return app::logger::Filter::merge(packedThreshold, app::logger::Filter::getThreshold().load(std::memory_order_relaxed));
+}
+
+void app::logger::Registry::update() {
+	std::lock_guard<std::mutex> lock(this->registryMutex);
+	for (std::map<std::string, std::vector<app::logger::Context::context_getter_t>>::const_iterator contextIt = this->contexts.cbegin(); contextIt != this->contexts.cend(); contextIt++) {
+		for (const app::logger::Context::context_getter_t & getter : contextIt->second) {
+			const app::logger::Context & context = getter();
+			context.setThreshold(this->computeThreshold(context));
+		}
+	}
+}
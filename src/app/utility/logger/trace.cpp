@@ -0,0 +1,87 @@
+/**
+ * @copyright
+ * @file trace.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Logger trace functions
+ */
+
+#include <utility>
+
+// Qt libraries
+#include <QtCore/QByteArray>
+
+#include "app/shared/qt_functions.h"
+#include "app/settings/global.h"
+#include "app/utility/logger/backend.h"
+#include "app/utility/logger/trace.h"
+
+void app::logger::trace::appendArgument(std::string & buffer, const QString & argument) {
+	const QByteArray text(argument.toUtf8());
+	app::logger::trace::appendRaw(buffer, app::logger::trace::argument_type_e::STRING);
+	app::logger::trace::appendString(buffer, text.constData(), static_cast<std::size_t>(text.size()));
+}
+
+app::logger::Tracer::Tracer() : descriptorMutex(), descriptors(), filename() {
+
+}
+
+app::logger::Tracer::~Tracer() {
+
+}
+
+std::uint32_t app::logger::Tracer::registerStatement(std::atomic<std::uint32_t> & id, const app::logger::metadata_s & metadata, const app::logger::Context & context, const char * format) {
+	std::lock_guard<std::mutex> lock(this->descriptorMutex);
+
+	std::uint32_t statementId = id.load(std::memory_order_acquire);
+	if (statementId == 0) {
+		app::logger::trace::descriptor_s descriptor;
+		descriptor.type = app::shared::qEnumToQString(metadata.type, true).toStdString();
+		descriptor.context = context.getName();
+		descriptor.file = (metadata.file != nullptr) ? metadata.file : "";
+		descriptor.line = metadata.line;
+		descriptor.function = (metadata.function != nullptr) ? metadata.function : "";
+		descriptor.format = (format != nullptr) ? format : "";
+		this->descriptors.push_back(descriptor);
+		statementId = static_cast<std::uint32_t>(this->descriptors.size());
+		id.store(statementId, std::memory_order_release);
+	}
+
+	return statementId;
+}
+
+bool app::logger::Tracer::getDescriptor(const std::uint32_t & id, app::logger::trace::descriptor_s & descriptor) const {
+	std::lock_guard<std::mutex> lock(this->descriptorMutex);
+	if ((id == 0) || (id > this->descriptors.size())) {
+		return false;
+	}
+	descriptor = this->descriptors.at(static_cast<std::size_t>(id - 1));
+	return true;
+}
+
+void app::logger::Tracer::push(const std::uint32_t & id, const app::logger::metadata_s & metadata, const app::logger::Context & context, const char * format, std::string && entry) {
+	if (this->filename.empty() == true) {
+		// Without a trace file, the message is formatted here and written to the text log like any other message
+		std::string text = std::string();
+		app::logger::trace::formatArguments(((format != nullptr) ? format : ""), (entry.data() + app::logger::trace::recordHeaderSize), (entry.data() + entry.size()), text);
+		const std::chrono::nanoseconds now = std::chrono::system_clock::now().time_since_epoch();
+		const std::string & contextLogFilename = context.getLogFilename();
+		const std::string & logFilename = (contextLogFilename.empty() == true) ? app::settings::Global::getLogFilePath() : contextLogFilename;
+		app::logger::record_s record = { &metadata, metadata.type, static_cast<std::int64_t>(now.count()), context.getName(), logFilename, std::move(text), app::logger::record_format_e::TEXT };
+		app::logger::Backend::getInstance()->push(std::move(record));
+	} else {
+		const std::chrono::nanoseconds now = std::chrono::steady_clock::now().time_since_epoch();
+		const std::int64_t timestamp = static_cast<std::int64_t>(now.count());
+		app::logger::trace::endRecord(entry, id, timestamp);
+		app::logger::record_s record = { nullptr, metadata.type, timestamp, std::string(), this->filename, std::move(entry), app::logger::record_format_e::BINARY };
+		app::logger::Backend::getInstance()->push(std::move(record));
+	}
+}
+
+void app::logger::Tracer::setFilename(const std::string & value) {
+	this->filename = value;
+}
+
+const std::string & app::logger::Tracer::getFilename() const {
+	return this->filename;
+}
@@ -0,0 +1,424 @@
+/**
+ * @copyright
+ * @file trace_format.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Logger trace format functions
+ */
+
+#include <ctime>
+#include <cstdio>
+
+#include "app/utility/logger/trace_format.h"
+
+namespace app {
+
+	namespace logger {
+
+		namespace trace {
+
+			namespace {
+				/**
+				 * @brief number of nanoseconds in a second
+				 *
+				 */
+				static constexpr std::int64_t nanosecondsInSecond = 1000000000;
+
+				/**
+				 * @brief number of nanoseconds in a millisecond
+				 *
+				 */
+				static constexpr std::int64_t nanosecondsInMillisecond = 1000000;
+
+				/**
+				 * @brief placeholder of an argument in the format string
+				 *
+				 */
+				static const std::string placeholder("{}");
+
+				/**
+				 * @brief Function: void appendEntry(std::string & buffer, const app::logger::trace::entry_type_e & type, const std::string & body)
+				 *
+				 * \param buffer: buffer to append the entry to
+				 * \param type: type of the entry
+				 * \param body: body of the entry
+				 *
+				 * This function appends an entry to the buffer
+				 */
+				void appendEntry(std::string & buffer, const app::logger::trace::entry_type_e & type, const std::string & body) {
+					app::logger::trace::appendRaw(buffer, type);
+					app::logger::trace::appendRaw(buffer, static_cast<std::uint32_t>(body.size()));
+					buffer.append(body);
+				}
+
+				/**
+				 * @brief Function: bool readString(const char * & data, const char * end, std::string & text)
+				 *
+				 * \param data: pointer to the bytes to read. It is moved past the string
+				 * \param end: end of the bytes to read
+				 * \param text: string read
+				 *
+				 * \return true if the string was read, false if there are not enough bytes
+				 *
+				 * This function reads the size of a string followed by its characters
+				 */
+				bool readString(const char * & data, const char * end, std::string & text) {
+					std::uint32_t size = 0;
+					if (app::logger::trace::readRaw(data, end, size) == false) {
+						return false;
+					}
+					if (static_cast<std::size_t>(end - data) < static_cast<std::size_t>(size)) {
+						return false;
+					}
+					text.assign(data, static_cast<std::size_t>(size));
+					data += size;
+					return true;
+				}
+
+				/**
+				 * @brief Function: bool appendDecodedArgument(const char * & data, const char * end, std::string & text)
+				 *
+				 * \param data: pointer to the argument to decode. It is moved past the argument
+				 * \param end: end of the arguments
+				 * \param text: text to append the argument to
+				 *
+				 * \return true if the argument was decoded, false otherwise
+				 *
+				 * This function decodes an argument and appends its textual representation to the text
+				 */
+				bool appendDecodedArgument(const char * & data, const char * end, std::string & text) {
+					app::logger::trace::argument_type_e type = app::logger::trace::argument_type_e::SIGNED;
+					if (app::logger::trace::readRaw(data, end, type) == false) {
+						return false;
+					}
+
+					bool success = false;
+					switch (type) {
+						case app::logger::trace::argument_type_e::SIGNED:
+						{
+							std::int64_t value = 0;
+							success = app::logger::trace::readRaw(data, end, value);
+							text.append(std::to_string(value));
+							break;
+						}
+						case app::logger::trace::argument_type_e::UNSIGNED:
+						{
+							std::uint64_t value = 0;
+							success = app::logger::trace::readRaw(data, end, value);
+							text.append(std::to_string(value));
+							break;
+						}
+						case app::logger::trace::argument_type_e::FLOATING:
+						{
+							double value = 0.0;
+							success = app::logger::trace::readRaw(data, end, value);
+							// Same representation as streaming a double into the text log
+							char number[32];
+							std::snprintf(number, sizeof(number), "%g", value);
+							text.append(number);
+							break;
+						}
+						case app::logger::trace::argument_type_e::BOOLEAN:
+						{
+							std::uint8_t value = 0;
+							success = app::logger::trace::readRaw(data, end, value);
+							text.append((value != 0) ? "1" : "0");
+							break;
+						}
+						case app::logger::trace::argument_type_e::STRING:
+						{
+							std::string value = std::string();
+							success = app::logger::trace::readString(data, end, value);
+							text.append(value);
+							break;
+						}
+						default:
+							success = false;
+							break;
+					}
+
+					return success;
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+void app::logger::trace::appendString(std::string & buffer, const char * text, const std::size_t & size) {
+	app::logger::trace::appendRaw(buffer, static_cast<std::uint32_t>(size));
+	buffer.append(text, size);
+}
+
+void app::logger::trace::appendArgument(std::string & buffer, const char * argument) {
+	app::logger::trace::appendRaw(buffer, app::logger::trace::argument_type_e::STRING);
+	if (argument == nullptr) {
+		app::logger::trace::appendString(buffer, "", 0);
+	} else {
+		app::logger::trace::appendString(buffer, argument, std::strlen(argument));
+	}
+}
+
+void app::logger::trace::appendArgument(std::string & buffer, const std::string & argument) {
+	app::logger::trace::appendRaw(buffer, app::logger::trace::argument_type_e::STRING);
+	app::logger::trace::appendString(buffer, argument.data(), argument.size());
+}
+
+void app::logger::trace::appendHeader(std::string & buffer, const std::int64_t & systemTime, const std::int64_t & monotonicTime) {
+	std::string body = std::string();
+	body.append(app::logger::trace::magic, (sizeof(app::logger::trace::magic) - 1));
+	app::logger::trace::appendRaw(body, app::logger::trace::version);
+	app::logger::trace::appendRaw(body, systemTime);
+	app::logger::trace::appendRaw(body, monotonicTime);
+	app::logger::trace::appendEntry(buffer, app::logger::trace::entry_type_e::HEADER, body);
+}
+
+void app::logger::trace::appendDescriptor(std::string & buffer, const std::uint32_t & id, const app::logger::trace::descriptor_s & descriptor) {
+	std::string body = std::string();
+	app::logger::trace::appendRaw(body, id);
+	app::logger::trace::appendRaw(body, static_cast<std::int32_t>(descriptor.line));
+	app::logger::trace::appendString(body, descriptor.type.data(), descriptor.type.size());
+	app::logger::trace::appendString(body, descriptor.context.data(), descriptor.context.size());
+	app::logger::trace::appendString(body, descriptor.file.data(), descriptor.file.size());
+	app::logger::trace::appendString(body, descriptor.function.data(), descriptor.function.size());
+	app::logger::trace::appendString(body, descriptor.format.data(), descriptor.format.size());
+	app::logger::trace::appendEntry(buffer, app::logger::trace::entry_type_e::DESCRIPTOR, body);
+}
+
+void app::logger::trace::beginRecord(std::string & buffer) {
+	buffer.assign(app::logger::trace::recordHeaderSize, '\0');
+}
+
+void app::logger::trace::endRecord(std::string & buffer, const std::uint32_t & id, const std::int64_t & monotonicTime) {
+	// Arguments are dropped rather than writing an entry the decoder would reject
+	if ((buffer.size() - app::logger::trace::entryHeaderSize) > app::logger::trace::maxBodySize) {
+		buffer.resize(app::logger::trace::recordHeaderSize);
+	}
+	const std::uint32_t bodySize = static_cast<std::uint32_t>(buffer.size() - app::logger::trace::entryHeaderSize);
+	std::size_t position = 0;
+	app::logger::trace::writeRaw(buffer, position, app::logger::trace::entry_type_e::RECORD);
+	position += sizeof(app::logger::trace::entry_type_e);
+	app::logger::trace::writeRaw(buffer, position, bodySize);
+	position += sizeof(bodySize);
+	app::logger::trace::writeRaw(buffer, position, id);
+	position += sizeof(id);
+	app::logger::trace::writeRaw(buffer, position, monotonicTime);
+}
+
+bool app::logger::trace::readRecordId(const std::string & buffer, std::uint32_t & id) {
+	const char * data = buffer.data();
+	const char * end = data + buffer.size();
+	app::logger::trace::entry_type_e type = app::logger::trace::entry_type_e::HEADER;
+	std::uint32_t bodySize = 0;
+	bool success = app::logger::trace::readRaw(data, end, type);
+	success = success && (type == app::logger::trace::entry_type_e::RECORD);
+	success = success && app::logger::trace::readRaw(data, end, bodySize);
+	success = success && app::logger::trace::readRaw(data, end, id);
+	return success;
+}
+
+bool app::logger::trace::formatArguments(const std::string & format, const char * data, const char * end, std::string & text) {
+	text.clear();
+	bool success = true;
+
+	std::size_t start = 0;
+	std::size_t position = format.find(app::logger::trace::placeholder);
+	while (position != std::string::npos) {
+		text.append(format, start, (position - start));
+		if ((success == true) && (data < end)) {
+			success = app::logger::trace::appendDecodedArgument(data, end, text);
+		} else {
+			text.append(app::logger::trace::placeholder);
+		}
+		start = position + app::logger::trace::placeholder.size();
+		position = format.find(app::logger::trace::placeholder, start);
+	}
+	text.append(format, start, std::string::npos);
+
+	while ((success == true) && (data < end)) {
+		text.append(" ");
+		success = app::logger::trace::appendDecodedArgument(data, end, text);
+	}
+
+	return success;
+}
+
+app::logger::trace::Decoder::Decoder() : descriptors(), systemOrigin(0), monotonicOrigin(0), decodedRecords(0), error(), text() {
+
+}
+
+app::logger::trace::Decoder::~Decoder() {
+
+}
+
+bool app::logger::trace::Decoder::decode(std::istream & input, std::ostream & output) {
+	std::string body = std::string();
+	bool headerFound = false;
+
+	while (true) {
+		char entryHeader[app::logger::trace::entryHeaderSize];
+		input.read(entryHeader, static_cast<std::streamsize>(app::logger::trace::entryHeaderSize));
+		const std::streamsize headerBytes = input.gcount();
+		if (headerBytes == 0) {
+			break;
+		}
+		if (headerBytes != static_cast<std::streamsize>(app::logger::trace::entryHeaderSize)) {
+			this->error = "The trace is truncated in the middle of the header of an entry";
+			return false;
+		}
+
+		const char * data = entryHeader;
+		const char * end = entryHeader + app::logger::trace::entryHeaderSize;
+		app::logger::trace::entry_type_e type = app::logger::trace::entry_type_e::HEADER;
+		std::uint32_t bodySize = 0;
+		app::logger::trace::readRaw(data, end, type);
+		app::logger::trace::readRaw(data, end, bodySize);
+
+		// The type and the size are checked before allocating the body as a corrupted size could allocate up to 4GB
+		if (type > app::logger::trace::entry_type_e::RECORD) {
+			this->error = "Unknown entry type " + std::to_string(static_cast<unsigned int>(type));
+			return false;
+		}
+		if (static_cast<std::size_t>(bodySize) > app::logger::trace::maxBodySize) {
+			this->error = "Entry of " + std::to_string(bodySize) + " bytes is larger than the maximum size of " + std::to_string(app::logger::trace::maxBodySize) + " bytes";
+			return false;
+		}
+
+		if ((headerFound == false) && (type != app::logger::trace::entry_type_e::HEADER)) {
+			this->error = "The trace does not start with a header";
+			return false;
+		}
+		headerFound = true;
+
+		body.resize(static_cast<std::size_t>(bodySize));
+		input.read(&body[0], static_cast<std::streamsize>(bodySize));
+		if (input.gcount() != static_cast<std::streamsize>(bodySize)) {
+			this->error = "The trace is truncated in the middle of the body of an entry";
+			return false;
+		}
+
+		if (this->decodeEntry(type, body, output) == false) {
+			return false;
+		}
+	}
+
+	if (headerFound == false) {
+		this->error = "The trace is empty";
+	}
+
+	return headerFound;
+}
+
+bool app::logger::trace::Decoder::decodeEntry(const app::logger::trace::entry_type_e & type, const std::string & body, std::ostream & output) {
+	const char * data = body.data();
+	const char * end = data + body.size();
+	bool success = true;
+
+	switch (type) {
+		case app::logger::trace::entry_type_e::HEADER:
+		{
+			const std::size_t magicSize = sizeof(app::logger::trace::magic) - 1;
+			std::uint32_t traceVersion = 0;
+			success = ((body.size() >= magicSize) && (body.compare(0, magicSize, app::logger::trace::magic) == 0));
+			data += magicSize;
+			success = success && app::logger::trace::readRaw(data, end, traceVersion);
+			success = success && (traceVersion == app::logger::trace::version);
+			success = success && app::logger::trace::readRaw(data, end, this->systemOrigin);
+			success = success && app::logger::trace::readRaw(data, end, this->monotonicOrigin);
+			if (success == false) {
+				this->error = "Invalid header or unsupported version of the trace format";
+			}
+			// Identifiers are only valid until the next header as they are assigned by every run of the program
+			this->descriptors.clear();
+			break;
+		}
+		case app::logger::trace::entry_type_e::DESCRIPTOR:
+		{
+			std::uint32_t id = 0;
+			std::int32_t line = 0;
+			app::logger::trace::descriptor_s descriptor;
+			success = app::logger::trace::readRaw(data, end, id);
+			success = success && app::logger::trace::readRaw(data, end, line);
+			success = success && app::logger::trace::readString(data, end, descriptor.type);
+			success = success && app::logger::trace::readString(data, end, descriptor.context);
+			success = success && app::logger::trace::readString(data, end, descriptor.file);
+			success = success && app::logger::trace::readString(data, end, descriptor.function);
+			success = success && app::logger::trace::readString(data, end, descriptor.format);
+			descriptor.line = static_cast<int>(line);
+			if (success == true) {
+				this->descriptors[id] = descriptor;
+			} else {
+				this->error = "Invalid descriptor";
+			}
+			break;
+		}
+		case app::logger::trace::entry_type_e::RECORD:
+		{
+			std::uint32_t id = 0;
+			std::int64_t monotonicTime = 0;
+			success = app::logger::trace::readRaw(data, end, id);
+			success = success && app::logger::trace::readRaw(data, end, monotonicTime);
+			std::map<std::uint32_t, app::logger::trace::descriptor_s>::const_iterator descriptorIt = this->descriptors.find(id);
+			success = success && (descriptorIt != this->descriptors.cend());
+			if (success == false) {
+				this->error = "Record refers to an unknown descriptor " + std::to_string(id);
+				break;
+			}
+
+			const app::logger::trace::descriptor_s & descriptor = descriptorIt->second;
+			success = app::logger::trace::formatArguments(descriptor.format, data, end, this->text);
+			if (success == false) {
+				this->error = "Invalid arguments of a record of descriptor " + std::to_string(id);
+				break;
+			}
+
+			// Same layout as the text log
+			output << "[" << this->formatDate(monotonicTime) << "] " << descriptor.type;
+			if (descriptor.context.empty() == false) {
+				output << " [" << descriptor.context << "]";
+			}
+			if (descriptor.file.empty() == false) {
+				output << " File " << descriptor.file;
+			}
+			if (descriptor.function.empty() == false) {
+				output << " in function " << descriptor.function;
+			}
+			output << " " << this->text << "\n";
+			this->decodedRecords++;
+			break;
+		}
+		default:
+			success = false;
+			this->error = "Unknown entry type " + std::to_string(static_cast<int>(type));
+			break;
+	}
+
+	return success;
+}
+
+std::string app::logger::trace::Decoder::formatDate(const std::int64_t & monotonicTime) const {
+	const std::int64_t systemTime = this->systemOrigin + (monotonicTime - this->monotonicOrigin);
+	const std::time_t seconds = static_cast<std::time_t>(systemTime / app::logger::trace::nanosecondsInSecond);
+	const std::int64_t milliseconds = (systemTime % app::logger::trace::nanosecondsInSecond) / app::logger::trace::nanosecondsInMillisecond;
+
+	std::tm localTime;
+	localtime_r(&seconds, &localTime);
+
+	char date[64];
+	const std::size_t dateSize = std::strftime(date, sizeof(date), "%Y/%m/%d %H:%M:%S", &localTime);
+	char fraction[8];
+	std::snprintf(fraction, sizeof(fraction), ".%03d", static_cast<int>(milliseconds));
+
+	return std::string(date, dateSize) + fraction + std::string(" ") + std::string((localTime.tm_zone != nullptr) ? localTime.tm_zone : "");
+}
+
+std::uint64_t app::logger::trace::Decoder::getDecodedRecords() const {
+	return this->decodedRecords;
+}
+
+const std::string & app::logger::trace::Decoder::getError() const {
+	return this->error;
+}
@@ -0,0 +1,209 @@
+/**
+ * @copyright
+ * @file startup_profiler.cpp
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Startup profiler functions
+ */
+
+#include <unistd.h>
+
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+// Qt libraries
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+#include "app/shared/exception.h"
+#include "app/utility/logger/macros.h"
+#include "app/utility/profiler/startup_profiler.h"
+
+// Categories
+LOGGING_CONTEXT(startupProfilerOverall, startupProfiler.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace app {
+
+	namespace utility {
+
+		namespace startup_profiler {
+
+			namespace {
+				/**
+				 * @brief time the static objects of the program were initialized
+				 *
+				 */
+				static const std::chrono::steady_clock::time_point origin(std::chrono::steady_clock::now());
+
+				/**
+				 * @brief width of the column of the table storing the name of the phases
+				 *
+				 */
+				static const int nameWidth = 32;
+
+				/**
+				 * @brief width of the columns of the table storing times
+				 *
+				 */
+				static const int timeWidth = 16;
+
+				/**
+				 * @brief Function: double toMilliseconds(const std::chrono::steady_clock::duration & duration)
+				 *
+				 * \param duration: duration to convert
+				 *
+				 * \return the duration in milliseconds
+				 *
+				 * This function converts a duration to milliseconds keeping the fractional part
+				 */
+				inline double toMilliseconds(const std::chrono::steady_clock::duration & duration) {
+					return std::chrono::duration<double, std::milli>(duration).count();
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+// The profiler is created before the logger is initialized therefore it does not log in its constructor
+app::utility::StartupProfiler::StartupProfiler() : phases() {
+
+}
+
+app::utility::StartupProfiler::~StartupProfiler() {
+
+}
+
+const std::chrono::steady_clock::time_point & app::utility::StartupProfiler::getOrigin() {
+	return app::utility::startup_profiler::origin;
+}
+
+void app::utility::StartupProfiler::startPhase(const std::string & name) {
+	std::vector<app::utility::startup_phase_s>::const_iterator phaseIt = std::find_if(this->phases.cbegin(), this->phases.cend(), [&] (const app::utility::startup_phase_s & phase) {
+		return (phase.name.compare(name) == 0);
+	});
+
+	if (phaseIt == this->phases.cend()) {
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		this->phases.push_back({name, now, now, false});
+	}
+}
+
+void app::utility::StartupProfiler::endPhase(const std::string & name) {
+	std::vector<app::utility::startup_phase_s>::iterator phaseIt = std::find_if(this->phases.begin(), this->phases.end(), [&] (const app::utility::startup_phase_s & phase) {
+		return (phase.name.compare(name) == 0);
+	});
+
+	if ((phaseIt != this->phases.end()) && (phaseIt->finished == false)) {
+		phaseIt->end = std::chrono::steady_clock::now();
+		phaseIt->finished = true;
+	}
+}
+
+const std::vector<app::utility::startup_phase_s> & app::utility::StartupProfiler::getPhases() const {
+	return this->phases;
+}
+
+std::string app::utility::StartupProfiler::printTable() const {
+	std::ostringstream table;
+	table << std::fixed << std::setprecision(3);
+	table << std::left << std::setw(app::utility::startup_profiler::nameWidth) << "Phase" << std::right << std::setw(app::utility::startup_profiler::timeWidth) << "Start (ms)" << std::setw(app::utility::startup_profiler::timeWidth) << "Duration (ms)" << "\n";
+
+	for (const app::utility::startup_phase_s & phase : this->phases) {
+		table << std::left << std::setw(app::utility::startup_profiler::nameWidth) << phase.name << std::right << std::setw(app::utility::startup_profiler::timeWidth) << app::utility::startup_profiler::toMilliseconds(phase.start - app::utility::StartupProfiler::getOrigin());
+		if (phase.finished == true) {
+			table << std::setw(app::utility::startup_profiler::timeWidth) << app::utility::startup_profiler::toMilliseconds(phase.end - phase.start);
+		} else {
+			table << std::setw(app::utility::startup_profiler::timeWidth) << "-";
+		}
+		table << "\n";
+	}
+
+	return table.str();
+}
+
+void app::utility::StartupProfiler::writeTrace(const std::string & filename) const {
+	const qint64 processId = static_cast<qint64>(::getpid());
+
+	// Times of complete events are in microseconds
+	QJsonArray events;
+	for (const app::utility::startup_phase_s & phase : this->phases) {
+		if (phase.finished == true) {
+			QJsonObject event;
+			event.insert("name", QString::fromStdString(phase.name));
+			event.insert("cat", "startup");
+			event.insert("ph", "X");
+			event.insert("ts", static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(phase.start - app::utility::StartupProfiler::getOrigin()).count()));
+			event.insert("dur", static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(phase.end - phase.start).count()));
+			event.insert("pid", processId);
+			event.insert("tid", 0);
+			events.append(event);
+		}
+	}
+
+	QJsonObject trace;
+	trace.insert("traceEvents", events);
+	trace.insert("displayTimeUnit", "ms");
+
+	QFile traceFile(QString::fromStdString(filename));
+	const bool opened = traceFile.open(QIODevice::WriteOnly | QIODevice::Truncate);
+	EXCEPTION_ACTION_COND((opened == false), throw, "Unable to open file " << filename << " to write the startup trace: " << traceFile.errorString().toStdString());
+	const QByteArray traceData(QJsonDocument(trace).toJson(QJsonDocument::Indented));
+	const qint64 writtenBytes = traceFile.write(traceData);
+	EXCEPTION_ACTION_COND((writtenBytes != static_cast<qint64>(traceData.size())), throw, "Unable to write the startup trace to file " << filename << ": " << traceFile.errorString().toStdString());
+	traceFile.close();
+
+	LOG_INFO(app::logger::info_level_e::ZERO, startupProfilerOverall, "Startup trace with " << events.size() << " phases written to file " << filename);
+}
+
+void app::utility::StartupProfiler::report(const std::string & traceFilename) const {
+	const std::string stdoutFilename("stdout");
+	LOG_INFO_TO_FILE(app::logger::info_level_e::ZERO, startupProfilerOverall, stdoutFilename, "Startup phases:\n" << this->printTable());
+
+	if (traceFilename.empty() == false) {
+		this->writeTrace(traceFilename);
+	}
+}
+
+app::utility::FirstPaintWatcher::FirstPaintWatcher(QWidget * watchedWindow, const std::function<void()> & paintCallback) : QObject(), window(watchedWindow), callback(paintCallback), painted(false) {
+	LOG_INFO(app::logger::info_level_e::ZERO, startupProfilerOverall, "First paint watcher constructor");
+
+	EXCEPTION_ACTION_COND((QCoreApplication::instance() == nullptr), throw, "Unable to watch the first paint of a window before the application is created");
+	// Paint events are delivered to the widgets of the window rather than to the window itself
+	QCoreApplication::instance()->installEventFilter(this);
+}
+
+app::utility::FirstPaintWatcher::~FirstPaintWatcher() {
+	LOG_INFO(app::logger::info_level_e::ZERO, startupProfilerOverall, "First paint watcher destructor");
+
+	if ((this->painted == false) && (QCoreApplication::instance() != nullptr)) {
+		QCoreApplication::instance()->removeEventFilter(this);
+	}
+}
+
+bool app::utility::FirstPaintWatcher::eventFilter(QObject * watched, QEvent * event) {
+	if ((this->painted == false) && (event->type() == QEvent::Paint)) {
+		const QWidget * widget = qobject_cast<QWidget *>(watched);
+		if ((widget != nullptr) && (widget->window() == this->window)) {
+			this->painted = true;
+			QCoreApplication::instance()->removeEventFilter(this);
+			// Widgets of the window are painted one after the other therefore the callback is run once all of them have been painted
+			QTimer::singleShot(0, this, [this] () {
+				if (this->callback) {
+					this->callback();
+				}
+			});
+		}
+	}
+
+	return QObject::eventFilter(watched, event);
+}
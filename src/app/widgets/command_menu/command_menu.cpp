@@ -6,24 +6,28 @@
  * @brief Command menu functions
  */
 
+#include <algorithm>
+#include <iterator>
+
 // Qt libraries
 #include <QtGui/QPainter>
 #include <QtWidgets/QScrollBar>
 
 #include "app/shared/enums.h"
+#include "app/shared/setters_getters.h"
 #include "app/utility/cpp/cpp_operator.h"
 #include "app/utility/logger/macros.h"
 #include "app/widgets/command_menu/command_menu.h"
 #include "app/widgets/command_menu/command_menu_model.h"
 
 // Categories
-LOGGING_CONTEXT(commandMenuOverall, commandMenu.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(commandMenuSettings, commandMenu.settings, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(commandMenuHashTable, commandMenu.hashTable, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(commandMenuViewport, commandMenu.viewport, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(commandMenuCursor, commandMenu.cursor, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(commandMenuScrollBar, commandMenu.scrollBar, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(commandMenuSelection, commandMenu.selection, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuOverall, commandMenu.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuSettings, commandMenu.settings, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuRowGeometry, commandMenu.rowGeometry, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuViewport, commandMenu.viewport, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuCursor, commandMenu.cursor, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuScrollBar, commandMenu.scrollBar, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuSelection, commandMenu.selection, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -127,29 +131,66 @@ void app::command_menu::CommandMenu::setProperties() {
 	this->setSelectionBehavior(app::command_menu::selection);
 }
 
-void app::command_menu::CommandMenu::setModel(app::command_menu::CommandMenuModel * model) {
+BASE_GETTER(app::command_menu::CommandMenu::getMenuModel, app::command_menu::CommandMenuModel *, this->menuModel)
+
+void app::command_menu::CommandMenu::setModel(QAbstractItemModel * model) {
+	// Changes to the previous model must no longer update the geometry of the rows
+	QAbstractItemModel * previousModel = this->model();
+	if ((previousModel != Q_NULLPTR) && (previousModel != model)) {
+		disconnect(previousModel, &QAbstractItemModel::modelReset, this, &app::command_menu::CommandMenu::updateRowGeometry);
+		disconnect(previousModel, &QAbstractItemModel::layoutChanged, this, &app::command_menu::CommandMenu::updateRowGeometry);
+		disconnect(previousModel, &QAbstractItemModel::rowsInserted, this, &app::command_menu::CommandMenu::updateRowGeometry);
+		disconnect(previousModel, &QAbstractItemModel::rowsRemoved, this, &app::command_menu::CommandMenu::updateRowGeometry);
+		disconnect(previousModel, &QAbstractItemModel::dataChanged, this, &app::command_menu::CommandMenu::updateRowGeometry);
+	}
+
 	// Call setModel from the base class
 	QAbstractItemView::setModel(model);
-}
 
-// Update hash table with elements from the model
-void app::command_menu::CommandMenu::updateHashTable() const {
+	// Row geometry is computed only when rows change rather than every time a row is looked up
+	if (model != Q_NULLPTR) {
+		connect(model, &QAbstractItemModel::modelReset, this, &app::command_menu::CommandMenu::updateRowGeometry, Qt::UniqueConnection);
+		connect(model, &QAbstractItemModel::layoutChanged, this, &app::command_menu::CommandMenu::updateRowGeometry, Qt::UniqueConnection);
+		connect(model, &QAbstractItemModel::rowsInserted, this, &app::command_menu::CommandMenu::updateRowGeometry, Qt::UniqueConnection);
+		connect(model, &QAbstractItemModel::rowsRemoved, this, &app::command_menu::CommandMenu::updateRowGeometry, Qt::UniqueConnection);
+		connect(model, &QAbstractItemModel::dataChanged, this, &app::command_menu::CommandMenu::updateRowGeometry, Qt::UniqueConnection);
+	}
 
-	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuHashTable, "Update Hash Table");
+	this->updateRowGeometry();
+}
+
+// Update offsets of the rows of the model
+void app::command_menu::CommandMenu::updateRowGeometry() {
 
 	const QFontMetrics fontProperties(this->font());
 
 	const int rowHeight = fontProperties.height() + app::command_menu::extraRowHeight;
-//	const int maxWidgetWidth = this->viewport()->width();
 
-	int xItem = 0;
-	int yItem = 0;
+	const int numberItemsInModel = (this->model() == Q_NULLPTR) ? 0 : this->model()->rowCount(this->rootIndex());
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuRowGeometry, "Update geometry of " << numberItemsInModel << " rows");
+
+	const std::size_t numberOfRows = static_cast<std::size_t>(numberItemsInModel);
+	this->rowOffsets.resize(numberOfRows + 1);
+	this->rowOffsets[0] = 0;
+	for (std::size_t row = 0; row < numberOfRows; row++) {
+		this->rowOffsets[row + 1] = this->rowOffsets[row] + rowHeight;
+	}
+
+	// Text is measured only when a row is displayed
+	this->rowWidths.assign(numberOfRows, -1);
 
-	int numberItemsInModel = this->model()->rowCount(this->rootIndex());
+	this->visibleHeight = this->rowOffsets[std::min(numberOfRows, static_cast<std::size_t>(app::command_menu::maxVisibleItems))];
 
-	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuHashTable, "Number of items in model " << numberItemsInModel);
+	this->updateScrollbars();
+	this->viewport()->update();
+}
 
-	for (int row = 0; row < numberItemsInModel; row++) {
+int app::command_menu::CommandMenu::getRowWidth(const int & row) const {
+	int & rowWidth = this->rowWidths[static_cast<std::size_t>(row)];
+
+	if (rowWidth < 0) {
+		const QFontMetrics fontProperties(this->font());
 		const QModelIndex rowIndex(this->model()->index(row, 0, this->rootIndex()));
 		const QString text = this->model()->data(rowIndex).toString();
 		#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
@@ -158,42 +199,35 @@ void app::command_menu::CommandMenu::updateHashTable() const {
 		const int textWidth = fontProperties.width(text);
 		#endif
 
-		const int rowWidth = textWidth + app::command_menu::extraRowWidth;
-
-		// Add element to hash table
-		const QRect item = QRect(xItem, yItem, rowWidth, rowHeight);
-		itemRect[row] = item;
-
-		LOG_INFO(app::logger::info_level_e::ZERO, commandMenuHashTable, "Adding item " << item << " to the hash table at row " << row);
-
-		yItem += rowHeight;
+		rowWidth = textWidth + app::command_menu::extraRowWidth;
 	}
 
-	if (numberItemsInModel < app::command_menu::maxVisibleItems) {
-		this->visibleHeight = yItem;
-	} else {
-		this->visibleHeight = app::command_menu::maxVisibleItems * rowHeight;
+	return rowWidth;
+}
+
+int app::command_menu::CommandMenu::rowAt(const int & y) const {
+	if ((this->rowOffsets.size() < 2) || (y < this->rowOffsets.front()) || (y >= this->rowOffsets.back())) {
+		return -1;
 	}
 
-	this->viewport()->update();
+	// The row spanning across y is the last one starting at or above it
+	const std::vector<int>::const_iterator rowEnd = std::upper_bound(this->rowOffsets.cbegin(), this->rowOffsets.cend(), y);
+	return static_cast<int>(std::distance(this->rowOffsets.cbegin(), rowEnd)) - 1;
 }
 
 // Compute rectangle used by an item
 QRect app::command_menu::CommandMenu::viewportRectangle(const int row) const {
 
-	this->updateHashTable();
-
 	QRect viewportRect = QRect();
-	const QRect currentRect(this->itemRect.value(row));
-	if (currentRect.isEmpty()) {
-		LOG_INFO(app::logger::info_level_e::ZERO, commandMenuViewport, "Current rectangle is empty");
-		viewportRect = currentRect;
+	if ((row < 0) || (static_cast<std::size_t>(row) >= this->rowWidths.size())) {
+		LOG_INFO(app::logger::info_level_e::ZERO, commandMenuViewport, "Row " << row << " is not in the model");
 	} else {
+		const std::size_t rowIdx = static_cast<std::size_t>(row);
 		// compute viewport coordinates (i.e. account for scrolling)
-		int x = currentRect.x() - this->horizontalScrollBar()->value();
-		int y = currentRect.y() - this->verticalScrollBar()->value();
-		int width = currentRect.width();
-		int height = currentRect.height();
+		int x = 0 - this->horizontalScrollBar()->value();
+		int y = this->rowOffsets[rowIdx] - this->verticalScrollBar()->value();
+		int width = this->getRowWidth(row);
+		int height = this->rowOffsets[rowIdx + 1] - this->rowOffsets[rowIdx];
 		viewportRect = QRect(x, y, width, height);
 		LOG_INFO(app::logger::info_level_e::ZERO, commandMenuViewport, "Viewport coordinates: x " << x << " y " << y);
 		LOG_INFO(app::logger::info_level_e::ZERO, commandMenuViewport, "Viewport dimension: width " << width << " height " << height);
@@ -268,13 +302,11 @@ QModelIndex app::command_menu::CommandMenu::indexAt(const QPoint &point) const {
 	pointCopy.rx() += this->horizontalScrollBar()->value();
 	pointCopy.ry() += this->verticalScrollBar()->value();
 
-	this->updateHashTable();
+	const int row = this->rowAt(pointCopy.y());
 
-	for (QHash<int, QRect>::const_iterator rectIter = this->itemRect.cbegin(); rectIter != this->itemRect.cend(); rectIter++) {
-		// If item contains the requested point, return it
-		if (rectIter.value().contains(pointCopy)) {
-			return this->model()->index(rectIter.key(), 0, this->rootIndex());
-		}
+	// If item contains the requested point, return it
+	if ((row >= 0) && (pointCopy.x() >= 0) && (pointCopy.x() < this->getRowWidth(row))) {
+		return this->model()->index(row, 0, this->rootIndex());
 	}
 
 	return QModelIndex();
@@ -287,45 +319,16 @@ QModelIndex app::command_menu::CommandMenu::moveCursor(const QAbstractItemView::
 	QModelIndex currIndex = this->currentIndex();
 
 	if (currIndex.isValid()) {
+		// Rows are stacked one below the other therefore the previous/next item on the list is also the item above/below the current one
 		if (((cursorAction == QAbstractItemView::MoveLeft) && (currIndex.row() > 0)) ||
-		    ((cursorAction == QAbstractItemView::MoveRight) && (currIndex.row() < (this->model()->rowCount() - 1)))) {
-			const app::shared::sign_e sign = ((cursorAction == QAbstractItemView::MoveLeft) ? app::shared::sign_e::PLUS : app::shared::sign_e::MINUS);
-			// Get previous/next item on the list
+		    ((cursorAction == QAbstractItemView::MoveRight) && (currIndex.row() < (this->model()->rowCount() - 1))) ||
+		    ((cursorAction == QAbstractItemView::MoveUp) && (currIndex.row() > 0)) ||
+		    ((cursorAction == QAbstractItemView::MoveDown) && (currIndex.row() < (this->model()->rowCount() - 1)))) {
+			const app::shared::sign_e sign = (((cursorAction == QAbstractItemView::MoveLeft) || (cursorAction == QAbstractItemView::MoveUp)) ? app::shared::sign_e::MINUS : app::shared::sign_e::PLUS);
 			const int rowIdx = currIndex.row() + static_cast<int>(sign);
 			const int colIdx = currIndex.column();
 			QModelIndex parentIdx = currIndex.parent();
 			currIndex = this->model()->index(rowIdx, colIdx, parentIdx);
-		} else if (((cursorAction == QAbstractItemView::MoveUp)    && (currIndex.row() > 0)) ||
-		           ((cursorAction == QAbstractItemView::MoveDown) && (currIndex.row() < (this->model()->rowCount() - 1)))) {
-
-			// Get the index of the item above/below the current item
-			QFontMetrics fontProperties(this->font());
-			const app::shared::sign_e sign = ((cursorAction == QAbstractItemView::MoveUp) ? app::shared::sign_e::PLUS : app::shared::sign_e::MINUS);
-			const int rowHeight = static_cast<int>(sign) * (fontProperties.height() + app::command_menu::extraRowHeight);
-
-			// Get current rectangle
-			QRect currentRect(this->viewportRectangle(currIndex.row()));
-
-			// Compute point that is one row above or below the center of the current rectangle
-			QPoint point(currentRect.center().x(), (currentRect.center().y() + rowHeight));
-
-			// Move left until the point is beyond the left edge
-			while (point.x() >= 0) {
-				currIndex = this->indexAt(point);
-				// Break if found model item is valid
-				if (currIndex.isValid()) {
-					break;
-				}
-
-				// Move point left by the width of one charcter
-
-				#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
-				point.rx() -= fontProperties.horizontalAdvance("n");
-				#else
-				point.rx() -= fontProperties.width("n");
-				#endif
-			}
-
 		}
 
 	}
@@ -359,8 +362,6 @@ bool app::command_menu::CommandMenu::isIndexHidden(const QModelIndex & index) co
 }
 
 void app::command_menu::CommandMenu::setSelection(const QRect & rect, QItemSelectionModel::SelectionFlags command) {
-	this->updateHashTable();
-
 	// Transalte rectangle into the visible region
 	QRect visibleRectangle(rect.translated(this->horizontalScrollBar()->value(), this->verticalScrollBar()->value()));
 	// Make width and height positive
@@ -374,15 +375,18 @@ void app::command_menu::CommandMenu::setSelection(const QRect & rect, QItemSelec
 	int topRowSel = topRowSelInitValue;
 	int bottomRowSel = bottomRowSelInitValue;
 
-	for (QHash<int, QRect>::const_iterator rectIter = this->itemRect.cbegin(); rectIter != this->itemRect.cend(); rectIter++) {
-		if (rectIter.value().intersects(visibleRectangle)) {
-			int keyIter = rectIter.key();
-			if (topRowSel >= keyIter) {
-				topRowSel = keyIter;
-			}
-
-			if (bottomRowSel <= keyIter) {
-				bottomRowSel = keyIter;
+	// Only rows spanning across the vertical extent of the rectangle may intersect it
+	const int numberOfRows = static_cast<int>(this->rowWidths.size());
+	if ((numberOfRows > 0) && (visibleRectangle.bottom() >= 0) && (visibleRectangle.top() < this->rowOffsets.back())) {
+		const int firstRow = std::max(this->rowAt(visibleRectangle.top()), 0);
+		const int lastRow = (visibleRectangle.bottom() >= this->rowOffsets.back()) ? (numberOfRows - 1) : this->rowAt(visibleRectangle.bottom());
+
+		for (int row = firstRow; row <= lastRow; row++) {
+			const std::size_t rowIdx = static_cast<std::size_t>(row);
+			const QRect rowRect(0, this->rowOffsets[rowIdx], this->getRowWidth(row), (this->rowOffsets[rowIdx + 1] - this->rowOffsets[rowIdx]));
+			if (rowRect.intersects(visibleRectangle)) {
+				topRowSel = std::min(topRowSel, row);
+				bottomRowSel = std::max(bottomRowSel, row);
 			}
 		}
 	}
@@ -428,13 +432,21 @@ void app::command_menu::CommandMenu::paintEvent(QPaintEvent * event) {
 	event->accept();
 	QPainter rectPainter(this->viewport());
 
-	int numberModelChildren = this->model()->rowCount();
+	const int numberModelChildren = static_cast<int>(this->rowWidths.size());
+	if (numberModelChildren == 0) {
+		return;
+	}
 
-	for (int row = 0; row < numberModelChildren; row++) {
+	// Only rows inside the viewport are painted
+	const int viewportTop = this->verticalScrollBar()->value();
+	const int viewportBottom = viewportTop + this->viewport()->height();
+	const int firstRow = std::max(this->rowAt(viewportTop), 0);
+	const int lastRow = (viewportBottom >= this->rowOffsets.back()) ? (numberModelChildren - 1) : this->rowAt(viewportBottom);
+
+	for (int row = firstRow; row <= lastRow; row++) {
 		QRect rowRect(this->viewportRectangle(row));
 
-		// if rectangle is inside the viewport
-		if ((rowRect.isValid()) && (rowRect.bottom() >= 0) && (rowRect.y() <= this->viewport()->height())) {
+		if (rowRect.isValid()) {
 			QStyleOptionViewItem optionRect(this->viewOptions());
 			optionRect.rect = rowRect;
 			QModelIndex rowIndex(this->model()->index(row, 0, this->rootIndex()));
@@ -463,12 +475,19 @@ void app::command_menu::CommandMenu::paintRectOutline(QPainter * painter, const
 void app::command_menu::CommandMenu::resizeEvent(QResizeEvent * event) {
 	event->accept();
 
-	this->updateHashTable();
-
 	// Calculate scrollbar range
 	this->updateScrollbars();
 }
 
+void app::command_menu::CommandMenu::changeEvent(QEvent * event) {
+	QAbstractItemView::changeEvent(event);
+
+	// Rows must be measured again with the new font
+	if (event->type() == QEvent::FontChange) {
+		this->updateRowGeometry();
+	}
+}
+
 void app::command_menu::CommandMenu::updateScrollbars() {
 
 	QFontMetrics fontProperties(this->font());
@@ -484,9 +503,10 @@ void app::command_menu::CommandMenu::updateScrollbars() {
 
 	const int rowHeight = fontProperties.height() + app::command_menu::extraRowHeight;
 	const int viewportHeight = this->viewport()->height();
-	this->horizontalScrollBar()->setSingleStep(rowHeight);
-	this->horizontalScrollBar()->setPageStep(viewportHeight);
-	this->horizontalScrollBar()->setRange(0, qMax(0, (this->visibleHeight - viewportHeight)));
+	const int contentHeight = (this->rowOffsets.empty() == true) ? 0 : this->rowOffsets.back();
+	this->verticalScrollBar()->setSingleStep(rowHeight);
+	this->verticalScrollBar()->setPageStep(viewportHeight);
+	this->verticalScrollBar()->setRange(0, qMax(0, (contentHeight - viewportHeight)));
 }
 
 void app::command_menu::CommandMenu::mousePressEvent(QMouseEvent * event) {
@@ -6,14 +6,59 @@
  * @brief Command menu model functions
  */
 
+#include <algorithm>
+#include <utility>
+
 #include "app/utility/logger/macros.h"
+#include "app/windows/main_window/json/action.h"
+#include "app/windows/main_window/json/data.h"
 #include "app/widgets/command_menu/command_menu_model.h"
 
 // Categories
-LOGGING_CONTEXT(commandMenuModelOverall, commandMenuModel.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(commandMenuModelSettings, commandMenuModel.settings, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuModelOverall, commandMenuModel.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuModelSettings, commandMenuModel.settings, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuModelFilter, commandMenuModel.filter, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace app {
+
+	namespace command_menu {
+
+		namespace command_menu_model {
+
+			namespace {
+				/**
+				 * @brief score of every character of the filter found in the command
+				 *
+				 */
+				static constexpr int matchScore = 1;
+
+				/**
+				 * @brief additional score of a character found right after the previous one
+				 *
+				 */
+				static constexpr int consecutiveScore = 5;
+
+				/**
+				 * @brief additional score of a character found at the beginning of a word
+				 *
+				 */
+				static constexpr int wordStartScore = 3;
+
+				/**
+				 * @brief characters separating words in a command
+				 *
+				 */
+				static const std::string wordSeparators("-_ .");
 
-app::command_menu::CommandMenuModel::CommandMenuModel(QObject * parent) : QAbstractItemModel(parent) {
+			}
+
+		}
+
+	}
+
+}
+
+app::command_menu::CommandMenuModel::CommandMenuModel(QObject * parent) : QAbstractItemModel(parent), commands(), filterSteps(1), filter(QString()), scoredCommandCount(0) {
 
 	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuModelOverall, "Create command menu model");
 }
@@ -23,30 +68,200 @@ app::command_menu::CommandMenuModel::~CommandMenuModel() {
 
 }
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-parameter"
+void app::command_menu::CommandMenuModel::setActions(const app::main_window::json::Action & actions) {
+	this->beginResetModel();
+
+	this->commands.clear();
+	for (const auto & data : actions.getActions()) {
+		const std::string & longCmd = data.second->getLongCmd();
+		// Commands without a long command cannot be typed in the command menu
+		if (longCmd.empty() == false) {
+			app::command_menu::CommandMenuModel::command_entry_s entry;
+			entry.name = QString::fromStdString(longCmd);
+			entry.help = QString::fromStdString(data.second->getHelp());
+			entry.lowercaseName = entry.name.toLower().toStdString();
+			entry.characters = app::command_menu::CommandMenuModel::getCharacterMask(entry.lowercaseName);
+			this->commands.push_back(std::move(entry));
+		}
+	}
+
+	std::sort(this->commands.begin(), this->commands.end(), [] (const app::command_menu::CommandMenuModel::command_entry_s & lhs, const app::command_menu::CommandMenuModel::command_entry_s & rhs) {
+		return (lhs.name < rhs.name);
+	});
+	// Multiple commands may share the same long command
+	this->commands.erase(std::unique(this->commands.begin(), this->commands.end(), [] (const app::command_menu::CommandMenuModel::command_entry_s & lhs, const app::command_menu::CommandMenuModel::command_entry_s & rhs) {
+		return (lhs.name.compare(rhs.name) == 0);
+	}), this->commands.end());
+
+	// An empty filter matches all commands
+	this->filterSteps.clear();
+	app::command_menu::CommandMenuModel::filter_step_s allCommands;
+	allCommands.rows.reserve(this->commands.size());
+	for (std::size_t row = 0; row < this->commands.size(); row++) {
+		allCommands.rows.push_back(static_cast<int>(row));
+	}
+	this->filterSteps.push_back(std::move(allCommands));
+
+	this->filter.clear();
+	this->scoredCommandCount = 0;
+
+	this->endResetModel();
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuModelSettings, "Command menu lists " << this->commands.size() << " commands");
+}
+
+void app::command_menu::CommandMenuModel::setFilter(const QString & value) {
+	const std::string lowercaseFilter(value.toLower().toStdString());
+
+	if (lowercaseFilter.compare(this->filterSteps.back().filter) == 0) {
+		this->filter = value;
+		return;
+	}
+
+	this->beginResetModel();
+
+	// Discard results of filters that are not a prefix of the new filter. The first step matches the empty filter hence it is never discarded
+	while ((this->filterSteps.size() > 1) && (lowercaseFilter.compare(0, this->filterSteps.back().filter.size(), this->filterSteps.back().filter) != 0)) {
+		this->filterSteps.pop_back();
+	}
+
+	if (lowercaseFilter.compare(this->filterSteps.back().filter) != 0) {
+		// A command that matches the new filter also matches any of its prefixes, therefore only commands matching the longest prefix must be scored
+		const std::uint64_t filterCharacters = app::command_menu::CommandMenuModel::getCharacterMask(lowercaseFilter);
+		std::vector<std::pair<int, int>> matches;
+		for (const int & row : this->filterSteps.back().rows) {
+			const app::command_menu::CommandMenuModel::command_entry_s & entry = this->commands[static_cast<std::size_t>(row)];
+			if ((entry.characters & filterCharacters) == filterCharacters) {
+				this->scoredCommandCount++;
+				const int commandScore = app::command_menu::CommandMenuModel::scoreLowercase(entry.lowercaseName, lowercaseFilter);
+				if (commandScore >= 0) {
+					matches.emplace_back(commandScore, row);
+				}
+			}
+		}
+
+		std::sort(matches.begin(), matches.end(), [this] (const std::pair<int, int> & lhs, const std::pair<int, int> & rhs) {
+			if (lhs.first != rhs.first) {
+				return (lhs.first > rhs.first);
+			}
+			const QString & lhsName = this->commands[static_cast<std::size_t>(lhs.second)].name;
+			const QString & rhsName = this->commands[static_cast<std::size_t>(rhs.second)].name;
+			if (lhsName.size() != rhsName.size()) {
+				return (lhsName.size() < rhsName.size());
+			}
+			return (lhs.second < rhs.second);
+		});
+
+		app::command_menu::CommandMenuModel::filter_step_s step;
+		step.filter = lowercaseFilter;
+		step.rows.reserve(matches.size());
+		for (const std::pair<int, int> & match : matches) {
+			step.rows.push_back(match.second);
+		}
+		this->filterSteps.push_back(std::move(step));
+	}
+
+	this->filter = value;
+
+	this->endResetModel();
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuModelFilter, "Filter " << this->filter << " matches " << this->getRows().size() << " commands");
+}
+
+const QString & app::command_menu::CommandMenuModel::getFilter() const {
+	return this->filter;
+}
+
+std::size_t app::command_menu::CommandMenuModel::getScoredCommandCount() const {
+	return this->scoredCommandCount;
+}
+
+const std::vector<int> & app::command_menu::CommandMenuModel::getRows() const {
+	return this->filterSteps.back().rows;
+}
+
+std::uint64_t app::command_menu::CommandMenuModel::getCharacterMask(const std::string & text) {
+	std::uint64_t mask = 0;
+	// Characters sharing the same bit can only let through commands that are rejected when they are scored
+	for (const char & character : text) {
+		mask |= (static_cast<std::uint64_t>(1) << (static_cast<unsigned char>(character) % 64));
+	}
+	return mask;
+}
+
+int app::command_menu::CommandMenuModel::score(const QString & command, const QString & filter) {
+	return app::command_menu::CommandMenuModel::scoreLowercase(command.toLower().toStdString(), filter.toLower().toStdString());
+}
+
+int app::command_menu::CommandMenuModel::scoreLowercase(const std::string & command, const std::string & filter) {
+	int commandScore = 0;
+	std::size_t position = 0;
+	std::size_t previousMatch = std::string::npos;
+
+	for (const char & character : filter) {
+		const std::size_t match = command.find(character, position);
+		if (match == std::string::npos) {
+			return -1;
+		}
+
+		commandScore += app::command_menu::command_menu_model::matchScore;
+		if ((previousMatch != std::string::npos) && (match == (previousMatch + 1))) {
+			commandScore += app::command_menu::command_menu_model::consecutiveScore;
+		}
+		if ((match == 0) || (app::command_menu::command_menu_model::wordSeparators.find(command[match - 1]) != std::string::npos)) {
+			commandScore += app::command_menu::command_menu_model::wordStartScore;
+		}
+
+		previousMatch = match;
+		position = match + 1;
+	}
+
+	return commandScore;
+}
+
 QModelIndex app::command_menu::CommandMenuModel::index(int row, int column, const QModelIndex & parent) const {
+	if ((parent.isValid() == true) || (row < 0) || (row >= this->rowCount()) || (column < 0) || (column >= this->columnCount())) {
+		return QModelIndex();
+	}
 
-	return QModelIndex();
+	return this->createIndex(row, column);
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
 QModelIndex app::command_menu::CommandMenuModel::parent(const QModelIndex & child) const {
-
+	// Commands are listed in a flat list
 	return QModelIndex();
 }
+#pragma GCC diagnostic pop
 
 int app::command_menu::CommandMenuModel::rowCount(const QModelIndex & parent) const {
+	if (parent.isValid() == true) {
+		return 0;
+	}
 
-	return 0;
+	return static_cast<int>(this->getRows().size());
 }
 
 int app::command_menu::CommandMenuModel::columnCount(const QModelIndex & parent) const {
+	if (parent.isValid() == true) {
+		return 0;
+	}
 
-	return 0;
+	return 1;
 }
 
 QVariant app::command_menu::CommandMenuModel::data(const QModelIndex & index, int role) const {
+	if ((index.isValid() == false) || (index.row() < 0) || (index.row() >= this->rowCount())) {
+		return QVariant();
+	}
+
+	const app::command_menu::CommandMenuModel::command_entry_s & entry = this->commands[static_cast<std::size_t>(this->getRows()[static_cast<std::size_t>(index.row())])];
+	if (role == Qt::DisplayRole) {
+		return entry.name;
+	} else if (role == Qt::ToolTipRole) {
+		return entry.help;
+	}
 
 	return QVariant();
 }
-#pragma GCC diagnostic pop
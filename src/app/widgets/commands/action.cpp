@@ -16,8 +16,8 @@
 #include "app/widgets/commands/key_sequence.h"
 
 // Categories
-LOGGING_CONTEXT(actionOverall, action.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(actionShortcut, action.shortcut, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(actionOverall, action.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(actionShortcut, action.shortcut, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::commands::Action::Action(QObject * parent, const QString & text, const QIcon & icon) : QAction(icon, text, parent), app::printable_object::PrintableObject() {
 
@@ -12,8 +12,8 @@
 #include "app/widgets/commands/key_info.h"
 
 // Categories
-LOGGING_CONTEXT(keyInfoOverall, keyInfo.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(keyInfoString, keyInfo.string, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(keyInfoOverall, keyInfo.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(keyInfoString, keyInfo.string, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 /** @addtogroup KeyInfoGroup Key Info Doxygen Group
  *  @{
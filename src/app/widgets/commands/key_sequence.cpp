@@ -15,8 +15,8 @@
 #include "app/widgets/commands/key_sequence.h"
 
 // Categories
-LOGGING_CONTEXT(keySequenceOverall, keySequence.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(keySequenceString, keySequence.string, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(keySequenceOverall, keySequence.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(keySequenceString, keySequence.string, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -155,13 +155,13 @@ unsigned int app::commands::KeySequence::count() const {
 
 int app::commands::KeySequence::getIntKey(const unsigned int & index) const {
 
-	this->checkRules();
+	// Rules are checked when the sequence is constructed and the vector cannot be modified afterwards
 
 	// Default key to 0
 	int key = 0;
 
 	if (index < this->count()) {
-		const QKeySequence qKeyVec(this->keySeqVec.at(index));
+		const QKeySequence & qKeyVec(this->keySeqVec.at(static_cast<int>(index)));
 
 		// Return index 0 as it is expected that the sequence has only 1 element
 		key = qKeyVec[0];
@@ -253,7 +253,7 @@ QKeySequence::SequenceMatch app::commands::KeySequence::matches(const app::comma
 		return QKeySequence::NoMatch;
 	}
 
-	const QVector<QKeySequence> otherKeySeq(otherSeq.getSeqVec());
+	const QVector<QKeySequence> & otherKeySeq(otherSeq.getSeqVec());
 
 	for (QVector<QKeySequence>::const_iterator cIter = this->keySeqVec.cbegin(), cOtherIter = otherKeySeq.cbegin(); cIter != this->keySeqVec.cend(); cIter++, cOtherIter++) {
 		// if elements are different. then return NoMatch
@@ -274,7 +274,7 @@ QKeySequence::SequenceMatch app::commands::KeySequence::matches(const app::comma
 
 // Operator overloading
 bool app::commands::KeySequence::operator< (const app::commands::KeySequence & otherSeq) const {
-	QVector<QKeySequence> otherKeySeq(otherSeq.getSeqVec());
+	const QVector<QKeySequence> & otherKeySeq(otherSeq.getSeqVec());
 	bool cmp = std::lexicographical_compare(this->keySeqVec.cbegin(), this->keySeqVec.cend(), otherKeySeq.cbegin(), otherKeySeq.cend());
 	return cmp;
 }
@@ -297,12 +297,11 @@ bool app::commands::KeySequence::operator== (const app::commands::KeySequence &
 		return false;
 	}
 
-	QVector<QKeySequence> otherKeySeq(otherSeq.getSeqVec());
+	const QVector<QKeySequence> & otherKeySeq(otherSeq.getSeqVec());
 
 	bool equal = true;
 
-	//for (QVector<QKeySequence>::const_iterator cIter = this->keySeqVec.cbegin(), QVector<QKeySequence>::const_iterator cOtherIter = otherKeySeq.cbegin(); cIter != this->keySeqVec.cend(); cIter++, cOtherIter++) {
-	for (QVector<QKeySequence>::const_iterator cIter = this->keySeqVec.cbegin(), cOtherIter = otherKeySeq.cbegin(); cIter != this->keySeqVec.cend(); cIter++, cOtherIter++) {
+	for (QVector<QKeySequence>::const_iterator cIter = this->keySeqVec.cbegin(), cOtherIter = otherKeySeq.cbegin(); ((cIter != this->keySeqVec.cend()) && (equal == true)); cIter++, cOtherIter++) {
 		// if elements are different. then set equal to false
 		if (*cIter != *cOtherIter) {
 			equal = false;
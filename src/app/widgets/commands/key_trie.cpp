@@ -0,0 +1,180 @@
+/**
+ * @copyright
+ * @file key_trie.cpp
+ * @author Andrea Gianarda
+ * @date 07th September 2020
+ * @brief Key Trie functions
+ */
+
+#include "app/utility/cpp/cpp_operator.h"
+#include "app/shared/exception.h"
+#include "app/shared/setters_getters.h"
+#include "app/utility/logger/macros.h"
+#include "app/widgets/commands/key_trie.h"
+
+// Categories
+LOGGING_CONTEXT(keyTrieOverall, keyTrie.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace app {
+
+	namespace commands {
+
+		namespace key_trie {
+
+			namespace {
+				/**
+				 * @brief Index of the root node
+				 *
+				 */
+				static constexpr std::size_t root = 0;
+
+				/**
+				 * @brief Value of nodes not bound to any value
+				 *
+				 */
+				static constexpr int noValue = -1;
+			}
+
+		}
+
+	}
+
+}
+
+app::commands::KeyTrie::KeyTrie(const std::chrono::milliseconds & timeout) : nodes({app::commands::key_trie::noValue}), transitions(), currentNode(app::commands::key_trie::root), matchedValue(app::commands::key_trie::noValue), lastKeyTime(), timeout(timeout), bindingCount(0) {
+	LOG_INFO(app::logger::info_level_e::ZERO, keyTrieOverall, "Key trie constructor with timeout " << timeout.count() << "ms");
+}
+
+app::commands::KeyTrie::~KeyTrie() {
+	LOG_INFO(app::logger::info_level_e::ZERO, keyTrieOverall, "Key trie destructor");
+}
+
+std::uint64_t app::commands::KeyTrie::getTransitionKey(const std::size_t & node, const int & key) {
+	return ((static_cast<std::uint64_t>(node) << 32) | static_cast<std::uint64_t>(static_cast<std::uint32_t>(key)));
+}
+
+void app::commands::KeyTrie::addBinding(const app::commands::KeySequence & sequence, const int & value) {
+	EXCEPTION_ACTION_COND((sequence.count() == 0), throw, "Unable to bind an empty key sequence to value " << value);
+	EXCEPTION_ACTION_COND((value < 0), throw, "Unable to bind key sequence " << sequence.toString() << " to negative value " << value);
+	EXCEPTION_ACTION_COND((this->hasConflict(sequence) == true), throw, "Unable to bind key sequence " << sequence.toString() << " to value " << value << " because it is already bound, it begins with a binding or a binding begins with it");
+
+	std::size_t node = app::commands::key_trie::root;
+	for (const QKeySequence & keySeq : sequence.getSeqVec()) {
+		const std::uint64_t transitionKey = app::commands::KeyTrie::getTransitionKey(node, keySeq[0]);
+		std::unordered_map<std::uint64_t, std::size_t>::const_iterator transition = this->transitions.find(transitionKey);
+		if (transition == this->transitions.cend()) {
+			const std::size_t child = this->nodes.size();
+			this->nodes.push_back(app::commands::key_trie::noValue);
+			this->transitions.emplace(transitionKey, child);
+			node = child;
+		} else {
+			node = transition->second;
+		}
+	}
+
+	this->nodes[node] = value;
+	this->bindingCount++;
+
+	LOG_INFO(app::logger::info_level_e::ZERO, keyTrieOverall, "Bound key sequence " << sequence.toString() << " to value " << value);
+}
+
+bool app::commands::KeyTrie::hasConflict(const app::commands::KeySequence & sequence) const {
+	// A sequence ending on an existing node conflicts with the binding of the node or with the bindings beginning with it
+	bool conflict = true;
+	std::size_t node = app::commands::key_trie::root;
+	for (const QKeySequence & keySeq : sequence.getSeqVec()) {
+		std::unordered_map<std::uint64_t, std::size_t>::const_iterator transition = this->transitions.find(app::commands::KeyTrie::getTransitionKey(node, keySeq[0]));
+		if (transition == this->transitions.cend()) {
+			// The sequence leaves the trie without going through a bound node
+			conflict = false;
+			break;
+		}
+		node = transition->second;
+		if (this->nodes[node] != app::commands::key_trie::noValue) {
+			// The sequence begins with a binding
+			break;
+		}
+	}
+
+	return conflict;
+}
+
+void app::commands::KeyTrie::clear() {
+	this->nodes.clear();
+	this->nodes.push_back(app::commands::key_trie::noValue);
+	this->transitions.clear();
+	this->bindingCount = 0;
+	this->reset();
+}
+
+std::size_t app::commands::KeyTrie::getStartNode(const std::chrono::steady_clock::time_point & time) const {
+	std::size_t node = this->currentNode;
+	// A key typed too late starts a new sequence
+	if ((node != app::commands::key_trie::root) && ((time - this->lastKeyTime) > this->timeout)) {
+		node = app::commands::key_trie::root;
+	}
+	return node;
+}
+
+QKeySequence::SequenceMatch app::commands::KeyTrie::feed(const int & key, const std::chrono::steady_clock::time_point & time) {
+	this->currentNode = this->getStartNode(time);
+	this->lastKeyTime = time;
+
+	std::unordered_map<std::uint64_t, std::size_t>::const_iterator transition = this->transitions.find(app::commands::KeyTrie::getTransitionKey(this->currentNode, key));
+
+	// A key that does not continue the sequence typed so far may begin a new one
+	if ((transition == this->transitions.cend()) && (this->currentNode != app::commands::key_trie::root)) {
+		this->currentNode = app::commands::key_trie::root;
+		transition = this->transitions.find(app::commands::KeyTrie::getTransitionKey(this->currentNode, key));
+	}
+
+	QKeySequence::SequenceMatch match = QKeySequence::NoMatch;
+	this->matchedValue = app::commands::key_trie::noValue;
+
+	if (transition == this->transitions.cend()) {
+		this->currentNode = app::commands::key_trie::root;
+	} else {
+		const int & value = this->nodes[transition->second];
+		// Bound nodes have no children as bindings cannot begin with another binding
+		if (value != app::commands::key_trie::noValue) {
+			match = QKeySequence::ExactMatch;
+			this->matchedValue = value;
+			this->currentNode = app::commands::key_trie::root;
+		} else {
+			match = QKeySequence::PartialMatch;
+			this->currentNode = transition->second;
+		}
+	}
+
+	return match;
+}
+
+bool app::commands::KeyTrie::isExpected(const int & key, const std::chrono::steady_clock::time_point & time) const {
+	const std::size_t node = this->getStartNode(time);
+	bool expected = (this->transitions.find(app::commands::KeyTrie::getTransitionKey(node, key)) != this->transitions.cend());
+	// Keys that do not continue the sequence typed so far are matched again from the root
+	if ((expected == false) && (node != app::commands::key_trie::root)) {
+		expected = (this->transitions.find(app::commands::KeyTrie::getTransitionKey(app::commands::key_trie::root, key)) != this->transitions.cend());
+	}
+	return expected;
+}
+
+QKeySequence::SequenceMatch app::commands::KeyTrie::feed(const int & key) {
+	return this->feed(key, std::chrono::steady_clock::now());
+}
+
+void app::commands::KeyTrie::reset() {
+	this->currentNode = app::commands::key_trie::root;
+	this->matchedValue = app::commands::key_trie::noValue;
+}
+
+bool app::commands::KeyTrie::isPending() const {
+	return (this->currentNode != app::commands::key_trie::root);
+}
+
+CONST_GETTER(app::commands::KeyTrie::getMatchedValue, int &, this->matchedValue)
+CONST_SETTER_GETTER(app::commands::KeyTrie::setTimeout, app::commands::KeyTrie::getTimeout, std::chrono::milliseconds &, this->timeout)
+
+std::size_t app::commands::KeyTrie::getBindingCount() const {
+	return this->bindingCount;
+}
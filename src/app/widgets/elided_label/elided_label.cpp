@@ -16,11 +16,11 @@
 #include "app/widgets/elided_label/elided_label.h"
 
 // Categories
-LOGGING_CONTEXT(elidedLabelOverall, elidedLabel.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(elidedLabelElision, elidedLabel.elision, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(elidedLabelPaint, elidedLabel.paint, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(elidedLabelOverall, elidedLabel.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(elidedLabelElision, elidedLabel.elision, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(elidedLabelPaint, elidedLabel.paint, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::elided_label::ElidedLabel::ElidedLabel(QWidget * parent, Qt::WindowFlags flags, const QString & textLabel, const QPoint & labelOrigin, const Qt::TextElideMode & textElisionMode) : QLabel(textLabel, parent, flags), elisionMode(textElisionMode), origin(labelOrigin) {
+app::elided_label::ElidedLabel::ElidedLabel(QWidget * parent, Qt::WindowFlags flags, const QString & textLabel, const QPoint & labelOrigin, const Qt::TextElideMode & textElisionMode) : QLabel(textLabel, parent, flags), elisionMode(textElisionMode), origin(labelOrigin), textUpdateCount(0), paintEventCount(0) {
 
 	LOG_INFO(app::logger::info_level_e::ZERO, elidedLabelOverall, "Elided label constructor for text " << this->text() << " origin " << this->origin << " elision mode " << this->elisionMode);
 
@@ -34,6 +34,12 @@ app::elided_label::ElidedLabel::~ElidedLabel() {
 
 void app::elided_label::ElidedLabel::setText(const QString & text) {
 
+	// Avoid computing elided text and repainting the label if the text is the same
+	if (text.compare(this->text(), Qt::CaseSensitive) == 0) {
+		return;
+	}
+
+	this->textUpdateCount++;
 	QLabel::setText(text);
 	this->updateElidedText(this->geometry().width());
 
@@ -58,6 +64,7 @@ void app::elided_label::ElidedLabel::resizeEvent(QResizeEvent * event) {
 }
 
 void app::elided_label::ElidedLabel::paintEvent(QPaintEvent * event) {
+	this->paintEventCount++;
 	LOG_INFO(app::logger::info_level_e::ZERO, elidedLabelPaint, "Paint text " << this->text() << " elision mode " << this->elisionMode);
 	if (this->elisionMode == Qt::ElideNone) {
 		QLabel::paintEvent(event);
@@ -75,3 +82,5 @@ void app::elided_label::ElidedLabel::paintEvent(QPaintEvent * event) {
 
 CONST_SETTER_GETTER(app::elided_label::ElidedLabel::setElisionMode, app::elided_label::ElidedLabel::getElisionMode, Qt::TextElideMode &, this->elisionMode)
 CONST_SETTER_GETTER(app::elided_label::ElidedLabel::setOrigin, app::elided_label::ElidedLabel::getOrigin, QPoint &, this->origin)
+CONST_GETTER(app::elided_label::ElidedLabel::getTextUpdateCount, std::uint64_t &, this->textUpdateCount)
+CONST_GETTER(app::elided_label::ElidedLabel::getPaintEventCount, std::uint64_t &, this->paintEventCount)
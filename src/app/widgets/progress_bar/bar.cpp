@@ -12,7 +12,7 @@
 #include "app/shared/enums.h"
 
 // Categories
-LOGGING_CONTEXT(progressBarOverall, progressBar.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(progressBarOverall, progressBar.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
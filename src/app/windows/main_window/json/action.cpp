@@ -18,7 +18,7 @@
 #include "app/windows/main_window/shared/shared_types.h"
 #include "app/windows/main_window/json/action.h"
 
-LOGGING_CONTEXT(mainWindowActionOverall, mainWindowAction.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowActionOverall, mainWindowAction.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::json::Action::Action() : app::main_window::json::Action::Action(std::string()) {
 
@@ -44,6 +44,18 @@ app::main_window::json::Action::~Action() {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowActionOverall, "Main window json action class destructor");
 }
 
+const std::unique_ptr<app::main_window::json::Data> & app::main_window::json::Action::findByLongCmd(const std::string & longCmd) const {
+	return this->findIndexedData(app::main_window::json::Data::indexed_parameter_e::LONG_CMD, std::string_view(longCmd));
+}
+
+const std::unique_ptr<app::main_window::json::Data> & app::main_window::json::Action::findByState(const app::main_window::state_e & state) const {
+	return this->findIndexedData(app::main_window::json::Data::indexed_parameter_e::STATE, static_cast<int>(state));
+}
+
+const std::unique_ptr<app::main_window::json::Data> & app::main_window::json::Action::findByShortcut(const int & shortcut) const {
+	return this->findIndexedData(app::main_window::json::Data::indexed_parameter_e::SHORTCUT, shortcut);
+}
+
 // TODO handle shortcuts with multiple keys
 std::string app::main_window::json::Action::getShortcutKey(const std::string & value) {
 	const std::string delim(",");
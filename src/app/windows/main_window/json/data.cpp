@@ -14,7 +14,7 @@
 #include "app/windows/main_window/json/data.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowDataOverall, mainWindowData.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowDataOverall, mainWindowData.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -30,6 +30,16 @@ namespace app {
 					 *
 					 */
 					static const std::vector<std::string> keyNames{"Key", "Name", "State", "Shortcut", "LongCmd", "Help"};
+
+					/**
+					 * @brief parameters whose value is indexed
+					 *
+					 */
+					static const app::main_window::json::Data::indexed_parameter_map_t indexedParameters = {
+						{ "State", app::main_window::json::Data::indexed_parameter_e::STATE },
+						{ "Shortcut", app::main_window::json::Data::indexed_parameter_e::SHORTCUT },
+						{ "LongCmd", app::main_window::json::Data::indexed_parameter_e::LONG_CMD }
+					};
 				}
 
 			}
@@ -229,6 +239,38 @@ bool app::main_window::json::Data::isSameFieldValue(const std::string & name, co
 	return isSame;
 }
 
+const app::main_window::json::Data::indexed_parameter_map_t & app::main_window::json::Data::getIndexedParameters() {
+	return app::main_window::json::data::indexedParameters;
+}
+
+app::base::json::Data::index_key_t app::main_window::json::Data::toIndexKey(const app::main_window::json::Data::indexed_parameter_e & parameter, const void * value) {
+	app::base::json::Data::index_key_t indexKey = 0;
+
+	if (parameter == app::main_window::json::Data::indexed_parameter_e::STATE) {
+		indexKey = static_cast<int>(*static_cast<const app::main_window::state_e *>(value));
+	} else if (parameter == app::main_window::json::Data::indexed_parameter_e::SHORTCUT) {
+		indexKey = *static_cast<const int *>(value);
+	} else if (parameter == app::main_window::json::Data::indexed_parameter_e::LONG_CMD) {
+		indexKey = std::string_view(*static_cast<const std::string *>(value));
+	}
+
+	return indexKey;
+}
+
+app::base::json::Data::index_key_t app::main_window::json::Data::getIndexKey(const app::main_window::json::Data::indexed_parameter_e & parameter) const {
+	app::base::json::Data::index_key_t indexKey = 0;
+
+	if (parameter == app::main_window::json::Data::indexed_parameter_e::STATE) {
+		indexKey = static_cast<int>(this->state);
+	} else if (parameter == app::main_window::json::Data::indexed_parameter_e::SHORTCUT) {
+		indexKey = this->shortcut;
+	} else if (parameter == app::main_window::json::Data::indexed_parameter_e::LONG_CMD) {
+		indexKey = std::string_view(this->longCmd);
+	}
+
+	return indexKey;
+}
+
 bool app::main_window::json::Data::operator==(const app::main_window::json::Data & rhs) {
 	bool isSame = true;
 	isSame &= app::base::json::Data::operator==(rhs);
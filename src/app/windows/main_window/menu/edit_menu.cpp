@@ -18,14 +18,14 @@
 #include "app/windows/secondary_windows/find_window/window.h"
 
 // Categories
-LOGGING_CONTEXT(editMenuOverall, editMenu.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(editMenuUndoAction, editMenu.undoAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(editMenuRedoAction, editMenu.redoAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(editMenuCutAction, editMenu.cutAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(editMenuCopyAction, editMenu.copyAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(editMenuPasteAction, editMenu.pasteAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(editMenuSelectAllAction, editMenu.selectAllAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(editMenuFindAction, editMenu.findAction, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(editMenuOverall, editMenu.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(editMenuUndoAction, editMenu.undoAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(editMenuRedoAction, editMenu.redoAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(editMenuCutAction, editMenu.cutAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(editMenuCopyAction, editMenu.copyAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(editMenuPasteAction, editMenu.pasteAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(editMenuSelectAllAction, editMenu.selectAllAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(editMenuFindAction, editMenu.findAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::menu::EditMenu::EditMenu(QWidget * parent, std::weak_ptr<QMenuBar> menuBar, const char* menuName, const app::commands::KeySequence & key) : app::base::menu::Menu(parent,menuBar,menuName,key), findWindow(Q_NULLPTR) {
 
@@ -15,12 +15,12 @@
 #include "app/windows/secondary_windows/open_window/window.h"
 
 // Categories
-LOGGING_CONTEXT(fileMenuOverall, fileMenu.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(fileMenuOpenAction, fileMenu.openAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(fileMenuOpenTabAction, fileMenu.openTabAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(fileMenuSaveAction, fileMenu.saveAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(fileMenuPrintAction, fileMenu.printAction, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(fileMenuExitAction, fileMenu.exitAction, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(fileMenuOverall, fileMenu.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(fileMenuOpenAction, fileMenu.openAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(fileMenuOpenTabAction, fileMenu.openTabAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(fileMenuSaveAction, fileMenu.saveAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(fileMenuPrintAction, fileMenu.printAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(fileMenuExitAction, fileMenu.exitAction, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::menu::FileMenu::FileMenu(QWidget * parent, std::weak_ptr<QMenuBar> menuBar, const char* menuName, const app::commands::KeySequence & key) : app::base::menu::Menu(parent,menuBar,menuName,key), openWindow(Q_NULLPTR) {
 
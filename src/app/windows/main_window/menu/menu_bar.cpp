@@ -15,7 +15,7 @@
 #include "app/windows/main_window/menu/edit_menu.h"
 #include "app/windows/main_window/menu/menu_bar.h"
 
-LOGGING_CONTEXT(mainWindowMenuBarOverall, menuBar.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowMenuBarOverall, menuBar.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::menu::MenuBar::MenuBar(QWidget * parent) : app::base::menu::MenuBar(parent), fileMenu(Q_NULLPTR), editMenu(Q_NULLPTR) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowMenuBarOverall, "Main window menu bar constructor");
@@ -25,7 +25,7 @@
 #include "app/widgets/elided_label/elided_label.h"
 
 // Categories
-LOGGING_CONTEXT(labelPopupOverall, labelPopup.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(labelPopupOverall, labelPopup.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -27,10 +27,10 @@
 #include "app/windows/main_window/popup/open_popup.h"
 
 // Categories
-LOGGING_CONTEXT(openPopupOverall, openPopup.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(openPopupOpen, openPopup.open, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(openPopupBrowse, openPopup.browse, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(openPopupCancel, openPopup.cancel, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(openPopupOverall, openPopup.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(openPopupOpen, openPopup.open, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(openPopupBrowse, openPopup.browse, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(openPopupCancel, openPopup.cancel, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 
 namespace app {
@@ -11,7 +11,7 @@
 #include "app/shared/enums.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowPopupBaseOverall, mainWindowPopupBase.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowPopupBaseOverall, mainWindowPopupBase.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::popup::PopupBase::PopupBase(QWidget * parent, const bool & centerWidget, const int & widgetPadding, Qt::WindowFlags flags) : app::base::popup::PopupBase(parent, centerWidget, widgetPadding, flags) {
 
@@ -17,7 +17,7 @@
 #include "app/windows/main_window/popup/popup_container.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowPopupContainerOverall, mainWindowPopupContainer.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowPopupContainerOverall, mainWindowPopupContainer.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
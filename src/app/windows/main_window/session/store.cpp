@@ -0,0 +1,360 @@
+/**
+ * @copyright
+ * @file store.cpp
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Main Window Session Store functions
+ */
+
+#include <algorithm>
+
+// Qt libraries
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtWidgets/QTabBar>
+
+#include "app/shared/exception.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/session/store.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "app/base/tabs/tab_bar.h"
+
+// Categories
+LOGGING_CONTEXT(sessionStoreOverall, sessionStore.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(sessionStoreWriter, sessionStore.writer, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace app {
+
+	namespace main_window {
+
+		namespace session {
+
+			namespace store {
+
+				namespace {
+					/**
+					 * @brief number identifying a session file
+					 *
+					 */
+					static constexpr quint32 magicNumber = 0x42505353;
+
+					/**
+					 * @brief version of the format of the session file
+					 *
+					 */
+					static constexpr quint16 formatVersion = 1;
+
+					/**
+					 * @brief version of the QDataStream serialization
+					 *
+					 */
+					static constexpr QDataStream::Version streamVersion = QDataStream::Qt_5_6;
+
+					/**
+					 * @brief maximum vertical scroll percentage
+					 *
+					 */
+					static constexpr int maxScrollPercentage = 100;
+
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+app::main_window::session::Store::Store(app::main_window::tab::TabWidget * tabWidget, const QString & sessionFile, const std::chrono::milliseconds & saveDelay) : tabs(tabWidget), filename(sessionFile), saveTimer(std::make_unique<QTimer>()), writer(), writerMutex(), wakeUp(), written(), pendingData(), pending(false), writing(false), running(false), writtenSessions(0) {
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionStoreOverall, "Session store constructor with file " << this->filename << " and save delay " << saveDelay.count() << "ms");
+
+	EXCEPTION_ACTION_COND((this->tabs == nullptr), throw, "Unable to create a session store without tabs");
+	EXCEPTION_ACTION_COND((saveDelay.count() < 0), throw, "Session save delay must not be negative. Got " << saveDelay.count() << "ms");
+
+	this->saveTimer->setSingleShot(true);
+	this->saveTimer->setInterval(static_cast<int>(saveDelay.count()));
+
+	if (this->filename.isEmpty() == false) {
+		// Connections are tied to the timer therefore they are removed when the store is destroyed
+		QObject::connect(this->saveTimer.get(), &QTimer::timeout, this->saveTimer.get(), [this] () {
+			this->save();
+		});
+		QObject::connect(this->tabs, &app::main_window::tab::TabWidget::numberTabsChanged, this->saveTimer.get(), [this] () {
+			this->scheduleSave();
+		});
+		QObject::connect(this->tabs, &app::main_window::tab::TabWidget::currentChanged, this->saveTimer.get(), [this] () {
+			this->scheduleSave();
+		});
+		QObject::connect(this->tabs, &app::main_window::tab::TabWidget::tabSourceChanged, this->saveTimer.get(), [this] () {
+			this->scheduleSave();
+		});
+		QObject::connect(this->tabs, &app::main_window::tab::TabWidget::tabUrlChanged, this->saveTimer.get(), [this] () {
+			this->scheduleSave();
+		});
+		QObject::connect(this->tabs, &app::main_window::tab::TabWidget::historyItemChanged, this->saveTimer.get(), [this] () {
+			this->scheduleSave();
+		});
+		QObject::connect(this->tabs->tabBar().get(), &QTabBar::tabMoved, this->saveTimer.get(), [this] () {
+			this->scheduleSave();
+		});
+
+		this->running = true;
+		this->writer = std::thread(&app::main_window::session::Store::run, this);
+	}
+}
+
+app::main_window::session::Store::~Store() {
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionStoreOverall, "Session store destructor");
+
+	if (this->writer.joinable() == true) {
+		this->saveTimer->stop();
+		// The scroll position of tabs is not tracked therefore the latest session is always written
+		this->save();
+
+		{
+			std::lock_guard<std::mutex> lock(this->writerMutex);
+			this->running = false;
+		}
+		this->wakeUp.notify_one();
+		this->writer.join();
+	}
+}
+
+void app::main_window::session::Store::scheduleSave() {
+	// The timer is not restarted in order to write the session even if the tabs keep changing
+	if ((this->filename.isEmpty() == false) && (this->saveTimer->isActive() == false)) {
+		this->saveTimer->start();
+	}
+}
+
+void app::main_window::session::Store::save() {
+	if (this->filename.isEmpty() == false) {
+		this->save(this->snapshot());
+	}
+}
+
+void app::main_window::session::Store::save(const app::main_window::session::session_state_s & session) {
+	EXCEPTION_ACTION_COND((this->writer.joinable() == false), throw, "Unable to save session as the session store has no file");
+
+	QByteArray data(app::main_window::session::Store::serialize(session));
+
+	{
+		std::lock_guard<std::mutex> lock(this->writerMutex);
+		this->pendingData = std::move(data);
+		this->pending = true;
+	}
+	this->wakeUp.notify_one();
+}
+
+void app::main_window::session::Store::flush() {
+	std::unique_lock<std::mutex> lock(this->writerMutex);
+	this->written.wait(lock, [this] () {
+		return ((this->pending == false) && (this->writing == false));
+	});
+}
+
+void app::main_window::session::Store::run() {
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionStoreWriter, "Session writer thread started");
+
+	std::unique_lock<std::mutex> lock(this->writerMutex);
+	while (true) {
+		this->wakeUp.wait(lock, [this] () {
+			return ((this->pending == true) || (this->running == false));
+		});
+
+		if (this->pending == false) {
+			break;
+		}
+
+		// Only the latest session is written
+		const QByteArray data(std::move(this->pendingData));
+		this->pendingData = QByteArray();
+		this->pending = false;
+		this->writing = true;
+
+		lock.unlock();
+		this->write(data);
+		lock.lock();
+
+		this->writing = false;
+		this->writtenSessions++;
+		this->written.notify_all();
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionStoreWriter, "Session writer thread stopped");
+}
+
+void app::main_window::session::Store::write(const QByteArray & data) const {
+	const QFileInfo fileInfo(this->filename);
+	QDir().mkpath(fileInfo.absolutePath());
+
+	// QSaveFile writes a temporary file and renames it to the session file when it is committed
+	QSaveFile file(this->filename);
+	if (file.open(QIODevice::WriteOnly) == false) {
+		LOG_WARNING(sessionStoreWriter, "Unable to open session file " << this->filename << ": " << file.errorString());
+		return;
+	}
+
+	file.write(data);
+	if (file.commit() == false) {
+		LOG_WARNING(sessionStoreWriter, "Unable to write session file " << this->filename << ": " << file.errorString());
+		return;
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionStoreWriter, "Written session of " << data.size() << " bytes to file " << this->filename);
+}
+
+app::main_window::session::session_state_s app::main_window::session::Store::snapshot() const {
+	app::main_window::session::session_state_s session;
+	session.currentIndex = -1;
+
+	const int currentIndex = this->tabs->currentIndex();
+	const int tabCount = this->tabs->count();
+	session.tabs.reserve(static_cast<std::size_t>(tabCount));
+
+	for (int index = 0; index < tabCount; index++) {
+		const std::shared_ptr<app::main_window::tab::Tab> tab = this->tabs->widget(index, true);
+		const app::main_window::page_type_e type = tab->getType();
+		// Tabs whose content is unknown cannot be restored
+		if ((type != app::main_window::page_type_e::TEXT) && (type != app::main_window::page_type_e::WEB_CONTENT)) {
+			continue;
+		}
+
+		if (index == currentIndex) {
+			session.currentIndex = static_cast<int>(session.tabs.size());
+		}
+
+		app::main_window::session::tab_state_s state;
+		state.type = type;
+		state.source = tab->getCurrentSource();
+		state.verticalScrollPercentage = tab->getVerticalScrollPercentage();
+		state.history = tab->getHistoryData();
+		session.tabs.push_back(std::move(state));
+	}
+
+	if ((session.currentIndex < 0) && (session.tabs.empty() == false)) {
+		session.currentIndex = 0;
+	}
+
+	return session;
+}
+
+bool app::main_window::session::Store::load(app::main_window::session::session_state_s & session) const {
+	if (this->filename.isEmpty() == true) {
+		return false;
+	}
+
+	QFile file(this->filename);
+	if (file.exists() == false) {
+		LOG_INFO(app::logger::info_level_e::ZERO, sessionStoreOverall, "No session to restore as file " << this->filename << " does not exist");
+		return false;
+	}
+
+	if (file.open(QIODevice::ReadOnly) == false) {
+		LOG_WARNING(sessionStoreOverall, "Unable to open session file " << this->filename << ": " << file.errorString());
+		return false;
+	}
+
+	const bool success = app::main_window::session::Store::deserialize(file.readAll(), session);
+	if (success == false) {
+		LOG_WARNING(sessionStoreOverall, "Unable to restore session as file " << this->filename << " is not a valid session file");
+	}
+
+	return success;
+}
+
+int app::main_window::session::Store::restore() {
+	app::main_window::session::session_state_s session;
+	if (this->load(session) == false) {
+		return 0;
+	}
+
+	return this->restore(session);
+}
+
+int app::main_window::session::Store::restore(const app::main_window::session::session_state_s & session) {
+	const int initialTabCount = this->tabs->count();
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionStoreOverall, "Restore session of " << session.tabs.size() << " tabs after " << initialTabCount << " open tabs");
+
+	for (const app::main_window::session::tab_state_s & state : session.tabs) {
+		this->tabs->restoreTab(state.type, state.source, state.history, state.verticalScrollPercentage);
+	}
+
+	const int restoredTabs = static_cast<int>(session.tabs.size());
+	if (restoredTabs > 0) {
+		const int currentIndex = std::clamp(session.currentIndex, 0, (restoredTabs - 1));
+		this->tabs->restoreCurrentTab(initialTabCount + currentIndex);
+	}
+
+	return restoredTabs;
+}
+
+QByteArray app::main_window::session::Store::serialize(const app::main_window::session::session_state_s & session) {
+	QByteArray data;
+	QDataStream stream(&data, QIODevice::WriteOnly);
+	stream.setVersion(app::main_window::session::store::streamVersion);
+
+	stream << app::main_window::session::store::magicNumber << app::main_window::session::store::formatVersion;
+	stream << static_cast<qint32>(session.currentIndex) << static_cast<quint32>(session.tabs.size());
+	for (const app::main_window::session::tab_state_s & state : session.tabs) {
+		stream << static_cast<quint8>(state.type) << state.source << static_cast<qint8>(state.verticalScrollPercentage) << state.history;
+	}
+
+	return data;
+}
+
+bool app::main_window::session::Store::deserialize(const QByteArray & data, app::main_window::session::session_state_s & session) {
+	QDataStream stream(data);
+	stream.setVersion(app::main_window::session::store::streamVersion);
+
+	quint32 magic = 0;
+	quint16 version = 0;
+	stream >> magic >> version;
+	if ((stream.status() != QDataStream::Ok) || (magic != app::main_window::session::store::magicNumber) || (version != app::main_window::session::store::formatVersion)) {
+		return false;
+	}
+
+	qint32 currentIndex = 0;
+	quint32 tabCount = 0;
+	stream >> currentIndex >> tabCount;
+	if (stream.status() != QDataStream::Ok) {
+		return false;
+	}
+
+	app::main_window::session::session_state_s decodedSession;
+	decodedSession.currentIndex = static_cast<int>(currentIndex);
+	// The number of tabs is not trusted to reserve memory as the file may be corrupted
+	for (quint32 tabIdx = 0; tabIdx < tabCount; tabIdx++) {
+		quint8 type = 0;
+		qint8 verticalScrollPercentage = 0;
+		app::main_window::session::tab_state_s state;
+		stream >> type >> state.source >> verticalScrollPercentage >> state.history;
+		if (stream.status() != QDataStream::Ok) {
+			return false;
+		}
+
+		state.type = static_cast<app::main_window::page_type_e>(type);
+		if ((state.type != app::main_window::page_type_e::TEXT) && (state.type != app::main_window::page_type_e::WEB_CONTENT)) {
+			return false;
+		}
+		state.verticalScrollPercentage = std::clamp(static_cast<int>(verticalScrollPercentage), 0, app::main_window::session::store::maxScrollPercentage);
+		decodedSession.tabs.push_back(std::move(state));
+	}
+
+	session = std::move(decodedSession);
+	return true;
+}
+
+const QString & app::main_window::session::Store::getFilename() const {
+	return this->filename;
+}
+
+std::uint64_t app::main_window::session::Store::getWrittenSessions() const {
+	std::lock_guard<std::mutex> lock(this->writerMutex);
+	return this->writtenSessions;
+}
@@ -0,0 +1,158 @@
+/**
+ * @copyright
+ * @file text_classifier.cpp
+ * @author Andrea Gianarda
+ * @date 10th September 2020
+ * @brief Main Window Text Classifier functions
+ */
+
+#include <utility>
+
+// Qt libraries
+#include <QtCore/QFile>
+#include <QtCore/QUrl>
+
+#include "app/shared/constants.h"
+#include "app/shared/exception.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/shared/text_classifier.h"
+
+// Categories
+LOGGING_CONTEXT(textClassifierOverall, textClassifier.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace app {
+
+	namespace main_window {
+
+		namespace text_classifier {
+
+			namespace {
+				/**
+				 * @brief default time after which a text must be checked again against the filesystem
+				 *
+				 */
+				static constexpr std::chrono::milliseconds defaultFileCheckTimeout(2000);
+
+			}
+
+		}
+
+	}
+
+}
+
+app::main_window::TextClassifier::TextClassifier() : recentTexts(), textPositions(), fileCheckTimeout(app::main_window::text_classifier::defaultFileCheckTimeout), hits(0), misses(0) {
+	LOG_INFO(app::logger::info_level_e::ZERO, textClassifierOverall, "Text classifier constructor");
+	this->textPositions.reserve(app::main_window::TextClassifier::capacity);
+}
+
+app::main_window::TextClassifier::~TextClassifier() {
+	LOG_INFO(app::logger::info_level_e::ZERO, textClassifierOverall, "Text classifier destructor");
+}
+
+bool app::main_window::TextClassifier::checkUrl(const QString & text) {
+
+	// QUrl is not built for texts that cannot be URLs: those without dots or with spaces such as search queries
+	const int numberDots = text.count(QChar('.'));
+	if (numberDots == 0) {
+		return false;
+	}
+
+	for (const QChar & character : text) {
+		if (character.isSpace() == true) {
+			return false;
+		}
+	}
+
+	const bool containsWww = text.contains(app::shared::www);
+	const bool containsHttps = text.contains(app::shared::https);
+
+	// Check also the number of dots in the argument text.
+	// In fact QUrl considers as valid an URL that is missing the .TLD (example .com)
+	// For example, if text is "cc", the URL built by this method is https://www.cc. It is considered a valid URL by QT whereas it is not
+	QString urlStr = QString();
+
+	if (containsHttps == false) {
+		urlStr += app::shared::https;
+	}
+
+	if (containsWww == false) {
+		urlStr += app::shared::www;
+	}
+
+	urlStr += text;
+
+	QUrl url(urlStr, QUrl::StrictMode);
+
+	return url.isValid();
+}
+
+bool app::main_window::TextClassifier::checkFile(const QString & text) {
+	QFile file(text);
+	return file.exists();
+}
+
+app::main_window::TextClassifier::classification_s & app::main_window::TextClassifier::classify(const QString & text) {
+	QHash<QString, std::list<app::main_window::TextClassifier::classification_s>::iterator>::iterator positionIt = this->textPositions.find(text);
+
+	if (positionIt != this->textPositions.end()) {
+		this->hits++;
+		// Move the text to the front of the list without invalidating any iterator
+		this->recentTexts.splice(this->recentTexts.begin(), this->recentTexts, positionIt.value());
+	} else {
+		this->misses++;
+		app::main_window::TextClassifier::classification_s classification;
+		classification.text = text;
+		classification.url = app::main_window::TextClassifier::checkUrl(text);
+		classification.file = false;
+		classification.fileChecked = false;
+		this->recentTexts.push_front(std::move(classification));
+		this->textPositions.insert(text, this->recentTexts.begin());
+
+		if (this->textPositions.size() > app::main_window::TextClassifier::capacity) {
+			this->textPositions.remove(this->recentTexts.back().text);
+			this->recentTexts.pop_back();
+		}
+	}
+
+	return this->recentTexts.front();
+}
+
+bool app::main_window::TextClassifier::isUrl(const QString & text) {
+	return this->classify(text).url;
+}
+
+bool app::main_window::TextClassifier::isFile(const QString & text) {
+	app::main_window::TextClassifier::classification_s & classification = this->classify(text);
+
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	if ((classification.fileChecked == false) || ((now - classification.fileCheckTime) >= this->fileCheckTimeout)) {
+		classification.file = app::main_window::TextClassifier::checkFile(text);
+		classification.fileChecked = true;
+		classification.fileCheckTime = now;
+	}
+
+	return classification.file;
+}
+
+void app::main_window::TextClassifier::clear() {
+	this->textPositions.clear();
+	this->recentTexts.clear();
+}
+
+void app::main_window::TextClassifier::setFileCheckTimeout(const std::chrono::milliseconds & value) {
+	EXCEPTION_ACTION_COND((value.count() < 0), throw, "File check timeout must not be negative. Got " << value.count() << " ms");
+	this->fileCheckTimeout = value;
+}
+
+const std::chrono::milliseconds & app::main_window::TextClassifier::getFileCheckTimeout() const {
+	return this->fileCheckTimeout;
+}
+
+std::uint64_t app::main_window::TextClassifier::getHits() const {
+	return this->hits;
+}
+
+std::uint64_t app::main_window::TextClassifier::getMisses() const {
+	return this->misses;
+}
@@ -20,9 +20,9 @@
 #include "app/windows/main_window/statusbar/bar.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowStatusBarOverall, mainWindowStatusBar.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowStatusBarMouse, mainWindowStatusBar.mouse, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowStatusBarUserInput, mainWindowStatusBar.userInput, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowStatusBarOverall, mainWindowStatusBar.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowStatusBarMouse, mainWindowStatusBar.mouse, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowStatusBarUserInput, mainWindowStatusBar.userInput, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -98,6 +98,12 @@ namespace app {
 				 */
 				static const QString bottomScroll = "bot";
 
+				/**
+				 * @brief interval in milliseconds between two updates of the status bar
+				 *
+				 */
+				static constexpr int updateInterval = 16;
+
 			}
 
 		}
@@ -106,7 +112,7 @@ namespace app {
 
 }
 
-app::main_window::statusbar::Bar::Bar(QWidget * parent, Qt::WindowFlags flags) : QWidget(parent, flags), userInput(Q_NULLPTR), contentPath(Q_NULLPTR), scroll(Q_NULLPTR), info(Q_NULLPTR), searchResult(Q_NULLPTR), loadBar(Q_NULLPTR) {
+app::main_window::statusbar::Bar::Bar(QWidget * parent, Qt::WindowFlags flags) : QWidget(parent, flags), userInput(Q_NULLPTR), contentPath(Q_NULLPTR), scroll(Q_NULLPTR), info(Q_NULLPTR), searchResult(Q_NULLPTR), loadBar(Q_NULLPTR), updateTimer(std::make_unique<QTimer>(this)), pendingTexts(), pendingProgressValue(0), progressValueDirty(false) {
 
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowStatusBarOverall, "Main window status bar constructor");
 
@@ -150,6 +156,10 @@ app::main_window::statusbar::Bar::Bar(QWidget * parent, Qt::WindowFlags flags) :
 
 	// Populate statusbar
 	this->fillStatusBar();
+
+	this->updateTimer->setSingleShot(true);
+	this->updateTimer->setInterval(app::main_window::statusbar::updateInterval);
+	connect(this->updateTimer.get(), &QTimer::timeout, this, &app::main_window::statusbar::Bar::applyPendingUpdates);
 }
 
 app::main_window::statusbar::Bar::~Bar() {
@@ -275,11 +285,11 @@ void app::main_window::statusbar::Bar::setVScroll(const int & vScroll) {
 		}
 	}
 
-	this->scroll->setText(vScrollText);
+	this->setPendingText(this->scroll.get(), vScrollText);
 }
 
 int app::main_window::statusbar::Bar::getVScroll() const {
-	QString vScrollText(this->scroll->text());
+	QString vScrollText(this->getLabelText(this->scroll));
 	int topCompare = QString::compare(vScrollText, app::main_window::statusbar::topScroll);
 	int bottomCompare = QString::compare(vScrollText, app::main_window::statusbar::bottomScroll);
 
@@ -300,16 +310,32 @@ int app::main_window::statusbar::Bar::getVScroll() const {
 }
 
 void app::main_window::statusbar::Bar::setProgressValue(const int & value) {
-	this->loadBar->setValue(value);
+	// Start and end of the load are applied straight away so that the visibility of the load bar follows the load status
+	if ((value == this->loadBar->minimum()) || (value == this->loadBar->maximum())) {
+		this->progressValueDirty = false;
+		this->loadBar->setValue(value);
+	} else {
+		this->pendingProgressValue = value;
+		this->progressValueDirty = true;
+		this->scheduleUpdate();
+	}
 }
-BASE_GETTER(app::main_window::statusbar::Bar::getProgressValue, int, this->loadBar->value())
+
+int app::main_window::statusbar::Bar::getProgressValue() const {
+	if (this->progressValueDirty == true) {
+		return this->pendingProgressValue;
+	}
+
+	return this->loadBar->value();
+}
+
 BASE_GETTER(app::main_window::statusbar::Bar::getLoadBarVisibility, bool, this->loadBar->isVisible())
 CONST_GETTER(app::main_window::statusbar::Bar::getLoadBar, std::unique_ptr<app::progress_bar::Bar> &, this->loadBar)
 
 void app::main_window::statusbar::Bar::setInfoText(const QString & text) {
-	this->info->setText(text);
+	this->setPendingText(this->info.get(), text);
 }
-CONST_GETTER(app::main_window::statusbar::Bar::getInfoText, QString, this->info->text())
+CONST_GETTER(app::main_window::statusbar::Bar::getInfoText, QString, this->getLabelText(this->info))
 CONST_GETTER(app::main_window::statusbar::Bar::getInfo, std::unique_ptr<app::elided_label::ElidedLabel> &, this->info)
 
 void app::main_window::statusbar::Bar::setUserInputText(const QString & text) {
@@ -325,13 +351,13 @@ CONST_GETTER(app::main_window::statusbar::Bar::getContentPathText, QString, this
 CONST_GETTER(app::main_window::statusbar::Bar::getContentPath, std::unique_ptr<app::elided_label::ElidedLabel> &, this->contentPath)
 
 void app::main_window::statusbar::Bar::setSearchResultText(const QString & text) {
-	this->searchResult->setText(text);
+	this->setPendingText(this->searchResult.get(), text);
 }
-CONST_GETTER(app::main_window::statusbar::Bar::getSearchResultText, QString, this->searchResult->text())
+CONST_GETTER(app::main_window::statusbar::Bar::getSearchResultText, QString, this->getLabelText(this->searchResult))
 CONST_GETTER(app::main_window::statusbar::Bar::getSearchResult, std::unique_ptr<app::elided_label::ElidedLabel> &, this->searchResult)
 
 void app::main_window::statusbar::Bar::showSearchResult(const bool & showWidget) {
-	const bool isTextEmpty = this->searchResult->text().isEmpty();
+	const bool isTextEmpty = this->getLabelText(this->searchResult).isEmpty();
 	if ((showWidget == true) && (isTextEmpty == false)) {
 		this->searchResult->show();
 	} else {
@@ -339,6 +365,57 @@ void app::main_window::statusbar::Bar::showSearchResult(const bool & showWidget)
 	}
 }
 
+void app::main_window::statusbar::Bar::setPendingText(app::elided_label::ElidedLabel * label, const QString & text) {
+	this->pendingTexts[label] = text;
+	this->scheduleUpdate();
+}
+
+QString app::main_window::statusbar::Bar::getLabelText(const std::unique_ptr<app::elided_label::ElidedLabel> & label) const {
+	std::map<app::elided_label::ElidedLabel *, QString>::const_iterator textIt = this->pendingTexts.find(label.get());
+	if (textIt != this->pendingTexts.cend()) {
+		return textIt->second;
+	}
+
+	return label->text();
+}
+
+void app::main_window::statusbar::Bar::scheduleUpdate() {
+	if (this->updateTimer->isActive() == false) {
+		this->updateTimer->start();
+	}
+}
+
+void app::main_window::statusbar::Bar::applyPendingUpdates() {
+	for (const auto & pendingText : this->pendingTexts) {
+		pendingText.first->setText(pendingText.second);
+	}
+	this->pendingTexts.clear();
+
+	if (this->progressValueDirty == true) {
+		this->progressValueDirty = false;
+		this->loadBar->setValue(this->pendingProgressValue);
+	}
+
+	// Schedule a single repaint of the status bar
+	this->update();
+}
+
+std::uint64_t app::main_window::statusbar::Bar::getLabelUpdateCount() const {
+	std::uint64_t count = 0;
+	for (const app::elided_label::ElidedLabel * label : { this->userInput.get(), this->contentPath.get(), this->scroll.get(), this->info.get(), this->searchResult.get() }) {
+		count += label->getTextUpdateCount();
+	}
+	return count;
+}
+
+std::uint64_t app::main_window::statusbar::Bar::getPaintEventCount() const {
+	std::uint64_t count = 0;
+	for (const app::elided_label::ElidedLabel * label : { this->userInput.get(), this->contentPath.get(), this->scroll.get(), this->info.get(), this->searchResult.get() }) {
+		count += label->getPaintEventCount();
+	}
+	return count;
+}
+
 void app::main_window::statusbar::Bar::mousePressEvent(QMouseEvent * event) {
 
 	if (event->type() == QEvent::MouseButtonPress) {
@@ -348,7 +425,7 @@ void app::main_window::statusbar::Bar::mousePressEvent(QMouseEvent * event) {
 		if (button & Qt::LeftButton) {
 
 			// Do not give focus if not tabs are opened
-			const QString infoText(this->info->text());
+			const QString infoText(this->getInfoText());
 			if (infoText.compare(app::main_window::noTabInfoText, Qt::CaseSensitive) != 0) {
 				// Position relative to the widget
 				const QPointF & relativePosition = event->localPos();
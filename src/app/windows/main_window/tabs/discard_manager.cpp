@@ -0,0 +1,149 @@
+/**
+ * @copyright
+ * @file discard_manager.cpp
+ * @author Andrea Gianarda
+ * @date 02nd September 2020
+ * @brief Main Window Tab Discard Manager functions
+ */
+
+#include <set>
+#include <string>
+#include <algorithm>
+
+#include "app/utility/logger/macros.h"
+#include "app/shared/exception.h"
+#include "app/shared/setters_getters.h"
+#include "app/utility/cpp/process_memory.h"
+#include "app/windows/main_window/tabs/discard_manager.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "app/windows/main_window/tabs/web_engine_page.h"
+
+// Categories
+LOGGING_CONTEXT(mainWindowTabDiscardManagerOverall, mainWindowTabDiscardManager.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabDiscardManagerBudget, mainWindowTabDiscardManager.budget, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+app::main_window::tab::DiscardManager::DiscardManager(const int & maxLiveTabs, const std::int64_t & memoryBudget): maxLiveTabs(0), memoryBudget(0), discardedTabs(0), activations() {
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabDiscardManagerOverall, "DiscardManager constructor");
+	this->setMaxLiveTabs(maxLiveTabs);
+	this->setMemoryBudget(memoryBudget);
+}
+
+app::main_window::tab::DiscardManager::~DiscardManager() {
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabDiscardManagerOverall, "DiscardManager destructor");
+}
+
+void app::main_window::tab::DiscardManager::activate(const std::shared_ptr<app::main_window::tab::Tab> & tab) {
+	this->remove(tab);
+	this->activations.emplace_back(tab, std::chrono::steady_clock::now());
+}
+
+void app::main_window::tab::DiscardManager::remove(const std::shared_ptr<app::main_window::tab::Tab> & tab) {
+	this->activations.remove_if([&tab] (const app::main_window::tab::DiscardManager::tab_activation_t & activation) {
+		return (activation.first.lock() == tab);
+	});
+}
+
+int app::main_window::tab::DiscardManager::getLiveTabs() const {
+	return static_cast<int>(std::count_if(this->activations.cbegin(), this->activations.cend(), [] (const app::main_window::tab::DiscardManager::tab_activation_t & activation) {
+		const std::shared_ptr<app::main_window::tab::Tab> tab = activation.first.lock();
+		return ((tab != nullptr) && (tab->isPlaceholder() == false));
+	}));
+}
+
+std::shared_ptr<app::main_window::tab::Tab> app::main_window::tab::DiscardManager::leastRecentlyUsed(const std::shared_ptr<app::main_window::tab::Tab> & currentTab) {
+	std::list<app::main_window::tab::DiscardManager::tab_activation_t>::iterator activationIt = this->activations.begin();
+	while (activationIt != this->activations.end()) {
+		const std::shared_ptr<app::main_window::tab::Tab> tab = activationIt->first.lock();
+		if (tab == nullptr) {
+			activationIt = this->activations.erase(activationIt);
+		} else {
+			if ((tab != currentTab) && (tab->isPlaceholder() == false)) {
+				return tab;
+			}
+			activationIt++;
+		}
+	}
+
+	return nullptr;
+}
+
+void app::main_window::tab::DiscardManager::discard(const std::shared_ptr<app::main_window::tab::Tab> & tab) {
+	tab->hibernate();
+	this->discardedTabs++;
+}
+
+void app::main_window::tab::DiscardManager::enforceBudget(const std::shared_ptr<app::main_window::tab::Tab> & currentTab) {
+	if (this->maxLiveTabs > 0) {
+		int liveTabs = this->getLiveTabs();
+		while (liveTabs > this->maxLiveTabs) {
+			const std::shared_ptr<app::main_window::tab::Tab> tab = this->leastRecentlyUsed(currentTab);
+			if (tab == nullptr) {
+				break;
+			}
+			LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabDiscardManagerBudget, "Hibernate least recently used tab as " << liveTabs << " tabs are live and the limit is " << this->maxLiveTabs);
+			this->discard(tab);
+			liveTabs--;
+		}
+	}
+
+	if (this->memoryBudget > 0) {
+		std::int64_t usedMemory = this->getUsedMemory();
+		while (usedMemory > this->memoryBudget) {
+			const std::shared_ptr<app::main_window::tab::Tab> tab = this->leastRecentlyUsed(currentTab);
+			if (tab == nullptr) {
+				break;
+			}
+			LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabDiscardManagerBudget, "Hibernate least recently used tab as memory used by live tabs " << usedMemory << " bytes exceeds the budget of " << this->memoryBudget << " bytes");
+			this->discard(tab);
+			// The renderer process of a hibernated tab is no longer accounted for unless another live tab shares it
+			const std::int64_t remainingMemory = this->getUsedMemory();
+			if (remainingMemory >= usedMemory) {
+				LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabDiscardManagerBudget, "Stop hibernating tabs as hibernating the last one did not reduce the memory used by live tabs (" << remainingMemory << " bytes)");
+				break;
+			}
+			usedMemory = remainingMemory;
+		}
+	}
+}
+
+std::int64_t app::main_window::tab::DiscardManager::getUsedMemory() const {
+	// The memory of the browser process does not depend on the live tabs therefore only renderer processes are accounted for
+	std::int64_t usedMemory = -1;
+
+	#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
+	usedMemory = 0;
+	std::set<qint64> rendererPids;
+	for (std::list<app::main_window::tab::DiscardManager::tab_activation_t>::const_iterator activationIt = this->activations.cbegin(); activationIt != this->activations.cend(); activationIt++) {
+		const std::shared_ptr<app::main_window::tab::Tab> tab = activationIt->first.lock();
+		if ((tab != nullptr) && (tab->isPlaceholder() == false)) {
+			const qint64 pid = tab->getPage()->renderProcessPid();
+			if (pid > 0) {
+				rendererPids.insert(pid);
+			}
+		}
+	}
+
+	for (std::set<qint64>::const_iterator pidIt = rendererPids.cbegin(); pidIt != rendererPids.cend(); pidIt++) {
+		const std::int64_t rendererMemory = app::utility::getMemoryStatus("VmRSS", std::to_string(*pidIt));
+		if (rendererMemory > 0) {
+			usedMemory += rendererMemory;
+		}
+	}
+	#endif // QT_VERSION
+
+	return usedMemory;
+}
+
+void app::main_window::tab::DiscardManager::setMaxLiveTabs(const int & value) {
+	EXCEPTION_ACTION_COND((value < 0), throw, "Maximum number of live tabs cannot be negative. Got " << value);
+	this->maxLiveTabs = value;
+}
+
+void app::main_window::tab::DiscardManager::setMemoryBudget(const std::int64_t & value) {
+	EXCEPTION_ACTION_COND((value < 0), throw, "Tab memory budget cannot be negative. Got " << value << " bytes");
+	this->memoryBudget = value;
+}
+
+CONST_GETTER(app::main_window::tab::DiscardManager::getMaxLiveTabs, int &, this->maxLiveTabs)
+CONST_GETTER(app::main_window::tab::DiscardManager::getMemoryBudget, std::int64_t &, this->memoryBudget)
+CONST_GETTER(app::main_window::tab::DiscardManager::getDiscardedTabs, std::uint64_t &, this->discardedTabs)
@@ -13,7 +13,7 @@
 #include "app/windows/main_window/tabs/history.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowTabHistoryOverall, mainWindowTabHistory.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabHistoryOverall, mainWindowTabHistory.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::tab::History::History(QWidget * parent, std::weak_ptr<app::base::tab::Tab> browserTab, QWebEngineHistory * newHistory): app::base::tab::History(parent, browserTab, newHistory) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabHistoryOverall, "Main window tab history constructor");
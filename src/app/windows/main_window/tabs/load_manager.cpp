@@ -14,7 +14,7 @@
 #include "app/windows/main_window/tabs/load_manager.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowTabLoadManagerOverall, mainWindowTabLoadManager.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabLoadManagerOverall, mainWindowTabLoadManager.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::tab::LoadManager::LoadManager(QWidget * parent): app::base::tab::LoadManager(parent) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabLoadManagerOverall, "LoadManager constructor");
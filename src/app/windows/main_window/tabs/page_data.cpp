@@ -13,8 +13,8 @@
 #include "app/shared/exception.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowPageDataOverall, mainWindowPageData.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowPageDataPrint, mainWindowPageData.print, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowPageDataOverall, mainWindowPageData.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowPageDataPrint, mainWindowPageData.print, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -15,7 +15,7 @@
 #include "app/windows/main_window/tabs/scroll_manager.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowTabScrollManagerOverall, mainWindowTabScrollManager.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabScrollManagerOverall, mainWindowTabScrollManager.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::tab::ScrollManager::ScrollManager(QWidget * parent, std::weak_ptr<app::main_window::tab::Tab> browserTab, const std::shared_ptr<app::base::tab::TabBar> & tabBar): app::base::tab::ScrollManager(parent, browserTab, tabBar) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabScrollManagerOverall, "ScrollManager constructor");
@@ -6,6 +6,8 @@
  * @brief Main window tab search functions
  */
 
+#include <algorithm>
+
 // Qt libraries
 #include <QtGui/QKeyEvent>
 
@@ -19,10 +21,10 @@
 #include "app/shared/exception.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowTabSearchOverall, mainWindowTabSearch.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowTabSearchFind, mainWindowTabSearch.find, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabSearchOverall, mainWindowTabSearch.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabSearchFind, mainWindowTabSearch.find, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::main_window::tab::Search::Search(QWidget * parent, std::weak_ptr<app::main_window::tab::Tab> attachedTab): app::base::tab::Search(parent, attachedTab) {
+app::main_window::tab::Search::Search(QWidget * parent, std::weak_ptr<app::main_window::tab::Tab> attachedTab): app::base::tab::Search(parent, attachedTab), textIndexes(), webResults() {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabSearchOverall, "Main window tab search constructor");
 
 	this->connectSignals();
@@ -41,6 +43,11 @@ void app::main_window::tab::Search::connectSignals() {
 	std::shared_ptr<app::main_window::tab::Tab> currentTab = this->getTab();
 	std::shared_ptr<app::main_window::tab::WebEnginePage> currentTabPage = currentTab->getPage();
 	connect(currentTabPage.get(), &app::main_window::tab::WebEnginePage::findTextFinished, this, &app::main_window::tab::Search::postProcessSearch, Qt::UniqueConnection);
+
+	// Results of the web engine are no longer valid once the content of the page changes
+	connect(currentTabPage.get(), &app::main_window::tab::WebEnginePage::loadStarted, this, [this] () {
+		this->webResults.clear();
+	});
 	#endif // QT_VERSION
 
 }
@@ -53,11 +60,89 @@ void app::main_window::tab::Search::postProcessSearch(const QWebEngineFindTextRe
 	const QString text = this->settings.getText();
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabSearchFind, "Searching text " << text << " in the current tab - Match " << activeMatch << " out of " << numberOfMatches);
 
-	const app::main_window::tab::search_data_s & data { activeMatch, numberOfMatches };
+	const app::main_window::tab::search_data_s data { activeMatch, numberOfMatches };
+	this->webResults.insert(this->getQueryKey(), data);
+
 	emit searchResultChanged(data);
 }
 #endif // QT_VERSION
 
+void app::main_window::tab::Search::search() {
+	bool searchedByEngine = true;
+
+	if (this->canProcessRequests() == true) {
+		std::shared_ptr<app::main_window::tab::Tab> currentTab = this->getTab();
+		std::shared_ptr<app::main_window::tab::WebEnginePage> currentTabPage = currentTab->getPage();
+
+		if ((currentTabPage->getType() == app::main_window::page_type_e::TEXT) && (currentTabPage->getTextFile() != nullptr)) {
+			this->searchTextFile(currentTabPage);
+			searchedByEngine = false;
+		} else {
+			// Asking the web engine again for a text it could not find in the page is pointless
+			const QHash<QString, app::main_window::tab::search_data_s>::const_iterator result = this->webResults.constFind(this->getQueryKey());
+			if ((result != this->webResults.cend()) && (result.value().numberOfMatches == 0)) {
+				LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabSearchFind, "Text " << this->settings.getText() << " was not found in the current tab since it was last loaded");
+				emit this->searchResultChanged(result.value());
+				if (this->callback) {
+					this->callback(false);
+				}
+				searchedByEngine = false;
+			}
+		}
+	}
+
+	if (searchedByEngine == true) {
+		app::base::tab::Search::search();
+	}
+}
+
+void app::main_window::tab::Search::searchTextFile(const std::shared_ptr<app::main_window::tab::WebEnginePage> & page) {
+	const QString text = this->settings.getText();
+	const bool caseSensitive = this->settings.getCaseSensitive();
+	const bool matchFullWord = this->settings.getMatchFullWord();
+	const app::shared::offset_type_e direction = this->settings.getDirection();
+	const std::shared_ptr<app::utility::MappedFile> & textFile = page->getTextFile();
+
+	EXCEPTION_ACTION_COND(((direction != app::shared::offset_type_e::DOWN) && (direction != app::shared::offset_type_e::UP)), throw, "Unable to perform search with direction set to " << direction);
+
+	std::list<app::main_window::tab::TextMatchIndex>::iterator indexIt = std::find_if(this->textIndexes.begin(), this->textIndexes.end(), [&] (const app::main_window::tab::TextMatchIndex & index) {
+		return index.isQuery(textFile, text, caseSensitive, matchFullWord);
+	});
+
+	if (indexIt == this->textIndexes.end()) {
+		this->textIndexes.emplace_front(textFile, text, caseSensitive, matchFullWord);
+		if (this->textIndexes.size() > app::main_window::tab::Search::textIndexCapacity) {
+			this->textIndexes.pop_back();
+		}
+	} else {
+		// Move the index to the front of the list without rebuilding it
+		this->textIndexes.splice(this->textIndexes.begin(), this->textIndexes, indexIt);
+	}
+
+	app::main_window::tab::TextMatchIndex & index = this->textIndexes.front();
+	const int activeMatch = index.step(direction);
+	const int numberOfMatches = index.getNumberOfMatches();
+	const bool found = (activeMatch >= 0);
+
+	if (found == true) {
+		page->showTextMatch(index.getActiveOffset(), index.getMatchLength());
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabSearchFind, "Searching text " << text << " in the text file of the current tab - Match " << (activeMatch + 1) << " out of " << numberOfMatches);
+
+	// Matches are numbered starting from 1 as the web engine does
+	const app::main_window::tab::search_data_s data { (activeMatch + 1), numberOfMatches };
+	emit this->searchResultChanged(data);
+	if (this->callback) {
+		this->callback(found);
+	}
+}
+
+QString app::main_window::tab::Search::getQueryKey() const {
+	const QString caseFlag((this->settings.getCaseSensitive() == true) ? "1" : "0");
+	return caseFlag + ":" + this->settings.getText();
+}
+
 void app::main_window::tab::Search::setCallback() {
 
 	this->callback = [=] (bool found) {
@@ -6,14 +6,20 @@
  * @brief Main Window Tab functions
  */
 
+#include <algorithm>
+
 // Qt libraries
+#include <QtCore/QUrl>
+#include <QtCore/QDataStream>
 #include <QtCore/QLoggingCategory>
 #include <QtGui/QKeyEvent>
 
 #include "app/utility/logger/macros.h"
 #include "app/utility/cpp/cpp_operator.h"
+#include "app/shared/exception.h"
 #include "app/shared/setters_getters.h"
 #include "app/windows/main_window/tabs/tab.h"
+#include "app/windows/main_window/tabs/page_data.h"
 #include "app/windows/main_window/tabs/web_engine_view.h"
 #include "app/windows/main_window/tabs/web_engine_page.h"
 #include "app/windows/main_window/tabs/web_engine_settings.h"
@@ -24,15 +30,17 @@
 #include "app/widgets/commands/key_sequence.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowTabOverall, mainWindowTab.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowTabUserInput, mainWindowTab.userInput, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabOverall, mainWindowTab.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabUserInput, mainWindowTab.userInput, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::main_window::tab::Tab::Tab(QWidget * parent, const QString & search): app::base::tab::Tab(parent), searchText(search) {
+app::main_window::tab::Tab::Tab(QWidget * parent, const QString & search): app::base::tab::Tab(parent), searchText(search), bar(nullptr), placeholderData(nullptr), hibernatedHistory(), hibernatedScrollPosition(QPointF(0.0, 0.0)), hibernatedScrollPercentage(0), hibernatedFindSettings(nullptr), restoreScrollPosition(false), restoreScrollPercentage(false) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabOverall, "Tab constructor");
 
 }
 
 void app::main_window::tab::Tab::configure(const std::shared_ptr<app::base::tab::TabBar> & tabBar, const app::main_window::page_type_e & type, const QString & src, const void * data) {
+	this->bar = tabBar;
+
 	std::shared_ptr<app::main_window::tab::WebEngineView> tabView = std::make_shared<app::main_window::tab::WebEngineView>(this, this->weak_from_this(), type, src, data);
 	this->updateView(tabView);
 
@@ -48,6 +56,145 @@ void app::main_window::tab::Tab::configure(const std::shared_ptr<app::base::tab:
 	this->connectSignals();
 }
 
+void app::main_window::tab::Tab::configurePlaceholder(const std::shared_ptr<app::base::tab::TabBar> & tabBar, const app::main_window::page_type_e & type, const QString & src, const void * data) {
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabOverall, "Configure placeholder tab of type " << type << " with source " << src);
+	this->bar = tabBar;
+	this->setPlaceholderData(app::main_window::tab::PageData::makePageData(type, src.toStdString(), data));
+}
+
+bool app::main_window::tab::Tab::isPlaceholder() const {
+	return (this->placeholderData != nullptr);
+}
+
+void app::main_window::tab::Tab::materialize() {
+	if (this->isPlaceholder() == true) {
+		const std::shared_ptr<app::main_window::tab::PageData> pageData = this->placeholderData;
+		this->placeholderData.reset();
+
+		LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabOverall, "Materialize tab with data " << *(pageData.get()));
+
+		// Restore state of a hibernated tab
+		if ((pageData->getType() == app::main_window::page_type_e::WEB_CONTENT) && (this->hibernatedHistory.isEmpty() == false)) {
+			// The page is created empty as restoring the history loads its current item
+			this->configure(this->bar, app::main_window::page_type_e::UNKNOWN, QString(), nullptr);
+			this->getPage()->setData(pageData);
+
+			QDataStream historyStream(&this->hibernatedHistory, QIODevice::ReadOnly);
+			historyStream >> *(this->getView()->history());
+			this->hibernatedHistory.clear();
+
+			// The page data may have been changed while the tab was hibernated
+			const QUrl restoredUrl(this->getView()->history()->currentItem().url());
+			if (restoredUrl != QUrl(QString::fromStdString(pageData->getSource()), QUrl::TolerantMode)) {
+				this->getPage()->setBody();
+			}
+		} else {
+			this->configure(this->bar, pageData->getType(), QString::fromStdString(pageData->getSource()), pageData->getData());
+		}
+
+		if (this->hibernatedFindSettings != nullptr) {
+			this->getSearch()->setSettings(*(this->hibernatedFindSettings));
+			this->hibernatedFindSettings.reset();
+		}
+
+		// The view is created after the tab has been added to the tab widget therefore it must be explicitly shown and resized
+		this->getView()->show();
+		this->resize(this->size());
+	}
+}
+
+void app::main_window::tab::Tab::hibernate() {
+	if (this->isPlaceholder() == false) {
+		const std::shared_ptr<app::main_window::tab::WebEngineView> view = this->getView();
+		const std::shared_ptr<app::main_window::tab::PageData> & currentData = view->page()->getData();
+		const app::main_window::page_type_e type = currentData->getType();
+
+		LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabOverall, "Hibernate tab with data " << *(currentData.get()));
+
+		const std::string source(this->getCurrentSource().toStdString());
+		this->hibernatedHistory = this->getHistoryData();
+		std::shared_ptr<app::main_window::tab::PageData> pageData = app::main_window::tab::PageData::makePageData(type, source, currentData->getData());
+
+		// Keep the position of an earlier hibernation if the page has not finished loading since then
+		if ((this->restoreScrollPosition == false) && (this->restoreScrollPercentage == false)) {
+			this->hibernatedScrollPosition = this->getScrollManager()->getScrollPosition();
+			this->hibernatedScrollPercentage = this->getScrollManager()->getVerticalScrollPercentage();
+			this->restoreScrollPosition = true;
+		}
+		this->hibernatedFindSettings = std::make_unique<app::windows::shared::FindSettings>(this->getSearch()->getSettings());
+
+		this->releaseComponents();
+		this->setPlaceholderData(pageData);
+	}
+}
+
+int app::main_window::tab::Tab::getVerticalScrollPercentage() const {
+	if (this->isPlaceholder() == true) {
+		return this->hibernatedScrollPercentage;
+	}
+
+	return this->getScrollManager()->getVerticalScrollPercentage();
+}
+
+const QString app::main_window::tab::Tab::getCurrentSource() const {
+	if (this->isPlaceholder() == true) {
+		return QString::fromStdString(this->placeholderData->getSource());
+	}
+
+	// Web pages may have navigated away from the source they were opened with
+	if (this->getType() == app::main_window::page_type_e::WEB_CONTENT) {
+		const QUrl url(this->getView()->url());
+		if (url.isValid() == true) {
+			return url.toString();
+		}
+	}
+
+	return this->getSource();
+}
+
+QByteArray app::main_window::tab::Tab::getHistoryData() const {
+	if (this->isPlaceholder() == true) {
+		return this->hibernatedHistory;
+	}
+
+	QByteArray history;
+	if (this->getType() == app::main_window::page_type_e::WEB_CONTENT) {
+		QDataStream historyStream(&history, QIODevice::WriteOnly);
+		historyStream << *(this->getView()->history());
+	}
+
+	return history;
+}
+
+void app::main_window::tab::Tab::setRestoredState(const QByteArray & history, const int & verticalScrollPercentage) {
+	EXCEPTION_ACTION_COND((this->isPlaceholder() == false), throw, "Only the state of a placeholder tab can be restored");
+	this->hibernatedHistory = history;
+	this->hibernatedScrollPercentage = verticalScrollPercentage;
+	this->restoreScrollPosition = false;
+	this->restoreScrollPercentage = true;
+}
+
+const app::windows::shared::FindSettings app::main_window::tab::Tab::getFindSettings() const {
+	if (this->hibernatedFindSettings != nullptr) {
+		return *(this->hibernatedFindSettings);
+	} else if (this->isPlaceholder() == true) {
+		// No search has ever been carried out in a tab that has never been materialized
+		return app::windows::shared::FindSettings(QString(), app::shared::offset_type_e::IDLE, false, false);
+	}
+
+	return this->getSearch()->getSettings();
+}
+
+const std::shared_ptr<app::main_window::tab::PageData> app::main_window::tab::Tab::getPageData() const {
+	if (this->isPlaceholder() == true) {
+		return this->placeholderData;
+	}
+
+	return this->getPage()->getData();
+}
+
+CONST_SETTER(app::main_window::tab::Tab::setPlaceholderData, std::shared_ptr<app::main_window::tab::PageData> &, this->placeholderData)
+
 app::main_window::tab::Tab::~Tab() {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabOverall, "Tab destructor");
 
@@ -78,7 +225,6 @@ void app::main_window::tab::Tab::updateView(const std::shared_ptr<app::main_wind
 }
 
 CONST_SETTER_GETTER(app::main_window::tab::Tab::setSearchText, app::main_window::tab::Tab::getSearchText, QString &, this->searchText)
-BASE_GETTER(app::main_window::tab::Tab::getVerticalScrollPercentage, int, this->getScrollManager()->getVerticalScrollPercentage())
 CONST_CASTED_SHARED_PTR_GETTER(app::main_window::tab::Tab::getView, app::main_window::tab::WebEngineView, app::base::tab::Tab::getView())
 CONST_CASTED_SHARED_PTR_GETTER(app::main_window::tab::Tab::getLoadManager, app::main_window::tab::LoadManager, app::base::tab::Tab::getLoadManager())
 CONST_CASTED_SHARED_PTR_GETTER(app::main_window::tab::Tab::getSearch, app::main_window::tab::Search, app::base::tab::Tab::getSearch())
@@ -86,8 +232,21 @@ CONST_CASTED_SHARED_PTR_GETTER(app::main_window::tab::Tab::getHistory, app::main
 CONST_CASTED_SHARED_PTR_GETTER(app::main_window::tab::Tab::getSettings, app::main_window::tab::WebEngineSettings, app::base::tab::Tab::getSettings())
 CONST_CASTED_SHARED_PTR_GETTER(app::main_window::tab::Tab::getScrollManager, app::main_window::tab::ScrollManager, app::base::tab::Tab::getScrollManager())
 
-CONST_GETTER(app::main_window::tab::Tab::getType, app::main_window::page_type_e &, this->getPage()->getType())
-CONST_GETTER(app::main_window::tab::Tab::getSource, QString, this->getPage()->getSource())
+const app::main_window::page_type_e & app::main_window::tab::Tab::getType() const {
+	if (this->isPlaceholder() == true) {
+		return this->placeholderData->getType();
+	}
+
+	return this->getPage()->getType();
+}
+
+const QString app::main_window::tab::Tab::getSource() const {
+	if (this->isPlaceholder() == true) {
+		return QString::fromStdString(this->placeholderData->getSource());
+	}
+
+	return this->getPage()->getSource();
+}
 
 void app::main_window::tab::Tab::connectSignals() {
 	const std::shared_ptr<app::main_window::tab::WebEngineView> view = this->getView();
@@ -126,6 +285,10 @@ void app::main_window::tab::Tab::connectSignals() {
 		emit this->titleChanged(title);
 	});
 
+	connect(page.get(), &app::main_window::tab::WebEnginePage::backgroundTabRequested, [this] (const QUrl & url) {
+		emit this->backgroundTabRequested(url);
+	});
+
 }
 
 void app::main_window::tab::Tab::postprocessLoadFinished(const bool & success) {
@@ -137,10 +300,25 @@ void app::main_window::tab::Tab::postprocessLoadFinished(const bool & success) {
 
 	std::shared_ptr<app::main_window::tab::Search> tabSearch = this->getSearch();
 	tabSearch->emptyRequestQueue();
+
+	// Move back to the position the page was at when the tab was hibernated
+	if ((success == true) && (this->restoreScrollPosition == true)) {
+		this->restoreScrollPosition = false;
+		this->getPage()->applyScrollRequest(qRound(this->hibernatedScrollPosition.x()), qRound(this->hibernatedScrollPosition.y()));
+	} else if ((success == true) && (this->restoreScrollPercentage == true)) {
+		this->restoreScrollPercentage = false;
+		const std::shared_ptr<app::main_window::tab::WebEnginePage> page = this->getPage();
+		const qreal scrollableHeight = std::max(0.0, (page->contentsSize().height() - static_cast<qreal>(this->getView()->height())));
+		page->applyScrollRequest(0, qRound((scrollableHeight * static_cast<qreal>(this->hibernatedScrollPercentage)) / 100.0));
+	}
 }
 
 std::shared_ptr<app::main_window::tab::WebEnginePage> app::main_window::tab::Tab::getPage() const {
 	std::shared_ptr<app::main_window::tab::WebEngineView> view = this->getView();
+	// Placeholder tabs have no view
+	if (view == nullptr) {
+		return nullptr;
+	}
 	return view->page();
 }
 
@@ -6,26 +6,58 @@
  * @brief Main Window Tab Widget functions
  */
 
+// Qt libraries
+#include <QtCore/QSignalBlocker>
+
 #include "app/utility/logger/enums.h"
 #include "app/utility/logger/macros.h"
 #include "app/utility/cpp/cpp_operator.h"
 #include "app/shared/type_print_macros.h"
 #include "app/shared/exception.h"
+#include "app/shared/setters_getters.h"
 #include "app/windows/main_window/shared/constants.h"
 #include "app/windows/main_window/shared/shared_functions.h"
 #include "app/windows/main_window/tabs/web_engine_page.h"
 #include "app/windows/main_window/tabs/tab_widget.h"
 #include "app/windows/main_window/tabs/page_data.h"
 #include "app/windows/main_window/tabs/tab.h"
+#include "app/windows/main_window/tabs/discard_manager.h"
 #include "app/windows/shared/find_settings.h"
 #include "app/base/tabs/tab_bar.h"
+#include "app/settings/global.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowTabWidgetOverall, mainWindowTabWidget.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowTabWidgetTabs, mainWindowTabWidget.tabs, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabWidgetOverall, mainWindowTabWidget.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabWidgetTabs, mainWindowTabWidget.tabs, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::main_window::tab::TabWidget::TabWidget(QWidget * parent): app::base::tab::TabWidget(parent) {
+app::main_window::tab::TabWidget::TabWidget(QWidget * parent): app::base::tab::TabWidget(parent), lazyTabs(true), discardManager(std::make_unique<app::main_window::tab::DiscardManager>(0, 0)) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabWidgetOverall, "Main Window Tab widget constructor");
+
+	const app::command_line::argument_map_t & settingsMap = app::settings::Global::getInstance()->getSettingsMap();
+	const auto & lazyTabsArgument = settingsMap.find("Lazy Tabs");
+	if (lazyTabsArgument != settingsMap.cend()) {
+		const std::string & lazyTabsValue = lazyTabsArgument->second;
+		EXCEPTION_ACTION_COND((lazyTabsValue.empty() == true), throw, "Lazy tabs setting cannot be an empty string");
+		this->setLazyTabs(std::stoi(lazyTabsValue) != 0);
+	}
+
+	const auto & liveTabLimitArgument = settingsMap.find("Live Tab Limit");
+	if (liveTabLimitArgument != settingsMap.cend()) {
+		const std::string & liveTabLimit = liveTabLimitArgument->second;
+		EXCEPTION_ACTION_COND((liveTabLimit.empty() == true), throw, "Live tab limit cannot be an empty string");
+		this->discardManager->setMaxLiveTabs(std::stoi(liveTabLimit));
+	}
+
+	const auto & memoryBudgetArgument = settingsMap.find("Tab Memory Budget");
+	if (memoryBudgetArgument != settingsMap.cend()) {
+		const std::string & memoryBudget = memoryBudgetArgument->second;
+		EXCEPTION_ACTION_COND((memoryBudget.empty() == true), throw, "Tab memory budget cannot be an empty string");
+		// Budget is provided in MB
+		this->discardManager->setMemoryBudget(std::stoll(memoryBudget) * 1024 * 1024);
+	}
+
+	// This connection is done before any other one therefore a placeholder tab is materialized before other slots are notified that it became the current tab
+	connect(this, &app::main_window::tab::TabWidget::currentChanged, this, &app::main_window::tab::TabWidget::processCurrentChanged);
 }
 
 app::main_window::tab::TabWidget::~TabWidget() {
@@ -46,6 +78,7 @@ app::main_window::tab::TabWidget::~TabWidget() {
 
 void app::main_window::tab::TabWidget::removeTab(const int & index) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabWidgetTabs, "Close tab " << index);
+	this->discardManager->remove(this->widget(index, true));
 	this->disconnectTab(this->currentIndex());
 	app::base::tab::TabWidget::removeTab(index);
 	const int currIndex = this->currentIndex();
@@ -106,7 +139,7 @@ void app::main_window::tab::TabWidget::connectTab(const int & index) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabWidgetTabs, "Connecting to tab " << index << " out of " << tabCount);
 
 	if (tabCount > 0) {
-		std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
+		std::shared_ptr<app::main_window::tab::Tab> tab = this->materializeTab(index);
 		this->tabSourceConnection = connect(tab.get(), &app::main_window::tab::Tab::sourceChanged, this, &app::main_window::tab::TabWidget::processTabSourceChanged);
 		this->tabUrlConnection = connect(tab.get(), &app::main_window::tab::Tab::urlChanged, this, &app::main_window::tab::TabWidget::processTabUrlChanged);
 		this->tabTitleConnection = connect(tab.get(), &app::main_window::tab::Tab::titleChanged, this, &app::main_window::tab::TabWidget::processTabTitleChanged);
@@ -127,10 +160,25 @@ std::shared_ptr<app::main_window::tab::Tab> app::main_window::tab::TabWidget::wi
 	return requestedWidget;
 }
 
+std::shared_ptr<app::main_window::tab::Tab> app::main_window::tab::TabWidget::materializeTab(const int & index) {
+	std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
+	if (tab->isPlaceholder() == true) {
+		LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabWidgetTabs, "Materialize tab " << index);
+		tab->materialize();
+	}
+
+	return tab;
+}
+
 void app::main_window::tab::TabWidget::setPageData(const int & index, const std::shared_ptr<app::main_window::tab::PageData> & pageData) {
-	std::shared_ptr<app::main_window::tab::WebEnginePage> page = this->getPage(index);
-	if (page != nullptr) {
-		page->setData(pageData);
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
+	if (tab->isPlaceholder() == true) {
+		tab->setPlaceholderData(pageData);
+	} else {
+		std::shared_ptr<app::main_window::tab::WebEnginePage> page = tab->getPage();
+		if (page != nullptr) {
+			page->setData(pageData);
+		}
 	}
 }
 
@@ -156,40 +204,35 @@ const std::shared_ptr<app::main_window::tab::PageData> app::main_window::tab::Ta
 
 	EXCEPTION_ACTION_COND(((index < 0) || (index >= tabCount)), throw, "Unable to retrieve tab type as index must be larger or equal to 0 and smaller than the number of tabs " << tabCount << ". Got " << index << ".");
 
-	std::shared_ptr<app::main_window::tab::PageData> pageData = nullptr;
-	const std::shared_ptr<app::main_window::tab::WebEnginePage> page = this->getPage(index);
-
-	if (page != nullptr) {
-		pageData = page->getData();
-	}
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
 
-	return pageData;
+	return tab->getPageData();
 }
 
 app::main_window::page_type_e app::main_window::tab::TabWidget::getPageType(const int & index) const {
-	const std::shared_ptr<app::main_window::tab::WebEnginePage> page = this->getPage(index);
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
 
-	if (page != nullptr) {
-		return page->getType();
+	if ((tab->isPlaceholder() == true) || (tab->getPage() != nullptr)) {
+		return tab->getType();
 	}
 
 	return app::main_window::page_type_e::UNKNOWN;
 }
 
 const QString app::main_window::tab::TabWidget::getPageSource(const int & index) const {
-	const std::shared_ptr<app::main_window::tab::WebEnginePage> page = this->getPage(index);
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
 
-	if (page != nullptr) {
-		return page->getSource();
+	if ((tab->isPlaceholder() == true) || (tab->getPage() != nullptr)) {
+		return tab->getSource();
 	}
 	return QString();
 }
 
 const void * app::main_window::tab::TabWidget::getPageExtraData(const int & index) const {
-	const std::shared_ptr<app::main_window::tab::WebEnginePage> page = this->getPage(index);
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
 
-	if (page != nullptr) {
-		return page->getData().get();
+	if ((tab->isPlaceholder() == true) || (tab->getPage() != nullptr)) {
+		return tab->getPageData().get();
 	}
 	return nullptr;
 }
@@ -214,6 +257,7 @@ int app::main_window::tab::TabWidget::insertTab(const int & index, const app::ma
 	const QString search = QString();
 	std::shared_ptr<app::main_window::tab::Tab> tab = std::make_shared<app::main_window::tab::Tab>(this, search);
 	tab->configure(this->tabBar(), type, source, data);
+	connect(tab.get(), &app::main_window::tab::Tab::backgroundTabRequested, this, &app::main_window::tab::TabWidget::processBackgroundTabRequest);
 
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabWidgetTabs, "Insert tab of type " << type << " with source " << source << " at position " << index);
 
@@ -229,14 +273,14 @@ int app::main_window::tab::TabWidget::insertTab(const int & index, const app::ma
 }
 
 void app::main_window::tab::TabWidget::findInTab(const int & index, const app::windows::shared::FindSettings & settings) {
-	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->materializeTab(index);
 
 	// Find text in tab
 	tab->find(settings);
 }
 
 void app::main_window::tab::TabWidget::scrollTab(const int & index, const app::shared::offset_type_e & direction) {
-	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->materializeTab(index);
 	// Scroll tab
 	switch (direction) {
 		case app::shared::offset_type_e::UP:
@@ -258,7 +302,7 @@ void app::main_window::tab::TabWidget::scrollTab(const int & index, const app::s
 }
 
 void app::main_window::tab::TabWidget::goToHistoryItem(const int & index, const app::main_window::navigation_type_e & direction) {
-	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->materializeTab(index);
 	// Go through history in tab
 	switch (direction) {
 		case app::main_window::navigation_type_e::UNDEFINED:
@@ -342,14 +386,115 @@ void app::main_window::tab::TabWidget::changeTabContent(const int & index, const
 	// Update text searched by the user
 	tab->setSearchText(userInput);
 
-	std::shared_ptr<app::main_window::tab::WebEnginePage> page = tab->getPage();
-	// Set tab body
-	page->setBody();
+	if (tab->isPlaceholder() == true) {
+		// The new page data has replaced the one of the placeholder therefore it is loaded when the tab is materialized
+		this->materializeTab(index);
+	} else {
+		std::shared_ptr<app::main_window::tab::WebEnginePage> page = tab->getPage();
+		// Set tab body
+		page->setBody();
+	}
 
 	// Set focus to the tab in case it was lost or changed
 	tab->setFocus();
 }
 
+int app::main_window::tab::TabWidget::openTabInBackground(const app::main_window::page_type_e & type, const QString & userInput, const void * data) {
+
+	// The first tab always becomes the current one
+	if (this->count() == 0) {
+		const int index = this->addTab(type, data);
+		this->changeTabContent(index, type, userInput, data);
+		return index;
+	}
+
+	const QString source(this->createSource(type, userInput));
+	const QString label(this->createLabel(type, userInput));
+	std::shared_ptr<app::main_window::tab::Tab> tab = std::make_shared<app::main_window::tab::Tab>(this, userInput);
+	if (this->lazyTabs == true) {
+		tab->configurePlaceholder(this->tabBar(), type, source, data);
+	} else {
+		tab->configure(this->tabBar(), type, source, data);
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabWidgetTabs, "Insert background tab of type " << type << " with source " << source << " at position " << this->count());
+	const int tabIndex = this->insertBackgroundTab(tab, label);
+
+	emit this->numberTabsChanged(this->currentIndex());
+
+	return tabIndex;
+}
+
+int app::main_window::tab::TabWidget::restoreTab(const app::main_window::page_type_e & type, const QString & source, const QByteArray & history, const int & verticalScrollPercentage) {
+	std::shared_ptr<app::main_window::tab::Tab> tab = std::make_shared<app::main_window::tab::Tab>(this, source);
+	tab->configurePlaceholder(this->tabBar(), type, source, nullptr);
+	tab->setRestoredState(history, verticalScrollPercentage);
+
+	const QString label(this->createLabel(type, source));
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabWidgetTabs, "Restore tab of type " << type << " with source " << source << " at position " << this->count());
+
+	return this->insertBackgroundTab(tab, label);
+}
+
+int app::main_window::tab::TabWidget::insertBackgroundTab(const std::shared_ptr<app::main_window::tab::Tab> & tab, const QString & label) {
+	connect(tab.get(), &app::main_window::tab::Tab::backgroundTabRequested, this, &app::main_window::tab::TabWidget::processBackgroundTabRequest);
+
+	const int index = this->count();
+	int tabIndex = -1;
+	{
+		// Inserting the first tab makes it the current one: signals are blocked in order not to materialize it as it may not be the tab the user moves to
+		const QSignalBlocker blocker(this);
+		tabIndex = app::base::tab::TabWidget::insertTab(index, tab, label, QIcon());
+	}
+
+	// Background tabs are tracked from the time they are opened
+	this->discardManager->activate(tab);
+	this->discardManager->enforceBudget(this->widget(this->currentIndex(), true));
+
+	return tabIndex;
+}
+
+void app::main_window::tab::TabWidget::restoreCurrentTab(const int & index) {
+	const int tabCount = this->count();
+	EXCEPTION_ACTION_COND(((index < 0) || (index >= tabCount)), throw, "Unable to restore current tab as index must be larger or equal to 0 and smaller than the number of tabs " << tabCount << ". Got " << index << ".");
+
+	// Tabs restored from a session may be appended to tabs that were already open
+	this->disconnectTab(this->currentIndex());
+
+	{
+		const QSignalBlocker blocker(this);
+		this->setCurrentIndex(index);
+	}
+
+	// Only the current tab is materialized and connected
+	this->connectTab(index);
+	const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
+	this->discardManager->activate(tab);
+
+	emit this->numberTabsChanged(index);
+}
+
+CONST_SETTER_GETTER(app::main_window::tab::TabWidget::setLazyTabs, app::main_window::tab::TabWidget::isLazyTabs, bool &, this->lazyTabs)
+CONST_GETTER(app::main_window::tab::TabWidget::getDiscardManager, std::unique_ptr<app::main_window::tab::DiscardManager> &, this->discardManager)
+
+void app::main_window::tab::TabWidget::processCurrentChanged(const int & index) {
+	if (index >= 0) {
+		const std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, false);
+		// When a tab is removed, this slot is called before the tab is removed from the list of tabs therefore the tab at the given index may not be the current one
+		// In such a scenario, the current tab is materialized when it is connected
+		if ((tab != nullptr) && (tab.get() == this->currentWidget())) {
+			this->materializeTab(index);
+			this->discardManager->activate(tab);
+			this->discardManager->enforceBudget(tab);
+		}
+	}
+}
+
+void app::main_window::tab::TabWidget::processBackgroundTabRequest(const QUrl & url) {
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTabWidgetTabs, "Open link " << url.toString() << " in a background tab");
+	this->openTabInBackground(app::main_window::page_type_e::WEB_CONTENT, url.toString());
+}
+
 void app::main_window::tab::TabWidget::processTabUrlChanged(const QUrl & url) {
 	const int idx = this->currentIndex();
 	const app::main_window::page_type_e type = this->getPageType(idx);
@@ -385,7 +530,7 @@ void app::main_window::tab::TabWidget::processFindTextFinished(const bool & foun
 }
 
 void app::main_window::tab::TabWidget::reloadTabContent(const int & index) {
-	std::shared_ptr<app::main_window::tab::Tab> tab = this->widget(index, true);
+	std::shared_ptr<app::main_window::tab::Tab> tab = this->materializeTab(index);
 	tab->reload();
 }
 
@@ -0,0 +1,210 @@
+/**
+ * @copyright
+ * @file text_match_index.cpp
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Main Window Text Match Index functions
+ */
+
+#include <cstring>
+#include <algorithm>
+
+#include "app/shared/exception.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/tabs/text_match_index.h"
+
+// Categories
+LOGGING_CONTEXT(textMatchIndexOverall, textMatchIndex.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace app {
+
+	namespace main_window {
+
+		namespace tab {
+
+			namespace text_match_index {
+
+				namespace {
+
+					/**
+					 * @brief Function: char toLowerAscii(const char & byte)
+					 *
+					 * \param byte: byte to convert
+					 *
+					 * \return the lower case of an ASCII letter or the byte itself otherwise
+					 *
+					 * This function converts ASCII letters to lower case regardless of the locale
+					 */
+					inline char toLowerAscii(const char & byte) {
+						return ((byte >= 'A') && (byte <= 'Z')) ? static_cast<char>(byte - 'A' + 'a') : byte;
+					}
+
+					/**
+					 * @brief Function: char toUpperAscii(const char & byte)
+					 *
+					 * \param byte: byte to convert
+					 *
+					 * \return the upper case of an ASCII letter or the byte itself otherwise
+					 *
+					 * This function converts ASCII letters to upper case regardless of the locale
+					 */
+					inline char toUpperAscii(const char & byte) {
+						return ((byte >= 'a') && (byte <= 'z')) ? static_cast<char>(byte - 'a' + 'A') : byte;
+					}
+
+					/**
+					 * @brief Function: bool isWordByte(const char & byte)
+					 *
+					 * \param byte: byte to check
+					 *
+					 * \return true if the byte can be part of a word, false otherwise
+					 *
+					 * This function checks whether a byte is a letter, a digit or an underscore
+					 * Bytes of multi-byte UTF-8 characters are considered part of a word
+					 */
+					inline bool isWordByte(const char & byte) {
+						const unsigned char value = static_cast<unsigned char>(byte);
+						return (((value >= 'a') && (value <= 'z')) || ((value >= 'A') && (value <= 'Z')) || ((value >= '0') && (value <= '9')) || (value == '_') || (value >= 0x80));
+					}
+
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+app::main_window::tab::TextMatchIndex::TextMatchIndex(const std::shared_ptr<app::utility::MappedFile> & textFile, const QString & searchedText, const bool & caseSensitiveSearch, const bool & fullWordSearch) : file(textFile), text(searchedText), caseSensitive(caseSensitiveSearch), matchFullWord(fullWordSearch), matchLength(0), offsets(), activeMatch(-1) {
+	EXCEPTION_ACTION_COND((textFile == nullptr), throw, "Unable to search text " << searchedText << " as no file is provided");
+
+	const std::string pattern(this->text.toUtf8().toStdString());
+	this->matchLength = pattern.size();
+	this->offsets = app::main_window::tab::TextMatchIndex::findMatches(textFile->view(), pattern, this->caseSensitive, this->matchFullWord);
+
+	LOG_INFO(app::logger::info_level_e::ZERO, textMatchIndexOverall, "Found " << this->offsets.size() << " matches of text " << this->text << " in file " << textFile->getFilename() << " - case sensitive " << this->caseSensitive << " match full word " << this->matchFullWord);
+}
+
+app::main_window::tab::TextMatchIndex::~TextMatchIndex() {
+	LOG_INFO(app::logger::info_level_e::ZERO, textMatchIndexOverall, "Text match index destructor");
+}
+
+std::vector<std::size_t> app::main_window::tab::TextMatchIndex::findMatches(const std::string_view & content, const std::string & pattern, const bool & caseSensitive, const bool & matchFullWord) {
+	std::vector<std::size_t> matches;
+
+	const std::size_t length = pattern.size();
+	const std::size_t size = content.size();
+	if ((length == 0) || (length > size)) {
+		return matches;
+	}
+
+	const char * data = content.data();
+	// Offset following the last one a match can start at
+	const std::size_t candidateEnd = size - length + 1;
+
+	std::string foldedPattern(pattern);
+	if (caseSensitive == false) {
+		std::transform(foldedPattern.begin(), foldedPattern.end(), foldedPattern.begin(), app::main_window::tab::text_match_index::toLowerAscii);
+	}
+
+	// Look for the first byte of the pattern in both cases if letters can be matched regardless of their case
+	const char lowerFirst = foldedPattern.front();
+	const char upperFirst = app::main_window::tab::text_match_index::toUpperAscii(lowerFirst);
+	const bool searchUpperFirst = ((caseSensitive == false) && (upperFirst != lowerFirst));
+
+	auto locate = [&] (const char & byte, const std::size_t & from) -> std::size_t {
+		const void * found = std::memchr(data + from, byte, (candidateEnd - from));
+		return (found == nullptr) ? std::string::npos : static_cast<std::size_t>(static_cast<const char *>(found) - data);
+	};
+
+	auto isMatch = [&] (const std::size_t & offset) -> bool {
+		bool equal = false;
+		if (caseSensitive == true) {
+			equal = (std::memcmp(data + offset + 1, foldedPattern.data() + 1, length - 1) == 0);
+		} else {
+			equal = std::equal(foldedPattern.cbegin() + 1, foldedPattern.cend(), data + offset + 1, [] (const char & patternByte, const char & contentByte) {
+				return (patternByte == app::main_window::tab::text_match_index::toLowerAscii(contentByte));
+			});
+		}
+
+		if ((equal == true) && (matchFullWord == true)) {
+			const bool wordStart = (offset == 0) || (app::main_window::tab::text_match_index::isWordByte(data[offset - 1]) == false);
+			const bool wordEnd = ((offset + length) == size) || (app::main_window::tab::text_match_index::isWordByte(data[offset + length]) == false);
+			equal = ((wordStart == true) && (wordEnd == true));
+		}
+
+		return equal;
+	};
+
+	// Positions of the next occurrence of the first byte of the pattern in each case are kept in order not to scan the content more than once
+	std::size_t nextLower = locate(lowerFirst, 0);
+	std::size_t nextUpper = (searchUpperFirst == true) ? locate(upperFirst, 0) : std::string::npos;
+	std::size_t position = 0;
+
+	while (position < candidateEnd) {
+		if ((nextLower != std::string::npos) && (nextLower < position)) {
+			nextLower = locate(lowerFirst, position);
+		}
+		if ((nextUpper != std::string::npos) && (nextUpper < position)) {
+			nextUpper = locate(upperFirst, position);
+		}
+
+		const std::size_t candidate = std::min(nextLower, nextUpper);
+		if (candidate == std::string::npos) {
+			break;
+		}
+
+		if (isMatch(candidate) == true) {
+			matches.push_back(candidate);
+			position = candidate + length;
+		} else {
+			position = candidate + 1;
+		}
+	}
+
+	return matches;
+}
+
+bool app::main_window::tab::TextMatchIndex::isQuery(const std::shared_ptr<app::utility::MappedFile> & textFile, const QString & searchedText, const bool & caseSensitiveSearch, const bool & fullWordSearch) const {
+	const bool sameFile = ((textFile != nullptr) && (this->file.lock() == textFile));
+	return ((sameFile == true) && (this->caseSensitive == caseSensitiveSearch) && (this->matchFullWord == fullWordSearch) && (this->text.compare(searchedText, Qt::CaseSensitive) == 0));
+}
+
+int app::main_window::tab::TextMatchIndex::step(const app::shared::offset_type_e & direction) {
+	const int numberOfMatches = this->getNumberOfMatches();
+
+	if (numberOfMatches == 0) {
+		this->activeMatch = -1;
+	} else if (direction == app::shared::offset_type_e::DOWN) {
+		this->activeMatch = ((this->activeMatch < 0) || (this->activeMatch >= (numberOfMatches - 1))) ? 0 : (this->activeMatch + 1);
+	} else if (direction == app::shared::offset_type_e::UP) {
+		this->activeMatch = (this->activeMatch <= 0) ? (numberOfMatches - 1) : (this->activeMatch - 1);
+	} else {
+		EXCEPTION_ACTION(throw, "Unable to move to a match with direction set to " << direction);
+	}
+
+	return this->activeMatch;
+}
+
+int app::main_window::tab::TextMatchIndex::getActiveMatch() const {
+	return this->activeMatch;
+}
+
+int app::main_window::tab::TextMatchIndex::getNumberOfMatches() const {
+	return static_cast<int>(this->offsets.size());
+}
+
+std::size_t app::main_window::tab::TextMatchIndex::getActiveOffset() const {
+	EXCEPTION_ACTION_COND((this->activeMatch < 0), throw, "No match of text " << this->text << " is active");
+	return this->offsets.at(static_cast<std::size_t>(this->activeMatch));
+}
+
+std::size_t app::main_window::tab::TextMatchIndex::getMatchLength() const {
+	return this->matchLength;
+}
+
+const std::vector<std::size_t> & app::main_window::tab::TextMatchIndex::getOffsets() const {
+	return this->offsets;
+}
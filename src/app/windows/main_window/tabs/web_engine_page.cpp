@@ -6,22 +6,96 @@
  * @brief Web engine page functions
  */
 
+#include <algorithm>
+
 // Qt libraries
 #include <QtGui/QKeyEvent>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtWidgets/QWidget>
 
 #include "app/utility/cpp/cpp_operator.h"
 #include "app/utility/logger/macros.h"
 #include "app/shared/setters_getters.h"
-#include "app/shared/cpp_functions.h"
+#include "app/shared/exception.h"
 #include "app/windows/main_window/tabs/web_engine_page.h"
 #include "app/windows/main_window/tabs/page_data.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowWebEnginePageOverall, mainWindowWebEnginePage.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowWebEnginePageOverall, mainWindowWebEnginePage.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowWebEnginePageText, mainWindowWebEnginePage.text, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace app {
+
+	namespace main_window {
+
+		namespace tab {
+
+			namespace {
+				/**
+				 * @brief size in bytes of the largest text file that is printed in the page at once
+				 *
+				 */
+				static const std::size_t plainTextMaximumSize = 1024 * 1024;
+
+				/**
+				 * @brief size in bytes of the portion of a large text file rendered in the page
+				 *
+				 */
+				static const std::size_t textWindowSize = 256 * 1024;
+
+				/**
+				 * @brief height in pixels of a line of a large text file
+				 * Lines have a fixed height in order to map the scroll position to an offset in the file
+				 *
+				 */
+				static const int textLineHeight = 16;
+
+				/**
+				 * @brief distance in pixels between the viewport and the edge of the rendered portion of a large text file below which a new portion is rendered
+				 *
+				 */
+				static const int textWindowMargin = 4096;
+
+				/**
+				 * @brief maximum height in pixels of the page showing a large text file
+				 *
+				 */
+				static const int textMaximumPageHeight = 8000000;
+
+				/**
+				 * @brief page showing a large text file
+				 * %1 is the height of the page, %2 is the position of the rendered portion of the file and %3 is its content
+				 *
+				 */
+				static const QString textWindowHtml("<!DOCTYPE html><html><head><meta charset=\"utf-8\"><style>body { margin: 0; } #spacer { position: relative; width: 100%; height: %1px; } #window { position: absolute; left: 0; top: %2px; margin: 0; font-family: monospace; font-size: 13px; line-height: 16px; white-space: pre; }</style></head><body><div id=\"spacer\"><pre id=\"window\">%3</pre></div></body></html>");
+
+				/**
+				 * @brief script moving the portion of a large text file rendered in the page
+				 * %1 is the height of the page, %2 is the position of the rendered portion of the file and %3 is a JSON array whose only element is its content
+				 *
+				 */
+				static const QString textWindowScript("(function() { var spacer = document.getElementById('spacer'); var textWindow = document.getElementById('window'); if ((spacer !== null) && (textWindow !== null)) { spacer.style.height = '%1px'; textWindow.style.top = '%2px'; textWindow.textContent = %3[0]; } })();");
+
+				/**
+				 * @brief script selecting a match in a text file and scrolling it into view
+				 * %1 and %2 are the offsets in UTF-16 code units of the beginning and the end of the match in the text shown in the page
+				 *
+				 */
+				static const QString textMatchScript("(function() { var root = document.getElementById('window'); if (root === null) { root = document.body; } if (root === null) { return; } var walker = document.createTreeWalker(root, NodeFilter.SHOW_TEXT); var range = document.createRange(); var start = %1; var end = %2; var position = 0; var startSet = false; var node = walker.nextNode(); while (node !== null) { var length = node.textContent.length; if ((startSet === false) && (start <= (position + length))) { range.setStart(node, start - position); startSet = true; } if ((startSet === true) && (end <= (position + length))) { range.setEnd(node, end - position); var selection = window.getSelection(); selection.removeAllRanges(); selection.addRange(range); var rectangle = range.getBoundingClientRect(); window.scrollTo(window.scrollX, Math.max(0, window.scrollY + rectangle.top - (window.innerHeight / 2))); return; } position += length; node = walker.nextNode(); } })();");
+			}
+
+		}
+
+	}
 
-app::main_window::tab::WebEnginePage::WebEnginePage(QWidget * parent, const app::main_window::page_type_e & type, const QString & src, app::main_window::tab::WebEngineProfile * profile, const void * data): app::base::tab::WebEnginePage(parent, profile), pageData(app::main_window::tab::PageData::makePageData(type, src.toStdString(), data)) {
+}
+
+app::main_window::tab::WebEnginePage::WebEnginePage(QWidget * parent, const app::main_window::page_type_e & type, const QString & src, app::base::tab::WebEngineProfile * profile, const void * data): app::base::tab::WebEnginePage(parent, profile), pageData(app::main_window::tab::PageData::makePageData(type, src.toStdString(), data)), textFile(nullptr), textWindow({0, 0, 0, 0, 0}), scrollRequestCount(0) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowWebEnginePageOverall, "Web engine page constructor");
 
+	connect(this, &app::main_window::tab::WebEnginePage::scrollPositionChanged, this, &app::main_window::tab::WebEnginePage::updateTextWindow);
+
 	this->setBody();
 	if (src != QString()) {
 		emit this->sourceChanged(src);
@@ -41,6 +115,9 @@ void app::main_window::tab::WebEnginePage::setBody() {
 
 	app::main_window::page_type_e type = this->getType();
 
+	// Release the file previously shown in the page
+	this->textFile.reset();
+
 	switch (type) {
 		case app::main_window::page_type_e::WEB_CONTENT:
 		{
@@ -51,7 +128,7 @@ void app::main_window::tab::WebEnginePage::setBody() {
 			break;
 		}
 		case app::main_window::page_type_e::TEXT:
-			this->setContent(this->getTextFileBody());
+			this->setTextFileBody();
 			break;
 		case app::main_window::page_type_e::UNKNOWN:
 			break;
@@ -69,6 +146,8 @@ CONST_GETTER(app::main_window::tab::WebEnginePage::getType, app::main_window::pa
 CONST_GETTER(app::main_window::tab::WebEnginePage::getSource, QString, QString::fromStdString(this->pageData->source))
 CONST_PTR_GETTER(app::main_window::tab::WebEnginePage::getExtraData, void, this->pageData->data)
 CONST_GETTER(app::main_window::tab::WebEnginePage::getData, std::shared_ptr<app::main_window::tab::PageData> &, this->pageData)
+CONST_GETTER(app::main_window::tab::WebEnginePage::getScrollRequestCount, std::uint64_t &, this->scrollRequestCount)
+CONST_GETTER(app::main_window::tab::WebEnginePage::getTextFile, std::shared_ptr<app::utility::MappedFile> &, this->textFile)
 
 void app::main_window::tab::WebEnginePage::reload() {
 	const app::main_window::page_type_e type = this->getType();
@@ -77,7 +156,8 @@ void app::main_window::tab::WebEnginePage::reload() {
 			this->triggerAction(QWebEnginePage::Reload);
 			break;
 		case app::main_window::page_type_e::TEXT:
-			this->setContent(this->getTextFileBody());
+			// Map the file again as its content may have changed
+			this->setTextFileBody();
 			break;
 		default:
 			EXCEPTION_ACTION(throw, "Unable to reload page as type " << type << " is not recognised");
@@ -85,22 +165,167 @@ void app::main_window::tab::WebEnginePage::reload() {
 	}
 }
 
-QByteArray app::main_window::tab::WebEnginePage::getTextFileBody() const {
+QWebEnginePage * app::main_window::tab::WebEnginePage::createWindow(QWebEnginePage::WebWindowType type) {
+	if (type == QWebEnginePage::WebBrowserBackgroundTab) {
+		// The page only receives the URL of the link: the background tab is opened by the tab widget
+		QWebEnginePage * requestPage = new QWebEnginePage(this->profile(), this);
+		connect(requestPage, &QWebEnginePage::urlChanged, this, [this, requestPage] (const QUrl & url) {
+			if (url.isEmpty() == false) {
+				disconnect(requestPage, &QWebEnginePage::urlChanged, this, nullptr);
+				LOG_INFO(app::logger::info_level_e::ZERO, mainWindowWebEnginePageOverall, "Request to open " << url.toString() << " in a background tab");
+				emit this->backgroundTabRequested(url);
+				requestPage->deleteLater();
+			}
+		});
+		return requestPage;
+	}
+
+	return app::base::tab::WebEnginePage::createWindow(type);
+}
+
+void app::main_window::tab::WebEnginePage::setTextFileBody() {
 
-	QByteArray pageContent(nullptr, -1);
+	this->textFile.reset();
+	this->textWindow = {0, 0, 0, 0, 0};
 
 	const QString source = this->getSource();
 
-	if (source.isEmpty() == false) {
+	if (source.isEmpty() == true) {
+		this->setContent(QByteArray(), "text/plain;charset=UTF-8");
+	} else {
 		app::main_window::page_type_e type = this->getType();
 		EXCEPTION_ACTION_COND((type != app::main_window::page_type_e::TEXT), throw, "Unable to get body of text file for tab of type " << type);
-		// Convert QString to std::string
-		std::string filename = source.toStdString();
-		const QString fileContent(QString::fromStdString(app::shared::readFile(filename.c_str())));
-		pageContent = fileContent.toUtf8();
+
+		this->textFile = std::make_shared<app::utility::MappedFile>(source.toStdString());
+
+		if (this->isTextWindowed() == true) {
+			this->moveTextWindow(0, 0);
+
+			// Estimate the height of the page from the average length of the lines in the first window
+			const std::size_t windowLines = static_cast<std::size_t>(std::max(1, (this->textWindow.bottom - this->textWindow.top) / app::main_window::tab::textLineHeight));
+			const std::size_t averageLineLength = std::max(static_cast<std::size_t>(1), (this->textWindow.end - this->textWindow.begin) / windowLines);
+			const std::size_t estimatedLines = this->textFile->size() / averageLineLength;
+			const std::size_t maximumLines = static_cast<std::size_t>(app::main_window::tab::textMaximumPageHeight / app::main_window::tab::textLineHeight);
+			this->textWindow.pageHeight = std::max(this->textWindow.bottom, static_cast<int>(std::min(estimatedLines, maximumLines)) * app::main_window::tab::textLineHeight);
+
+			LOG_INFO(app::logger::info_level_e::ZERO, mainWindowWebEnginePageText, "File " << source << " of " << this->textFile->size() << " bytes is rendered in windows of " << app::main_window::tab::textWindowSize << " bytes. Estimated page height " << this->textWindow.pageHeight << " pixels");
+
+			const QString html(app::main_window::tab::textWindowHtml.arg(QString::number(this->textWindow.pageHeight), QString::number(this->textWindow.top), this->getTextWindowContent().toHtmlEscaped()));
+			this->setContent(html.toUtf8(), "text/html;charset=UTF-8");
+		} else {
+			this->setContent(QByteArray(this->textFile->data(), static_cast<int>(this->textFile->size())), "text/plain;charset=UTF-8");
+		}
+	}
+}
+
+bool app::main_window::tab::WebEnginePage::isTextWindowed() const {
+	return ((this->textFile != nullptr) && (this->textFile->size() > app::main_window::tab::plainTextMaximumSize));
+}
+
+void app::main_window::tab::WebEnginePage::moveTextWindow(const std::size_t & offset, const int & position) {
+	const char * content = this->textFile->data();
+	const std::size_t size = this->textFile->size();
+	const std::size_t halfWindow = app::main_window::tab::textWindowSize / 2;
+
+	// Windows are aligned to lines but very long lines are cut in order to keep the amount of data pushed into the page bounded
+	const std::size_t target = std::min(offset, size);
+	const std::size_t lineStart = std::max(this->textFile->findLineStart(target), ((target > halfWindow) ? (target - halfWindow) : 0));
+	const std::size_t lowestBegin = (lineStart > app::main_window::tab::textWindowSize) ? (lineStart - app::main_window::tab::textWindowSize) : 0;
+	const std::size_t highestEnd = std::min(size, lineStart + app::main_window::tab::textWindowSize);
+
+	this->textWindow.begin = std::max(lowestBegin, this->textFile->findLineStart((lineStart > halfWindow) ? (lineStart - halfWindow) : 0));
+	this->textWindow.end = std::min(highestEnd, this->textFile->findLineEnd(std::min(size, lineStart + halfWindow)));
+
+	const int linesBefore = static_cast<int>(std::count(content + this->textWindow.begin, content + lineStart, '\n'));
+	int windowLines = static_cast<int>(std::count(content + this->textWindow.begin, content + this->textWindow.end, '\n'));
+	if ((this->textWindow.end > this->textWindow.begin) && (content[this->textWindow.end - 1] != '\n')) {
+		windowLines++;
+	}
+
+	// Keep the line at the offset provided as argument at the requested position
+	this->textWindow.top = (this->textWindow.begin == 0) ? 0 : std::max(0, position - linesBefore * app::main_window::tab::textLineHeight);
+	this->textWindow.bottom = this->textWindow.top + windowLines * app::main_window::tab::textLineHeight;
+
+	if (this->textWindow.end == size) {
+		this->textWindow.pageHeight = this->textWindow.bottom;
+	} else {
+		this->textWindow.pageHeight = std::max(this->textWindow.pageHeight, this->textWindow.bottom);
+	}
+}
+
+QString app::main_window::tab::WebEnginePage::getTextWindowContent() const {
+	return QString::fromUtf8(this->textFile->data() + this->textWindow.begin, static_cast<int>(this->textWindow.end - this->textWindow.begin));
+}
+
+void app::main_window::tab::WebEnginePage::updateTextWindow(const QPointF & position) {
+	if (this->isTextWindowed() == false) {
+		return;
+	}
+
+	const int y = qRound(position.y());
+	const int viewportHeight = (this->view() == nullptr) ? 0 : this->view()->height();
+	const int margin = std::min(app::main_window::tab::textWindowMargin, (this->textWindow.bottom - this->textWindow.top) / 4);
+
+	const bool topCovered = (this->textWindow.begin == 0) || (y >= (this->textWindow.top + margin));
+	const bool bottomCovered = (this->textWindow.end == this->textFile->size()) || ((y + viewportHeight) <= (this->textWindow.bottom - margin));
+	if ((topCovered == true) && (bottomCovered == true)) {
+		return;
+	}
+
+	std::size_t offset = 0;
+	if ((y >= this->textWindow.top) && (y < this->textWindow.bottom)) {
+		// The viewport is still within the window: walk its lines in order to scroll smoothly
+		int linesToSkip = (y - this->textWindow.top) / app::main_window::tab::textLineHeight;
+		offset = this->textWindow.begin;
+		while ((linesToSkip > 0) && (offset < this->textWindow.end)) {
+			offset = this->textFile->findLineEnd(offset);
+			linesToSkip--;
+		}
+	} else {
+		// The viewport jumped away from the window: map the scroll position to an offset in the file
+		const int scrollableHeight = std::max(1, this->textWindow.pageHeight - viewportHeight);
+		const double fraction = std::clamp(static_cast<double>(y) / static_cast<double>(scrollableHeight), 0.0, 1.0);
+		offset = static_cast<std::size_t>(fraction * static_cast<double>(this->textFile->size()));
+	}
+
+	this->moveTextWindow(offset, y);
+
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowWebEnginePageText, "Rendering bytes " << this->textWindow.begin << " to " << this->textWindow.end << " of file " << this->textFile->getFilename() << " at vertical position " << this->textWindow.top);
+
+	const QJsonArray windowContent({this->getTextWindowContent()});
+	const QString windowContentStr(QString::fromUtf8(QJsonDocument(windowContent).toJson(QJsonDocument::Compact)));
+	this->runJavaScript(app::main_window::tab::textWindowScript.arg(QString::number(this->textWindow.pageHeight), QString::number(this->textWindow.top), windowContentStr));
+}
+
+void app::main_window::tab::WebEnginePage::showTextMatch(const std::size_t & offset, const std::size_t & length) {
+	EXCEPTION_ACTION_COND((this->textFile == nullptr), throw, "Unable to show a match in page " << this->getSource() << " as it has no text file");
+	const std::size_t size = this->textFile->size();
+	EXCEPTION_ACTION_COND(((offset + length) > size), throw, "Match at offset " << offset << " of length " << length << " is beyond the end of file " << this->textFile->getFilename() << " of " << size << " bytes");
+
+	std::size_t textBegin = 0;
+	if (this->isTextWindowed() == true) {
+		const bool rendered = ((offset >= this->textWindow.begin) && ((offset + length) <= this->textWindow.end));
+		if (rendered == false) {
+			// Place the match where the viewport would be if the page was scrolled to it
+			const int viewportHeight = (this->view() == nullptr) ? 0 : this->view()->height();
+			const int scrollableHeight = std::max(1, this->textWindow.pageHeight - viewportHeight);
+			const double fraction = static_cast<double>(offset) / static_cast<double>(std::max(static_cast<std::size_t>(1), size));
+			this->moveTextWindow(offset, static_cast<int>(fraction * static_cast<double>(scrollableHeight)));
+
+			LOG_INFO(app::logger::info_level_e::ZERO, mainWindowWebEnginePageText, "Rendering bytes " << this->textWindow.begin << " to " << this->textWindow.end << " of file " << this->textFile->getFilename() << " in order to show the match at offset " << offset);
+
+			const QJsonArray windowContent({this->getTextWindowContent()});
+			const QString windowContentStr(QString::fromUtf8(QJsonDocument(windowContent).toJson(QJsonDocument::Compact)));
+			this->runJavaScript(app::main_window::tab::textWindowScript.arg(QString::number(this->textWindow.pageHeight), QString::number(this->textWindow.top), windowContentStr));
+		}
+		textBegin = this->textWindow.begin;
 	}
 
-	return pageContent;
+	// The page holds the text as UTF-16 therefore offsets in bytes must be converted
+	const char * content = this->textFile->data();
+	const int matchStart = QString::fromUtf8(content + textBegin, static_cast<int>(offset - textBegin)).size();
+	const int matchEnd = matchStart + QString::fromUtf8(content + offset, static_cast<int>(length)).size();
+	this->runJavaScript(app::main_window::tab::textMatchScript.arg(QString::number(matchStart), QString::number(matchEnd)));
 }
 
 void app::main_window::tab::WebEnginePage::setData(const std::shared_ptr<app::main_window::tab::PageData> & newData) {
@@ -109,6 +334,7 @@ void app::main_window::tab::WebEnginePage::setData(const std::shared_ptr<app::ma
 }
 
 void app::main_window::tab::WebEnginePage::applyScrollRequest(const int & x, const int & y) {
+	this->scrollRequestCount++;
 	// Quite annoying work-around as QT C++ API doesn't allow the user to set the scroll position of a web page direction
 	this->runJavaScript(QString("window.scrollTo(%1, %2)").arg(x).arg(y));
 }
@@ -14,17 +14,11 @@
 #include "app/windows/main_window/tabs/web_engine_profile.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowWebEngineProfileOverall, mainWindowWebEngineProfile.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowWebEngineProfileOverall, mainWindowWebEngineProfile.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::main_window::tab::WebEngineProfile * app::main_window::tab::WebEngineProfile::defaultProfile() {
-	try {
-		static app::main_window::tab::WebEngineProfile * profile = dynamic_cast<app::main_window::tab::WebEngineProfile *>(app::base::tab::WebEngineProfile::defaultProfile());
-		return profile;
-	} catch (const std::bad_cast & badCastE) {
-		EXCEPTION_ACTION(throw, badCastE.what());
-	}
-
-	return Q_NULLPTR;
+app::base::tab::WebEngineProfile * app::main_window::tab::WebEngineProfile::defaultProfile() {
+	// Pages of the main window share the profile of all other pages in order not to open the same storage twice
+	return app::base::tab::WebEngineProfile::defaultProfile();
 }
 
 app::main_window::tab::WebEngineProfile::WebEngineProfile(const QString & storageName, QObject * parent): app::base::tab::WebEngineProfile(storageName, parent) {
@@ -13,7 +13,7 @@
 #include "app/windows/main_window/tabs/web_engine_settings.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowWebEngineSettingsOverall, mainWindowWebEngineSettings.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowWebEngineSettingsOverall, mainWindowWebEngineSettings.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::tab::WebEngineSettings::WebEngineSettings(QWebEngineSettings * newSettings): app::base::tab::WebEngineSettings(newSettings) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowWebEngineSettingsOverall, "Web engine settings constructor");
@@ -23,18 +23,15 @@
 #include "app/windows/main_window/tabs/web_engine_page.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowWebEngineViewOverall, mainWindowWebEngineView.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowWebEngineViewMenu, mainWindowWebEngineView.menu, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowWebEngineViewOverall, mainWindowWebEngineView.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowWebEngineViewMenu, mainWindowWebEngineView.menu, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::main_window::tab::WebEngineView::WebEngineView(QWidget * parent, std::weak_ptr<app::main_window::tab::Tab> attachedTab, const app::main_window::page_type_e & type, const QString & src, const void * data): app::base::tab::WebEngineView(parent, attachedTab) {
+// Use deleteLater to schedule a destruction event in the event loop
+app::main_window::tab::WebEngineView::WebEngineView(QWidget * parent, std::weak_ptr<app::main_window::tab::Tab> attachedTab, const app::main_window::page_type_e & type, const QString & src, const void * data): app::base::tab::WebEngineView(parent, attachedTab, std::shared_ptr<app::main_window::tab::WebEnginePage>(new app::main_window::tab::WebEnginePage(parent, type, src, app::main_window::tab::WebEngineProfile::defaultProfile(), data), [] (app::main_window::tab::WebEnginePage * p) {
+	p->deleteLater();
+})) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowWebEngineViewOverall, "Web engine view constructor");
 
-	// Use deleteLater to schedule a destruction event in the event loop
-	std::shared_ptr<app::main_window::tab::WebEnginePage> newPage = std::shared_ptr<app::main_window::tab::WebEnginePage>(new app::main_window::tab::WebEnginePage(parent, type, src, app::main_window::tab::WebEngineProfile::defaultProfile(), data), [] (app::main_window::tab::WebEnginePage * p) {
-		p->deleteLater();
-	});
-	this->updatePage(newPage);
-
 	this->connectSignals();
 }
 
@@ -11,7 +11,7 @@
 #include "app/windows/main_window/window/base.h"
 #include "app/utility/logger/macros.h"
 
-LOGGING_CONTEXT(mainWindowBaseOverall, mainWindowBase.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowBaseOverall, mainWindowBase.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::window::Base::Base(const std::shared_ptr<app::main_window::window::Core> & windowCore) : core(windowCore) {
 
@@ -6,20 +6,54 @@
  * @brief Main window commands functions
  */
 
+#include <chrono>
+
 #include "app/utility/cpp/cpp_operator.h"
+#include "app/utility/cpp/stl_helper.h"
+#include "app/utility/qt/qt_operator.h"
+#include "app/shared/exception.h"
+#include "app/settings/global.h"
 #include "app/windows/main_window/window/commands.h"
 
-LOGGING_CONTEXT(mainWindowCommandsOverall, mainWindowCommands.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCommandsOverall, mainWindowCommands.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace app {
+
+	namespace main_window {
+
+		namespace window {
+
+			namespace {
+				/**
+				 * @brief Minimum number of edits tolerated between a mistyped command and the suggested one
+				 *
+				 */
+				static constexpr int minimumSuggestionDistance = 2;
+
+				/**
+				 * @brief Ratio between the length of a mistyped command and the maximum number of edits tolerated to suggest a command
+				 *
+				 */
+				static constexpr int suggestionDistanceRatio = 3;
+			}
+
+		}
+
+	}
+
+}
 
 app::main_window::window::Commands::Commands() : app::main_window::window::Commands(std::string()) {
 
 }
 
-app::main_window::window::Commands::Commands(const std::list<std::string> jsonFiles) : app::main_window::json::Action(jsonFiles) {
+app::main_window::window::Commands::Commands(const std::list<std::string> jsonFiles) : app::main_window::json::Action(jsonFiles), shortcutTrie(), shortcutCommands() {
+	this->buildShortcutTrie();
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCommandsOverall, "Creating main window commands with " << this->getActionJsonFilesAsString());
 }
 
-app::main_window::window::Commands::Commands(const std::string jsonFile) : app::main_window::json::Action(jsonFile) {
+app::main_window::window::Commands::Commands(const std::string jsonFile) : app::main_window::json::Action(jsonFile), shortcutTrie(), shortcutCommands() {
+	this->buildShortcutTrie();
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCommandsOverall, "Creating main window commands with " << this->getActionJsonFilesAsString());
 }
 
@@ -29,12 +63,82 @@ app::main_window::window::Commands::~Commands() {
 
 void app::main_window::window::Commands::appendActionData(const std::list<std::string> & jsonFiles) {
 	app::main_window::json::Action::appendActionData(jsonFiles);
+	this->buildShortcutTrie();
 }
 
 void app::main_window::window::Commands::appendActionData(const std::string & filename) {
 	app::main_window::json::Action::appendActionData(filename);
+	this->buildShortcutTrie();
 }
 
 void app::main_window::window::Commands::clear() {
 	app::main_window::json::Action::clear();
+	this->shortcutTrie.clear();
+	this->shortcutCommands.clear();
+}
+
+void app::main_window::window::Commands::buildShortcutTrie() {
+	this->shortcutTrie.clear();
+	this->shortcutCommands.clear();
+
+	const app::command_line::argument_map_t & settingsMap = app::settings::Global::getInstance()->getSettingsMap();
+	const auto & chordTimeoutArgument = settingsMap.find("Chord Timeout");
+	if (chordTimeoutArgument != settingsMap.cend()) {
+		const std::string & chordTimeout = chordTimeoutArgument->second;
+		EXCEPTION_ACTION_COND((chordTimeout.empty() == true), throw, "Chord timeout cannot be an empty string");
+		this->shortcutTrie.setTimeout(std::chrono::milliseconds(std::stoi(chordTimeout)));
+	}
+
+	const app::main_window::window::Commands::action_data_t & commands = this->getActions();
+
+	for (const auto & data : commands) {
+		const std::unique_ptr<app::main_window::json::Data> & commandData = data.second;
+		const app::commands::KeySequence shortcut(commandData->getShortcut());
+		// Only the command returned by a search by shortcut is bound in order to keep the first command in case multiple commands share the same shortcut
+		if ((shortcut.isEmpty() == false) && (this->findByShortcut(commandData->getShortcut()).get() == commandData.get())) {
+			if (this->shortcutTrie.hasConflict(shortcut) == true) {
+				LOG_WARNING(mainWindowCommandsOverall, "Shortcut " << shortcut.toString() << " of command " << commandData->getName() << " is not bound because it begins with the shortcut of another command or the shortcut of another command begins with it");
+			} else {
+				this->shortcutTrie.addBinding(shortcut, static_cast<int>(this->shortcutCommands.size()));
+				this->shortcutCommands.push_back(commandData.get());
+			}
+		}
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCommandsOverall, "Built trie of " << this->shortcutTrie.getBindingCount() << " shortcuts");
+}
+
+QString app::main_window::window::Commands::findClosestCommand(const QString & name) const {
+	const std::string userCommand(name.toStdString());
+	const std::size_t maximumDistance = static_cast<std::size_t>(std::max(app::main_window::window::minimumSuggestionDistance, (name.size() / app::main_window::window::suggestionDistanceRatio)));
+
+	std::string closestCommand = std::string();
+	std::size_t closestDistance = maximumDistance + 1;
+
+	const app::main_window::window::Commands::action_data_t & commands = this->getActions();
+	for (app::main_window::window::Commands::action_data_t::const_iterator commandIt = commands.cbegin(); commandIt != commands.cend(); commandIt++) {
+		const std::string & longCmd = commandIt->second->getLongCmd();
+		if (longCmd.empty() == false) {
+			const std::size_t distance = app::utility::editDistance(userCommand, longCmd);
+			// Break ties alphabetically in order to make the suggestion independent from the ordering of the commands
+			if ((distance < closestDistance) || ((distance == closestDistance) && (closestCommand.empty() == false) && (longCmd.compare(closestCommand) < 0))) {
+				closestDistance = distance;
+				closestCommand = longCmd;
+			}
+		}
+	}
+
+	return QString::fromStdString(closestCommand);
+}
+
+app::commands::KeyTrie & app::main_window::window::Commands::getShortcutTrie() {
+	return this->shortcutTrie;
+}
+
+const app::main_window::json::Data * app::main_window::window::Commands::getShortcutCommand(const int & value) const {
+	const app::main_window::json::Data * command = nullptr;
+	if ((value >= 0) && (static_cast<std::size_t>(value) < this->shortcutCommands.size())) {
+		command = this->shortcutCommands.at(static_cast<std::size_t>(value));
+	}
+	return command;
 }
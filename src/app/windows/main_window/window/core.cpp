@@ -6,10 +6,13 @@
  * @brief Main Window core functions
  */
 
+#include <chrono>
 #include <iostream>
 
 #include "app/widgets/command_menu/command_menu.h"
+#include "app/widgets/command_menu/command_menu_model.h"
 #include "app/utility/cpp/cpp_operator.h"
+#include "app/utility/profiler/startup_profiler.h"
 #include "app/shared/exception.h"
 #include "app/shared/qt_functions.h"
 #include "app/shared/setters_getters.h"
@@ -19,10 +22,12 @@
 #include "app/windows/main_window/menu/menu_bar.h"
 #include "app/windows/main_window/tabs/tab_widget.h"
 #include "app/windows/main_window/statusbar/bar.h"
+#include "app/windows/main_window/session/store.h"
+#include "app/settings/global.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowCoreOverall, mainWindowCore.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowCoreUserInput, mainWindowCore.userInput, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCoreOverall, mainWindowCore.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCoreUserInput, mainWindowCore.userInput, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -63,6 +68,20 @@ namespace app {
 					 */
 					static const std::string tabCommandFileFullPath(commandFileDirectory + tabCommandFileName);
 
+					/**
+					 * @brief Function: app::main_window::window::Commands * loadCommands()
+					 *
+					 * \return the commands of the window
+					 *
+					 * This function parses the JSON files storing informations about commands and shortcuts and records the time it takes during the startup
+					 */
+					app::main_window::window::Commands * loadCommands() {
+						app::utility::StartupProfiler::getInstance()->startPhase("JSON load");
+						app::main_window::window::Commands * commands = new app::main_window::window::Commands({tabCommandFileFullPath, globalCommandFileFullPath});
+						app::utility::StartupProfiler::getInstance()->endPhase("JSON load");
+						return commands;
+					}
+
 				}
 
 			}
@@ -73,12 +92,24 @@ namespace app {
 
 }
 
-app::main_window::window::Core::Core(QWidget * parent) : mainWidget(new QWidget(parent)), tabs(new app::main_window::tab::TabWidget(parent)), topMenuBar(new app::main_window::menu::MenuBar(parent)), popup(new app::main_window::popup::PopupContainer(parent)), bottomStatusBar(new app::main_window::statusbar::Bar(parent)), cmdMenu(new app::command_menu::CommandMenu(parent)), commands(new app::main_window::window::Commands({app::main_window::window::core::tabCommandFileFullPath, app::main_window::window::core::globalCommandFileFullPath})), mainWindowState(app::main_window::state_e::IDLE), offsetType(app::shared::offset_type_e::IDLE), userText(QString()) {
+app::main_window::window::Core::Core(QWidget * parent, const QString & sessionFile) : mainWidget(new QWidget(parent)), tabs(new app::main_window::tab::TabWidget(parent)), topMenuBar(new app::main_window::menu::MenuBar(parent)), popup(new app::main_window::popup::PopupContainer(parent)), bottomStatusBar(new app::main_window::statusbar::Bar(parent)), cmdMenu(new app::command_menu::CommandMenu(parent)), commands(app::main_window::window::core::loadCommands()), session(nullptr), mainWindowState(app::main_window::state_e::IDLE), offsetType(app::shared::offset_type_e::IDLE), userText(QString()) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCoreOverall, "Main window core constructor");
 	this->topMenuBar->createMenus();
+	this->cmdMenu->getMenuModel()->setActions(*(this->commands));
+
+	const app::command_line::argument_map_t & settingsMap = app::settings::Global::getInstance()->getSettingsMap();
+	int saveDelay = 0;
+	const auto & saveDelayArgument = settingsMap.find("Session Save Delay");
+	if (saveDelayArgument != settingsMap.cend()) {
+		const std::string & saveDelayValue = saveDelayArgument->second;
+		EXCEPTION_ACTION_COND((saveDelayValue.empty() == true), throw, "Session save delay cannot be an empty string");
+		saveDelay = std::stoi(saveDelayValue);
+	}
+
+	this->session = std::make_unique<app::main_window::session::Store>(this->tabs.get(), sessionFile, std::chrono::milliseconds(saveDelay));
 }
 
-app::main_window::window::Core::Core(app::main_window::window::Core && rhs) :  mainWidget(std::exchange(rhs.mainWidget, Q_NULLPTR)), tabs(std::exchange(rhs.tabs, Q_NULLPTR)), topMenuBar(std::exchange(rhs.topMenuBar, Q_NULLPTR)), popup(std::exchange(rhs.popup, Q_NULLPTR)), bottomStatusBar(std::exchange(rhs.bottomStatusBar, Q_NULLPTR)), cmdMenu(std::exchange(rhs.cmdMenu, Q_NULLPTR)), commands(std::exchange(rhs.commands, Q_NULLPTR)), mainWindowState(std::exchange(rhs.mainWindowState, app::main_window::state_e::IDLE)), offsetType(std::exchange(rhs.offsetType, app::shared::offset_type_e::IDLE)), userText(std::exchange(rhs.userText, QString())) {
+app::main_window::window::Core::Core(app::main_window::window::Core && rhs) :  mainWidget(std::exchange(rhs.mainWidget, Q_NULLPTR)), tabs(std::exchange(rhs.tabs, Q_NULLPTR)), topMenuBar(std::exchange(rhs.topMenuBar, Q_NULLPTR)), popup(std::exchange(rhs.popup, Q_NULLPTR)), bottomStatusBar(std::exchange(rhs.bottomStatusBar, Q_NULLPTR)), cmdMenu(std::exchange(rhs.cmdMenu, Q_NULLPTR)), commands(std::exchange(rhs.commands, Q_NULLPTR)), session(std::exchange(rhs.session, Q_NULLPTR)), mainWindowState(std::exchange(rhs.mainWindowState, app::main_window::state_e::IDLE)), offsetType(std::exchange(rhs.offsetType, app::shared::offset_type_e::IDLE)), userText(std::exchange(rhs.userText, QString())) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCoreOverall, "Move constructor main window core");
 }
 
@@ -108,6 +139,9 @@ app::main_window::window::Core & app::main_window::window::Core::operator=(app::
 		this->commands = std::move(rhs.commands);
 		rhs.commands.reset();
 
+		this->session = std::move(rhs.session);
+		rhs.session.reset();
+
 		this->mainWindowState = std::exchange(rhs.mainWindowState, app::main_window::state_e::IDLE);
 		this->offsetType = std::exchange(rhs.offsetType, app::shared::offset_type_e::IDLE);
 		this->userText = std::exchange(rhs.userText, QString());
@@ -120,6 +154,8 @@ app::main_window::window::Core::~Core() {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCoreOverall, "Main window core destructor");
 
 	// Reset pointers
+	// The session is written before the tabs are destroyed
+	this->session.reset();
 	this->commands.reset();
 	this->cmdMenu.reset();
 	this->bottomStatusBar.reset();
@@ -156,6 +192,11 @@ void app::main_window::window::Core::printUserInput(const app::main_window::text
 
 	this->bottomStatusBar->setUserInputText(textLabel);
 
+	if (windowState == app::main_window::state_e::COMMAND) {
+		// Only the command name is matched against the commands listed in the command menu
+		this->cmdMenu->getMenuModel()->setFilter(this->getUserText().section(QChar(' '), 0, 0));
+	}
+
 }
 
 const QString app::main_window::window::Core::getActionName() const {
@@ -21,9 +21,9 @@
 #include "app/windows/main_window/json/action.h"
 #include "app/widgets/commands/key_sequence.h"
 
-LOGGING_CONTEXT(mainWindowCtrlBaseOverall, mainWindowCtrlBase.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowCtrlBaseCheck, mainWindowCtrlBase.check, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowCtrlBaseUserInput, mainWindowCtrlBase.userInput, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCtrlBaseOverall, mainWindowCtrlBase.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCtrlBaseCheck, mainWindowCtrlBase.check, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCtrlBaseUserInput, mainWindowCtrlBase.userInput, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::main_window::window::CtrlBase::CtrlBase(QWidget * parent, const std::shared_ptr<app::main_window::window::Core> & core) : QWidget(parent), app::main_window::window::Base(core) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlBaseOverall, "Main window control base classe constructor");
@@ -33,23 +33,40 @@ app::main_window::window::CtrlBase::~CtrlBase() {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlBaseOverall, "Main window control base class destructor");
 }
 
+const app::main_window::json::Data * app::main_window::window::CtrlBase::findCommand(const QString & userCommand, QString & arguments) const {
+	const QString trimmedCommand(userCommand.trimmed());
+
+	// Arguments are separated from the command by the first space
+	const int argumentStart = trimmedCommand.indexOf(QChar(' '));
+	const QString commandName((argumentStart < 0) ? trimmedCommand : trimmedCommand.left(argumentStart));
+	arguments = (argumentStart < 0) ? QString() : trimmedCommand.mid(argumentStart + 1).trimmed();
+
+	const std::unique_ptr<app::main_window::json::Data> & commandData = this->core->commands->findByLongCmd(commandName.toStdString());
+
+	if (commandData == nullptr) {
+		const QString suggestion(this->core->commands->findClosestCommand(commandName));
+		if (suggestion.isEmpty() == true) {
+			LOG_WARNING(mainWindowCtrlBaseOverall, "Unknown command " << commandName);
+		} else {
+			LOG_WARNING(mainWindowCtrlBaseOverall, "Unknown command " << commandName << ". Did you mean " << suggestion << "?");
+		}
+	} else {
+		LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlBaseOverall, "Found command " << commandData->getLongCmd() << " with arguments \"" << arguments << "\" matching user input: " << userCommand);
+	}
+
+	return commandData.get();
+}
+
 void app::main_window::window::CtrlBase::executeCommand(const QString & userCommand, const app::main_window::state_postprocessing_e & postprocess) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlBaseOverall, "Looking for command matching user input: " << userCommand);
 
 	const app::main_window::state_e previousWindowState = this->core->getMainWindowState();
 
-	const app::main_window::window::Commands::action_data_t & commands = this->core->commands->getActions();
-
-	std::for_each(commands.cbegin(), commands.cend(), [&] (const auto & data) {
-		const std::unique_ptr<app::main_window::json::Data> & commandData = data.second;
-		const QString refCommand = QString::fromStdString(commandData->getLongCmd());
-
-		// If user command matches the command in the JSON file
-		if (userCommand.compare(refCommand) == 0) {
-			LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlBaseOverall, "Found command " << refCommand << " matching user input: " << userCommand);
-			emit windowStateChangeRequested(commandData->getState(), postprocess);
-		}
-	});
+	QString arguments;
+	const app::main_window::json::Data * commandData = this->findCommand(userCommand, arguments);
+	if (commandData != nullptr) {
+		emit windowStateChangeRequested(commandData->getState(), postprocess, Qt::Key_unknown, arguments);
+	}
 
 	const app::main_window::state_e currentWindowState = this->core->getMainWindowState();
 
@@ -171,7 +188,7 @@ void app::main_window::window::CtrlBase::keyPressEvent(QKeyEvent * event) {
 void app::main_window::window::CtrlBase::moveToCommandStateFromNonIdleState(const app::main_window::state_e & windowState, const Qt::Key & key) {
 	// Saving long command for a given state to set it after changing state
 	const app::main_window::state_e requestedWindowState = app::main_window::state_e::COMMAND;
-	const std::unique_ptr<app::main_window::json::Data> & data = this->core->commands->findDataWithFieldValue("State", &windowState);
+	const std::unique_ptr<app::main_window::json::Data> & data = this->core->commands->findByState(windowState);
 	if (data != this->core->commands->getInvalidData()) {
 		QString longCmd(QString::fromStdString(data->getLongCmd()));
 		emit windowStateChangeRequested(requestedWindowState, app::main_window::state_postprocessing_e::POSTPROCESS, key);
@@ -6,9 +6,11 @@
  * @brief Main Window Control Wrapper functions
  */
 
+#include <chrono>
+
 // Qt libraries
 #include <QtGui/QKeyEvent>
-#include <QtWidgets/QShortcut>
+#include <QtWidgets/QApplication>
 
 #include "app/utility/logger/enums.h"
 #include "app/utility/logger/macros.h"
@@ -18,19 +20,26 @@
 #include "app/windows/main_window/window/ctrl.h"
 #include "app/windows/main_window/window/ctrl_tab.h"
 #include "app/windows/main_window/statusbar/bar.h"
+#include "app/windows/main_window/menu/menu_bar.h"
+#include "app/windows/main_window/menu/file_menu.h"
+#include "app/windows/main_window/menu/edit_menu.h"
 #include "app/windows/main_window/tabs/tab.h"
 #include "app/windows/main_window/tabs/tab_widget.h"
 #include "app/widgets/commands/key_sequence.h"
+#include "app/widgets/commands/key_trie.h"
 #include "app/shared/exception.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowCtrlWrapperOverall, mainWindowCtrlWrapper.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowCtrlWrapperUserInput, mainWindowCtrlWrapper.userInput, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCtrlWrapperOverall, mainWindowCtrlWrapper.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCtrlWrapperUserInput, mainWindowCtrlWrapper.userInput, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::main_window::window::CtrlWrapper::CtrlWrapper(QWidget * parent, const std::shared_ptr<app::main_window::window::Core> & core) : QWidget(parent), app::main_window::window::Base(core), winctrl(new app::main_window::window::Ctrl(this, core)), tabctrl(new app::main_window::window::CtrlTab(this, core)), savedData({app::main_window::state_e::IDLE, QString()}) {
+app::main_window::window::CtrlWrapper::CtrlWrapper(QWidget * parent, const std::shared_ptr<app::main_window::window::Core> & core) : QWidget(parent), app::main_window::window::Base(core), winctrl(new app::main_window::window::Ctrl(this, core)), tabctrl(new app::main_window::window::CtrlTab(this, core)), savedData({app::main_window::state_e::IDLE, QString()}), shortcutsEnabled(true) {
 	// Connect signals and slots
 	this->connectSignals();
 
+	// Shortcuts are typed while any widget of the window has the focus therefore the filter follows the focus widget
+	connect(qApp, &QApplication::focusChanged, this, &app::main_window::window::CtrlWrapper::followFocus);
+
 }
 
 app::main_window::window::CtrlWrapper::~CtrlWrapper() {
@@ -44,7 +53,7 @@ void app::main_window::window::CtrlWrapper::keyPressEvent(QKeyEvent * event) {
 	this->winctrl->keyPressEvent(event);
 	this->tabctrl->keyPressEvent(event);
 
-	this->core->mainWidget->repaint();
+	this->core->mainWidget->update();
 
 }
 
@@ -67,22 +76,6 @@ void app::main_window::window::CtrlWrapper::connectSignals() {
 		this->setAllShortcutEnabledProperty(false);
 	});
 
-	const app::main_window::window::Commands::action_data_t & commands = this->core->commands->getActions();
-
-	std::for_each(commands.cbegin(), commands.cend(), [&] (const auto & data) {
-		const std::unique_ptr<app::main_window::json::Data> & commandData = data.second;
-		QShortcut * shortcut = new QShortcut(commandData->getShortcut(), this->window());
-		LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlWrapperOverall, "Connecting shortcut for key " << (commandData->getShortcut()) << " to trigger a change of controller state to " << commandData->getState());
-		QMetaObject::Connection connection = connect(shortcut, &QShortcut::activated,
-			[&] () {
-				this->changeWindowStateWrapper(commandData, app::main_window::state_postprocessing_e::POSTPROCESS);
-			}
-		);
-
-		EXCEPTION_ACTION_COND((static_cast<bool>(connection) == false), throw, "Unable to connect shortcut for key " << (commandData->getShortcut()) << " to trigger a change of controller state to " << commandData->getState());
-
-	});
-
 }
 
 void app::main_window::window::CtrlWrapper::saveData() {
@@ -118,6 +111,10 @@ void app::main_window::window::CtrlWrapper::restoreSavedData() {
 
 CONST_GETTER(app::main_window::window::CtrlWrapper::getSavedData, app::main_window::window::ctrl_data_s &, this->savedData)
 
+const app::main_window::json::Data * app::main_window::window::CtrlWrapper::findCommand(const QString & userCommand, QString & arguments) const {
+	return this->winctrl->findCommand(userCommand, arguments);
+}
+
 bool app::main_window::window::CtrlWrapper::isValidWindowState(const app::main_window::state_e & requestedWindowState) {
 	bool isValid = false;
 	const app::main_window::state_e windowState = this->core->getMainWindowState();
@@ -166,12 +163,12 @@ bool app::main_window::window::CtrlWrapper::isValidWindowState(const app::main_w
 	return isValid;
 }
 
-void app::main_window::window::CtrlWrapper::changeWindowStateWrapper(const std::unique_ptr<app::main_window::json::Data> & commandData, const app::main_window::state_postprocessing_e & postprocess) {
+void app::main_window::window::CtrlWrapper::changeWindowStateWrapper(const app::main_window::json::Data * commandData, const app::main_window::state_postprocessing_e & postprocess) {
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlWrapperOverall, "Command " << commandData->getName() << " (shortcut: " << commandData->getShortcut() << " long command: " << commandData->getLongCmd() << ") - moving to state " << commandData->getState());
 	this->changeWindowState(commandData->getState(), postprocess);
 }
 
-void app::main_window::window::CtrlWrapper::changeWindowState(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key) {
+void app::main_window::window::CtrlWrapper::changeWindowState(const app::main_window::state_e & nextState, const app::main_window::state_postprocessing_e postprocess, const Qt::Key key, const QString & argument) {
 
 	const app::main_window::state_e windowState = this->core->getMainWindowState();
 	const QString & userTypedText = this->core->getUserText();
@@ -188,6 +185,9 @@ void app::main_window::window::CtrlWrapper::changeWindowState(const app::main_wi
 			this->core->setMainWindowState(nextState);
 
 			this->core->printUserInput(app::main_window::text_action_e::CLEAR);
+			if (argument.isEmpty() == false) {
+				this->core->printUserInput(app::main_window::text_action_e::SET, argument);
+			}
 
 			if (postprocess == app::main_window::state_postprocessing_e::SETUP) {
 				this->setupWindowState(windowState);
@@ -326,15 +326,80 @@ void app::main_window::window::CtrlWrapper::postprocessWindowStateChange(const a
 }
 
 void app::main_window::window::CtrlWrapper::setAllShortcutEnabledProperty(const bool enabled) {
-	const QList<QShortcut *> shortcuts = this->window()->findChildren<QShortcut *>(QString(), Qt::FindChildrenRecursively);
-
-	for (QShortcut * shortcut : shortcuts) {
-		app::commands::KeySequence key(shortcut->key());
-		// If shortcut key is not defined, then do not do anything
-		if (key.count() > 0) {
-			LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlWrapperUserInput, "Setting enabled for key " << key.toString() << " to " << enabled);
-			shortcut->setEnabled(enabled);
+	if (this->shortcutsEnabled != enabled) {
+		LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlWrapperUserInput, "Setting enabled property of " << this->core->commands->getShortcutTrie().getBindingCount() << " shortcuts to " << enabled);
+
+		// Discard keys of a shortcut typed before the window changed state
+		this->core->commands->getShortcutTrie().reset();
+
+		const std::shared_ptr<app::main_window::menu::MenuBar> & menuBar = this->core->topMenuBar;
+		if (menuBar != nullptr) {
+			if (menuBar->getFileMenu() != nullptr) {
+				menuBar->getFileMenu()->setEnabledProperty(enabled);
+			}
+			if (menuBar->getEditMenu() != nullptr) {
+				menuBar->getEditMenu()->setEnabledProperty(enabled);
+			}
 		}
+
+		this->shortcutsEnabled = enabled;
+	}
+}
+
+CONST_GETTER(app::main_window::window::CtrlWrapper::getShortcutEnabledProperty, bool &, this->shortcutsEnabled)
+
+bool app::main_window::window::CtrlWrapper::eventFilter(QObject * watched, QEvent * event) {
+	bool filtered = false;
+
+	// Key events propagated to the parents of the focus widget are not fed again to the trie
+	QWidget * receiver = QApplication::focusWidget();
+	if (receiver == nullptr) {
+		receiver = this->window();
+	}
+
+	if ((this->shortcutsEnabled == true) && (event->type() == QEvent::KeyPress) && (watched == receiver) && (receiver->window() == this->window())) {
+		QKeyEvent * keyEvent = static_cast<QKeyEvent *>(event);
+		const int key = keyEvent->key();
+		// Modifiers are not shortcuts on their own and they must not discard the keys of a shortcut typed so far
+		const bool isModifier = ((key == Qt::Key_Shift) || (key == Qt::Key_Control) || (key == Qt::Key_Alt) || (key == Qt::Key_AltGr) || (key == Qt::Key_Meta) || (key == Qt::Key_CapsLock) || (key == Qt::Key_unknown));
+		if (isModifier == false) {
+			app::commands::KeyTrie & trie = this->core->commands->getShortcutTrie();
+			const std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+			const int modifiers = static_cast<int>(keyEvent->modifiers() & ~Qt::KeypadModifier);
+			int shortcutKey = key | modifiers;
+			// Symbols like the colon are typed with the shift modifier but their shortcuts do not have it
+			if ((trie.isExpected(shortcutKey, time) == false) && ((modifiers & Qt::ShiftModifier) != 0)) {
+				shortcutKey = key | (modifiers & ~Qt::ShiftModifier);
+			}
+
+			const QKeySequence::SequenceMatch match = trie.feed(shortcutKey, time);
+			if (match == QKeySequence::ExactMatch) {
+				const app::main_window::json::Data * commandData = this->core->commands->getShortcutCommand(trie.getMatchedValue());
+				EXCEPTION_ACTION_COND((commandData == nullptr), throw, "Unable to find command bound to value " << trie.getMatchedValue() << " of the shortcut trie");
+				LOG_INFO(app::logger::info_level_e::ZERO, mainWindowCtrlWrapperUserInput, "Shortcut " << app::commands::KeySequence(shortcutKey).toString() << " matches command " << commandData->getName());
+				this->changeWindowStateWrapper(commandData, app::main_window::state_postprocessing_e::POSTPROCESS);
+				filtered = true;
+			} else if (match == QKeySequence::PartialMatch) {
+				filtered = true;
+			}
+		}
+	}
+
+	if (filtered == false) {
+		filtered = QWidget::eventFilter(watched, event);
+	}
+
+	return filtered;
+}
+
+void app::main_window::window::CtrlWrapper::followFocus(QWidget * previous, QWidget * current) {
+	if (previous != nullptr) {
+		previous->removeEventFilter(this);
+	}
+
+	// Only key presses received by widgets of this window are fed to its shortcut trie
+	if ((current != nullptr) && (current->window() == this->window())) {
+		current->installEventFilter(this);
 	}
 }
 
@@ -350,7 +415,7 @@ void app::main_window::window::CtrlWrapper::keyReleaseEvent(QKeyEvent * event) {
 	this->winctrl->keyReleaseEvent(event);
 	this->tabctrl->keyReleaseEvent(event);
 
-	this->core->mainWidget->repaint();
+	this->core->mainWidget->update();
 
 }
 
@@ -30,9 +30,9 @@
 #include "app/shared/setters_getters.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowOverall, mainWindow.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowCenterWindow, mainWindow.centerWindow, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(mainWindowTabs, mainWindow.tabs, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowOverall, mainWindow.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowCenterWindow, mainWindow.centerWindow, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTabs, mainWindow.tabs, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -83,7 +83,7 @@ namespace app {
 
 }
 
-app::main_window::window::MainWindow::MainWindow(QWidget * parent, Qt::WindowFlags flags) : QMainWindow(parent, flags), app::main_window::window::Base(std::shared_ptr<app::main_window::window::Core>(new app::main_window::window::Core(this))), overlayedWidgets(std::list<std::shared_ptr<app::base::overlayed_widget::OverlayedWidget>>()) {
+app::main_window::window::MainWindow::MainWindow(QWidget * parent, Qt::WindowFlags flags, const QString & sessionFile) : QMainWindow(parent, flags), app::main_window::window::Base(std::shared_ptr<app::main_window::window::Core>(new app::main_window::window::Core(this, sessionFile))), overlayedWidgets(std::list<std::shared_ptr<app::base::overlayed_widget::OverlayedWidget>>()) {
 
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowOverall, "Main window constructor");
 
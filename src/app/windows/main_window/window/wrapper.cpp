@@ -13,9 +13,9 @@
 #include "app/windows/main_window/window/main_window.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowWrapperOverall, mainWindowWrapper.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowWrapperOverall, mainWindowWrapper.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-app::main_window::window::Wrapper::Wrapper(QWidget * parent, Qt::WindowFlags flags) : window(new app::main_window::window::MainWindow(parent, flags)) {
+app::main_window::window::Wrapper::Wrapper(QWidget * parent, Qt::WindowFlags flags, const QString & sessionFile) : window(new app::main_window::window::MainWindow(parent, flags, sessionFile)) {
 
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowWrapperOverall, "Main window wrapper constructor");
 
@@ -22,9 +22,9 @@
 #include "app/windows/secondary_windows/shared/utility.h"
 
 // Categories
-LOGGING_CONTEXT(findButtonWindowOverall, findButtonWindow.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(findButtonWindowCancel, findButtonWindow.cancel_button, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(findButtonWindowFind, findButtonWindow.find, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(findButtonWindowOverall, findButtonWindow.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(findButtonWindowCancel, findButtonWindow.cancel_button, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(findButtonWindowFind, findButtonWindow.find, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
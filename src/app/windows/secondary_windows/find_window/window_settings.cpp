@@ -22,7 +22,7 @@
 #include "app/windows/secondary_windows/find_window/window_settings.h"
 
 // Categories
-LOGGING_CONTEXT(findButtonWindowSettingsOverall, findButtonWindowSettings.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(findButtonWindowSettingsOverall, findButtonWindowSettings.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
@@ -22,10 +22,10 @@
 #include "app/windows/secondary_windows/shared/utility.h"
 
 // Categories
-LOGGING_CONTEXT(openButtonWindowOverall, openButtonWindow.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(openButtonWindowOpen, openButtonWindow.open_button, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(openButtonWindowBrowse, openButtonWindow.browse_button, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(openButtonWindowCancel, openButtonWindow.cancel_button, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(openButtonWindowOverall, openButtonWindow.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(openButtonWindowOpen, openButtonWindow.open_button, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(openButtonWindowBrowse, openButtonWindow.browse_button, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(openButtonWindowCancel, openButtonWindow.cancel_button, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace app {
 
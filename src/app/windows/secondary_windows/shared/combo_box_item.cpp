@@ -16,7 +16,7 @@
 #include "app/windows/secondary_windows/shared/combo_box_item.h"
 
 // Categories
-LOGGING_CONTEXT(comboBoxItemOverall, comboBoxItem.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(comboBoxItemOverall, comboBoxItem.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::combo_box_item::ComboBoxItem::ComboBoxItem(const QIcon itemIcon, const QVariant itemUserData, std::unique_ptr<app::commands::Action> & itemAction) : icon(itemIcon), userData(itemUserData), action(std::move(itemAction)) {
 	EXCEPTION_ACTION_COND((this->action == nullptr), throw, "Action must not be null");
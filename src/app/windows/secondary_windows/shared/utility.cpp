@@ -56,7 +56,7 @@ namespace app {
 }
 
 // Categories
-LOGGING_CONTEXT(secondaryWindowUtilityOverall, secondaryWindowUtility.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(secondaryWindowUtilityOverall, secondaryWindowUtility.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 std::unique_ptr<QFileSystemModel> app::secondary_window::createFileModel(QWidget *parent, const QStringList & filters, const QDir & directory) {
 
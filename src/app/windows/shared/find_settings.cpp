@@ -13,7 +13,7 @@
 #include "app/shared/setters_getters.h"
 
 // Categories
-LOGGING_CONTEXT(findSettingsOverall, findSettings.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(findSettingsOverall, findSettings.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 app::windows::shared::FindSettings::FindSettings(const QString & initText, const app::shared::offset_type_e & initDirection, const bool & initCaseSensitive, const bool & initMatchFullWord) : app::printable_object::PrintableObject(), text(initText), direction(initDirection), caseSensitive(initCaseSensitive), matchFullWord(initMatchFullWord) {
 
@@ -0,0 +1,67 @@
+/**
+ * @copyright
+ * @file log_decoder.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Main function of the log decoder
+ */
+
+#include <string>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "app/utility/logger/trace_format.h"
+
+/** @addtogroup LogDecoderGroup
+ *  @{
+ */
+
+/** 
+ * @brief Function: int main (int argc, char * argv[])
+ *
+ * \param argc: argument count. Number of arguments including the executable itself.
+ * \param argv: argument vector. The first argument is the executable name. Last element of the array is NULL.
+ * \return an integer corresponging to the exit status
+ *
+ * Converts the binary trace provided as first argument to the text format of the log
+ * The text is written to the file provided as second argument or to the standard output if it is omitted
+ *
+ */
+int main (int argc, char* argv[]) {
+
+	if ((argc < 2) || (argc > 3)) {
+		std::cerr << "Usage: " << argv[0] << " <trace file> [output file]" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const std::string inputFilename(argv[1]);
+	std::ifstream input(inputFilename, std::ios::binary);
+	if (input.is_open() == false) {
+		std::cerr << "Unable to open trace file " << inputFilename << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::ofstream outputFile;
+	if (argc == 3) {
+		const std::string outputFilename(argv[2]);
+		outputFile.open(outputFilename, (std::ios::out | std::ios::trunc));
+		if (outputFile.is_open() == false) {
+			std::cerr << "Unable to open output file " << outputFilename << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	std::ostream & output = (outputFile.is_open() == true) ? static_cast<std::ostream &>(outputFile) : std::cout;
+
+	app::logger::trace::Decoder decoder;
+	const bool success = decoder.decode(input, output);
+	output.flush();
+
+	if (success == false) {
+		std::cerr << "Unable to decode trace file " << inputFilename << " after " << decoder.getDecodedRecords() << " records: " << decoder.getError() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+/** @} */ // End of LogDecoderGroup group
@@ -28,8 +28,8 @@
 #include "tester/base/suite.h"
 #include "tester/top/main_window_wrapper.h"
 
-LOGGING_CONTEXT(commandTestOverall, commandTest.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(commandTestTest, commandTest.test, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(commandTestOverall, commandTest.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandTestTest, commandTest.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace tester {
 	namespace base {
@@ -11,7 +11,7 @@
 #include "app/shared/setters_getters.h"
 #include "tester/base/factory.h"
 
-LOGGING_CONTEXT(baseFactoryOverall, baseFactory.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(baseFactoryOverall, baseFactory.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 tester::base::Factory::Factory(int & argc, char** argv, const tester::base::Factory::suite_container_t & testSuites) : argc(argc), argv(argv), suites(testSuites) {
 	LOG_INFO(app::logger::info_level_e::ZERO, baseFactoryOverall, "Creating base factory with initial content " << *this);
@@ -12,7 +12,7 @@
 #include "tester/base/suite.h"
 #include "tester/base/factory.h"
 
-LOGGING_CONTEXT(baseSuiteOverall, baseSuite.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(baseSuiteOverall, baseSuite.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 bool tester::base::SuitePtrCompare::operator() (const std::shared_ptr<tester::base::Suite> & rhs, const std::shared_ptr<tester::base::Suite> & lhs) const {
 	bool isSame = ((*rhs) == (*lhs));
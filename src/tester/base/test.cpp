@@ -9,6 +9,7 @@
 // Qt libraries
 #include <QtWidgets/QApplication>
 
+#include <chrono>
 #include <locale>
 #include <thread>
 
@@ -25,24 +26,24 @@
 #include "tester/base/suite.h"
 #include "tester/top/main_window_wrapper.h"
 
-LOGGING_CONTEXT(baseTestOverall, baseTest.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(baseTestTest, baseTest.test, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(baseTestError, baseTest.error, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(baseTestApp, baseTest.app, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(baseTestOverall, baseTest.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(baseTestTest, baseTest.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(baseTestError, baseTest.error, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(baseTestApp, baseTest.app, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 bool tester::base::TestPtrCompare::operator() (const std::shared_ptr<tester::base::Test> & rhs, const std::shared_ptr<tester::base::Test> & lhs) const {
 	bool isSame = ((*rhs) == (*lhs));
 	return isSame;
 }
 
-tester::base::Test::Test(const std::shared_ptr<tester::base::Suite> & testSuite, const std::string & testName) : windowWrapper(nullptr), suite(testSuite), name(testName), errorMap(tester::base::Test::test_error_container_t()), expectedErrors(tester::base::Test::test_error_container_t()), state(tester::shared::test_state_e::INSTATIATED), status(tester::shared::test_status_e::NOT_RUN) {
+tester::base::Test::Test(const std::shared_ptr<tester::base::Suite> & testSuite, const std::string & testName) : windowWrapper(nullptr), suite(testSuite), name(testName), errorMap(tester::base::Test::test_error_container_t()), expectedErrors(tester::base::Test::test_error_container_t()), state(tester::shared::test_state_e::INSTATIATED), status(tester::shared::test_status_e::NOT_RUN), setupDuration(std::chrono::nanoseconds::zero()), bodyDuration(std::chrono::nanoseconds::zero()), wrapupDuration(std::chrono::nanoseconds::zero()), duration(std::chrono::nanoseconds::zero()) {
 
 	this->checkCreation();
 
 	LOG_INFO(app::logger::info_level_e::ZERO, baseTestOverall, "Creating test " << this->name << " in suite " << this->getSuite()->getName());
 }
 
-tester::base::Test::Test(const std::shared_ptr<tester::base::Factory> & factory, const std::string & suiteName, const std::string & testName) : windowWrapper(nullptr), name(testName), errorMap(tester::base::Test::test_error_container_t()), expectedErrors(tester::base::Test::test_error_container_t()), state(tester::shared::test_state_e::INSTATIATED), status(tester::shared::test_status_e::NOT_RUN) {
+tester::base::Test::Test(const std::shared_ptr<tester::base::Factory> & factory, const std::string & suiteName, const std::string & testName) : windowWrapper(nullptr), name(testName), errorMap(tester::base::Test::test_error_container_t()), expectedErrors(tester::base::Test::test_error_container_t()), state(tester::shared::test_state_e::INSTATIATED), status(tester::shared::test_status_e::NOT_RUN), setupDuration(std::chrono::nanoseconds::zero()), bodyDuration(std::chrono::nanoseconds::zero()), wrapupDuration(std::chrono::nanoseconds::zero()), duration(std::chrono::nanoseconds::zero()) {
 
 	std::shared_ptr<tester::base::Suite> suiteSharedPtr = factory->findOrCreateSuite(suiteName);
 	if (suiteSharedPtr != nullptr) {
@@ -164,15 +165,21 @@ void tester::base::Test::test() {
 
 	LOG_INFO(app::logger::info_level_e::ZERO, baseTestTest, "Start test " << this->getName());
 	this->setState(tester::shared::test_state_e::SETTING_UP);
+	std::chrono::steady_clock::time_point phaseStartTime = std::chrono::steady_clock::now();
 	bool setupSuccessful = this->setup();
+	this->setupDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - phaseStartTime);
 	this->setState(tester::shared::test_state_e::RUNNING);
+	phaseStartTime = std::chrono::steady_clock::now();
 	if (setupSuccessful == true) {
 		this->testBody();
 	}
+	this->bodyDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - phaseStartTime);
 	this->setState(tester::shared::test_state_e::WRAPPING_UP);
+	phaseStartTime = std::chrono::steady_clock::now();
 	this->wrapup();
+	this->wrapupDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - phaseStartTime);
 	this->setState(tester::shared::test_state_e::FINISHED);
-	LOG_INFO(app::logger::info_level_e::ZERO, baseTestTest, "End test " << this->getName());
+	LOG_INFO(app::logger::info_level_e::ZERO, baseTestTest, "End test " << this->getName() << " - setup " << this->setupDuration.count() << "ns body " << this->bodyDuration.count() << "ns wrapup " << this->wrapupDuration.count() << "ns");
 
 }
 
@@ -227,6 +234,10 @@ CONST_GETTER(tester::base::Test::getErrorMap, tester::base::Test::test_error_con
 CONST_GETTER(tester::base::Test::getExpectedErrors, tester::base::Test::test_error_container_t &, this->expectedErrors)
 CONST_SETTER_GETTER(tester::base::Test::setState, tester::base::Test::getState, tester::shared::test_state_e &, this->state)
 CONST_GETTER(tester::base::Test::getStatus, tester::shared::test_status_e &, this->status)
+CONST_GETTER(tester::base::Test::getSetupDuration, std::chrono::nanoseconds &, this->setupDuration)
+CONST_GETTER(tester::base::Test::getBodyDuration, std::chrono::nanoseconds &, this->bodyDuration)
+CONST_GETTER(tester::base::Test::getWrapupDuration, std::chrono::nanoseconds &, this->wrapupDuration)
+CONST_GETTER(tester::base::Test::getDuration, std::chrono::nanoseconds &, this->duration)
 
 void tester::base::Test::addError(test_error_container_t & errors, const tester::shared::error_type_e & type, const tester::shared::ErrorData & data) const {
 	errors.insert(std::pair<tester::shared::error_type_e, tester::shared::ErrorData>(type, data));
@@ -319,7 +330,7 @@ void tester::base::Test::run() {
 		app = new QApplication(factory->getArgc(), factory->getArgv());
 	}
 
-	this->windowWrapper = std::make_unique<tester::main_window_wrapper::MainWindowWrapper>(Q_NULLPTR, Qt::Window);
+	this->windowWrapper = std::make_unique<tester::main_window_wrapper::MainWindowWrapper>(Q_NULLPTR, Qt::Window, this->getSessionFile());
 	this->windowWrapper->show();
 
 	WAIT_FOR_CONDITION((this->getWindow()->isHidden() == false), tester::shared::error_type_e::WINDOW, "Window is not active at the start of test " + this->getName(), 5000);
@@ -331,6 +342,10 @@ void tester::base::Test::run() {
 	}
 }
 
+QString tester::base::Test::getSessionFile() const {
+	return QString();
+}
+
 const std::string tester::base::Test::print() const {
 	std::string testInfo;
 
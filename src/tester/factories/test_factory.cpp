@@ -11,8 +11,9 @@
 #include "app/shared/setters_getters.h"
 #include "tester/factories/test_factory.h"
 #include "tester/suites/command_suite.h"
+#include "tester/suites/performance_suite.h"
 
-LOGGING_CONTEXT(testFactoryOverall, testFactory.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(testFactoryOverall, testFactory.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 tester::factory::TestFactory::TestFactory(int & argc, char** argv, const tester::base::Factory::suite_container_t & testSuites) : tester::base::Factory(argc, argv, testSuites) {
 
@@ -28,4 +29,5 @@ tester::factory::TestFactory::~TestFactory() {
 
 void tester::factory::TestFactory::populate() {
 	tester::suite::CommandSuite::create<tester::suite::CommandSuite>(this->shared_from_this());
+	tester::suite::PerformanceSuite::create<tester::suite::PerformanceSuite>(this->shared_from_this());
 }
@@ -11,7 +11,7 @@
 
 #include "tester/shared/base_element_creation.h"
 
-LOGGING_CONTEXT(baseElementCreationOverall, baseElementCreation.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(baseElementCreationOverall, baseElementCreation.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 tester::shared::BaseElementCreation::BaseElementCreation() {
 
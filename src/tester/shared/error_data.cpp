@@ -13,7 +13,7 @@
 #include "tester/base/test.h"
 
 // Categories
-LOGGING_CONTEXT(errorDataOverall, errorData.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(errorDataOverall, errorData.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 tester::shared::ErrorData::ErrorData(const std::weak_ptr<const tester::base::Test> & errorTest, const std::string & errorFilename, const int & errorLineNumber, const std::string & errorCondition, const std::string & errorMessage) : test(errorTest), lineNumber(errorLineNumber), filename(errorFilename), condition(errorCondition), message(errorMessage) {
 	LOG_INFO(app::logger::info_level_e::ZERO, errorDataOverall, "Error data constructor");
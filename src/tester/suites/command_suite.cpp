@@ -20,7 +20,7 @@
 #include "tester/tests/edit_command_in_statusbar.h"
 #include "tester/tests/edit_path_in_statusbar.h"
 
-LOGGING_CONTEXT(commandSuiteOverall, commandSuite.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(commandSuiteOverall, commandSuite.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 tester::suite::CommandSuite::CommandSuite(const std::shared_ptr<tester::base::Factory> & testFactory, const tester::base::Suite::tests_container_t & testList) : tester::base::Suite(testFactory, "Command suite", testList) {
 
@@ -0,0 +1,78 @@
+/**
+ * @copyright
+ * @file performance_suite.cpp
+ * @author Andrea Gianarda
+ * @date 27th August 2020
+ * @brief Performance suite functions
+ */
+
+#include "app/utility/logger/macros.h"
+#include "tester/suites/performance_suite.h"
+#include "tester/tests/logger_throughput.h"
+#include "tester/tests/filtered_logging.h"
+#include "tester/tests/command_index.h"
+#include "tester/tests/json_decoding.h"
+#include "tester/tests/lazy_tabs.h"
+#include "tester/tests/tab_hibernation.h"
+#include "tester/tests/text_file_loading.h"
+#include "tester/tests/scroll_coalescing.h"
+#include "tester/tests/statusbar_updates.h"
+#include "tester/tests/command_dispatch.h"
+#include "tester/tests/shortcut_toggling.h"
+#include "tester/tests/shortcut_trie.h"
+#include "tester/tests/command_menu_filtering.h"
+#include "tester/tests/command_menu_results.h"
+#include "tester/tests/command_menu_geometry.h"
+#include "tester/tests/text_classification.h"
+#include "tester/tests/profile_cache.h"
+#include "tester/tests/session_restore.h"
+#include "tester/tests/find_in_page.h"
+#include "tester/tests/startup_profile.h"
+#include "tester/tests/qt_message_throughput.h"
+#include "tester/tests/log_rotation.h"
+#include "tester/tests/trace_log.h"
+#include "tester/tests/log_rules.h"
+#include "tester/tests/disabled_context_overhead.h"
+#include "tester/tests/exception_overhead.h"
+
+LOGGING_CONTEXT(performanceSuiteOverall, performanceSuite.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+tester::suite::PerformanceSuite::PerformanceSuite(const std::shared_ptr<tester::base::Factory> & testFactory, const tester::base::Suite::tests_container_t & testList) : tester::base::Suite(testFactory, "Performance suite", testList) {
+
+}
+
+tester::suite::PerformanceSuite::~PerformanceSuite() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, performanceSuiteOverall, "Performance suite destructor");
+
+}
+
+void tester::suite::PerformanceSuite::populate() {
+	LOG_INFO(app::logger::info_level_e::ZERO, performanceSuiteOverall, "Populating suite " << this->getName());
+	tester::test::LoggerThroughput::create<tester::test::LoggerThroughput>(this->shared_from_this());
+	tester::test::FilteredLogging::create<tester::test::FilteredLogging>(this->shared_from_this());
+	tester::test::CommandIndex::create<tester::test::CommandIndex>(this->shared_from_this());
+	tester::test::JsonDecoding::create<tester::test::JsonDecoding>(this->shared_from_this());
+	tester::test::LazyTabs::create<tester::test::LazyTabs>(this->shared_from_this());
+	tester::test::TabHibernation::create<tester::test::TabHibernation>(this->shared_from_this());
+	tester::test::TextFileLoading::create<tester::test::TextFileLoading>(this->shared_from_this());
+	tester::test::ScrollCoalescing::create<tester::test::ScrollCoalescing>(this->shared_from_this());
+	tester::test::StatusbarUpdates::create<tester::test::StatusbarUpdates>(this->shared_from_this());
+	tester::test::CommandDispatch::create<tester::test::CommandDispatch>(this->shared_from_this());
+	tester::test::ShortcutToggling::create<tester::test::ShortcutToggling>(this->shared_from_this());
+	tester::test::ShortcutTrie::create<tester::test::ShortcutTrie>(this->shared_from_this());
+	tester::test::CommandMenuFiltering::create<tester::test::CommandMenuFiltering>(this->shared_from_this());
+	tester::test::CommandMenuResults::create<tester::test::CommandMenuResults>(this->shared_from_this());
+	tester::test::CommandMenuGeometry::create<tester::test::CommandMenuGeometry>(this->shared_from_this());
+	tester::test::TextClassification::create<tester::test::TextClassification>(this->shared_from_this());
+	tester::test::ProfileCache::create<tester::test::ProfileCache>(this->shared_from_this());
+	tester::test::SessionRestore::create<tester::test::SessionRestore>(this->shared_from_this());
+	tester::test::FindInPage::create<tester::test::FindInPage>(this->shared_from_this());
+	tester::test::StartupProfile::create<tester::test::StartupProfile>(this->shared_from_this());
+	tester::test::QtMessageThroughput::create<tester::test::QtMessageThroughput>(this->shared_from_this());
+	tester::test::LogRotation::create<tester::test::LogRotation>(this->shared_from_this());
+	tester::test::TraceLog::create<tester::test::TraceLog>(this->shared_from_this());
+	tester::test::LogRules::create<tester::test::LogRules>(this->shared_from_this());
+	tester::test::DisabledContextOverhead::create<tester::test::DisabledContextOverhead>(this->shared_from_this());
+	tester::test::ExceptionOverhead::create<tester::test::ExceptionOverhead>(this->shared_from_this());
+}
@@ -0,0 +1,189 @@
+/**
+ * @copyright
+ * @file command_dispatch.cpp
+ * @author Andrea Gianarda
+ * @date 05th September 2020
+ * @brief Command dispatch functions
+ */
+
+#include <chrono>
+#include <algorithm>
+
+#include "app/shared/enums.h"
+#include "app/utility/cpp/stl_helper.h"
+#include "app/utility/logger/macros.h"
+#include "app/utility/qt/qt_operator.h"
+#include "app/windows/main_window/json/data.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/window/commands.h"
+#include "app/windows/main_window/window/ctrl_wrapper.h"
+#include "tester/tests/command_dispatch.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(commandDispatchOverall, commandDispatch.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandDispatchTest, commandDispatch.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace command_dispatch {
+
+			namespace {
+
+				/**
+				 * @brief Number of commands dispatched
+				 *
+				 */
+				static const int numberOfCommands = 100000;
+
+				/**
+				 * @brief One every unknownCommandPeriod commands is mistyped
+				 *
+				 */
+				static const int unknownCommandPeriod = 100;
+
+				/**
+				 * @brief Argument appended to the commands that take one
+				 *
+				 */
+				static const QString argument("argument");
+
+				/**
+				 * @brief Percentiles of the latencies reported
+				 *
+				 */
+				static const std::vector<int> percentiles({ 50, 90, 99 });
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::CommandDispatch::CommandDispatch(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Command dispatch") {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandDispatchOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::CommandDispatch::~CommandDispatch() {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandDispatchOverall, "Test " << this->getName() << " destructor");
+}
+
+const app::main_window::json::Data * tester::test::CommandDispatch::linearDispatch(const QString & userCommand) const {
+	const app::main_window::window::Commands::action_data_t & commands = this->windowWrapper->getWindowCore()->commands->getActions();
+
+	const QString trimmedCommand(userCommand.trimmed());
+	const int argumentStart = trimmedCommand.indexOf(QChar(' '));
+	const QString commandName((argumentStart < 0) ? trimmedCommand : trimmedCommand.left(argumentStart));
+
+	const app::main_window::json::Data * match = nullptr;
+	for (const auto & data : commands) {
+		const QString refCommand = QString::fromStdString(data.second->getLongCmd());
+		if ((match == nullptr) && (refCommand.isEmpty() == false) && (commandName.compare(refCommand) == 0)) {
+			match = data.second.get();
+		}
+	}
+
+	return match;
+}
+
+void tester::test::CommandDispatch::reportLatencies(const std::string & mode, std::vector<std::int64_t> & latencies) const {
+	std::sort(latencies.begin(), latencies.end());
+
+	std::string report = "[" + mode + "] " + std::to_string(latencies.size()) + " commands -";
+	for (const int & percentile : tester::test::command_dispatch::percentiles) {
+		const std::size_t idx = (latencies.size() * static_cast<std::size_t>(percentile)) / 100;
+		report.append(" p" + std::to_string(percentile) + ": " + std::to_string(latencies.at(std::min(idx, (latencies.size() - 1)))) + "ns");
+	}
+	report.append(" max: " + std::to_string(latencies.back()) + "ns");
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandDispatchTest, report);
+}
+
+void tester::test::CommandDispatch::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandDispatchTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	const std::unique_ptr<app::main_window::window::CtrlWrapper> & windowCtrl = this->windowWrapper->getWindowCtrl();
+	const app::main_window::window::Commands::action_data_t & commands = this->windowWrapper->getWindowCore()->commands->getActions();
+
+	// Build the pool of commands the user may type: every command alone and followed by an argument
+	std::vector<QString> knownCommands;
+	for (const auto & data : commands) {
+		const QString longCmd(QString::fromStdString(data.second->getLongCmd()));
+		if (longCmd.isEmpty() == false) {
+			knownCommands.push_back(longCmd);
+			knownCommands.push_back(longCmd + " " + tester::test::command_dispatch::argument);
+		}
+	}
+	ASSERT((knownCommands.empty() == false), tester::shared::error_type_e::COMMAND, "No command is available in the window");
+	if (knownCommands.empty() == true) {
+		return;
+	}
+
+	std::vector<QString> userCommands;
+	userCommands.reserve(static_cast<std::size_t>(tester::test::command_dispatch::numberOfCommands));
+	for (int commandIdx = 0; commandIdx < tester::test::command_dispatch::numberOfCommands; commandIdx++) {
+		const QString & knownCommand = knownCommands.at(static_cast<std::size_t>(commandIdx) % knownCommands.size());
+		if ((commandIdx % tester::test::command_dispatch::unknownCommandPeriod) == 0) {
+			// Mistype the command by repeating its first character
+			userCommands.push_back(knownCommand.left(1) + knownCommand);
+		} else {
+			userCommands.push_back(knownCommand);
+		}
+	}
+
+	std::vector<std::int64_t> linearLatencies;
+	std::vector<std::int64_t> hashLatencies;
+	linearLatencies.reserve(userCommands.size());
+	hashLatencies.reserve(userCommands.size());
+	std::size_t mismatches = 0;
+	std::size_t misses = 0;
+	std::size_t wrongArguments = 0;
+
+	// Commands are resolved without being executed in order not to change the state of the window
+	for (const QString & userCommand : userCommands) {
+		const std::chrono::steady_clock::time_point linearStart = std::chrono::steady_clock::now();
+		const app::main_window::json::Data * linearMatch = this->linearDispatch(userCommand);
+		const std::chrono::steady_clock::time_point linearEnd = std::chrono::steady_clock::now();
+
+		const std::chrono::steady_clock::time_point hashStart = std::chrono::steady_clock::now();
+		QString arguments;
+		const app::main_window::json::Data * hashMatch = windowCtrl->findCommand(userCommand, arguments);
+		const std::chrono::steady_clock::time_point hashEnd = std::chrono::steady_clock::now();
+
+		linearLatencies.push_back(static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(linearEnd - linearStart).count()));
+		hashLatencies.push_back(static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(hashEnd - hashStart).count()));
+
+		if (linearMatch != hashMatch) {
+			mismatches++;
+		}
+		if (hashMatch == nullptr) {
+			misses++;
+		}
+		const QString expectedArguments((userCommand.endsWith(" " + tester::test::command_dispatch::argument) == true) ? tester::test::command_dispatch::argument : QString());
+		if (arguments.compare(expectedArguments) != 0) {
+			wrongArguments++;
+		}
+	}
+
+	this->reportLatencies("linear", linearLatencies);
+	this->reportLatencies("hash", hashLatencies);
+	LOG_INFO(app::logger::info_level_e::ZERO, commandDispatchTest, misses << " commands out of " << userCommands.size() << " were unknown");
+
+	ASSERT((mismatches == 0), tester::shared::error_type_e::COMMAND, "Linear and hash dispatch resolved " + std::to_string(mismatches) + " commands differently");
+	ASSERT((wrongArguments == 0), tester::shared::error_type_e::COMMAND, "The arguments of " + std::to_string(wrongArguments) + " commands were not split off the command");
+
+	const std::size_t expectedMisses = static_cast<std::size_t>(((tester::test::command_dispatch::numberOfCommands - 1) / tester::test::command_dispatch::unknownCommandPeriod) + 1);
+	ASSERT((misses == expectedMisses), tester::shared::error_type_e::COMMAND, "Expected " + std::to_string(expectedMisses) + " unknown commands but " + std::to_string(misses) + " were not found");
+
+	// A mistyped command must be close enough to the original one for a command to be suggested
+	const QString & knownCommand = knownCommands.front();
+	const QString mistypedCommand(knownCommand.left(1) + knownCommand);
+	const QString suggestion(this->windowWrapper->getWindowCore()->commands->findClosestCommand(mistypedCommand));
+	const std::size_t suggestionDistance = app::utility::editDistance(mistypedCommand.toStdString(), suggestion.toStdString());
+	ASSERT(((suggestion.isEmpty() == false) && (suggestionDistance == 1)), tester::shared::error_type_e::COMMAND, "Expected a command one edit away from " + mistypedCommand.toStdString() + " to be suggested but got \"" + suggestion.toStdString() + "\"");
+}
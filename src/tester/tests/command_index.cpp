@@ -0,0 +1,244 @@
+/**
+ * @copyright
+ * @file command_index.cpp
+ * @author Andrea Gianarda
+ * @date 31st August 2020
+ * @brief Command index functions
+ */
+
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+
+// Qt libraries
+#include <QtCore/QTemporaryDir>
+
+#include "app/shared/enums.h"
+#include "app/shared/exception.h"
+#include "app/shared/qt_functions.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/json/action.h"
+#include "tester/tests/command_index.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(commandIndexOverall, commandIndex.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandIndexTest, commandIndex.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace command_index {
+
+			namespace {
+
+				/**
+				 * @brief Name of the JSON file storing the synthetic commands. It is written to a temporary directory
+				 *
+				 */
+				static const std::string jsonFilename("command_index.json");
+
+				/**
+				 * @brief Number of synthetic commands
+				 *
+				 */
+				static const int numberOfCommands = 5000;
+
+				/**
+				 * @brief Number of times every value is searched
+				 *
+				 */
+				static const int numberOfIterations = 10;
+
+				/**
+				 * @brief States assigned to the synthetic commands
+				 * States are shared by several commands therefore searches return the command with the smallest key
+				 *
+				 */
+				static const std::vector<app::main_window::state_e> states({ app::main_window::state_e::OPEN_TAB, app::main_window::state_e::CLOSE_TAB, app::main_window::state_e::REFRESH_TAB, app::main_window::state_e::MOVE_LEFT, app::main_window::state_e::MOVE_RIGHT, app::main_window::state_e::SCROLL_UP, app::main_window::state_e::SCROLL_DOWN, app::main_window::state_e::FIND });
+
+				/**
+				 * @brief Letters used as shortcuts of the synthetic commands
+				 *
+				 */
+				static const std::string shortcutLetters("abcdefghijklmnopqrstuvwxyz");
+
+				/**
+				 * @brief Function: std::string getLongCmd(const int & idx)
+				 *
+				 * \param idx: index of the command
+				 *
+				 * \return the long command of the command
+				 */
+				std::string getLongCmd(const int & idx) {
+					return ("command-" + std::to_string(idx));
+				}
+
+				/**
+				 * @brief Function: std::string getKey(const int & idx)
+				 *
+				 * \param idx: index of the command
+				 *
+				 * \return the key of the command in the JSON file
+				 */
+				std::string getKey(const int & idx) {
+					return ("Command" + std::to_string(idx));
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::CommandIndex::CommandIndex(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Command index") {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandIndexOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::CommandIndex::~CommandIndex() {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandIndexOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::CommandIndex::writeCommandFile(const std::string & filename) const {
+	std::ofstream jsonFile(filename, (std::ios::out | std::ios::trunc));
+	EXCEPTION_ACTION_COND(((jsonFile.rdstate() & std::ostream::failbit) != 0), throw, "Unable to open file " << filename);
+
+	const std::size_t numberOfStates = tester::test::command_index::states.size();
+	const std::size_t numberOfLetters = tester::test::command_index::shortcutLetters.size();
+
+	jsonFile << "{\n";
+	for (int idx = 0; idx < tester::test::command_index::numberOfCommands; idx++) {
+		const std::size_t uidx = static_cast<std::size_t>(idx);
+		const app::main_window::state_e & state = tester::test::command_index::states.at(uidx % numberOfStates);
+		const char shortcut = tester::test::command_index::shortcutLetters.at(uidx % numberOfLetters);
+
+		if (idx != 0) {
+			jsonFile << ",\n";
+		}
+		jsonFile << "\t\"" << tester::test::command_index::getKey(idx) << "\" : {\n";
+		jsonFile << "\t\t\"Name\" : \"synthetic command " << idx << "\",\n";
+		jsonFile << "\t\t\"State\" : \"" << app::shared::qEnumToQString(state, true).toStdString() << "\",\n";
+		jsonFile << "\t\t\"Shortcut\" : \"" << shortcut << "\",\n";
+		jsonFile << "\t\t\"LongCmd\" : \"" << tester::test::command_index::getLongCmd(idx) << "\",\n";
+		jsonFile << "\t\t\"Help\" : \"Synthetic command used to benchmark searches\"\n";
+		jsonFile << "\t}";
+	}
+	jsonFile << "\n}\n";
+}
+
+std::int64_t tester::test::CommandIndex::linearSearch(const app::main_window::json::Action & actions, const std::string & name, const std::vector<const void *> & values, std::vector<const void *> & matches) const {
+	const app::main_window::json::Action::action_data_t & actionData = actions.getActions();
+	matches.clear();
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int iteration = 0; iteration < tester::test::command_index::numberOfIterations; iteration++) {
+		for (const void * value : values) {
+			const app::main_window::json::Action::action_data_t::const_iterator foundData = std::find_if(actionData.cbegin(), actionData.cend(), [&] (const auto & data) -> bool {
+				return data.second->isSameFieldValue(name, value);
+			});
+			if (iteration == 0) {
+				matches.push_back((foundData == actionData.cend()) ? nullptr : foundData->second.get());
+			}
+		}
+	}
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+std::int64_t tester::test::CommandIndex::indexedSearch(const app::main_window::json::Action & actions, const std::string & name, const std::vector<const void *> & values, std::vector<const void *> & matches) const {
+	matches.clear();
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int iteration = 0; iteration < tester::test::command_index::numberOfIterations; iteration++) {
+		for (const void * value : values) {
+			const app::main_window::json::Data * foundData = nullptr;
+			if (name.compare("LongCmd") == 0) {
+				foundData = actions.findByLongCmd(*static_cast<const std::string *>(value)).get();
+			} else if (name.compare("State") == 0) {
+				foundData = actions.findByState(*static_cast<const app::main_window::state_e *>(value)).get();
+			} else if (name.compare("Shortcut") == 0) {
+				foundData = actions.findByShortcut(*static_cast<const int *>(value)).get();
+			} else {
+				EXCEPTION_ACTION(throw, "No typed lookup for field " << name);
+			}
+			if (iteration == 0) {
+				matches.push_back(foundData);
+			}
+		}
+	}
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void tester::test::CommandIndex::compare(const std::string & name, const std::int64_t & linearTime, const std::int64_t & indexedTime, const std::vector<const void *> & linearMatches, const std::vector<const void *> & indexedMatches) {
+	const std::size_t numberOfSearches = linearMatches.size() * static_cast<std::size_t>(tester::test::command_index::numberOfIterations);
+	const double linearLatency = static_cast<double>(linearTime) / static_cast<double>(numberOfSearches);
+	const double indexedLatency = static_cast<double>(indexedTime) / static_cast<double>(numberOfSearches);
+	const double speedup = (indexedLatency > 0.0) ? (linearLatency / indexedLatency) : 0.0;
+	LOG_INFO(app::logger::info_level_e::ZERO, commandIndexTest, "[" << name << "] " << numberOfSearches << " searches among " << tester::test::command_index::numberOfCommands << " commands - linear: " << linearLatency << " ns/search indexed: " << indexedLatency << " ns/search speedup: " << speedup);
+
+	ASSERT((linearMatches == indexedMatches), tester::shared::error_type_e::COMMAND, "Linear and indexed searches of field " + name + " returned different commands");
+
+	const std::size_t misses = static_cast<std::size_t>(std::count(indexedMatches.cbegin(), indexedMatches.cend(), nullptr));
+	ASSERT((misses == 0), tester::shared::error_type_e::COMMAND, "Indexed search of field " + name + " did not find " + std::to_string(misses) + " values out of " + std::to_string(indexedMatches.size()));
+}
+
+void tester::test::CommandIndex::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandIndexTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == false) {
+		return;
+	}
+	const std::string jsonFilePath(directory.filePath(QString::fromStdString(tester::test::command_index::jsonFilename)).toStdString());
+
+	this->writeCommandFile(jsonFilePath);
+	const app::main_window::json::Action actions(jsonFilePath);
+
+	const std::size_t numberOfActions = actions.getActions().size();
+	ASSERT((numberOfActions == static_cast<std::size_t>(tester::test::command_index::numberOfCommands)), tester::shared::error_type_e::COMMAND, "Expected " + std::to_string(tester::test::command_index::numberOfCommands) + " commands but " + std::to_string(numberOfActions) + " were loaded");
+
+	std::vector<const void *> linearMatches;
+	std::vector<const void *> indexedMatches;
+
+	// Long commands are unique
+	std::vector<std::string> longCmds;
+	for (int idx = 0; idx < tester::test::command_index::numberOfCommands; idx++) {
+		longCmds.push_back(tester::test::command_index::getLongCmd(idx));
+	}
+	std::vector<const void *> longCmdValues;
+	for (const std::string & longCmd : longCmds) {
+		longCmdValues.push_back(&longCmd);
+	}
+	const std::int64_t longCmdLinearTime = this->linearSearch(actions, "LongCmd", longCmdValues, linearMatches);
+	const std::int64_t longCmdIndexedTime = this->indexedSearch(actions, "LongCmd", longCmdValues, indexedMatches);
+	this->compare("LongCmd", longCmdLinearTime, longCmdIndexedTime, linearMatches, indexedMatches);
+
+	// States are shared among commands
+	std::vector<const void *> stateValues;
+	for (const app::main_window::state_e & state : tester::test::command_index::states) {
+		stateValues.push_back(&state);
+	}
+	const std::int64_t stateLinearTime = this->linearSearch(actions, "State", stateValues, linearMatches);
+	const std::int64_t stateIndexedTime = this->indexedSearch(actions, "State", stateValues, indexedMatches);
+	this->compare("State", stateLinearTime, stateIndexedTime, linearMatches, indexedMatches);
+
+	// Shortcuts are lowercase letters therefore they have no modifier
+	std::vector<int> shortcuts;
+	for (std::size_t idx = 0; idx < tester::test::command_index::shortcutLetters.size(); idx++) {
+		shortcuts.push_back(static_cast<int>(Qt::Key_A) + static_cast<int>(idx));
+	}
+	std::vector<const void *> shortcutValues;
+	for (const int & shortcut : shortcuts) {
+		shortcutValues.push_back(&shortcut);
+	}
+	const std::int64_t shortcutLinearTime = this->linearSearch(actions, "Shortcut", shortcutValues, linearMatches);
+	const std::int64_t shortcutIndexedTime = this->indexedSearch(actions, "Shortcut", shortcutValues, indexedMatches);
+	this->compare("Shortcut", shortcutLinearTime, shortcutIndexedTime, linearMatches, indexedMatches);
+}
@@ -0,0 +1,283 @@
+/**
+ * @copyright
+ * @file command_menu_filtering.cpp
+ * @author Andrea Gianarda
+ * @date 08th September 2020
+ * @brief Command menu filtering functions
+ */
+
+#include <chrono>
+#include <random>
+#include <fstream>
+#include <algorithm>
+
+#include "app/shared/exception.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/json/action.h"
+#include "app/widgets/command_menu/command_menu_model.h"
+#include "tester/tests/command_menu_filtering.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(commandMenuFilteringOverall, commandMenuFiltering.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuFilteringTest, commandMenuFiltering.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace command_menu_filtering {
+
+			namespace {
+
+				/**
+				 * @brief JSON file storing the synthetic commands
+				 *
+				 */
+				static const std::string jsonFilename("command_menu_filtering.json");
+
+				/**
+				 * @brief Number of synthetic commands
+				 *
+				 */
+				static const int numberOfCommands = 10000;
+
+				/**
+				 * @brief Number of queries typed
+				 *
+				 */
+				static const int numberOfQueries = 100;
+
+				/**
+				 * @brief Number of characters of every query
+				 *
+				 */
+				static const int queryLength = 20;
+
+				/**
+				 * @brief One every noMatchPeriod queries does not match any command
+				 *
+				 */
+				static const int noMatchPeriod = 4;
+
+				/**
+				 * @brief Seed of the random number generator
+				 *
+				 */
+				static const unsigned int seed = 24680;
+
+				/**
+				 * @brief Words making up the long commands
+				 *
+				 */
+				static const std::vector<std::string> words({ "open", "close", "tab", "window", "file", "search", "find", "scroll", "move", "left", "right", "up", "down", "page", "reload", "history", "bookmark", "download", "zoom", "print" });
+
+				/**
+				 * @brief Number of words of every long command
+				 *
+				 */
+				static const std::size_t wordsPerCommand = 4;
+
+				/**
+				 * @brief Characters that do not appear in any long command
+				 *
+				 */
+				static const std::string unusedCharacters("jqx");
+
+				/**
+				 * @brief Percentiles of the latencies reported
+				 *
+				 */
+				static const std::vector<int> percentiles({ 50, 90, 99 });
+
+				/**
+				 * @brief Function: std::string getLongCmd(const int & idx)
+				 *
+				 * \param idx: index of the command
+				 *
+				 * \return the long command of the command
+				 */
+				std::string getLongCmd(const int & idx) {
+					const std::size_t numberOfWords = tester::test::command_menu_filtering::words.size();
+					std::size_t wordIdx = static_cast<std::size_t>(idx);
+					std::string longCmd;
+					for (std::size_t word = 0; word < tester::test::command_menu_filtering::wordsPerCommand; word++) {
+						longCmd.append(tester::test::command_menu_filtering::words.at(wordIdx % numberOfWords) + "-");
+						wordIdx /= numberOfWords;
+					}
+					longCmd.append(std::to_string(idx));
+					return longCmd;
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::CommandMenuFiltering::CommandMenuFiltering(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Command menu filtering") {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuFilteringOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::CommandMenuFiltering::~CommandMenuFiltering() {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuFilteringOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::CommandMenuFiltering::writeCommandFile() const {
+	std::ofstream jsonFile(tester::test::command_menu_filtering::jsonFilename, (std::ios::out | std::ios::trunc));
+	EXCEPTION_ACTION_COND(((jsonFile.rdstate() & std::ostream::failbit) != 0), throw, "Unable to open file " << tester::test::command_menu_filtering::jsonFilename);
+
+	jsonFile << "{\n";
+	for (int idx = 0; idx < tester::test::command_menu_filtering::numberOfCommands; idx++) {
+		if (idx != 0) {
+			jsonFile << ",\n";
+		}
+		jsonFile << "\t\"Command" << idx << "\" : {\n";
+		jsonFile << "\t\t\"Name\" : \"synthetic command " << idx << "\",\n";
+		jsonFile << "\t\t\"State\" : \"OPEN_TAB\",\n";
+		jsonFile << "\t\t\"Shortcut\" : \"a\",\n";
+		jsonFile << "\t\t\"LongCmd\" : \"" << tester::test::command_menu_filtering::getLongCmd(idx) << "\",\n";
+		jsonFile << "\t\t\"Help\" : \"Synthetic command used to benchmark the command menu\"\n";
+		jsonFile << "\t}";
+	}
+	jsonFile << "\n}\n";
+}
+
+std::vector<QString> tester::test::CommandMenuFiltering::createQueries(const app::command_menu::CommandMenuModel & model) const {
+	std::mt19937 generator(tester::test::command_menu_filtering::seed);
+	std::uniform_int_distribution<int> rowDistribution(0, (model.rowCount() - 1));
+	std::uniform_int_distribution<std::size_t> unusedDistribution(0, (tester::test::command_menu_filtering::unusedCharacters.size() - 1));
+
+	std::vector<QString> queries;
+	for (int queryIdx = 0; queryIdx < tester::test::command_menu_filtering::numberOfQueries; queryIdx++) {
+		// Commands shorter than the query cannot be matched by a query made up of their characters
+		QString command;
+		while (command.size() < tester::test::command_menu_filtering::queryLength) {
+			command = model.data(model.index(rowDistribution(generator), 0)).toString();
+		}
+
+		// Pick characters evenly spread across the command so that the query is a fuzzy match of it
+		QString query;
+		for (int charIdx = 0; charIdx < tester::test::command_menu_filtering::queryLength; charIdx++) {
+			query.append(command.at((charIdx * command.size()) / tester::test::command_menu_filtering::queryLength));
+		}
+
+		// Queries matching no command narrow down the results halfway through
+		if ((queryIdx % tester::test::command_menu_filtering::noMatchPeriod) == 0) {
+			const int middle = tester::test::command_menu_filtering::queryLength / 2;
+			query[middle] = QChar::fromLatin1(tester::test::command_menu_filtering::unusedCharacters.at(unusedDistribution(generator)));
+		}
+
+		// Alternate the case of the characters as filtering is case insensitive
+		if ((queryIdx % 2) == 1) {
+			query = query.toUpper();
+		}
+
+		queries.push_back(query);
+	}
+
+	return queries;
+}
+
+void tester::test::CommandMenuFiltering::reportLatencies(const std::string & mode, const std::vector<std::vector<std::int64_t>> & latencies) const {
+	std::vector<std::int64_t> allLatencies;
+
+	std::string keystrokeReport = "[" + mode + "] average latency per keystroke -";
+	for (std::size_t keystroke = 0; keystroke < latencies.size(); keystroke++) {
+		const std::vector<std::int64_t> & keystrokeLatencies = latencies.at(keystroke);
+		std::int64_t totalLatency = 0;
+		for (const std::int64_t & latency : keystrokeLatencies) {
+			totalLatency += latency;
+		}
+		const std::int64_t averageLatency = (keystrokeLatencies.empty() == true) ? 0 : (totalLatency / static_cast<std::int64_t>(keystrokeLatencies.size()));
+		keystrokeReport.append(" " + std::to_string(keystroke + 1) + ": " + std::to_string(averageLatency) + "ns");
+		allLatencies.insert(allLatencies.end(), keystrokeLatencies.cbegin(), keystrokeLatencies.cend());
+	}
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuFilteringTest, keystrokeReport);
+
+	if (allLatencies.empty() == true) {
+		return;
+	}
+
+	std::sort(allLatencies.begin(), allLatencies.end());
+	std::string report = "[" + mode + "] " + std::to_string(allLatencies.size()) + " keystrokes -";
+	for (const int & percentile : tester::test::command_menu_filtering::percentiles) {
+		const std::size_t idx = (allLatencies.size() * static_cast<std::size_t>(percentile)) / 100;
+		report.append(" p" + std::to_string(percentile) + ": " + std::to_string(allLatencies.at(std::min(idx, (allLatencies.size() - 1)))) + "ns");
+	}
+	report.append(" max: " + std::to_string(allLatencies.back()) + "ns");
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuFilteringTest, report);
+}
+
+void tester::test::CommandMenuFiltering::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuFilteringTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	this->writeCommandFile();
+	const app::main_window::json::Action actions(tester::test::command_menu_filtering::jsonFilename);
+
+	// The incremental model refines the results of the previous keystroke whereas the full model scores all commands at every keystroke
+	app::command_menu::CommandMenuModel incrementalModel(nullptr);
+	app::command_menu::CommandMenuModel fullModel(nullptr);
+	incrementalModel.setActions(actions);
+	fullModel.setActions(actions);
+
+	ASSERT((incrementalModel.rowCount() == tester::test::command_menu_filtering::numberOfCommands), tester::shared::error_type_e::COMMAND, "Expected " + std::to_string(tester::test::command_menu_filtering::numberOfCommands) + " commands to be listed but got " + std::to_string(incrementalModel.rowCount()));
+	if (incrementalModel.rowCount() == 0) {
+		return;
+	}
+
+	const std::vector<QString> queries(this->createQueries(incrementalModel));
+
+	std::vector<std::vector<std::int64_t>> incrementalLatencies(static_cast<std::size_t>(tester::test::command_menu_filtering::queryLength));
+	std::vector<std::vector<std::int64_t>> fullLatencies(static_cast<std::size_t>(tester::test::command_menu_filtering::queryLength));
+	std::size_t mismatches = 0;
+	std::size_t emptyQueries = 0;
+
+	for (const QString & query : queries) {
+		incrementalModel.setFilter(QString());
+		for (int keystroke = 1; keystroke <= query.size(); keystroke++) {
+			const QString typedText(query.left(keystroke));
+
+			const std::chrono::steady_clock::time_point incrementalStart = std::chrono::steady_clock::now();
+			incrementalModel.setFilter(typedText);
+			const std::chrono::steady_clock::time_point incrementalEnd = std::chrono::steady_clock::now();
+
+			fullModel.setFilter(QString());
+			const std::chrono::steady_clock::time_point fullStart = std::chrono::steady_clock::now();
+			fullModel.setFilter(typedText);
+			const std::chrono::steady_clock::time_point fullEnd = std::chrono::steady_clock::now();
+
+			const std::size_t keystrokeIdx = static_cast<std::size_t>(keystroke - 1);
+			incrementalLatencies.at(keystrokeIdx).push_back(static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(incrementalEnd - incrementalStart).count()));
+			fullLatencies.at(keystrokeIdx).push_back(static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(fullEnd - fullStart).count()));
+
+			// Only the row count and the best match are compared in order to keep the benchmark short. The correctness of the results is checked by another test
+			bool sameResults = (incrementalModel.rowCount() == fullModel.rowCount());
+			if ((sameResults == true) && (incrementalModel.rowCount() > 0)) {
+				sameResults = (incrementalModel.data(incrementalModel.index(0, 0)) == fullModel.data(fullModel.index(0, 0)));
+			}
+			if (sameResults == false) {
+				mismatches++;
+			}
+		}
+
+		if (incrementalModel.rowCount() == 0) {
+			emptyQueries++;
+		}
+	}
+
+	this->reportLatencies("incremental", incrementalLatencies);
+	this->reportLatencies("full", fullLatencies);
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuFilteringTest, "Commands scored - incremental: " << incrementalModel.getScoredCommandCount() << " full: " << fullModel.getScoredCommandCount());
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuFilteringTest, emptyQueries << " queries out of " << queries.size() << " matched no command");
+
+	ASSERT((mismatches == 0), tester::shared::error_type_e::COMMAND, "Incremental and full filtering returned different results for " + std::to_string(mismatches) + " keystrokes");
+
+	const std::size_t expectedEmptyQueries = static_cast<std::size_t>(((tester::test::command_menu_filtering::numberOfQueries - 1) / tester::test::command_menu_filtering::noMatchPeriod) + 1);
+	ASSERT((emptyQueries == expectedEmptyQueries), tester::shared::error_type_e::COMMAND, "Expected " + std::to_string(expectedEmptyQueries) + " queries to match no command but " + std::to_string(emptyQueries) + " did");
+
+	ASSERT((incrementalModel.getScoredCommandCount() < fullModel.getScoredCommandCount()), tester::shared::error_type_e::PERFORMANCE, "Incremental filtering scored " + std::to_string(incrementalModel.getScoredCommandCount()) + " commands whereas full filtering scored " + std::to_string(fullModel.getScoredCommandCount()));
+}
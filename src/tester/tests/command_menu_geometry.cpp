@@ -0,0 +1,161 @@
+/**
+ * @copyright
+ * @file command_menu_geometry.cpp
+ * @author Andrea Gianarda
+ * @date 09th September 2020
+ * @brief Command menu geometry functions
+ */
+
+#include <chrono>
+
+// Qt libraries
+#include <QtCore/QStringList>
+#include <QtCore/QStringListModel>
+#include <QtWidgets/QScrollBar>
+#include <QtWidgets/QWidget>
+
+#include "app/utility/logger/macros.h"
+#include "app/widgets/command_menu/command_menu.h"
+#include "tester/tests/command_menu_geometry.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(commandMenuGeometryOverall, commandMenuGeometry.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuGeometryTest, commandMenuGeometry.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace command_menu_geometry {
+
+			namespace {
+
+				/**
+				 * @brief Number of rows of the model
+				 *
+				 */
+				static const int numberOfRows = 100000;
+
+				/**
+				 * @brief Number of positions the command menu is scrolled to
+				 *
+				 */
+				static const int numberOfScrollPositions = 2000;
+
+				/**
+				 * @brief Number of points hit-tested at every scroll position
+				 *
+				 */
+				static const int pointsPerPosition = 20;
+
+				/**
+				 * @brief Horizontal coordinate of the points hit-tested
+				 * It is smaller than the width of any row
+				 *
+				 */
+				static const int hitX = 1;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::CommandMenuGeometry::CommandMenuGeometry(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Command menu geometry") {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuGeometryOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::CommandMenuGeometry::~CommandMenuGeometry() {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuGeometryOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::CommandMenuGeometry::reportLatency(const std::string & name, const std::int64_t & elapsedTime, const std::size_t & calls) const {
+	const double timePerCall = (calls == 0) ? 0.0 : (static_cast<double>(elapsedTime) / static_cast<double>(calls));
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuGeometryTest, "[" << name << "] " << calls << " calls on " << tester::test::command_menu_geometry::numberOfRows << " rows in " << elapsedTime << "ns: " << timePerCall << " ns/call");
+}
+
+void tester::test::CommandMenuGeometry::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuGeometryTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QWidget parent;
+	app::command_menu::CommandMenu menu(&parent);
+	// Functions of the view are called through its base class as it is the way Qt calls them
+	QAbstractItemView & view = menu;
+
+	QStringListModel model;
+	view.setModel(&model);
+
+	QStringList commands;
+	commands.reserve(tester::test::command_menu_geometry::numberOfRows);
+	for (int row = 0; row < tester::test::command_menu_geometry::numberOfRows; row++) {
+		commands.append("command-" + QString::number(row));
+	}
+
+	// Geometry is computed once when the model is reset
+	const std::chrono::steady_clock::time_point resetStart = std::chrono::steady_clock::now();
+	model.setStringList(commands);
+	const std::chrono::steady_clock::time_point resetEnd = std::chrono::steady_clock::now();
+	this->reportLatency("model reset", static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(resetEnd - resetStart).count()), 1);
+
+	const QRect firstRect(view.visualRect(model.index(0, 0)));
+	const int rowHeight = firstRect.height();
+	ASSERT((rowHeight > 0), tester::shared::error_type_e::COMMAND, "Rows of the command menu are expected to have a positive height");
+	if (rowHeight <= 0) {
+		return;
+	}
+
+	QScrollBar * scrollBar = menu.verticalScrollBar();
+	const int maximumScroll = scrollBar->maximum();
+	const int viewportHeight = menu.viewport()->height();
+	ASSERT((maximumScroll > 0), tester::shared::error_type_e::COMMAND, "Command menu with " + std::to_string(tester::test::command_menu_geometry::numberOfRows) + " rows is expected to scroll vertically");
+
+	std::int64_t indexAtTime = 0;
+	std::int64_t visualRectTime = 0;
+	std::size_t calls = 0;
+	std::size_t wrongRows = 0;
+	std::size_t pointsOutsideRect = 0;
+
+	for (int position = 0; position < tester::test::command_menu_geometry::numberOfScrollPositions; position++) {
+		const int scrollValue = static_cast<int>((static_cast<std::int64_t>(maximumScroll) * position) / (tester::test::command_menu_geometry::numberOfScrollPositions - 1));
+		scrollBar->setValue(scrollValue);
+
+		for (int pointIdx = 0; pointIdx < tester::test::command_menu_geometry::pointsPerPosition; pointIdx++) {
+			const QPoint point(tester::test::command_menu_geometry::hitX, ((viewportHeight * pointIdx) / tester::test::command_menu_geometry::pointsPerPosition));
+
+			const std::chrono::steady_clock::time_point indexAtStart = std::chrono::steady_clock::now();
+			const QModelIndex index(view.indexAt(point));
+			const std::chrono::steady_clock::time_point indexAtEnd = std::chrono::steady_clock::now();
+
+			const std::chrono::steady_clock::time_point visualRectStart = std::chrono::steady_clock::now();
+			const QRect rect(view.visualRect(index));
+			const std::chrono::steady_clock::time_point visualRectEnd = std::chrono::steady_clock::now();
+
+			indexAtTime += static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(indexAtEnd - indexAtStart).count());
+			visualRectTime += static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(visualRectEnd - visualRectStart).count());
+			calls++;
+
+			// All rows have the same height therefore the expected row can be computed from the coordinates
+			const int expectedRow = (scrollBar->value() + point.y()) / rowHeight;
+			if ((index.isValid() == false) || (index.row() != expectedRow)) {
+				wrongRows++;
+			}
+			if (rect.contains(point) == false) {
+				pointsOutsideRect++;
+			}
+		}
+	}
+
+	this->reportLatency("indexAt", indexAtTime, calls);
+	this->reportLatency("visualRect", visualRectTime, calls);
+
+	ASSERT((wrongRows == 0), tester::shared::error_type_e::COMMAND, std::to_string(wrongRows) + " points out of " + std::to_string(calls) + " were not mapped to the row below them");
+	ASSERT((pointsOutsideRect == 0), tester::shared::error_type_e::COMMAND, std::to_string(pointsOutsideRect) + " points out of " + std::to_string(calls) + " were outside of the rectangle of the row found at their coordinates");
+
+	// Points beyond the last row do not belong to any row
+	scrollBar->setValue(maximumScroll);
+	const QModelIndex pastLastRow(view.indexAt(QPoint(tester::test::command_menu_geometry::hitX, (viewportHeight + rowHeight))));
+	ASSERT((pastLastRow.isValid() == false), tester::shared::error_type_e::COMMAND, "Point below the last row is expected not to be mapped to any row");
+}
@@ -0,0 +1,212 @@
+/**
+ * @copyright
+ * @file command_menu_results.cpp
+ * @author Andrea Gianarda
+ * @date 08th September 2020
+ * @brief Command menu results functions
+ */
+
+#include <tuple>
+#include <fstream>
+#include <algorithm>
+
+#include "app/shared/exception.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/json/action.h"
+#include "app/widgets/command_menu/command_menu_model.h"
+#include "tester/tests/command_menu_results.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(commandMenuResultsOverall, commandMenuResults.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(commandMenuResultsTest, commandMenuResults.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace command_menu_results {
+
+			namespace {
+
+				/**
+				 * @brief JSON file storing the commands
+				 *
+				 */
+				static const std::string jsonFilename("command_menu_results.json");
+
+				/**
+				 * @brief Long commands written to the JSON file
+				 * Long command open-tab is shared by two commands and one command has no long command
+				 *
+				 */
+				static const std::vector<std::string> longCmds({ "open-tab", "close-tab", "open-file", "find", "find-down", "scroll-up", "scroll-down", "move-tab-left", "move-tab-right", "reload", "open-tab", "" });
+
+				/**
+				 * @brief Number of unique non-empty long commands
+				 *
+				 */
+				static const int numberOfListedCommands = 10;
+
+				/**
+				 * @brief Filters typed by the user
+				 *
+				 */
+				static const std::vector<QString> filters({ "o", "op", "opt", "optb", "ot", "tab", "TAB", "Tab-L", "sd", "scrldn", "e", "xyz", "find-down-" });
+
+				/**
+				 * @brief Help of every command
+				 *
+				 */
+				static const QString help("Command used to check the results of the command menu");
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::CommandMenuResults::CommandMenuResults(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Command menu results") {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuResultsOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::CommandMenuResults::~CommandMenuResults() {
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuResultsOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::CommandMenuResults::writeCommandFile() const {
+	std::ofstream jsonFile(tester::test::command_menu_results::jsonFilename, (std::ios::out | std::ios::trunc));
+	EXCEPTION_ACTION_COND(((jsonFile.rdstate() & std::ostream::failbit) != 0), throw, "Unable to open file " << tester::test::command_menu_results::jsonFilename);
+
+	jsonFile << "{\n";
+	for (std::size_t idx = 0; idx < tester::test::command_menu_results::longCmds.size(); idx++) {
+		if (idx != 0) {
+			jsonFile << ",\n";
+		}
+		jsonFile << "\t\"Command" << idx << "\" : {\n";
+		jsonFile << "\t\t\"Name\" : \"command " << idx << "\",\n";
+		jsonFile << "\t\t\"State\" : \"OPEN_TAB\",\n";
+		jsonFile << "\t\t\"Shortcut\" : \"a\",\n";
+		jsonFile << "\t\t\"LongCmd\" : \"" << tester::test::command_menu_results::longCmds.at(idx) << "\",\n";
+		jsonFile << "\t\t\"Help\" : \"" << tester::test::command_menu_results::help.toStdString() << "\"\n";
+		jsonFile << "\t}";
+	}
+	jsonFile << "\n}\n";
+}
+
+std::vector<QString> tester::test::CommandMenuResults::getResults(const app::command_menu::CommandMenuModel & model) const {
+	std::vector<QString> results;
+	for (int row = 0; row < model.rowCount(); row++) {
+		results.push_back(model.data(model.index(row, 0)).toString());
+	}
+	return results;
+}
+
+std::vector<QString> tester::test::CommandMenuResults::getExpectedResults(const QString & filter) const {
+	std::vector<QString> commands;
+	for (const std::string & longCmd : tester::test::command_menu_results::longCmds) {
+		const QString command(QString::fromStdString(longCmd));
+		if ((command.isEmpty() == false) && (std::find(commands.cbegin(), commands.cend(), command) == commands.cend())) {
+			commands.push_back(command);
+		}
+	}
+
+	std::vector<std::tuple<int, QString>> matches;
+	for (const QString & command : commands) {
+		const int score = app::command_menu::CommandMenuModel::score(command, filter);
+		if (score >= 0) {
+			matches.emplace_back(score, command);
+		}
+	}
+
+	std::sort(matches.begin(), matches.end(), [] (const std::tuple<int, QString> & lhs, const std::tuple<int, QString> & rhs) {
+		if (std::get<0>(lhs) != std::get<0>(rhs)) {
+			return (std::get<0>(lhs) > std::get<0>(rhs));
+		}
+		if (std::get<1>(lhs).size() != std::get<1>(rhs).size()) {
+			return (std::get<1>(lhs).size() < std::get<1>(rhs).size());
+		}
+		return (std::get<1>(lhs) < std::get<1>(rhs));
+	});
+
+	std::vector<QString> results;
+	for (const std::tuple<int, QString> & match : matches) {
+		results.push_back(std::get<1>(match));
+	}
+	return results;
+}
+
+void tester::test::CommandMenuResults::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, commandMenuResultsTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	this->writeCommandFile();
+	const app::main_window::json::Action actions(tester::test::command_menu_results::jsonFilename);
+
+	app::command_menu::CommandMenuModel incrementalModel(nullptr);
+	incrementalModel.setActions(actions);
+
+	// Commands sharing the same long command are listed once and commands without a long command are not listed
+	ASSERT((incrementalModel.rowCount() == tester::test::command_menu_results::numberOfListedCommands), tester::shared::error_type_e::COMMAND, "Expected " + std::to_string(tester::test::command_menu_results::numberOfListedCommands) + " commands to be listed but got " + std::to_string(incrementalModel.rowCount()));
+	ASSERT((incrementalModel.data(incrementalModel.index(0, 0), Qt::ToolTipRole).toString() == tester::test::command_menu_results::help), tester::shared::error_type_e::COMMAND, "The tooltip of a command is expected to be its help");
+	ASSERT((incrementalModel.index(incrementalModel.rowCount(), 0).isValid() == false), tester::shared::error_type_e::COMMAND, "Index past the last command is expected to be invalid");
+
+	for (const QString & filter : tester::test::command_menu_results::filters) {
+		const std::vector<QString> expectedResults(this->getExpectedResults(filter));
+
+		// Type the filter one character at a time and compare the results at every keystroke
+		incrementalModel.setFilter(QString());
+		for (int keystroke = 1; keystroke <= filter.size(); keystroke++) {
+			const QString typedText(filter.left(keystroke));
+			incrementalModel.setFilter(typedText);
+			const std::vector<QString> incrementalResults(this->getResults(incrementalModel));
+			const std::vector<QString> keystrokeExpectedResults(this->getExpectedResults(typedText));
+			ASSERT((incrementalResults == keystrokeExpectedResults), tester::shared::error_type_e::COMMAND, "Typing filter " + typedText.toStdString() + " one character at a time returned " + std::to_string(incrementalResults.size()) + " commands whereas " + std::to_string(keystrokeExpectedResults.size()) + " were expected or their order is different");
+		}
+
+		// Setting the whole filter at once must give the same results
+		app::command_menu::CommandMenuModel fullModel(nullptr);
+		fullModel.setActions(actions);
+		fullModel.setFilter(filter);
+		const std::vector<QString> fullResults(this->getResults(fullModel));
+		ASSERT((fullResults == expectedResults), tester::shared::error_type_e::COMMAND, "Setting filter " + filter.toStdString() + " returned " + std::to_string(fullResults.size()) + " commands whereas " + std::to_string(expectedResults.size()) + " were expected or their order is different");
+
+		// Deleting characters must restore the results of the shorter filter
+		if (filter.size() > 1) {
+			const QString shorterFilter(filter.left(filter.size() / 2));
+			incrementalModel.setFilter(shorterFilter);
+			const std::vector<QString> shorterResults(this->getResults(incrementalModel));
+			ASSERT((shorterResults == this->getExpectedResults(shorterFilter)), tester::shared::error_type_e::COMMAND, "Deleting characters down to filter " + shorterFilter.toStdString() + " returned unexpected commands");
+		}
+	}
+
+	// Filtering is case insensitive
+	incrementalModel.setFilter("tab");
+	const std::vector<QString> lowercaseResults(this->getResults(incrementalModel));
+	incrementalModel.setFilter("TAB");
+	const std::vector<QString> uppercaseResults(this->getResults(incrementalModel));
+	ASSERT((lowercaseResults == uppercaseResults), tester::shared::error_type_e::COMMAND, "Filters differing only by case returned different commands");
+
+	// Characters matched at the beginning of words rank a command higher
+	incrementalModel.setFilter("ot");
+	ASSERT(((incrementalModel.rowCount() > 0) && (incrementalModel.data(incrementalModel.index(0, 0)).toString() == "open-tab")), tester::shared::error_type_e::COMMAND, "Expected open-tab to be the best match of filter ot");
+
+	// Characters must appear in the same order as in the filter
+	incrementalModel.setFilter("bat");
+	const std::vector<QString> reversedResults(this->getResults(incrementalModel));
+	ASSERT((std::find(reversedResults.cbegin(), reversedResults.cend(), "open-tab") == reversedResults.cend()), tester::shared::error_type_e::COMMAND, "Filter bat is not expected to match open-tab");
+
+	incrementalModel.setFilter("xyz");
+	ASSERT((incrementalModel.rowCount() == 0), tester::shared::error_type_e::COMMAND, "Filter xyz is not expected to match any command but " + std::to_string(incrementalModel.rowCount()) + " were listed");
+
+	// Refining a filter only scores commands matching the previous filter
+	app::command_menu::CommandMenuModel countingModel(nullptr);
+	countingModel.setActions(actions);
+	countingModel.setFilter("s");
+	const std::size_t scoredFirstKeystroke = countingModel.getScoredCommandCount();
+	const int matchesFirstKeystroke = countingModel.rowCount();
+	countingModel.setFilter("sc");
+	const std::size_t scoredSecondKeystroke = countingModel.getScoredCommandCount() - scoredFirstKeystroke;
+	ASSERT((scoredSecondKeystroke <= static_cast<std::size_t>(matchesFirstKeystroke)), tester::shared::error_type_e::PERFORMANCE, "Filter sc scored " + std::to_string(scoredSecondKeystroke) + " commands whereas only " + std::to_string(matchesFirstKeystroke) + " matched filter s");
+}
@@ -0,0 +1,122 @@
+/**
+ * @copyright
+ * @file disabled_context_overhead.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Disabled context overhead functions
+ */
+
+#include <chrono>
+
+// Qt libraries
+#include <QtCore/QTemporaryDir>
+
+#include "app/utility/logger/backend.h"
+#include "app/utility/logger/macros.h"
+#include "app/utility/logger/registry.h"
+#include "tester/tests/disabled_context_overhead.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(disabledContextOverheadOverall, disabledContextOverhead.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(disabledContextOverheadTest, disabledContextOverhead.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(disabledContextOverheadMessage, disabledContextOverhead.message, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace disabled_context_overhead {
+
+			namespace {
+
+				/**
+				 * @brief Number of messages logged while the context is disabled
+				 *
+				 */
+				static const std::uint64_t disabledMessages = 50000000;
+
+				/**
+				 * @brief Number of messages logged while the context is enabled
+				 *
+				 */
+				static const std::uint64_t enabledMessages = 200000;
+
+				/**
+				 * @brief Rule disabling the information messages of the context messages are logged to
+				 *
+				 */
+				static const std::string disablingRule("disabledContextOverhead.message=warning");
+
+				/**
+				 * @brief Minimum ratio between the time taken by a message logged to an enabled context and the time taken by a message logged to a disabled context
+				 *
+				 */
+				static const double minimumSpeedup = 10.0;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::DisabledContextOverhead::DisabledContextOverhead(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Disabled context overhead"), evaluations(0) {
+	LOG_INFO(app::logger::info_level_e::ZERO, disabledContextOverheadOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::DisabledContextOverhead::~DisabledContextOverhead() {
+	LOG_INFO(app::logger::info_level_e::ZERO, disabledContextOverheadOverall, "Test " << this->getName() << " destructor");
+}
+
+std::uint64_t tester::test::DisabledContextOverhead::evaluateArgument() {
+	this->evaluations++;
+	return this->evaluations;
+}
+
+std::int64_t tester::test::DisabledContextOverhead::logMessages(const std::uint64_t & messages, const std::string & filename) {
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (std::uint64_t iteration = 0; iteration < messages; iteration++) {
+		LOG_INFO_TO_FILE(app::logger::info_level_e::ZERO, disabledContextOverheadMessage, filename, "iteration " << iteration << " evaluation " << this->evaluateArgument());
+	}
+	app::logger::Backend::getInstance()->flush();
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void tester::test::DisabledContextOverhead::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, disabledContextOverheadTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == false) {
+		return;
+	}
+
+	app::logger::Registry * registry = app::logger::Registry::getInstance();
+	const std::string initialRules(registry->getRules());
+	const std::string filename(directory.path().toStdString() + "/overhead.log");
+
+	const bool enabled = disabledContextOverheadMessage().isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::ZERO);
+	ASSERT((enabled == true), tester::shared::error_type_e::TEST, "Information messages are expected to be enabled in order to compare against disabled ones");
+	this->evaluations = 0;
+	const std::int64_t enabledTime = this->logMessages(tester::test::disabled_context_overhead::enabledMessages, filename);
+	const std::uint64_t enabledEvaluations = this->evaluations;
+	app::logger::Backend::getInstance()->close(filename);
+
+	registry->setRules(initialRules + "," + tester::test::disabled_context_overhead::disablingRule);
+	this->evaluations = 0;
+	const std::int64_t disabledTime = this->logMessages(tester::test::disabled_context_overhead::disabledMessages, filename);
+	const std::uint64_t disabledEvaluations = this->evaluations;
+	registry->setRules(initialRules);
+	app::logger::Backend::getInstance()->close(filename);
+
+	const double enabledTimePerMessage = static_cast<double>(enabledTime) / static_cast<double>(tester::test::disabled_context_overhead::enabledMessages);
+	const double disabledTimePerMessage = static_cast<double>(disabledTime) / static_cast<double>(tester::test::disabled_context_overhead::disabledMessages);
+	LOG_INFO(app::logger::info_level_e::ZERO, disabledContextOverheadTest, "Logging " << tester::test::disabled_context_overhead::enabledMessages << " messages to an enabled context took " << enabledTime << "ns (" << enabledTimePerMessage << " ns/message) - logging " << tester::test::disabled_context_overhead::disabledMessages << " messages to a disabled context took " << disabledTime << "ns (" << disabledTimePerMessage << " ns/message)");
+
+	ASSERT((enabledEvaluations == tester::test::disabled_context_overhead::enabledMessages), tester::shared::error_type_e::TEST, "Arguments of messages logged to an enabled context were evaluated " + std::to_string(enabledEvaluations) + " times instead of " + std::to_string(tester::test::disabled_context_overhead::enabledMessages));
+	ASSERT((disabledEvaluations == 0), tester::shared::error_type_e::PERFORMANCE, "Arguments of messages logged to a disabled context were evaluated " + std::to_string(disabledEvaluations) + " times");
+	ASSERT(((disabledTimePerMessage * tester::test::disabled_context_overhead::minimumSpeedup) <= enabledTimePerMessage), tester::shared::error_type_e::PERFORMANCE, "A message logged to a disabled context takes " + std::to_string(disabledTimePerMessage) + " ns whereas a message logged to an enabled context takes " + std::to_string(enabledTimePerMessage) + " ns");
+}
@@ -20,8 +20,8 @@
 #include "tester/base/suite.h"
 #include "tester/top/main_window_wrapper.h"
 
-LOGGING_CONTEXT(editPathInStatusbarOverall, editPathInStatusbar.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(editPathInStatusbarTest, editPathInStatusbar.test, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(editPathInStatusbarOverall, editPathInStatusbar.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(editPathInStatusbarTest, editPathInStatusbar.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace tester {
 
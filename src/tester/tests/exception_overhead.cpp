@@ -0,0 +1,212 @@
+/**
+ * @copyright
+ * @file exception_overhead.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Exception overhead functions
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include <QtWidgets/QApplication>
+
+#include "app/shared/enums.h"
+#include "app/shared/exception.h"
+#include "app/shared/cpp_functions.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "app/windows/main_window/tabs/scroll_manager.h"
+#include "app/windows/main_window/tabs/web_engine_page.h"
+#include "tester/tests/exception_overhead.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(exceptionOverheadOverall, exceptionOverhead.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(exceptionOverheadTest, exceptionOverhead.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace exception_overhead {
+
+			namespace {
+
+				/**
+				 * @brief Number of exceptions thrown to measure their cost
+				 *
+				 */
+				static const int numberOfThrows = 100000;
+
+				/**
+				 * @brief Number of times every file is read
+				 *
+				 */
+				static const int numberOfReads = 1000;
+
+				/**
+				 * @brief File with content read by the benchmark
+				 *
+				 */
+				static const std::string textFilename("exception_overhead.txt");
+
+				/**
+				 * @brief Empty file read by the benchmark
+				 *
+				 */
+				static const std::string emptyFilename("exception_overhead_empty.txt");
+
+				/**
+				 * @brief Number of lines of the long page
+				 *
+				 */
+				static const int numberOfLines = 20000;
+
+				/**
+				 * @brief Number of scroll commands sent to every page
+				 *
+				 */
+				static const int numberOfCommands = 200;
+
+				/**
+				 * @brief Timeout in milliseconds to wait for a page to load or to settle
+				 *
+				 */
+				static const int timeout = 10000;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::ExceptionOverhead::ExceptionOverhead(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Exception overhead") {
+	LOG_INFO(app::logger::info_level_e::ZERO, exceptionOverheadOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::ExceptionOverhead::~ExceptionOverhead() {
+	LOG_INFO(app::logger::info_level_e::ZERO, exceptionOverheadOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::ExceptionOverhead::checkExceptionFormatting() {
+	const int & throws = tester::test::exception_overhead::numberOfThrows;
+	int caught = 0;
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int iteration = 0; iteration < throws; iteration++) {
+		try {
+			EXCEPTION_ACTION_COND((iteration >= 0), throw, "Iteration " << iteration);
+		} catch (const app::exception::Exception & exc) {
+			caught += exc.getLine();
+		}
+	}
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	const double throwTime = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(throws);
+
+	const app::exception::Exception exception(__LINE__, __FILE__, "condition", "message");
+	const std::chrono::steady_clock::time_point formatStart = std::chrono::steady_clock::now();
+	const char * description = exception.what();
+	const std::chrono::steady_clock::time_point formatEnd = std::chrono::steady_clock::now();
+	const double formatTime = std::chrono::duration<double, std::nano>(formatEnd - formatStart).count();
+
+	LOG_INFO(app::logger::info_level_e::ZERO, exceptionOverheadTest, "Throwing and catching " << throws << " exceptions took " << throwTime << " ns/exception - formatting the description took " << formatTime << " ns");
+
+	ASSERT((caught != 0), tester::shared::error_type_e::TEST, "No exception was caught");
+	ASSERT((std::strstr(description, "message") != nullptr), tester::shared::error_type_e::TEST, "Description \"" + std::string(description) + "\" does not contain the message of the exception");
+	ASSERT((exception.what() == description), tester::shared::error_type_e::PERFORMANCE, "Description of an exception is expected to be formatted once and cached");
+}
+
+void tester::test::ExceptionOverhead::checkReadFile() {
+	std::ofstream textFile(tester::test::exception_overhead::textFilename, (std::ios::out | std::ios::trunc));
+	for (int lineIdx = 0; lineIdx < 1000; lineIdx++) {
+		textFile << "Line " << lineIdx << " of a file read until its end\n";
+	}
+	textFile.close();
+	std::ofstream emptyFile(tester::test::exception_overhead::emptyFilename, (std::ios::out | std::ios::trunc));
+	emptyFile.close();
+
+	const std::uint64_t initialExceptions = app::exception::Exception::getCreatedExceptions();
+	std::size_t characters = 0;
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int iteration = 0; iteration < tester::test::exception_overhead::numberOfReads; iteration++) {
+		characters += app::shared::readFile(tester::test::exception_overhead::textFilename).size();
+		characters += app::shared::readFile(tester::test::exception_overhead::emptyFilename).size();
+	}
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	const std::uint64_t exceptions = app::exception::Exception::getCreatedExceptions() - initialExceptions;
+
+	const int reads = 2 * tester::test::exception_overhead::numberOfReads;
+	const double readTime = std::chrono::duration<double, std::micro>(end - start).count() / static_cast<double>(reads);
+	LOG_INFO(app::logger::info_level_e::ZERO, exceptionOverheadTest, reads << " files read (" << characters << " characters) in " << readTime << " us/file with " << (static_cast<double>(exceptions) / static_cast<double>(reads)) << " exceptions/file");
+
+	ASSERT((exceptions == 0), tester::shared::error_type_e::PERFORMANCE, std::to_string(exceptions) + " exceptions were thrown while reading " + std::to_string(reads) + " files");
+
+	std::remove(tester::test::exception_overhead::textFilename.c_str());
+	std::remove(tester::test::exception_overhead::emptyFilename.c_str());
+}
+
+void tester::test::ExceptionOverhead::checkScroll() {
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+
+	// A long page scrolls whereas a page shorter than the window does not
+	for (const int & lines : { tester::test::exception_overhead::numberOfLines, 1 }) {
+		std::ofstream textFile(tester::test::exception_overhead::textFilename, (std::ios::out | std::ios::trunc));
+		for (int lineIdx = 0; lineIdx < lines; lineIdx++) {
+			textFile << "Line " << lineIdx << " of a page scrolled down and up\n";
+		}
+		textFile.close();
+
+		tabs->openTabInBackground(app::main_window::page_type_e::TEXT, QString::fromStdString(tester::test::exception_overhead::textFilename));
+		const int tabIdx = tabs->count() - 1;
+		tabs->setCurrentIndex(tabIdx);
+		QApplication::processEvents(QEventLoop::AllEvents);
+
+		const std::shared_ptr<app::main_window::tab::Tab> tab = tabs->widget(tabIdx, true);
+		WAIT_FOR_CONDITION((tab->getLoadStatus() == app::base::tab::load_status_e::FINISHED), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " has not finished loading", tester::test::exception_overhead::timeout);
+
+		const std::shared_ptr<app::main_window::tab::WebEnginePage> page = tab->getPage();
+		const std::uint64_t initialExceptions = app::exception::Exception::getCreatedExceptions();
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int commandIdx = 0; commandIdx < tester::test::exception_overhead::numberOfCommands; commandIdx++) {
+			tabs->scrollTab(tabIdx, app::shared::offset_type_e::DOWN);
+			QApplication::processEvents(QEventLoop::AllEvents);
+		}
+		for (int commandIdx = 0; commandIdx < tester::test::exception_overhead::numberOfCommands; commandIdx++) {
+			tabs->scrollTab(tabIdx, app::shared::offset_type_e::UP);
+			QApplication::processEvents(QEventLoop::AllEvents);
+		}
+		WAIT_FOR_CONDITION((qRound(page->scrollPosition().y()) == 0), tester::shared::error_type_e::TABS, "Vertical position of tab " + std::to_string(tabIdx) + " is " + std::to_string(page->scrollPosition().y()) + " whereas it is expected to settle at the top of the page", tester::test::exception_overhead::timeout);
+		const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		const std::uint64_t exceptions = app::exception::Exception::getCreatedExceptions() - initialExceptions;
+
+		const int commands = 2 * tester::test::exception_overhead::numberOfCommands;
+		const int percentage = tab->getScrollManager()->getVerticalScrollPercentage();
+		const std::int64_t elapsedTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+		LOG_INFO(app::logger::info_level_e::ZERO, exceptionOverheadTest, commands << " scroll commands sent to a page of " << lines << " lines settled after " << elapsedTime << "ms with " << (static_cast<double>(exceptions) / static_cast<double>(commands)) << " exceptions/command - vertical scroll " << percentage << "%");
+
+		ASSERT((exceptions == 0), tester::shared::error_type_e::PERFORMANCE, std::to_string(exceptions) + " exceptions were thrown while sending " + std::to_string(commands) + " scroll commands to a page of " + std::to_string(lines) + " lines");
+		ASSERT(((percentage >= 0) && (percentage <= 100)), tester::shared::error_type_e::TABS, "Vertical scroll of a page of " + std::to_string(lines) + " lines is " + std::to_string(percentage) + "%");
+
+		tabs->removeTab(tabIdx);
+		QApplication::processEvents(QEventLoop::AllEvents);
+	}
+
+	std::remove(tester::test::exception_overhead::textFilename.c_str());
+}
+
+void tester::test::ExceptionOverhead::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, exceptionOverheadTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	this->checkExceptionFormatting();
+	this->checkReadFile();
+	this->checkScroll();
+}
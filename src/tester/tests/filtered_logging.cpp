@@ -0,0 +1,115 @@
+/**
+ * @copyright
+ * @file filtered_logging.cpp
+ * @author Andrea Gianarda
+ * @date 30th August 2020
+ * @brief Filtered logging functions
+ */
+
+#include <list>
+#include <chrono>
+
+#include "app/shared/enums.h"
+#include "app/utility/logger/macros.h"
+#include "app/utility/logger/filter.h"
+#include "app/utility/logger/registry.h"
+#include "app/windows/main_window/json/action.h"
+#include "tester/tests/filtered_logging.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(filteredLoggingOverall, filteredLogging.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(filteredLoggingTest, filteredLogging.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace filtered_logging {
+
+			namespace {
+
+				/**
+				 * @brief Path towards JSON file storing informations about commands and shortcuts
+				 *
+				 */
+				static const std::string jsonFilePath("json/");
+
+				/**
+				 * @brief JSON files loaded by the benchmark
+				 *
+				 */
+				static const std::list<std::string> jsonFiles({ jsonFilePath + "global_commands.json", jsonFilePath + "tab_commands.json" });
+
+				/**
+				 * @brief Number of times JSON files are loaded for every threshold
+				 *
+				 */
+				static const int numberOfIterations = 100;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::FilteredLogging::FilteredLogging(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Filtered logging") {
+	LOG_INFO(app::logger::info_level_e::ZERO, filteredLoggingOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::FilteredLogging::~FilteredLogging() {
+	LOG_INFO(app::logger::info_level_e::ZERO, filteredLoggingOverall, "Test " << this->getName() << " destructor");
+}
+
+std::int64_t tester::test::FilteredLogging::loadActions(const std::string & rule, const app::logger::msg_type_e & minimumType, const app::logger::info_level_e & maximumVerbosity, std::size_t & numberOfActions) const {
+	const app::logger::msg_type_e initialMinimumType = app::logger::Filter::getMinimumType();
+	const app::logger::info_level_e initialMaximumVerbosity = app::logger::Filter::getMaximumVerbosity();
+	app::logger::Registry * registry = app::logger::Registry::getInstance();
+	const std::string initialRules(registry->getRules());
+
+	// Contexts start from their default thresholds therefore a rule is needed to print messages with a higher verbosity
+	app::logger::Filter::setThreshold(minimumType, maximumVerbosity);
+	registry->setRules(rule);
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int iteration = 0; iteration < tester::test::filtered_logging::numberOfIterations; iteration++) {
+		const app::main_window::json::Action actions(tester::test::filtered_logging::jsonFiles);
+		numberOfActions = actions.getActions().size();
+	}
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	registry->setRules(initialRules);
+	app::logger::Filter::setThreshold(initialMinimumType, initialMaximumVerbosity);
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void tester::test::FilteredLogging::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, filteredLoggingTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName() << " - verbosity compiled in: " << app::logger::info_level_e::INFO_VERBOSITY);
+
+	// Loading JSON files logs information messages with verbosity HIGH therefore the comparison is meaningless if they are removed at compile time
+	if (app::logger::Filter::isCompiledIn(app::logger::msg_type_e::INFO, app::logger::info_level_e::HIGH) == false) {
+		LOG_WARNING(filteredLoggingTest, "Test " << this->getName() << " is skipped because information messages with verbosity HIGH are removed at compile time. Build with INFO_VERBOSITY=HIGH to run it");
+		return;
+	}
+
+	std::size_t highVerbosityActions = 0;
+	const std::int64_t highVerbosityTime = this->loadActions("*=info:high", app::logger::msg_type_e::INFO, app::logger::info_level_e::HIGH, highVerbosityActions);
+
+	std::size_t zeroVerbosityActions = 0;
+	const std::int64_t zeroVerbosityTime = this->loadActions("*=info:zero", app::logger::msg_type_e::INFO, app::logger::info_level_e::ZERO, zeroVerbosityActions);
+
+	// Information messages are all filtered out by the runtime threshold
+	std::size_t noInfoActions = 0;
+	const std::int64_t noInfoTime = this->loadActions("*=warning", app::logger::msg_type_e::WARNING, app::logger::info_level_e::ZERO, noInfoActions);
+
+	const int & iterations = tester::test::filtered_logging::numberOfIterations;
+	LOG_INFO(app::logger::info_level_e::ZERO, filteredLoggingTest, "Loading " << tester::test::filtered_logging::jsonFiles.size() << " JSON files " << iterations << " times with verbosity HIGH took " << highVerbosityTime << "ns (" << (highVerbosityTime / iterations) << " ns/iteration)");
+	LOG_INFO(app::logger::info_level_e::ZERO, filteredLoggingTest, "Loading " << tester::test::filtered_logging::jsonFiles.size() << " JSON files " << iterations << " times with verbosity ZERO took " << zeroVerbosityTime << "ns (" << (zeroVerbosityTime / iterations) << " ns/iteration)");
+	LOG_INFO(app::logger::info_level_e::ZERO, filteredLoggingTest, "Loading " << tester::test::filtered_logging::jsonFiles.size() << " JSON files " << iterations << " times with information messages disabled took " << noInfoTime << "ns (" << (noInfoTime / iterations) << " ns/iteration)");
+
+	ASSERT((highVerbosityActions == zeroVerbosityActions), tester::shared::error_type_e::TEST, "Number of actions loaded with verbosity HIGH (" + std::to_string(highVerbosityActions) + ") differs from the one loaded with verbosity ZERO (" + std::to_string(zeroVerbosityActions) + ")");
+	ASSERT((highVerbosityActions == noInfoActions), tester::shared::error_type_e::TEST, "Number of actions loaded with verbosity HIGH (" + std::to_string(highVerbosityActions) + ") differs from the one loaded with information messages disabled (" + std::to_string(noInfoActions) + ")");
+}
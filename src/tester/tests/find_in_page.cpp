@@ -0,0 +1,325 @@
+/**
+ * @copyright
+ * @file find_in_page.cpp
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Find in page functions
+ */
+
+#include <chrono>
+#include <random>
+#include <fstream>
+#include <algorithm>
+
+// Qt libraries
+#include <QtCore/QTemporaryDir>
+#include <QtWidgets/QApplication>
+
+#include "app/shared/enums.h"
+#include "app/utility/cpp/mapped_file.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "app/windows/main_window/tabs/text_match_index.h"
+#include "app/windows/shared/find_settings.h"
+#include "tester/tests/find_in_page.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(findInPageOverall, findInPage.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(findInPageTest, findInPage.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace find_in_page {
+
+			namespace {
+
+				/**
+				 * @brief Size in bytes of the text file
+				 *
+				 */
+				static const std::size_t fileSize = 50 * 1024 * 1024;
+
+				/**
+				 * @brief Number of distinct words in the text file
+				 *
+				 */
+				static const std::size_t vocabularySize = 20000;
+
+				/**
+				 * @brief Number of words in a line of the text file
+				 *
+				 */
+				static const int wordsPerLine = 12;
+
+				/**
+				 * @brief Number of searched terms
+				 *
+				 */
+				static const int numberOfTerms = 1000;
+
+				/**
+				 * @brief Number of searched terms that are not in the text file
+				 *
+				 */
+				static const int numberOfMissingTerms = 100;
+
+				/**
+				 * @brief Number of searched terms whose matches are checked against std::string::find
+				 *
+				 */
+				static const int numberOfCheckedTerms = 40;
+
+				/**
+				 * @brief Seed of the random number generator
+				 *
+				 */
+				static const unsigned int seed = 24680;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::FindInPage::FindInPage(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Find in page") {
+	LOG_INFO(app::logger::info_level_e::ZERO, findInPageOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::FindInPage::~FindInPage() {
+	LOG_INFO(app::logger::info_level_e::ZERO, findInPageOverall, "Test " << this->getName() << " destructor");
+}
+
+std::string tester::test::FindInPage::createContent(std::vector<std::string> & vocabulary) const {
+	std::mt19937 generator(tester::test::find_in_page::seed);
+	std::uniform_int_distribution<int> lengthDistribution(4, 9);
+	std::uniform_int_distribution<int> letterDistribution(0, 25);
+	std::uniform_int_distribution<int> percentageDistribution(0, 99);
+
+	vocabulary.clear();
+	vocabulary.reserve(tester::test::find_in_page::vocabularySize);
+	for (std::size_t wordIdx = 0; wordIdx < tester::test::find_in_page::vocabularySize; wordIdx++) {
+		std::string word;
+		const int length = lengthDistribution(generator);
+		for (int letterIdx = 0; letterIdx < length; letterIdx++) {
+			word.push_back(static_cast<char>('a' + letterDistribution(generator)));
+		}
+		vocabulary.push_back(word);
+	}
+
+	std::uniform_int_distribution<std::size_t> wordDistribution(0, (vocabulary.size() - 1));
+	std::string content;
+	content.reserve(tester::test::find_in_page::fileSize + 256);
+	int wordInLine = 0;
+	while (content.size() < tester::test::find_in_page::fileSize) {
+		std::string word(vocabulary.at(wordDistribution(generator)));
+		const int percentage = percentageDistribution(generator);
+		if (percentage < 10) {
+			// Capitalized words only match case insensitive searches
+			word.front() = static_cast<char>(word.front() - 'a' + 'A');
+		} else if (percentage < 15) {
+			// Joined words only match searches that are not restricted to full words
+			word += vocabulary.at(wordDistribution(generator));
+		}
+		content += word;
+
+		wordInLine++;
+		if (wordInLine == tester::test::find_in_page::wordsPerLine) {
+			content.push_back('\n');
+			wordInLine = 0;
+		} else {
+			content.push_back(' ');
+		}
+	}
+
+	return content;
+}
+
+std::size_t tester::test::FindInPage::referenceCount(const std::string & content, const std::string & lowerContent, const std::string & term, const bool & caseSensitive, const bool & matchFullWord) const {
+	const std::string & searchedContent = (caseSensitive == true) ? content : lowerContent;
+	std::string searchedTerm(term);
+	if (caseSensitive == false) {
+		std::transform(searchedTerm.begin(), searchedTerm.end(), searchedTerm.begin(), [] (const char & byte) {
+			return ((byte >= 'A') && (byte <= 'Z')) ? static_cast<char>(byte - 'A' + 'a') : byte;
+		});
+	}
+
+	auto isWordByte = [] (const char & byte) {
+		return (((byte >= 'a') && (byte <= 'z')) || ((byte >= 'A') && (byte <= 'Z')) || ((byte >= '0') && (byte <= '9')) || (byte == '_'));
+	};
+
+	std::size_t count = 0;
+	std::size_t position = searchedContent.find(searchedTerm);
+	while (position != std::string::npos) {
+		bool match = true;
+		if (matchFullWord == true) {
+			const bool wordStart = (position == 0) || (isWordByte(searchedContent.at(position - 1)) == false);
+			const bool wordEnd = ((position + searchedTerm.size()) == searchedContent.size()) || (isWordByte(searchedContent.at(position + searchedTerm.size())) == false);
+			match = ((wordStart == true) && (wordEnd == true));
+		}
+
+		if (match == true) {
+			count++;
+			position = searchedContent.find(searchedTerm, position + searchedTerm.size());
+		} else {
+			position = searchedContent.find(searchedTerm, position + 1);
+		}
+	}
+
+	return count;
+}
+
+void tester::test::FindInPage::findInTab(const QString & path, const QString & term, const int & expectedMatches) {
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+
+	const int initialTabIdx = tabs->currentIndex();
+	const int tabIdx = tabs->openTabInBackground(app::main_window::page_type_e::TEXT, path);
+	tabs->setCurrentIndex(tabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	const std::shared_ptr<app::main_window::tab::Tab> tab = tabs->widget(tabIdx, true);
+	WAIT_FOR_CONDITION((tab->getLoadStatus() == app::base::tab::load_status_e::FINISHED), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " has not finished loading", 10000);
+
+	int activeMatch = -1;
+	int numberOfMatches = -1;
+	const QMetaObject::Connection resultConnection = QObject::connect(tab.get(), &app::main_window::tab::Tab::searchResultChanged, [&] (const app::main_window::tab::search_data_s & data) {
+		activeMatch = data.activeMatch;
+		numberOfMatches = data.numberOfMatches;
+	});
+
+	// The index of the matches is built by the first search and the other ones move through it
+	const std::chrono::steady_clock::time_point findStart = std::chrono::steady_clock::now();
+	tab->find(app::windows::shared::FindSettings(term, app::shared::offset_type_e::DOWN, true, true));
+	const std::chrono::steady_clock::time_point findEnd = std::chrono::steady_clock::now();
+	ASSERT((activeMatch == 1), tester::shared::error_type_e::TABS, "Searching " + term.toStdString() + " forward in the tab moved to match " + std::to_string(activeMatch) + " whereas it is expected to move to the first one");
+	ASSERT((numberOfMatches == expectedMatches), tester::shared::error_type_e::TABS, "Searching " + term.toStdString() + " in the tab found " + std::to_string(numberOfMatches) + " matches whereas " + std::to_string(expectedMatches) + " are expected");
+
+	tab->find(app::windows::shared::FindSettings(term, app::shared::offset_type_e::UP, true, true));
+	tab->find(app::windows::shared::FindSettings(term, app::shared::offset_type_e::UP, true, true));
+	const std::chrono::steady_clock::time_point stepEnd = std::chrono::steady_clock::now();
+	const int expectedActiveMatch = std::max(1, (expectedMatches - 1));
+	ASSERT((activeMatch == expectedActiveMatch), tester::shared::error_type_e::TABS, "Searching " + term.toStdString() + " backward twice in the tab moved to match " + std::to_string(activeMatch) + " whereas it is expected to move to match " + std::to_string(expectedActiveMatch));
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	const std::int64_t findTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(findEnd - findStart).count());
+	const std::int64_t stepTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(stepEnd - findEnd).count());
+	LOG_INFO(app::logger::info_level_e::ZERO, findInPageTest, "Tab search of " << term << " - first match after " << findTime << "us - two steps backward in " << stepTime << "us");
+
+	QObject::disconnect(resultConnection);
+	tabs->setCurrentIndex(initialTabIdx);
+	tabs->removeTab(tabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+}
+
+void tester::test::FindInPage::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, findInPageTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == false) {
+		return;
+	}
+
+	std::vector<std::string> vocabulary;
+	const std::string content(this->createContent(vocabulary));
+	const QString path(directory.path() + "/find_in_page.txt");
+	std::ofstream textFile(path.toStdString(), (std::ios::out | std::ios::trunc | std::ios::binary));
+	textFile.write(content.data(), static_cast<std::streamsize>(content.size()));
+	textFile.close();
+
+	const std::shared_ptr<app::utility::MappedFile> mappedFile = std::make_shared<app::utility::MappedFile>(path.toStdString());
+	ASSERT((mappedFile->size() == content.size()), tester::shared::error_type_e::TEST, "Text file has " + std::to_string(mappedFile->size()) + " bytes whereas " + std::to_string(content.size()) + " bytes were written");
+
+	std::string lowerContent(content);
+	std::transform(lowerContent.begin(), lowerContent.end(), lowerContent.begin(), [] (const char & byte) {
+		return ((byte >= 'A') && (byte <= 'Z')) ? static_cast<char>(byte - 'A' + 'a') : byte;
+	});
+
+	std::mt19937 generator(tester::test::find_in_page::seed);
+	std::uniform_int_distribution<std::size_t> wordDistribution(0, (vocabulary.size() - 1));
+
+	std::int64_t totalFirstMatchTime = 0;
+	std::int64_t maximumFirstMatchTime = 0;
+	std::int64_t totalStepTime = 0;
+	std::int64_t totalMatches = 0;
+	std::int64_t totalSteps = 0;
+	int termsFound = 0;
+	int mismatches = 0;
+
+	for (int termIdx = 0; termIdx < tester::test::find_in_page::numberOfTerms; termIdx++) {
+		std::string term;
+		if (termIdx < (tester::test::find_in_page::numberOfTerms - tester::test::find_in_page::numberOfMissingTerms)) {
+			term = vocabulary.at(wordDistribution(generator));
+			if ((termIdx % 3) == 0) {
+				term.front() = static_cast<char>(term.front() - 'a' + 'A');
+			}
+		} else {
+			// Digits are never written in the file
+			term = "missing" + std::to_string(termIdx);
+		}
+		const bool caseSensitive = ((termIdx % 2) == 1);
+		const bool matchFullWord = (((termIdx / 2) % 2) == 1);
+		const QString text(QString::fromStdString(term));
+
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		app::main_window::tab::TextMatchIndex index(mappedFile, text, caseSensitive, matchFullWord);
+		const int firstMatch = index.step(app::shared::offset_type_e::DOWN);
+		const std::chrono::steady_clock::time_point firstMatchEnd = std::chrono::steady_clock::now();
+
+		const int numberOfMatches = index.getNumberOfMatches();
+		std::size_t previousOffset = 0;
+		bool ordered = true;
+		for (int matchIdx = 1; matchIdx < numberOfMatches; matchIdx++) {
+			index.step(app::shared::offset_type_e::DOWN);
+			const std::size_t offset = index.getActiveOffset();
+			if (offset <= previousOffset) {
+				ordered = false;
+			}
+			previousOffset = offset;
+		}
+		const std::chrono::steady_clock::time_point stepEnd = std::chrono::steady_clock::now();
+
+		ASSERT((ordered == true), tester::shared::error_type_e::TEST, "Matches of " + term + " are not visited in increasing order of offset");
+		ASSERT((firstMatch == ((numberOfMatches > 0) ? 0 : -1)), tester::shared::error_type_e::TEST, "First search of " + term + " moved to match " + std::to_string(firstMatch));
+		if (numberOfMatches > 0) {
+			ASSERT((index.step(app::shared::offset_type_e::DOWN) == 0), tester::shared::error_type_e::TEST, "Moving past the last match of " + term + " is expected to wrap around to the first one");
+			ASSERT((index.step(app::shared::offset_type_e::UP) == (numberOfMatches - 1)), tester::shared::error_type_e::TEST, "Moving before the first match of " + term + " is expected to wrap around to the last one");
+			termsFound++;
+		}
+
+		if (termIdx < tester::test::find_in_page::numberOfCheckedTerms) {
+			const std::size_t expectedMatches = this->referenceCount(content, lowerContent, term, caseSensitive, matchFullWord);
+			if (expectedMatches != static_cast<std::size_t>(numberOfMatches)) {
+				mismatches++;
+				LOG_INFO(app::logger::info_level_e::ZERO, findInPageTest, "Found " << numberOfMatches << " matches of " << term << " whereas " << expectedMatches << " are expected - case sensitive " << caseSensitive << " match full word " << matchFullWord);
+			}
+		}
+
+		const std::int64_t firstMatchTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(firstMatchEnd - start).count());
+		totalFirstMatchTime += firstMatchTime;
+		maximumFirstMatchTime = std::max(maximumFirstMatchTime, firstMatchTime);
+		totalStepTime += static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stepEnd - firstMatchEnd).count());
+		totalMatches += numberOfMatches;
+		totalSteps += std::max(0, (numberOfMatches - 1));
+	}
+
+	ASSERT((mismatches == 0), tester::shared::error_type_e::TEST, "Number of matches differs from std::string::find for " + std::to_string(mismatches) + " terms out of " + std::to_string(tester::test::find_in_page::numberOfCheckedTerms));
+	ASSERT((termsFound > 0), tester::shared::error_type_e::TEST, "None of the " + std::to_string(tester::test::find_in_page::numberOfTerms) + " terms was found in the file");
+
+	const double averageFirstMatchTime = static_cast<double>(totalFirstMatchTime) / static_cast<double>(tester::test::find_in_page::numberOfTerms) / 1000.0;
+	const double averageStepTime = (totalSteps > 0) ? (static_cast<double>(totalStepTime) / static_cast<double>(totalSteps)) : 0.0;
+	LOG_INFO(app::logger::info_level_e::ZERO, findInPageTest, tester::test::find_in_page::numberOfTerms << " terms searched in " << (content.size() / (1024 * 1024)) << "MB - " << termsFound << " found with " << totalMatches << " matches in total - time to first match: average " << averageFirstMatchTime << "ms maximum " << (static_cast<double>(maximumFirstMatchTime) / 1000.0) << "ms - stepping through all matches: " << (static_cast<double>(totalStepTime) / 1000000.0) << "ms in total " << averageStepTime << "ns/match");
+
+	// Search a word through a tab showing the file
+	const std::string tabTerm(vocabulary.front());
+	const std::size_t tabMatches = this->referenceCount(content, lowerContent, tabTerm, true, true);
+	this->findInTab(path, QString::fromStdString(tabTerm), static_cast<int>(tabMatches));
+}
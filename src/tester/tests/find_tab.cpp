@@ -21,8 +21,8 @@
 #include "tester/base/suite.h"
 #include "tester/top/main_window_wrapper.h"
 
-LOGGING_CONTEXT(findTabOverall, findTab.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(findTabTest, findTab.test, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(findTabOverall, findTab.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(findTabTest, findTab.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace tester {
 
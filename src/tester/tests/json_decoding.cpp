@@ -0,0 +1,129 @@
+/**
+ * @copyright
+ * @file json_decoding.cpp
+ * @author Andrea Gianarda
+ * @date 1st September 2020
+ * @brief JSON decoding functions
+ */
+
+#include <list>
+#include <chrono>
+#include <fstream>
+
+#include "app/shared/enums.h"
+#include "app/shared/exception.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/json/action.h"
+#include "tester/tests/json_decoding.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(jsonDecodingOverall, jsonDecoding.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(jsonDecodingTest, jsonDecoding.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace json_decoding {
+
+			namespace {
+
+				/**
+				 * @brief Path towards JSON file storing informations about commands and shortcuts
+				 *
+				 */
+				static const std::string jsonFilePath("json/");
+
+				/**
+				 * @brief JSON files loaded by the benchmark
+				 *
+				 */
+				static const std::list<std::string> jsonFiles({ jsonFilePath + "tab_commands.json", jsonFilePath + "global_commands.json" });
+
+				/**
+				 * @brief Number of times every JSON file is loaded
+				 *
+				 */
+				static const int numberOfIterations = 10000;
+
+				/**
+				 * @brief JSON file with a schema error
+				 *
+				 */
+				static const std::string invalidJsonFilename("json_decoding_invalid.json");
+
+				/**
+				 * @brief Path of the offending value in the JSON file with a schema error
+				 *
+				 */
+				static const std::string invalidValuePath(invalidJsonFilename + "/Broken/Name");
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::JsonDecoding::JsonDecoding(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "JSON decoding") {
+	LOG_INFO(app::logger::info_level_e::ZERO, jsonDecodingOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::JsonDecoding::~JsonDecoding() {
+	LOG_INFO(app::logger::info_level_e::ZERO, jsonDecodingOverall, "Test " << this->getName() << " destructor");
+}
+
+std::int64_t tester::test::JsonDecoding::loadFile(const std::string & filename, std::size_t & numberOfActions) const {
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int iteration = 0; iteration < tester::test::json_decoding::numberOfIterations; iteration++) {
+		const app::main_window::json::Action actions(filename);
+		numberOfActions = actions.getActions().size();
+	}
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void tester::test::JsonDecoding::checkSchemaError() {
+	std::ofstream jsonFile(tester::test::json_decoding::invalidJsonFilename, (std::ios::out | std::ios::trunc));
+	jsonFile << "{\n";
+	jsonFile << "\t\"Broken\" : {\n";
+	jsonFile << "\t\t\"Name\" : [ \"arrays\", \"are\", \"not\", \"allowed\" ],\n";
+	jsonFile << "\t\t\"State\" : \"QUIT\"\n";
+	jsonFile << "\t}\n";
+	jsonFile << "}\n";
+	jsonFile.close();
+
+	std::string errorMessage = std::string();
+	try {
+		const app::main_window::json::Action actions(tester::test::json_decoding::invalidJsonFilename);
+	} catch (const app::exception::Exception & exc) {
+		errorMessage = exc.getMessage();
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, jsonDecodingTest, "Decoding a file with a schema error reported: " << errorMessage);
+
+	ASSERT((errorMessage.empty() == false), tester::shared::error_type_e::TEST, "No error was reported while decoding JSON file " + tester::test::json_decoding::invalidJsonFilename);
+	ASSERT((errorMessage.find(tester::test::json_decoding::invalidValuePath) != std::string::npos), tester::shared::error_type_e::TEST, "Error message \"" + errorMessage + "\" does not contain the path of the offending value " + tester::test::json_decoding::invalidValuePath);
+}
+
+void tester::test::JsonDecoding::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, jsonDecodingTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	const int & iterations = tester::test::json_decoding::numberOfIterations;
+	std::int64_t totalTime = 0;
+
+	for (const std::string & filename : tester::test::json_decoding::jsonFiles) {
+		std::size_t numberOfActions = 0;
+		const std::int64_t fileTime = this->loadFile(filename, numberOfActions);
+		totalTime += fileTime;
+		LOG_INFO(app::logger::info_level_e::ZERO, jsonDecodingTest, "Loading " << filename << " (" << numberOfActions << " actions) " << iterations << " times took " << fileTime << "ns (" << (fileTime / iterations) << " ns/load)");
+		ASSERT((numberOfActions > 0), tester::shared::error_type_e::TEST, "No action was decoded from JSON file " + filename);
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, jsonDecodingTest, "Loading " << tester::test::json_decoding::jsonFiles.size() << " JSON files " << iterations << " times took " << totalTime << "ns (" << (totalTime / iterations) << " ns/iteration)");
+
+	this->checkSchemaError();
+}
@@ -16,8 +16,8 @@
 #include "tester/tests/launch_app.h"
 #include "tester/base/suite.h"
 
-LOGGING_CONTEXT(launchAppOverall, launchApp.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(launchAppTest, launchApp.test, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(launchAppOverall, launchApp.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(launchAppTest, launchApp.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace tester {
 
@@ -0,0 +1,150 @@
+/**
+ * @copyright
+ * @file lazy_tabs.cpp
+ * @author Andrea Gianarda
+ * @date 01st September 2020
+ * @brief Lazy tabs functions
+ */
+
+#include <chrono>
+
+#include <QtWidgets/QApplication>
+
+#include "app/shared/enums.h"
+#include "app/shared/exception.h"
+#include "app/shared/qt_functions.h"
+#include "app/utility/cpp/process_memory.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "tester/tests/lazy_tabs.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(lazyTabsOverall, lazyTabs.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(lazyTabsTest, lazyTabs.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace lazy_tabs {
+
+			namespace {
+
+				/**
+				 * @brief File printed in every tab
+				 *
+				 */
+				static const std::string textFilename("lazy_tabs.txt");
+
+				/**
+				 * @brief Number of lines of the file printed in every tab
+				 *
+				 */
+				static const int numberOfLines = 1000;
+
+				/**
+				 * @brief Number of tabs opened in the background
+				 *
+				 */
+				static const int numberOfTabs = 200;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::LazyTabs::LazyTabs(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Lazy tabs") {
+	LOG_INFO(app::logger::info_level_e::ZERO, lazyTabsOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::LazyTabs::~LazyTabs() {
+	LOG_INFO(app::logger::info_level_e::ZERO, lazyTabsOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::LazyTabs::openTabs(const bool & lazy) {
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+	const QString filepath(QString::fromStdString(tester::test::lazy_tabs::textFilename));
+	const app::main_window::page_type_e type = app::main_window::page_type_e::TEXT;
+
+	const bool initialLazyTabs = tabs->isLazyTabs();
+	tabs->setLazyTabs(lazy);
+
+	// Make sure there is a current tab so that all tabs opened in the background are not visible
+	if (tabs->count() == 0) {
+		tabs->openTabInBackground(type, filepath);
+		QApplication::processEvents(QEventLoop::AllEvents);
+	}
+	const int initialTabCount = tabs->count();
+
+	const std::int64_t initialMemory = app::utility::getResidentMemory();
+	ASSERT((initialMemory >= 0), tester::shared::error_type_e::TEST, "Unable to read the resident memory of the process");
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (int tabIdx = 0; tabIdx < tester::test::lazy_tabs::numberOfTabs; tabIdx++) {
+		tabs->openTabInBackground(type, filepath);
+	}
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	const std::int64_t finalMemory = app::utility::getResidentMemory();
+
+	const std::int64_t elapsedTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+	const std::int64_t memoryIncrease = finalMemory - initialMemory;
+	const std::string mode((lazy == true) ? "lazy" : "eager");
+	LOG_INFO(app::logger::info_level_e::ZERO, lazyTabsTest, "[" << mode << "] " << tester::test::lazy_tabs::numberOfTabs << " tabs opened in the background in " << elapsedTime << "ms - resident memory increased by " << (memoryIncrease / 1024) << "kB from " << (initialMemory / 1024) << "kB to " << (finalMemory / 1024) << "kB");
+
+	const int tabCount = tabs->count();
+	ASSERT((tabCount == (initialTabCount + tester::test::lazy_tabs::numberOfTabs)), tester::shared::error_type_e::TABS, "Expected " + std::to_string(initialTabCount + tester::test::lazy_tabs::numberOfTabs) + " tabs but " + std::to_string(tabCount) + " are opened");
+
+	int placeholders = 0;
+	for (int tabIdx = initialTabCount; tabIdx < tabCount; tabIdx++) {
+		const std::shared_ptr<app::main_window::tab::Tab> tab = tabs->widget(tabIdx, true);
+		if (tab->isPlaceholder() == true) {
+			placeholders++;
+		}
+		ASSERT((tabs->getPageType(tabIdx) == type), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " is expected to be of type " + app::shared::qEnumToQString(type, true).toStdString());
+		ASSERT((tabs->getPageSource(tabIdx).compare(filepath) == 0), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " has source " + tabs->getPageSource(tabIdx).toStdString() + " whereas it is expected to be " + filepath.toStdString());
+	}
+
+	const int expectedPlaceholders = (lazy == true) ? tester::test::lazy_tabs::numberOfTabs : 0;
+	ASSERT((placeholders == expectedPlaceholders), tester::shared::error_type_e::TABS, "Expected " + std::to_string(expectedPlaceholders) + " placeholder tabs in " + mode + " mode but found " + std::to_string(placeholders));
+
+	// Moving to a background tab must create its web engine objects
+	const int lastTabIdx = tabCount - 1;
+	const int currentTabIdx = tabs->currentIndex();
+	tabs->setCurrentIndex(lastTabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+	ASSERT((tabs->widget(lastTabIdx, true)->isPlaceholder() == false), tester::shared::error_type_e::TABS, "Tab " + std::to_string(lastTabIdx) + " is still a placeholder after becoming the current tab");
+	ASSERT((tabs->getPage(lastTabIdx) != nullptr), tester::shared::error_type_e::TABS, "Tab " + std::to_string(lastTabIdx) + " has no page after becoming the current tab");
+	tabs->setCurrentIndex(currentTabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	// Close tabs opened by this function starting from the last one in order not to change the current tab
+	for (int tabIdx = (tabCount - 1); tabIdx >= initialTabCount; tabIdx--) {
+		tabs->removeTab(tabIdx);
+	}
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	tabs->setLazyTabs(initialLazyTabs);
+}
+
+void tester::test::LazyTabs::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, lazyTabsTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	std::ofstream textFile(tester::test::lazy_tabs::textFilename, (std::ios::out | std::ios::trunc));
+	for (int lineIdx = 0; lineIdx < tester::test::lazy_tabs::numberOfLines; lineIdx++) {
+		textFile << "Line " << lineIdx << " of the file printed in every tab opened in the background\n";
+	}
+	textFile.close();
+
+	this->openTabs(false);
+	this->openTabs(true);
+}
@@ -0,0 +1,222 @@
+/**
+ * @copyright
+ * @file log_rotation.cpp
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Log rotation functions
+ */
+
+#include <chrono>
+#include <fstream>
+
+// Qt libraries
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTemporaryDir>
+
+#include "app/utility/logger/backend.h"
+#include "app/utility/logger/macros.h"
+#include "tester/tests/log_rotation.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(logRotationOverall, logRotation.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(logRotationTest, logRotation.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace log_rotation {
+
+			namespace {
+
+				/**
+				 * @brief Number of bytes in a megabyte
+				 *
+				 */
+				static const std::uint64_t bytesInMegabyte = 1024 * 1024;
+
+				/**
+				 * @brief Bytes of log traffic written to the rotated file
+				 *
+				 */
+				static const std::uint64_t trafficSize = 500 * bytesInMegabyte;
+
+				/**
+				 * @brief Bytes of log traffic written to the file whose segments are compressed
+				 *
+				 */
+				static const std::uint64_t compressedTrafficSize = 100 * bytesInMegabyte;
+
+				/**
+				 * @brief Maximum size in bytes of the log file and its segments
+				 *
+				 */
+				static const std::uint64_t diskBudget = 50 * bytesInMegabyte;
+
+				/**
+				 * @brief Size in bytes a log file is rotated at
+				 *
+				 */
+				static const std::uint64_t maxFileSize = 8 * bytesInMegabyte;
+
+				/**
+				 * @brief Maximum number of segments of a log file
+				 *
+				 */
+				static const int segments = 8;
+
+				/**
+				 * @brief Bytes of traffic written between two checks of the disk space
+				 *
+				 */
+				static const std::uint64_t checkInterval = 25 * bytesInMegabyte;
+
+				/**
+				 * @brief Text filling the payload of every record to make it about 1 kB long
+				 *
+				 */
+				static const std::string padding(1000, 'x');
+
+				/**
+				 * @brief Text preceding the sequence number in every record
+				 *
+				 */
+				static const std::string sequenceTag("sequence ");
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::LogRotation::LogRotation(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Log rotation") {
+	LOG_INFO(app::logger::info_level_e::ZERO, logRotationOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::LogRotation::~LogRotation() {
+	LOG_INFO(app::logger::info_level_e::ZERO, logRotationOverall, "Test " << this->getName() << " destructor");
+}
+
+std::uint64_t tester::test::LogRotation::getUsedSpace(const std::string & directory) const {
+	std::uint64_t usedSpace = 0;
+	const QFileInfoList files(QDir(QString::fromStdString(directory)).entryInfoList(QDir::Files));
+	for (const QFileInfo & file : files) {
+		usedSpace += static_cast<std::uint64_t>(file.size());
+	}
+	return usedSpace;
+}
+
+std::vector<std::uint64_t> tester::test::LogRotation::readSequence(const std::string & filename, const int & segments) const {
+	std::vector<std::string> files;
+	for (int index = segments; index > 0; index--) {
+		files.push_back(filename + "." + std::to_string(index));
+	}
+	files.push_back(filename);
+
+	std::vector<std::uint64_t> sequence;
+	for (const std::string & file : files) {
+		std::ifstream ifile(file);
+		std::string line = std::string();
+		while (std::getline(ifile, line)) {
+			const std::size_t position = line.find(tester::test::log_rotation::sequenceTag);
+			if (position != std::string::npos) {
+				sequence.push_back(std::stoull(line.substr(position + tester::test::log_rotation::sequenceTag.size())));
+			}
+		}
+	}
+
+	return sequence;
+}
+
+void tester::test::LogRotation::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, logRotationTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == false) {
+		return;
+	}
+
+	app::logger::Backend * backend = app::logger::Backend::getInstance();
+	const app::logger::queue_policy_e initialPolicy = backend->getQueuePolicy();
+	const app::logger::rotation_s initialRotation(backend->getRotation());
+
+	// Records must not be dropped in order to check that the tail of the log is complete
+	backend->setQueuePolicy(app::logger::queue_policy_e::BLOCK);
+
+	for (const bool & compress : { false, true }) {
+		const std::string subdirectory((compress == true) ? "compressed" : "plain");
+		QDir(directory.path()).mkdir(QString::fromStdString(subdirectory));
+		const std::string logDirectory(directory.path().toStdString() + "/" + subdirectory);
+		const std::string filename(logDirectory + "/rotation.log");
+		const std::uint64_t traffic = (compress == true) ? tester::test::log_rotation::compressedTrafficSize : tester::test::log_rotation::trafficSize;
+
+		backend->setRotation({ tester::test::log_rotation::maxFileSize, 0, tester::test::log_rotation::segments, compress, tester::test::log_rotation::diskBudget });
+
+		std::uint64_t sequenceNumber = 0;
+		std::uint64_t writtenBytes = 0;
+		std::uint64_t nextCheck = tester::test::log_rotation::checkInterval;
+		std::uint64_t maxUsedSpace = 0;
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		while (writtenBytes < traffic) {
+			const std::chrono::nanoseconds now = std::chrono::system_clock::now().time_since_epoch();
+			std::string payload(tester::test::log_rotation::padding + " " + tester::test::log_rotation::sequenceTag + std::to_string(sequenceNumber));
+			writtenBytes += static_cast<std::uint64_t>(payload.size() + 1);
+			app::logger::record_s record = { nullptr, app::logger::msg_type_e::INFO, static_cast<std::int64_t>(now.count()), std::string(), filename, std::move(payload), app::logger::record_format_e::TEXT };
+			backend->push(std::move(record));
+			sequenceNumber++;
+
+			if (writtenBytes >= nextCheck) {
+				backend->flush();
+				const std::uint64_t usedSpace = this->getUsedSpace(logDirectory);
+				if (usedSpace > maxUsedSpace) {
+					maxUsedSpace = usedSpace;
+				}
+				nextCheck += tester::test::log_rotation::checkInterval;
+			}
+		}
+		backend->flush();
+		const std::chrono::steady_clock::time_point written = std::chrono::steady_clock::now();
+		backend->waitForSegments();
+		backend->close(filename);
+
+		const std::uint64_t usedSpace = this->getUsedSpace(logDirectory);
+		if (usedSpace > maxUsedSpace) {
+			maxUsedSpace = usedSpace;
+		}
+		const double elapsedTime = std::chrono::duration<double>(written - start).count();
+		const double throughput = (elapsedTime > 0.0) ? (static_cast<double>(writtenBytes) / static_cast<double>(tester::test::log_rotation::bytesInMegabyte) / elapsedTime) : 0.0;
+		LOG_INFO(app::logger::info_level_e::ZERO, logRotationTest, "[compression " << compress << "] " << writtenBytes << " bytes written in " << sequenceNumber << " records in " << elapsedTime << " s (" << throughput << " MB/s) - disk space used at the end: " << usedSpace << " bytes maximum: " << maxUsedSpace << " bytes budget: " << tester::test::log_rotation::diskBudget << " bytes");
+
+		ASSERT((maxUsedSpace <= tester::test::log_rotation::diskBudget), tester::shared::error_type_e::PERFORMANCE, "Log files used " + std::to_string(maxUsedSpace) + " bytes whereas the disk budget is " + std::to_string(tester::test::log_rotation::diskBudget) + " bytes");
+
+		if (compress == true) {
+			bool uncompressedSegments = false;
+			bool compressedSegments = false;
+			for (int index = 1; index <= tester::test::log_rotation::segments; index++) {
+				uncompressedSegments |= QFile::exists(QString::fromStdString(filename + "." + std::to_string(index)));
+				compressedSegments |= QFile::exists(QString::fromStdString(filename + "." + std::to_string(index) + ".gz"));
+			}
+			ASSERT((uncompressedSegments == false), tester::shared::error_type_e::TEST, "Segments of " + filename + " are expected to be compressed");
+			ASSERT((compressedSegments == true), tester::shared::error_type_e::TEST, "No compressed segment of " + filename + " was found");
+		} else {
+			// The most recent records must all be kept and in order
+			const std::vector<std::uint64_t> sequence(this->readSequence(filename, tester::test::log_rotation::segments));
+			bool contiguous = (sequence.empty() == false);
+			for (std::size_t idx = 1; idx < sequence.size(); idx++) {
+				contiguous &= (sequence.at(idx) == (sequence.at(idx - 1) + 1));
+			}
+			ASSERT((contiguous == true), tester::shared::error_type_e::TEST, "Records kept in " + filename + " and its segments are not contiguous");
+			ASSERT(((sequence.empty() == false) && (sequence.back() == (sequenceNumber - 1))), tester::shared::error_type_e::TEST, "The last record written to " + filename + " is missing");
+			LOG_INFO(app::logger::info_level_e::ZERO, logRotationTest, sequence.size() << " most recent records out of " << sequenceNumber << " are kept");
+		}
+	}
+
+	backend->setRotation(initialRotation);
+	backend->setQueuePolicy(initialPolicy);
+}
@@ -0,0 +1,152 @@
+/**
+ * @copyright
+ * @file log_rules.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Log rules functions
+ */
+
+#include <tuple>
+#include <vector>
+#include <algorithm>
+
+#include "app/shared/exception.h"
+#include "app/utility/logger/macros.h"
+#include "app/utility/logger/filter.h"
+#include "app/utility/logger/registry.h"
+#include "tester/tests/log_rules.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(logRulesOverall, logRules.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(logRulesTest, logRules.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(logRulesTarget, logRules.target, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace log_rules {
+
+			namespace {
+
+				/**
+				 * @brief Patterns, names and whether the name is expected to match the pattern
+				 *
+				 */
+				static const std::vector<std::tuple<std::string, std::string, bool>> patterns = {
+					std::make_tuple("mainWindowTabWidget.overall", "mainWindowTabWidget.overall", true),
+					std::make_tuple("mainWindowTabWidget.overall", "mainWindowTabWidget.overal", false),
+					std::make_tuple("mainWindowTabWidget.*", "mainWindowTabWidget.overall", true),
+					std::make_tuple("mainWindowTabWidget.*", "mainWindowTabWidgetTab.overall", false),
+					std::make_tuple("*.overall", "mainWindowTabWidget.overall", true),
+					std::make_tuple("*.overall", "mainWindowTabWidget.overallTab", false),
+					std::make_tuple("mainWindow*.overall", "mainWindowTabWidget.overall", true),
+					std::make_tuple("main*Tab*.*all", "mainWindowTabWidget.overall", true),
+					std::make_tuple("main*Tab*.*all", "mainWindowStatusBar.overall", false),
+					std::make_tuple("logRules.tes?", "logRules.test", true),
+					std::make_tuple("logRules.tes?", "logRules.tes", false),
+					std::make_tuple("*", "logRules.test", true),
+					std::make_tuple("**", "", true),
+					std::make_tuple("", "logRules.test", false),
+					std::make_tuple("a*a*a*a*b", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", false)
+				};
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::LogRules::LogRules(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Log rules") {
+	LOG_INFO(app::logger::info_level_e::ZERO, logRulesOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::LogRules::~LogRules() {
+	LOG_INFO(app::logger::info_level_e::ZERO, logRulesOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::LogRules::checkPatterns() {
+	for (const std::tuple<std::string, std::string, bool> & pattern : tester::test::log_rules::patterns) {
+		const bool match = app::logger::Registry::matches(std::get<0>(pattern), std::get<1>(pattern));
+		ASSERT((match == std::get<2>(pattern)), tester::shared::error_type_e::TEST, "Name \"" + std::get<1>(pattern) + "\" is expected " + ((std::get<2>(pattern) == true) ? "" : "not ") + "to match pattern \"" + std::get<0>(pattern) + "\"");
+	}
+}
+
+void tester::test::LogRules::checkRules() {
+	app::logger::Registry * registry = app::logger::Registry::getInstance();
+
+	const std::vector<std::string> names(registry->getNames());
+	for (const std::string & name : { std::string("logRules.overall"), std::string("logRules.test"), std::string("logRules.target") }) {
+		ASSERT((std::find(names.cbegin(), names.cend(), name) != names.cend()), tester::shared::error_type_e::TEST, "Context " + name + " has not been registered");
+	}
+
+	const app::logger::Context & target = registry->getContext("logRules.target");
+	const bool defaultEnabled = target.isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::ZERO);
+
+	// Rules are applied in order therefore the second one overrides the first one for the target context only
+	registry->setRules("logRules.*=info:zero, logRules.tar*=warning");
+	ASSERT((target.isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::ZERO) == false), tester::shared::error_type_e::TEST, "Information messages of context logRules.target are expected to be disabled by rule logRules.tar*=warning");
+	ASSERT((target.isEnabled(app::logger::msg_type_e::WARNING, app::logger::info_level_e::ZERO) == true), tester::shared::error_type_e::TEST, "Warning messages of context logRules.target are expected to be enabled by rule logRules.tar*=warning");
+	ASSERT((logRulesTest().isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::ZERO) == defaultEnabled), tester::shared::error_type_e::TEST, "Information messages of context logRules.test are expected to be enabled by rule logRules.*=info:zero");
+
+	// A call site reads the thresholds of its context
+	const std::atomic<std::uint32_t> & threshold = app::logger::Filter::getThreshold(logRulesTarget);
+	ASSERT((&threshold == &target.getThreshold()), tester::shared::error_type_e::TEST, "Call sites logging to context logRules.target are expected to read the thresholds of the context");
+
+	// Invalid rules leave the current rules untouched
+	this->checkRejectedRule("logRules.*=verbose", "its type is not valid");
+	this->checkRejectedRule("logRules.*=info:verbose", "its verbosity is not valid");
+	if (app::logger::Filter::getCompiledMaximumVerbosity() < app::logger::info_level_e::HIGH) {
+		this->checkRejectedRule("logRules.*=info:high", "information messages with high verbosity are removed at compile time");
+	}
+	if (app::logger::Filter::getCompiledMinimumType() > app::logger::msg_type_e::DEBUG) {
+		this->checkRejectedRule("logRules.*=debug", "debug messages are removed at compile time");
+	}
+
+	// Without rules, contexts go back to the thresholds they are declared with
+	registry->setRules(std::string());
+	ASSERT((target.isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::ZERO) == defaultEnabled), tester::shared::error_type_e::TEST, "Thresholds of context logRules.target are expected to be restored when rules are removed");
+
+	// A rule can raise the thresholds of a context above the ones it is declared with up to the compile time ones
+	if ((app::logger::Filter::isCompiledIn(app::logger::msg_type_e::INFO, app::logger::info_level_e::HIGH) == true) && (app::logger::info_level_e::DEFAULT_INFO_VERBOSITY < app::logger::info_level_e::HIGH)) {
+		ASSERT((target.isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::HIGH) == false), tester::shared::error_type_e::TEST, "Information messages with high verbosity of context logRules.target are expected to be disabled when no rule matches it");
+		registry->setRules("logRules.tar*=info:high");
+		ASSERT((target.isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::HIGH) == true), tester::shared::error_type_e::TEST, "Information messages with high verbosity of context logRules.target are expected to be enabled by rule logRules.tar*=info:high");
+		registry->setRules(std::string());
+	}
+}
+
+void tester::test::LogRules::checkRejectedRule(const std::string & rule, const std::string & reason) {
+	app::logger::Registry * registry = app::logger::Registry::getInstance();
+	const app::logger::Context & target = registry->getContext("logRules.target");
+
+	const std::string rules(registry->getRules());
+	const bool enabled = target.isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::ZERO);
+	std::string errorMessage = std::string();
+	try {
+		registry->setRules(rule);
+	} catch (const app::exception::Exception & exc) {
+		errorMessage = exc.getMessage();
+	}
+	LOG_INFO(app::logger::info_level_e::ZERO, logRulesTest, "Setting rule " << rule << " reported: " << errorMessage);
+	ASSERT((errorMessage.empty() == false), tester::shared::error_type_e::TEST, "Rule " + rule + " is expected to be rejected because " + reason);
+	ASSERT((registry->getRules() == rules), tester::shared::error_type_e::TEST, "Rules are expected to be left untouched by rule " + rule);
+	ASSERT((target.isEnabled(app::logger::msg_type_e::INFO, app::logger::info_level_e::ZERO) == enabled), tester::shared::error_type_e::TEST, "Thresholds of context logRules.target are expected to be left untouched by rule " + rule);
+}
+
+void tester::test::LogRules::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, logRulesTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	app::logger::Registry * registry = app::logger::Registry::getInstance();
+	const std::string initialRules(registry->getRules());
+
+	this->checkPatterns();
+	this->checkRules();
+
+	registry->setRules(initialRules);
+
+	LOG_INFO(app::logger::info_level_e::ZERO, logRulesTest, registry->getNames().size() << " contexts are registered");
+}
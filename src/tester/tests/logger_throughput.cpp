@@ -0,0 +1,219 @@
+/**
+ * @copyright
+ * @file logger_throughput.cpp
+ * @author Andrea Gianarda
+ * @date 30th August 2020
+ * @brief Logger throughput functions
+ */
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <fstream>
+
+// Qt libraries
+#include <QtCore/QTemporaryDir>
+
+#include "app/shared/enums.h"
+#include "app/shared/qt_functions.h"
+#include "app/utility/logger/macros.h"
+#include "app/utility/logger/backend.h"
+#include "tester/tests/logger_throughput.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(loggerThroughputOverall, loggerThroughput.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(loggerThroughputTest, loggerThroughput.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(loggerThroughputBenchmark, loggerThroughput.benchmark, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace logger_throughput {
+
+			namespace {
+
+				/**
+				 * @brief File the benchmark messages are logged into
+				 *
+				 */
+				static const std::string logFilename("logger_throughput.log");
+
+				/**
+				 * @brief File the benchmark messages are logged into by the logger the backend replaced
+				 *
+				 */
+				static const std::string legacyLogFilename("logger_throughput_legacy.log");
+
+				/**
+				 * @brief Number of messages logged in every run
+				 *
+				 */
+				static const int numberOfMessages = 100000;
+
+				/**
+				 * @brief Number of threads logging concurrently in the multithreaded runs
+				 *
+				 */
+				static const int numberOfThreads = 4;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::LoggerThroughput::LoggerThroughput(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Logger throughput") {
+	LOG_INFO(app::logger::info_level_e::ZERO, loggerThroughputOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::LoggerThroughput::~LoggerThroughput() {
+	LOG_INFO(app::logger::info_level_e::ZERO, loggerThroughputOverall, "Test " << this->getName() << " destructor");
+}
+
+std::int64_t tester::test::LoggerThroughput::logMessages(const int & numberOfThreads) const {
+	const int messagesPerThread = tester::test::logger_throughput::numberOfMessages / numberOfThreads;
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for (int threadIdx = 0; threadIdx < numberOfThreads; threadIdx++) {
+		threads.emplace_back([threadIdx, messagesPerThread] () {
+			for (int messageIdx = 0; messageIdx < messagesPerThread; messageIdx++) {
+				LOG_INFO_TO_FILE(app::logger::info_level_e::ZERO, loggerThroughputBenchmark, tester::test::logger_throughput::logFilename, "Thread " << threadIdx << " message " << messageIdx << " value " << (messageIdx * 0.5));
+			}
+		});
+	}
+
+	for (auto & thread : threads) {
+		thread.join();
+	}
+
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+std::int64_t tester::test::LoggerThroughput::logMessagesLegacy(const int & numberOfThreads) const {
+	const int messagesPerThread = tester::test::logger_throughput::numberOfMessages / numberOfThreads;
+	const std::string contextFile(__FILE__);
+	const std::string contextFunction(__func__);
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for (int threadIdx = 0; threadIdx < numberOfThreads; threadIdx++) {
+		threads.emplace_back([threadIdx, messagesPerThread, &contextFile, &contextFunction] () {
+			for (int messageIdx = 0; messageIdx < messagesPerThread; messageIdx++) {
+				// Every message owned a mutex and a stream that was opened by the first argument written to it
+				std::mutex logMutex;
+				std::ofstream ofile;
+				auto writeToStream = [&logMutex, &ofile] (const auto & arg) {
+					logMutex.lock();
+					if (ofile.is_open() == false) {
+						ofile.open(tester::test::logger_throughput::legacyLogFilename, (std::ios::ate | std::ios::app | std::ios::out));
+					}
+					ofile << arg;
+					logMutex.unlock();
+				};
+
+				std::string header = std::string();
+				header = header + "[" + app::shared::getDateTime().toStdString() + "] ";
+				header = header + app::shared::qEnumToQString(app::logger::msg_type_e::INFO, true).toStdString();
+				header = header + " [loggerThroughput.benchmark]";
+				header = header + " File " + contextFile;
+				header = header + " in function " + contextFunction;
+				writeToStream(header);
+				writeToStream(" ");
+				writeToStream("Thread ");
+				writeToStream(threadIdx);
+				writeToStream(" message ");
+				writeToStream(messageIdx);
+				writeToStream(" value ");
+				writeToStream(messageIdx * 0.5);
+
+				logMutex.lock();
+				ofile << std::endl;
+				ofile.close();
+				logMutex.unlock();
+			}
+		});
+	}
+
+	for (auto & thread : threads) {
+		thread.join();
+	}
+
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void tester::test::LoggerThroughput::reportThroughput(const std::string & mode, const std::int64_t & elapsedTime) const {
+	const double timePerMessage = static_cast<double>(elapsedTime) / static_cast<double>(tester::test::logger_throughput::numberOfMessages);
+	const double messagesPerSecond = (timePerMessage > 0.0) ? (1.0e9 / timePerMessage) : 0.0;
+	LOG_INFO(app::logger::info_level_e::ZERO, loggerThroughputTest, "[" << mode << "] " << tester::test::logger_throughput::numberOfMessages << " messages logged in " << elapsedTime << "ns: " << timePerMessage << " ns/message " << messagesPerSecond << " messages/s");
+}
+
+void tester::test::LoggerThroughput::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, loggerThroughputTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	app::logger::Backend * backend = app::logger::Backend::getInstance();
+	const app::logger::queue_policy_e initialPolicy = backend->getQueuePolicy();
+
+	// Write path of the logger before the backend was introduced: every message builds its header, opens the file, locks a mutex for every argument and flushes with std::endl
+	const std::int64_t legacyTime = this->logMessagesLegacy(1);
+	this->reportThroughput("before: legacy synchronous", legacyTime);
+
+	// Fallback of the backend when its writer thread is stopped: every message is formatted, written and flushed by the thread logging it but the file is kept open
+	backend->stop();
+	const std::int64_t synchronousTime = this->logMessages(1);
+	backend->start();
+	this->reportThroughput("backend synchronous fallback", synchronousTime);
+
+	for (const app::logger::queue_policy_e & policy : { app::logger::queue_policy_e::BLOCK, app::logger::queue_policy_e::DROP }) {
+		backend->setQueuePolicy(policy);
+
+		for (const int & threads : { 1, tester::test::logger_throughput::numberOfThreads }) {
+			const std::uint64_t droppedBefore = backend->getDroppedRecords();
+			const std::int64_t asynchronousTime = this->logMessages(threads);
+			backend->flush();
+			const std::uint64_t dropped = backend->getDroppedRecords() - droppedBefore;
+
+			std::string mode("asynchronous ");
+			mode.append(app::shared::qEnumToQString(policy, true).toStdString());
+			mode.append(" " + std::to_string(threads) + " thread(s)");
+			this->reportThroughput(mode, asynchronousTime);
+			if (threads == 1) {
+				const double speedup = (asynchronousTime > 0) ? (static_cast<double>(legacyTime) / static_cast<double>(asynchronousTime)) : 0.0;
+				LOG_INFO(app::logger::info_level_e::ZERO, loggerThroughputTest, "[" << mode << "] " << speedup << " times faster than the legacy synchronous logger");
+			}
+			LOG_INFO(app::logger::info_level_e::ZERO, loggerThroughputTest, "[" << mode << "] " << dropped << " messages dropped");
+
+			if (policy == app::logger::queue_policy_e::BLOCK) {
+				ASSERT((dropped == 0), tester::shared::error_type_e::TEST, "No message is expected to be dropped when the queue policy is " + app::shared::qEnumToQString(policy, true).toStdString() + " but " + std::to_string(dropped) + " were dropped");
+			}
+		}
+	}
+
+	backend->setQueuePolicy(initialPolicy);
+
+	// A file that cannot be opened must not terminate the program from the writer thread
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == true) {
+		const std::string unwritableFilename(directory.path().toStdString() + "/missing/logger_throughput.log");
+		const std::uint64_t droppedBefore = backend->getDroppedRecords();
+		const std::chrono::nanoseconds now = std::chrono::system_clock::now().time_since_epoch();
+		app::logger::record_s record = { nullptr, app::logger::msg_type_e::INFO, static_cast<std::int64_t>(now.count()), std::string(), unwritableFilename, std::string("Message to a file that cannot be opened"), app::logger::record_format_e::TEXT };
+		backend->push(std::move(record));
+		backend->flush();
+		ASSERT((backend->getDroppedRecords() > droppedBefore), tester::shared::error_type_e::TEST, "A message written to file " + unwritableFilename + " that cannot be opened is expected to be dropped and counted");
+		ASSERT((backend->isRunning() == true), tester::shared::error_type_e::TEST, "The writer thread is expected to keep running after failing to open file " + unwritableFilename);
+		backend->close(unwritableFilename);
+	}
+}
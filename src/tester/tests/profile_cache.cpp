@@ -0,0 +1,160 @@
+/**
+ * @copyright
+ * @file profile_cache.cpp
+ * @author Andrea Gianarda
+ * @date 11th September 2020
+ * @brief Profile cache functions
+ */
+
+#include <chrono>
+
+// Qt libraries
+#include <QtCore/QEventLoop>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QTextStream>
+#include <QtCore/QTimer>
+#include <QtCore/QUrl>
+
+#include "app/utility/logger/macros.h"
+#include "app/base/tabs/web_engine_page.h"
+#include "app/windows/main_window/tabs/web_engine_profile.h"
+#include "tester/tests/profile_cache.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(profileCacheOverall, profileCache.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(profileCacheTest, profileCache.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace profile_cache {
+
+			namespace {
+
+				/**
+				 * @brief Number of sub-resources of every kind referenced by the page
+				 *
+				 */
+				static const int resourcesPerKind = 150;
+
+				/**
+				 * @brief Maximum time in milliseconds a page can take to load
+				 *
+				 */
+				static const int loadTimeout = 30000;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::ProfileCache::ProfileCache(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Profile cache") {
+	LOG_INFO(app::logger::info_level_e::ZERO, profileCacheOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::ProfileCache::~ProfileCache() {
+	LOG_INFO(app::logger::info_level_e::ZERO, profileCacheOverall, "Test " << this->getName() << " destructor");
+}
+
+QString tester::test::ProfileCache::writePage(const QString & directory) const {
+	const QString pagePath(directory + "/page.html");
+	QFile page(pagePath);
+	page.open(QIODevice::WriteOnly | QIODevice::Truncate);
+	QTextStream pageStream(&page);
+	pageStream << "<!DOCTYPE html>\n<html>\n<head>\n<title>Profile cache</title>\n";
+
+	for (int idx = 0; idx < tester::test::profile_cache::resourcesPerKind; idx++) {
+		const QString number(QString::number(idx));
+
+		QFile style(directory + "/style" + number + ".css");
+		style.open(QIODevice::WriteOnly | QIODevice::Truncate);
+		QTextStream styleStream(&style);
+		styleStream << ".class" << number << " { color: #" << QString::number(idx % 256, 16).rightJustified(2, QLatin1Char('0')) << "0000; margin: " << number << "px; }\n";
+		pageStream << "<link rel=\"stylesheet\" href=\"style" << number << ".css\">\n";
+
+		QFile script(directory + "/script" + number + ".js");
+		script.open(QIODevice::WriteOnly | QIODevice::Truncate);
+		QTextStream scriptStream(&script);
+		scriptStream << "var value" << number << " = " << number << ";\n";
+		pageStream << "<script src=\"script" << number << ".js\"></script>\n";
+	}
+
+	pageStream << "</head>\n<body>\n";
+
+	for (int idx = 0; idx < tester::test::profile_cache::resourcesPerKind; idx++) {
+		const QString number(QString::number(idx));
+
+		QFile image(directory + "/image" + number + ".svg");
+		image.open(QIODevice::WriteOnly | QIODevice::Truncate);
+		QTextStream imageStream(&image);
+		imageStream << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"16\" height=\"16\"><rect width=\"16\" height=\"" << QString::number((idx % 16) + 1) << "\"/></svg>\n";
+		pageStream << "<p class=\"class" << number << "\"><img src=\"image" << number << ".svg\"></p>\n";
+	}
+
+	pageStream << "</body>\n</html>\n";
+
+	return pagePath;
+}
+
+std::int64_t tester::test::ProfileCache::loadPage(app::base::tab::WebEngineProfile * profile, const QString & path, bool & success) const {
+	app::base::tab::WebEnginePage page(nullptr, profile);
+
+	success = false;
+	QEventLoop loop;
+	QObject::connect(&page, &app::base::tab::WebEnginePage::loadFinished, &loop, [&] (bool ok) {
+		success = ok;
+		loop.quit();
+	});
+	QTimer::singleShot(tester::test::profile_cache::loadTimeout, &loop, &QEventLoop::quit);
+
+	const std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
+	page.load(QUrl::fromLocalFile(path));
+	loop.exec();
+	const std::chrono::steady_clock::time_point loadEnd = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(loadEnd - loadStart).count());
+}
+
+void tester::test::ProfileCache::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, profileCacheTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == false) {
+		return;
+	}
+
+	// All pages share the same profile
+	app::base::tab::WebEngineProfile * profile = app::main_window::tab::WebEngineProfile::defaultProfile();
+	ASSERT((profile != nullptr), tester::shared::error_type_e::TEST, "Default web engine profile is expected to be created");
+	if (profile == nullptr) {
+		return;
+	}
+	ASSERT((profile == app::main_window::tab::WebEngineProfile::defaultProfile()), tester::shared::error_type_e::TEST, "Default web engine profile is expected to be created only once");
+	ASSERT((profile == app::base::tab::WebEngineProfile::defaultProfile()), tester::shared::error_type_e::TEST, "Main window pages are expected to share the default web engine profile of all other pages");
+	ASSERT((profile->storageName() == app::base::tab::WebEngineProfile::getDefaultStorageName()), tester::shared::error_type_e::TEST, "Storage name of the default web engine profile " + profile->storageName().toStdString() + " does not match the settings");
+	LOG_INFO(app::logger::info_level_e::ZERO, profileCacheTest, "Profile " << profile->storageName() << " cache path " << profile->cachePath() << " maximum size " << profile->httpCacheMaximumSize() << " bytes");
+
+	const QString pagePath(this->writePage(directory.path()));
+	const int numberOfResources = 3 * tester::test::profile_cache::resourcesPerKind;
+
+	// The first load reads all sub-resources from disk whereas the second one is served by the caches of the shared profile
+	bool coldSuccess = false;
+	const std::int64_t coldTime = this->loadPage(profile, pagePath, coldSuccess);
+	ASSERT((coldSuccess == true), tester::shared::error_type_e::TABS, "Unable to load page " + pagePath.toStdString() + " the first time");
+
+	bool warmSuccess = false;
+	const std::int64_t warmTime = this->loadPage(profile, pagePath, warmSuccess);
+	ASSERT((warmSuccess == true), tester::shared::error_type_e::TABS, "Unable to load page " + pagePath.toStdString() + " the second time");
+
+	const double coldTimeMs = static_cast<double>(coldTime) / 1000000.0;
+	const double warmTimeMs = static_cast<double>(warmTime) / 1000000.0;
+	const double speedup = (warmTime > 0) ? (static_cast<double>(coldTime) / static_cast<double>(warmTime)) : 0.0;
+	LOG_INFO(app::logger::info_level_e::ZERO, profileCacheTest, "Page with " << numberOfResources << " sub-resources - cold load: " << coldTimeMs << " ms warm load: " << warmTimeMs << " ms speedup: " << speedup);
+}
@@ -0,0 +1,144 @@
+/**
+ * @copyright
+ * @file qt_message_throughput.cpp
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Qt message throughput functions
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <fstream>
+
+// Qt libraries
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QtDebug>
+
+#include "app/utility/log/logging.h"
+#include "app/utility/logger/backend.h"
+#include "app/utility/logger/macros.h"
+#include "tester/tests/qt_message_throughput.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(qtMessageThroughputOverall, qtMessageThroughput.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(qtMessageThroughputTest, qtMessageThroughput.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace qt_message_throughput {
+
+			namespace {
+
+				/**
+				 * @brief Number of threads logging messages concurrently
+				 *
+				 */
+				static const int numberOfThreads = 4;
+
+				/**
+				 * @brief Number of messages logged by every thread
+				 *
+				 */
+				static const int messagesPerThread = 250000;
+
+				/**
+				 * @brief Function: QLoggingCategory & category()
+				 *
+				 * \return the category of the messages of the test
+				 *
+				 * This function returns the category of the messages of the test
+				 * Debug messages are enabled regardless of the level of the default category
+				 */
+				QLoggingCategory & category() {
+					static QLoggingCategory throughputCategory("tester.qtMessageThroughput");
+					return throughputCategory;
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::QtMessageThroughput::QtMessageThroughput(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Qt message throughput") {
+	LOG_INFO(app::logger::info_level_e::ZERO, qtMessageThroughputOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::QtMessageThroughput::~QtMessageThroughput() {
+	LOG_INFO(app::logger::info_level_e::ZERO, qtMessageThroughputOverall, "Test " << this->getName() << " destructor");
+}
+
+std::uint64_t tester::test::QtMessageThroughput::countMessages(const std::string & filename, const std::uint64_t & offset, const std::string & tag) const {
+	std::ifstream ifile(filename);
+	if (ifile.is_open() == false) {
+		return 0;
+	}
+
+	ifile.seekg(static_cast<std::streamoff>(offset));
+
+	std::uint64_t count = 0;
+	std::string line = std::string();
+	while (std::getline(ifile, line)) {
+		if (line.find(tag) != std::string::npos) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+void tester::test::QtMessageThroughput::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, qtMessageThroughputTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	app::logger::Backend * backend = app::logger::Backend::getInstance();
+	tester::test::qt_message_throughput::category().setEnabled(QtDebugMsg, true);
+
+	// Only messages written after this point are counted
+	backend->flush();
+	const std::string & filename = app::logging::getLogFilename();
+	const QFileInfo initialInfo(QString::fromStdString(filename));
+	const std::uint64_t offset = (initialInfo.exists() == true) ? static_cast<std::uint64_t>(initialInfo.size()) : 0;
+	const std::string tag("qtMessageThroughput-" + std::to_string(QDateTime::currentMSecsSinceEpoch()));
+	const QString messageTag(QString::fromStdString(tag));
+	const std::uint64_t initialDroppedRecords = backend->getDroppedRecords();
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for (int threadIdx = 0; threadIdx < tester::test::qt_message_throughput::numberOfThreads; threadIdx++) {
+		threads.push_back(std::thread([threadIdx, &messageTag] () {
+			for (int messageIdx = 0; messageIdx < tester::test::qt_message_throughput::messagesPerThread; messageIdx++) {
+				qCDebug(tester::test::qt_message_throughput::category) << messageTag << "thread" << threadIdx << "message" << messageIdx;
+			}
+		}));
+	}
+	for (std::thread & thread : threads) {
+		thread.join();
+	}
+	const std::chrono::steady_clock::time_point logged = std::chrono::steady_clock::now();
+	backend->flush();
+	const std::chrono::steady_clock::time_point flushed = std::chrono::steady_clock::now();
+
+	const std::uint64_t totalMessages = static_cast<std::uint64_t>(tester::test::qt_message_throughput::numberOfThreads) * static_cast<std::uint64_t>(tester::test::qt_message_throughput::messagesPerThread);
+	const std::uint64_t writtenMessages = this->countMessages(filename, offset, tag);
+	const std::uint64_t lostMessages = (writtenMessages < totalMessages) ? (totalMessages - writtenMessages) : 0;
+	const std::uint64_t droppedRecords = backend->getDroppedRecords() - initialDroppedRecords;
+
+	const double loggingTime = std::chrono::duration<double>(logged - start).count();
+	const double flushTime = std::chrono::duration<double, std::milli>(flushed - logged).count();
+	const double throughput = (loggingTime > 0.0) ? (static_cast<double>(totalMessages) / loggingTime) : 0.0;
+	LOG_INFO(app::logger::info_level_e::ZERO, qtMessageThroughputTest, totalMessages << " messages from " << tester::test::qt_message_throughput::numberOfThreads << " threads logged in " << loggingTime << " s - throughput: " << throughput << " messages/s flush: " << flushTime << " ms written: " << writtenMessages << " lost: " << lostMessages << " dropped by the queue: " << droppedRecords);
+
+	// Messages can only be lost if the queue is full and the backend is configured to drop them
+	ASSERT((lostMessages <= droppedRecords), tester::shared::error_type_e::TEST, std::to_string(lostMessages) + " messages are missing from " + filename + " but only " + std::to_string(droppedRecords) + " records were dropped by the log queue");
+	if (backend->getQueuePolicy() == app::logger::queue_policy_e::BLOCK) {
+		ASSERT((lostMessages == 0), tester::shared::error_type_e::TEST, std::to_string(lostMessages) + " messages were lost even though the log queue blocks when it is full");
+	}
+}
@@ -22,8 +22,8 @@
 #include "tester/tests/reload_tab.h"
 #include "tester/top/main_window_wrapper.h"
 
-LOGGING_CONTEXT(reloadTabOverall, reloadTab.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(reloadTabTest, reloadTab.test, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(reloadTabOverall, reloadTab.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(reloadTabTest, reloadTab.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace tester {
 
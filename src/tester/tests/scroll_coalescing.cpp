@@ -0,0 +1,132 @@
+/**
+ * @copyright
+ * @file scroll_coalescing.cpp
+ * @author Andrea Gianarda
+ * @date 04th September 2020
+ * @brief Scroll coalescing functions
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+
+#include <QtWidgets/QApplication>
+
+#include "app/shared/enums.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "app/windows/main_window/tabs/web_engine_page.h"
+#include "tester/tests/scroll_coalescing.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(scrollCoalescingOverall, scrollCoalescing.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(scrollCoalescingTest, scrollCoalescing.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace scroll_coalescing {
+
+			namespace {
+
+				/**
+				 * @brief File scrolled through
+				 *
+				 */
+				static const std::string textFilename("scroll_coalescing.txt");
+
+				/**
+				 * @brief Number of lines of the file scrolled through
+				 * The page must be long enough for all scroll commands to move it
+				 *
+				 */
+				static const int numberOfLines = 20000;
+
+				/**
+				 * @brief Number of scroll commands sent to the tab
+				 *
+				 */
+				static const int numberOfCommands = 1000;
+
+				/**
+				 * @brief Vertical offset in pixels of a scroll command
+				 *
+				 */
+				static const int scrollStep = 100;
+
+				/**
+				 * @brief Maximum time in milliseconds to wait for the page to load and to settle
+				 *
+				 */
+				static const int timeout = 10000;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::ScrollCoalescing::ScrollCoalescing(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Scroll coalescing") {
+	LOG_INFO(app::logger::info_level_e::ZERO, scrollCoalescingOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::ScrollCoalescing::~ScrollCoalescing() {
+	LOG_INFO(app::logger::info_level_e::ZERO, scrollCoalescingOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::ScrollCoalescing::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, scrollCoalescingTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	std::ofstream textFile(tester::test::scroll_coalescing::textFilename, (std::ios::out | std::ios::trunc));
+	for (int lineIdx = 0; lineIdx < tester::test::scroll_coalescing::numberOfLines; lineIdx++) {
+		textFile << "Line " << lineIdx << " of a long page\n";
+	}
+	textFile.close();
+
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+
+	tabs->openTabInBackground(app::main_window::page_type_e::TEXT, QString::fromStdString(tester::test::scroll_coalescing::textFilename));
+	const int tabIdx = tabs->count() - 1;
+	tabs->setCurrentIndex(tabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	const std::shared_ptr<app::main_window::tab::Tab> tab = tabs->widget(tabIdx, true);
+	WAIT_FOR_CONDITION((tab->getLoadStatus() == app::base::tab::load_status_e::FINISHED), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " has not finished loading", tester::test::scroll_coalescing::timeout);
+
+	const std::shared_ptr<app::main_window::tab::WebEnginePage> page = tab->getPage();
+	const std::uint64_t initialRequests = page->getScrollRequestCount();
+	const qreal initialPosition = page->scrollPosition().y();
+	const qreal expectedPosition = initialPosition + static_cast<qreal>(tester::test::scroll_coalescing::numberOfCommands * tester::test::scroll_coalescing::scrollStep);
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	// Every command goes through the event loop as if the user was holding the scroll down key
+	for (int commandIdx = 0; commandIdx < tester::test::scroll_coalescing::numberOfCommands; commandIdx++) {
+		tabs->scrollTab(tabIdx, app::shared::offset_type_e::DOWN);
+		QApplication::processEvents(QEventLoop::AllEvents);
+	}
+
+	WAIT_FOR_CONDITION((qRound(page->scrollPosition().y()) == qRound(expectedPosition)), tester::shared::error_type_e::TABS, "Vertical position of tab " + std::to_string(tabIdx) + " is " + std::to_string(page->scrollPosition().y()) + " whereas it is expected to settle at " + std::to_string(expectedPosition), tester::test::scroll_coalescing::timeout);
+
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	const std::uint64_t requests = page->getScrollRequestCount() - initialRequests;
+	const std::int64_t elapsedTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+	LOG_INFO(app::logger::info_level_e::ZERO, scrollCoalescingTest, tester::test::scroll_coalescing::numberOfCommands << " scroll commands resulted in " << requests << " scripts run in the page - final position settled after " << elapsedTime << "ms");
+
+	ASSERT((requests <= static_cast<std::uint64_t>(tester::test::scroll_coalescing::numberOfCommands)), tester::shared::error_type_e::PERFORMANCE, "Expected at most one script per scroll command but " + std::to_string(requests) + " scripts were run for " + std::to_string(tester::test::scroll_coalescing::numberOfCommands) + " commands");
+
+	tabs->removeTab(tabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	std::remove(tester::test::scroll_coalescing::textFilename.c_str());
+}
@@ -21,8 +21,8 @@
 #include "tester/tests/scroll_tab.h"
 #include "tester/top/main_window_wrapper.h"
 
-LOGGING_CONTEXT(scrollTabOverall, scrollTab.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(scrollTabTest, scrollTab.test, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(scrollTabOverall, scrollTab.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(scrollTabTest, scrollTab.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace tester {
 
@@ -17,8 +17,8 @@
 #include "tester/tests/search_tab.h"
 #include "tester/top/main_window_wrapper.h"
 
-LOGGING_CONTEXT(searchTabOverall, searchTab.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(searchTabTest, searchTab.test, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(searchTabOverall, searchTab.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(searchTabTest, searchTab.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace tester {
 
@@ -0,0 +1,204 @@
+/**
+ * @copyright
+ * @file session_restore.cpp
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Session restore functions
+ */
+
+#include <vector>
+#include <chrono>
+
+// Qt libraries
+#include <QtCore/QEventLoop>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QTextStream>
+#include <QtCore/QTimer>
+#include <QtCore/QUrl>
+#include <QtWidgets/QApplication>
+
+#include "app/utility/cpp/process_memory.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/web_engine_page.h"
+#include "app/windows/main_window/tabs/discard_manager.h"
+#include "app/windows/main_window/session/store.h"
+#include "tester/tests/session_restore.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(sessionRestoreOverall, sessionRestore.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(sessionRestoreTest, sessionRestore.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace session_restore {
+
+			namespace {
+
+				/**
+				 * @brief Number of tabs of the restored sessions
+				 *
+				 */
+				static const std::vector<int> numbersOfTabs({ 10, 100, 500 });
+
+				/**
+				 * @brief Number of lines of the page shown in every tab
+				 *
+				 */
+				static const int numberOfLines = 500;
+
+				/**
+				 * @brief Maximum time in milliseconds the current tab can take to load
+				 *
+				 */
+				static const int loadTimeout = 30000;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::SessionRestore::SessionRestore(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Session restore"), directory() {
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionRestoreOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::SessionRestore::~SessionRestore() {
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionRestoreOverall, "Test " << this->getName() << " destructor");
+}
+
+QString tester::test::SessionRestore::getSessionFile() const {
+	QString sessionFile = QString();
+	if (this->directory.isValid() == true) {
+		sessionFile = this->directory.filePath("session.bin");
+	}
+	return sessionFile;
+}
+
+void tester::test::SessionRestore::restoreTabs(const int & numberOfTabs) {
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+	const std::unique_ptr<app::main_window::session::Store> & store = windowCore->session;
+	const QString & sessionFile = store->getFilename();
+	const QUrl pageUrl(QUrl::fromLocalFile(this->directory.filePath("page.html")));
+
+	app::main_window::session::session_state_s session;
+	session.currentIndex = numberOfTabs / 2;
+	session.tabs.reserve(static_cast<std::size_t>(numberOfTabs));
+	for (int tabIdx = 0; tabIdx < numberOfTabs; tabIdx++) {
+		QUrl url(pageUrl);
+		url.setQuery("tab=" + QString::number(tabIdx));
+		app::main_window::session::tab_state_s state;
+		state.type = app::main_window::page_type_e::WEB_CONTENT;
+		state.source = url.toString();
+		state.verticalScrollPercentage = tabIdx % 101;
+		state.history = QByteArray();
+		session.tabs.push_back(state);
+	}
+
+	// The file must hold exactly the session that was saved
+	const QByteArray data(app::main_window::session::Store::serialize(session));
+	app::main_window::session::session_state_s decodedSession;
+	const bool decoded = app::main_window::session::Store::deserialize(data, decodedSession);
+	ASSERT((decoded == true), tester::shared::error_type_e::TEST, "Unable to decode a session with " + std::to_string(numberOfTabs) + " tabs");
+	ASSERT((decodedSession.currentIndex == session.currentIndex), tester::shared::error_type_e::TEST, "Decoded current tab " + std::to_string(decodedSession.currentIndex) + " whereas it is expected to be " + std::to_string(session.currentIndex));
+	ASSERT((decodedSession.tabs.size() == session.tabs.size()), tester::shared::error_type_e::TEST, "Decoded " + std::to_string(decodedSession.tabs.size()) + " tabs whereas " + std::to_string(session.tabs.size()) + " were encoded");
+	if (decodedSession.tabs.size() == session.tabs.size()) {
+		for (std::size_t tabIdx = 0; tabIdx < session.tabs.size(); tabIdx++) {
+			const app::main_window::session::tab_state_s & expected = session.tabs.at(tabIdx);
+			const app::main_window::session::tab_state_s & actual = decodedSession.tabs.at(tabIdx);
+			ASSERT(((actual.type == expected.type) && (actual.source == expected.source) && (actual.verticalScrollPercentage == expected.verticalScrollPercentage)), tester::shared::error_type_e::TEST, "Decoded tab " + std::to_string(tabIdx) + " differs from the encoded one");
+		}
+	}
+
+	ASSERT((sessionFile == this->getSessionFile()), tester::shared::error_type_e::TEST, "Window saves its session to file " + sessionFile.toStdString() + " whereas it is expected to use file " + this->getSessionFile().toStdString());
+	QFile::remove(sessionFile);
+	store->save(session);
+	store->flush();
+	ASSERT((QFile::exists(sessionFile) == true), tester::shared::error_type_e::TEST, "Session file " + sessionFile.toStdString() + " has not been written");
+
+	const int initialTabCount = tabs->count();
+	const std::int64_t initialMemory = app::utility::getResidentMemory();
+
+	bool loaded = false;
+	QEventLoop loop;
+	QTimer::singleShot(tester::test::session_restore::loadTimeout, &loop, &QEventLoop::quit);
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	const int restoredTabs = store->restore();
+	const std::chrono::steady_clock::time_point restoreEnd = std::chrono::steady_clock::now();
+
+	// The current tab is interactive once its page has loaded
+	const std::shared_ptr<app::main_window::tab::WebEnginePage> page = tabs->getPage(tabs->currentIndex());
+	ASSERT((page != nullptr), tester::shared::error_type_e::TABS, "Current tab has no page after restoring the session");
+	if (page != nullptr) {
+		QObject::connect(page.get(), &app::main_window::tab::WebEnginePage::loadFinished, &loop, [&] (bool ok) {
+			loaded = ok;
+			loop.quit();
+		});
+		loop.exec();
+	}
+	const std::chrono::steady_clock::time_point interactiveEnd = std::chrono::steady_clock::now();
+	const std::int64_t finalMemory = app::utility::getResidentMemory();
+
+	ASSERT((loaded == true), tester::shared::error_type_e::TABS, "Current tab has not loaded after restoring a session with " + std::to_string(numberOfTabs) + " tabs");
+	ASSERT((restoredTabs == numberOfTabs), tester::shared::error_type_e::TABS, "Restored " + std::to_string(restoredTabs) + " tabs whereas the session has " + std::to_string(numberOfTabs) + " tabs");
+
+	const int tabCount = tabs->count();
+	ASSERT((tabCount == (initialTabCount + numberOfTabs)), tester::shared::error_type_e::TABS, "Expected " + std::to_string(initialTabCount + numberOfTabs) + " tabs but " + std::to_string(tabCount) + " are opened");
+	const int expectedCurrentIdx = initialTabCount + session.currentIndex;
+	ASSERT((tabs->currentIndex() == expectedCurrentIdx), tester::shared::error_type_e::TABS, "Current tab is " + std::to_string(tabs->currentIndex()) + " whereas it is expected to be " + std::to_string(expectedCurrentIdx));
+
+	// Only the current tab is materialized
+	int materializedTabs = 0;
+	for (int tabIdx = initialTabCount; tabIdx < tabCount; tabIdx++) {
+		if (tabs->widget(tabIdx, true)->isPlaceholder() == false) {
+			materializedTabs++;
+		}
+	}
+	ASSERT((materializedTabs == 1), tester::shared::error_type_e::PERFORMANCE, std::to_string(materializedTabs) + " restored tabs have a web engine page whereas only the current tab is expected to have one");
+
+	const std::int64_t restoreTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(restoreEnd - start).count());
+	const std::int64_t interactiveTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(interactiveEnd - start).count());
+	const std::int64_t memoryIncrease = finalMemory - initialMemory;
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionRestoreTest, numberOfTabs << " tabs - session file " << data.size() << " bytes restored in " << restoreTime << "ms - current tab interactive after " << interactiveTime << "ms - resident memory increased by " << (memoryIncrease / 1024) << "kB from " << (initialMemory / 1024) << "kB to " << (finalMemory / 1024) << "kB");
+
+	// Close restored tabs starting from the last one
+	for (int tabIdx = (tabs->count() - 1); tabIdx >= initialTabCount; tabIdx--) {
+		tabs->removeTab(tabIdx);
+	}
+	QApplication::processEvents(QEventLoop::AllEvents);
+}
+
+void tester::test::SessionRestore::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, sessionRestoreTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	ASSERT((this->directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (this->directory.isValid() == false) {
+		return;
+	}
+
+	QFile page(this->directory.filePath("page.html"));
+	page.open(QIODevice::WriteOnly | QIODevice::Truncate);
+	QTextStream pageStream(&page);
+	pageStream << "<!DOCTYPE html>\n<html>\n<head>\n<title>Session restore</title>\n</head>\n<body>\n";
+	for (int lineIdx = 0; lineIdx < tester::test::session_restore::numberOfLines; lineIdx++) {
+		pageStream << "<p>Line " << lineIdx << " of the page restored in every tab</p>\n";
+	}
+	pageStream << "</body>\n</html>\n";
+	pageStream.flush();
+	page.close();
+
+	for (const int & numberOfTabs : tester::test::session_restore::numbersOfTabs) {
+		this->restoreTabs(numberOfTabs);
+	}
+}
@@ -0,0 +1,185 @@
+/**
+ * @copyright
+ * @file shortcut_toggling.cpp
+ * @author Andrea Gianarda
+ * @date 06th September 2020
+ * @brief Shortcut toggling functions
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <fstream>
+
+#include <QtGui/QKeyEvent>
+#include <QtWidgets/QApplication>
+
+#include "app/shared/enums.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/shared/shared_types.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/window/ctrl_wrapper.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/window/commands.h"
+#include "app/widgets/commands/key_trie.h"
+#include "tester/tests/shortcut_toggling.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(shortcutTogglingOverall, shortcutToggling.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(shortcutTogglingTest, shortcutToggling.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace shortcut_toggling {
+
+			namespace {
+
+				/**
+				 * @brief File opened in every tab
+				 *
+				 */
+				static const std::string textFilename("shortcut_toggling.txt");
+
+				/**
+				 * @brief Number of tabs opened in every run
+				 *
+				 */
+				static const std::vector<int> tabCounts({ 20, 50, 200 });
+
+				/**
+				 * @brief Number of key presses dispatched in every run
+				 *
+				 */
+				static const int numberOfEvents = 1000000;
+
+				/**
+				 * @brief Keys searched for one that no shortcut begins with
+				 *
+				 */
+				static const std::vector<int> candidateKeys({ Qt::Key_F12, Qt::Key_F11, Qt::Key_F10, Qt::Key_F9, Qt::Key_Z, Qt::Key_Y, Qt::Key_X, Qt::Key_W });
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::ShortcutToggling::ShortcutToggling(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Shortcut toggling") {
+	LOG_INFO(app::logger::info_level_e::ZERO, shortcutTogglingOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::ShortcutToggling::~ShortcutToggling() {
+	LOG_INFO(app::logger::info_level_e::ZERO, shortcutTogglingOverall, "Test " << this->getName() << " destructor");
+}
+
+int tester::test::ShortcutToggling::findUnboundKey() const {
+	app::commands::KeyTrie & trie = this->windowWrapper->getWindowCore()->commands->getShortcutTrie();
+	trie.reset();
+
+	const std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+
+	int unboundKey = Qt::Key_unknown;
+	for (const int & key : tester::test::shortcut_toggling::candidateKeys) {
+		if ((unboundKey == Qt::Key_unknown) && (trie.isExpected(key, time) == false)) {
+			unboundKey = key;
+		}
+	}
+
+	return unboundKey;
+}
+
+std::int64_t tester::test::ShortcutToggling::dispatchKeys(const int & numberOfEvents, const int & key, int & filteredEvents) {
+	const std::unique_ptr<app::main_window::window::CtrlWrapper> & windowCtrl = this->windowWrapper->getWindowCtrl();
+
+	// The main window filters the key presses received by the focus widget
+	QWidget * receiver = QApplication::focusWidget();
+	if (receiver == nullptr) {
+		receiver = windowCtrl->window();
+	}
+
+	QKeyEvent keyEvent(QEvent::KeyPress, key, Qt::NoModifier);
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (int eventIdx = 0; eventIdx < numberOfEvents; eventIdx++) {
+		if (windowCtrl->eventFilter(receiver, &keyEvent) == true) {
+			filteredEvents++;
+		}
+	}
+
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void tester::test::ShortcutToggling::benchmark(const int & numberOfTabs, const int & key) {
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+	const QString filepath(QString::fromStdString(tester::test::shortcut_toggling::textFilename));
+
+	const int initialTabCount = tabs->count();
+	for (int tabIdx = initialTabCount; tabIdx < numberOfTabs; tabIdx++) {
+		tabs->openTabInBackground(app::main_window::page_type_e::TEXT, filepath);
+	}
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	const app::main_window::state_e initialState = windowCore->getMainWindowState();
+
+	int filteredEvents = 0;
+	const std::int64_t time = this->dispatchKeys(tester::test::shortcut_toggling::numberOfEvents, key, filteredEvents);
+
+	const double latency = static_cast<double>(time) / static_cast<double>(tester::test::shortcut_toggling::numberOfEvents);
+	LOG_INFO(app::logger::info_level_e::ZERO, shortcutTogglingTest, "[" << tabs->count() << " tabs] " << windowCore->commands->getShortcutTrie().getBindingCount() << " shortcuts - " << latency << " ns/key press");
+
+	// A key no shortcut begins with must reach the focus widget and leave the window in the same state
+	ASSERT((filteredEvents == 0), tester::shared::error_type_e::COMMAND, std::to_string(filteredEvents) + " presses of key " + app::commands::KeySequence(key).toString().toStdString() + " have been filtered out even though no shortcut begins with it");
+	ASSERT((windowCore->getMainWindowState() == initialState), tester::shared::error_type_e::COMMAND, "Pressing key " + app::commands::KeySequence(key).toString().toStdString() + " changed the state of the window");
+	ASSERT((windowCore->commands->getShortcutTrie().isPending() == false), tester::shared::error_type_e::COMMAND, "The shortcut trie is waiting for the next key of a shortcut after pressing key " + app::commands::KeySequence(key).toString().toStdString());
+}
+
+void tester::test::ShortcutToggling::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, shortcutTogglingTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	std::ofstream textFile(tester::test::shortcut_toggling::textFilename, (std::ios::out | std::ios::trunc));
+	textFile << "Tab opened to benchmark shortcut dispatch\n";
+	textFile.close();
+
+	const int key = this->findUnboundKey();
+	ASSERT((key != Qt::Key_unknown), tester::shared::error_type_e::COMMAND, "Every candidate key is the first key of a shortcut");
+	if (key == Qt::Key_unknown) {
+		std::remove(tester::test::shortcut_toggling::textFilename.c_str());
+		return;
+	}
+
+	const std::unique_ptr<app::main_window::window::CtrlWrapper> & windowCtrl = this->windowWrapper->getWindowCtrl();
+	const bool initialShortcutsEnabled = windowCtrl->getShortcutEnabledProperty();
+	// Key presses are fed to the shortcut trie only while shortcuts are enabled
+	windowCtrl->setAllShortcutEnabledProperty(true);
+
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = this->windowWrapper->getWindowCore()->tabs;
+	const int initialTabCount = tabs->count();
+	const bool initialLazyTabs = tabs->isLazyTabs();
+	// Background tabs do not need to load their content to be part of the widget tree
+	tabs->setLazyTabs(true);
+
+	for (const int & numberOfTabs : tester::test::shortcut_toggling::tabCounts) {
+		this->benchmark(numberOfTabs, key);
+	}
+
+	windowCtrl->setAllShortcutEnabledProperty(initialShortcutsEnabled);
+
+	for (int tabIdx = (tabs->count() - 1); tabIdx >= initialTabCount; tabIdx--) {
+		tabs->removeTab(tabIdx);
+	}
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	tabs->setLazyTabs(initialLazyTabs);
+
+	std::remove(tester::test::shortcut_toggling::textFilename.c_str());
+}
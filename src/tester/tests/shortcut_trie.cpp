@@ -0,0 +1,324 @@
+/**
+ * @copyright
+ * @file shortcut_trie.cpp
+ * @author Andrea Gianarda
+ * @date 07th September 2020
+ * @brief Shortcut trie functions
+ */
+
+#include <random>
+#include <algorithm>
+
+#include "app/shared/enums.h"
+#include "app/utility/logger/macros.h"
+#include "app/utility/exception/exception.h"
+#include "app/widgets/commands/key_trie.h"
+#include "app/windows/main_window/json/data.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/window/commands.h"
+#include "tester/tests/shortcut_trie.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(shortcutTrieOverall, shortcutTrie.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(shortcutTrieTest, shortcutTrie.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace shortcut_trie {
+
+			namespace {
+
+				/**
+				 * @brief Number of key events fed to the matchers
+				 *
+				 */
+				static const int numberOfEvents = 1000000;
+
+				/**
+				 * @brief Number of synthetic bindings
+				 *
+				 */
+				static const int numberOfBindings = 200;
+
+				/**
+				 * @brief Maximum number of synthetic key sequences generated in order to collect the bindings
+				 * Key sequences that begin with a binding or that a binding begins with are discarded
+				 *
+				 */
+				static const int maximumGeneratedSequences = 100000;
+
+				/**
+				 * @brief Maximum number of keys of a binding
+				 *
+				 */
+				static const int maximumBindingLength = 4;
+
+				/**
+				 * @brief Keys bindings are made of
+				 * Keys are few in order for bindings to share their beginning
+				 *
+				 */
+				static const std::vector<int> bindingKeys({ Qt::Key_A, Qt::Key_B, Qt::Key_C, Qt::Key_D, Qt::Key_E, Qt::Key_F, (static_cast<int>(Qt::Key_G) | static_cast<int>(Qt::ShiftModifier)), (static_cast<int>(Qt::Key_X) | static_cast<int>(Qt::ControlModifier)) });
+
+				/**
+				 * @brief Key typed by the user that is not part of any binding
+				 *
+				 */
+				static const int unboundKey = Qt::Key_Z;
+
+				/**
+				 * @brief Maximum time between two keys of the same binding
+				 *
+				 */
+				static const std::chrono::milliseconds chordTimeout(1000);
+
+				/**
+				 * @brief Time between two keys typed quickly
+				 *
+				 */
+				static const std::chrono::milliseconds typingInterval(100);
+
+				/**
+				 * @brief One every pausePeriod keys is typed after the chord timeout has elapsed
+				 *
+				 */
+				static const int pausePeriod = 50;
+
+				/**
+				 * @brief Seed of the random generator in order to feed the same keys in every run
+				 *
+				 */
+				static const unsigned int seed = 12345;
+
+				/**
+				 * @brief Result of a key that is the beginning of a binding
+				 *
+				 */
+				static constexpr int partialMatch = -1;
+
+				/**
+				 * @brief Result of a key that does not match any binding
+				 *
+				 */
+				static constexpr int noMatch = -2;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::ShortcutTrie::ShortcutTrie(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Shortcut trie") {
+	LOG_INFO(app::logger::info_level_e::ZERO, shortcutTrieOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::ShortcutTrie::~ShortcutTrie() {
+	LOG_INFO(app::logger::info_level_e::ZERO, shortcutTrieOverall, "Test " << this->getName() << " destructor");
+}
+
+std::int64_t tester::test::ShortcutTrie::linearMatch(const std::vector<app::commands::KeySequence> & bindings, const std::vector<int> & keys, const std::vector<std::chrono::steady_clock::time_point> & times, std::vector<int> & results) const {
+	results.clear();
+	results.reserve(keys.size());
+
+	std::vector<int> typedKeys;
+	std::chrono::steady_clock::time_point lastKeyTime;
+
+	const auto matchKeys = [&bindings] (const std::vector<int> & typed) {
+		std::vector<int> sequenceKeys(typed);
+		sequenceKeys.resize(static_cast<std::size_t>(tester::test::shortcut_trie::maximumBindingLength), Qt::Key_unknown);
+		const app::commands::KeySequence typedSequence(sequenceKeys[0], sequenceKeys[1], sequenceKeys[2], sequenceKeys[3]);
+
+		int result = tester::test::shortcut_trie::noMatch;
+		for (std::size_t bindingIdx = 0; bindingIdx < bindings.size(); bindingIdx++) {
+			const QKeySequence::SequenceMatch match = typedSequence.matches(bindings[bindingIdx]);
+			if (match == QKeySequence::ExactMatch) {
+				result = static_cast<int>(bindingIdx);
+				break;
+			} else if (match == QKeySequence::PartialMatch) {
+				result = tester::test::shortcut_trie::partialMatch;
+			}
+		}
+
+		return result;
+	};
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (std::size_t eventIdx = 0; eventIdx < keys.size(); eventIdx++) {
+		if ((typedKeys.empty() == false) && ((times[eventIdx] - lastKeyTime) > tester::test::shortcut_trie::chordTimeout)) {
+			typedKeys.clear();
+		}
+		lastKeyTime = times[eventIdx];
+		typedKeys.push_back(keys[eventIdx]);
+
+		int result = matchKeys(typedKeys);
+
+		// A key that does not continue the sequence typed so far may begin a new one
+		if ((result == tester::test::shortcut_trie::noMatch) && (typedKeys.size() > 1)) {
+			typedKeys.assign(1, keys[eventIdx]);
+			result = matchKeys(typedKeys);
+		}
+
+		if (result != tester::test::shortcut_trie::partialMatch) {
+			typedKeys.clear();
+		}
+		results.push_back(result);
+	}
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+std::int64_t tester::test::ShortcutTrie::trieMatch(const std::vector<app::commands::KeySequence> & bindings, const std::vector<int> & keys, const std::vector<std::chrono::steady_clock::time_point> & times, std::vector<int> & results) const {
+	results.clear();
+	results.reserve(keys.size());
+
+	app::commands::KeyTrie trie(tester::test::shortcut_trie::chordTimeout);
+	for (std::size_t bindingIdx = 0; bindingIdx < bindings.size(); bindingIdx++) {
+		trie.addBinding(bindings[bindingIdx], static_cast<int>(bindingIdx));
+	}
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (std::size_t eventIdx = 0; eventIdx < keys.size(); eventIdx++) {
+		const QKeySequence::SequenceMatch match = trie.feed(keys[eventIdx], times[eventIdx]);
+		int result = tester::test::shortcut_trie::noMatch;
+		if (match == QKeySequence::ExactMatch) {
+			result = trie.getMatchedValue();
+		} else if (match == QKeySequence::PartialMatch) {
+			result = tester::test::shortcut_trie::partialMatch;
+		}
+		results.push_back(result);
+	}
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void tester::test::ShortcutTrie::checkCommandShortcuts() {
+	const std::unique_ptr<app::main_window::window::Commands> & commands = this->windowWrapper->getWindowCore()->commands;
+	app::commands::KeyTrie & trie = commands->getShortcutTrie();
+
+	for (const auto & data : commands->getActions()) {
+		const int & shortcut = data.second->getShortcut();
+		const app::commands::KeySequence shortcutSequence(shortcut);
+		if (shortcutSequence.isEmpty() == false) {
+			trie.reset();
+			const QKeySequence::SequenceMatch match = trie.feed(shortcut);
+			const app::main_window::json::Data * expectedCommand = commands->findByShortcut(shortcut).get();
+			const app::main_window::json::Data * command = (match == QKeySequence::ExactMatch) ? commands->getShortcutCommand(trie.getMatchedValue()) : nullptr;
+			ASSERT((command == expectedCommand), tester::shared::error_type_e::COMMAND, "Shortcut " + shortcutSequence.toStdString() + " of command " + data.first + " is not resolved to command " + ((expectedCommand == nullptr) ? std::string("none") : expectedCommand->getName()) + " by the shortcut trie");
+		}
+	}
+
+	trie.reset();
+}
+
+void tester::test::ShortcutTrie::checkPrefixConflicts() {
+	app::commands::KeyTrie trie(tester::test::shortcut_trie::chordTimeout);
+	const app::commands::KeySequence binding(Qt::Key_A, Qt::Key_B);
+	trie.addBinding(binding, 0);
+
+	const app::commands::KeySequence bindingBeginning(Qt::Key_A);
+	const app::commands::KeySequence bindingExtension(Qt::Key_A, Qt::Key_B, Qt::Key_C);
+	const app::commands::KeySequence sharedBeginning(Qt::Key_A, Qt::Key_C);
+	ASSERT((trie.hasConflict(binding) == true), tester::shared::error_type_e::COMMAND, "Key sequence " + binding.toStdString() + " is already bound but the trie reports no conflict");
+	ASSERT((trie.hasConflict(bindingBeginning) == true), tester::shared::error_type_e::COMMAND, "Binding " + binding.toStdString() + " begins with key sequence " + bindingBeginning.toStdString() + " but the trie reports no conflict");
+	ASSERT((trie.hasConflict(bindingExtension) == true), tester::shared::error_type_e::COMMAND, "Key sequence " + bindingExtension.toStdString() + " begins with binding " + binding.toStdString() + " but the trie reports no conflict");
+	ASSERT((trie.hasConflict(sharedBeginning) == false), tester::shared::error_type_e::COMMAND, "Key sequence " + sharedBeginning.toStdString() + " only shares its first key with binding " + binding.toStdString() + " but the trie reports a conflict");
+
+	bool rejected = false;
+	try {
+		trie.addBinding(bindingExtension, 1);
+	} catch (const app::exception::Exception &) {
+		rejected = true;
+	}
+	ASSERT((rejected == true), tester::shared::error_type_e::COMMAND, "Key sequence " + bindingExtension.toStdString() + " is bound even though it begins with binding " + binding.toStdString());
+
+	trie.addBinding(sharedBeginning, 1);
+	const std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+	const QKeySequence::SequenceMatch firstMatch = trie.feed(Qt::Key_A, time);
+	const QKeySequence::SequenceMatch secondMatch = trie.feed(Qt::Key_C, (time + tester::test::shortcut_trie::typingInterval));
+	ASSERT(((firstMatch == QKeySequence::PartialMatch) && (secondMatch == QKeySequence::ExactMatch) && (trie.getMatchedValue() == 1)), tester::shared::error_type_e::COMMAND, "Key sequence " + sharedBeginning.toStdString() + " is not matched after binding " + binding.toStdString());
+}
+
+void tester::test::ShortcutTrie::checkSequenceRestart() {
+	app::commands::KeyTrie trie(tester::test::shortcut_trie::chordTimeout);
+	const app::commands::KeySequence chord(Qt::Key_G, Qt::Key_G);
+	const app::commands::KeySequence singleKey(Qt::Key_X);
+	trie.addBinding(chord, 0);
+	trie.addBinding(singleKey, 1);
+
+	const std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+	const QKeySequence::SequenceMatch firstMatch = trie.feed(Qt::Key_G, time);
+	const QKeySequence::SequenceMatch secondMatch = trie.feed(Qt::Key_X, (time + tester::test::shortcut_trie::typingInterval));
+	ASSERT((firstMatch == QKeySequence::PartialMatch), tester::shared::error_type_e::COMMAND, "Key sequence " + app::commands::KeySequence(Qt::Key_G).toStdString() + " is not reported as the beginning of binding " + chord.toStdString());
+	ASSERT(((secondMatch == QKeySequence::ExactMatch) && (trie.getMatchedValue() == 1)), tester::shared::error_type_e::COMMAND, "Binding " + singleKey.toStdString() + " is not matched when typed after the beginning of binding " + chord.toStdString());
+	ASSERT((trie.isPending() == false), tester::shared::error_type_e::COMMAND, "The trie is waiting for further keys after matching binding " + singleKey.toStdString());
+}
+
+void tester::test::ShortcutTrie::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, shortcutTrieTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	this->checkCommandShortcuts();
+	this->checkPrefixConflicts();
+	this->checkSequenceRestart();
+
+	std::mt19937 generator(tester::test::shortcut_trie::seed);
+	std::uniform_int_distribution<std::size_t> keyDistribution(0, (tester::test::shortcut_trie::bindingKeys.size() - 1));
+	std::uniform_int_distribution<int> lengthDistribution(1, tester::test::shortcut_trie::maximumBindingLength);
+
+	// Bindings cannot begin with another binding
+	app::commands::KeyTrie generatedBindings;
+	std::vector<app::commands::KeySequence> bindings;
+	for (int sequenceIdx = 0; (sequenceIdx < tester::test::shortcut_trie::maximumGeneratedSequences) && (static_cast<int>(bindings.size()) < tester::test::shortcut_trie::numberOfBindings); sequenceIdx++) {
+		std::vector<int> sequenceKeys;
+		const int length = lengthDistribution(generator);
+		for (int keyIdx = 0; keyIdx < length; keyIdx++) {
+			sequenceKeys.push_back(tester::test::shortcut_trie::bindingKeys.at(keyDistribution(generator)));
+		}
+		sequenceKeys.resize(static_cast<std::size_t>(tester::test::shortcut_trie::maximumBindingLength), Qt::Key_unknown);
+		const app::commands::KeySequence sequence(sequenceKeys[0], sequenceKeys[1], sequenceKeys[2], sequenceKeys[3]);
+		if (generatedBindings.hasConflict(sequence) == false) {
+			generatedBindings.addBinding(sequence, static_cast<int>(bindings.size()));
+			bindings.push_back(sequence);
+		}
+	}
+
+	// Unbound keys are typed as often as every bound key
+	std::uniform_int_distribution<std::size_t> eventDistribution(0, tester::test::shortcut_trie::bindingKeys.size());
+	std::vector<int> keys;
+	std::vector<std::chrono::steady_clock::time_point> times;
+	keys.reserve(static_cast<std::size_t>(tester::test::shortcut_trie::numberOfEvents));
+	times.reserve(static_cast<std::size_t>(tester::test::shortcut_trie::numberOfEvents));
+	std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+	for (int eventIdx = 0; eventIdx < tester::test::shortcut_trie::numberOfEvents; eventIdx++) {
+		const std::size_t keyIdx = eventDistribution(generator);
+		keys.push_back((keyIdx < tester::test::shortcut_trie::bindingKeys.size()) ? tester::test::shortcut_trie::bindingKeys.at(keyIdx) : tester::test::shortcut_trie::unboundKey);
+		if ((eventIdx % tester::test::shortcut_trie::pausePeriod) == 0) {
+			time += (tester::test::shortcut_trie::chordTimeout + tester::test::shortcut_trie::typingInterval);
+		} else {
+			time += tester::test::shortcut_trie::typingInterval;
+		}
+		times.push_back(time);
+	}
+
+	std::vector<int> linearResults;
+	std::vector<int> trieResults;
+	const std::int64_t linearTime = this->linearMatch(bindings, keys, times, linearResults);
+	const std::int64_t trieTime = this->trieMatch(bindings, keys, times, trieResults);
+
+	const double linearLatency = static_cast<double>(linearTime) / static_cast<double>(tester::test::shortcut_trie::numberOfEvents);
+	const double trieLatency = static_cast<double>(trieTime) / static_cast<double>(tester::test::shortcut_trie::numberOfEvents);
+	const double speedup = (trieLatency > 0.0) ? (linearLatency / trieLatency) : 0.0;
+	const std::size_t exactMatches = static_cast<std::size_t>(std::count_if(trieResults.cbegin(), trieResults.cend(), [] (const int & result) {
+		return (result >= 0);
+	}));
+	LOG_INFO(app::logger::info_level_e::ZERO, shortcutTrieTest, tester::test::shortcut_trie::numberOfEvents << " key events against " << bindings.size() << " bindings (" << exactMatches << " exact matches) - linear: " << linearLatency << " ns/event trie: " << trieLatency << " ns/event speedup: " << speedup);
+
+	ASSERT((linearResults == trieResults), tester::shared::error_type_e::COMMAND, "Linear matching and trie returned different matches");
+}
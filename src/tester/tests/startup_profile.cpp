@@ -0,0 +1,211 @@
+/**
+ * @copyright
+ * @file startup_profile.cpp
+ * @author Andrea Gianarda
+ * @date 12th September 2020
+ * @brief Startup profile functions
+ */
+
+#include <list>
+#include <algorithm>
+
+// Qt libraries
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QProcess>
+#include <QtCore/QProcessEnvironment>
+#include <QtCore/QStringList>
+#include <QtCore/QTemporaryDir>
+
+#include "app/utility/logger/macros.h"
+#include "tester/tests/startup_profile.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(startupProfileOverall, startupProfile.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(startupProfileTest, startupProfile.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace startup_profile {
+
+			namespace {
+
+				/**
+				 * @brief Name of the executable of the browser. It is expected to be in the same directory as the tester
+				 *
+				 */
+				static const QString browserExecutable("browser");
+
+				/**
+				 * @brief File storing the expected duration of every phase of the startup
+				 * If the file does not exist, the durations measured by the test are recorded to it and they are checked from the following run onwards
+				 * It must be kept in sync with STARTUP_BASELINE in the Makefile
+				 *
+				 */
+				static const QString baselineFilename("tester_files/startup_baseline.json");
+
+				/**
+				 * @brief Qt platform the browser is started on
+				 * The baseline is measured on the same platform regardless of the platform the tester runs on in order for durations to be comparable
+				 *
+				 */
+				static const QString qpaPlatform("offscreen");
+
+				/**
+				 * @brief Phases that must be in the trace
+				 *
+				 */
+				static const std::list<std::string> expectedPhases({ "Logger initialization", "Argument parsing", "Application construction", "JSON load", "Window construction", "First show", "First paint" });
+
+				/**
+				 * @brief A phase fails if it is this many times slower than the baseline
+				 *
+				 */
+				static const double slowdownThreshold = 2.0;
+
+				/**
+				 * @brief Baselines shorter than this number of milliseconds are rounded up to it as shorter phases are dominated by noise
+				 *
+				 */
+				static const double minimumBaseline = 10.0;
+
+				/**
+				 * @brief Maximum time in milliseconds the browser can take to start and quit
+				 *
+				 */
+				static const int startupTimeout = 60000;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::StartupProfile::StartupProfile(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Startup profile") {
+	LOG_INFO(app::logger::info_level_e::ZERO, startupProfileOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::StartupProfile::~StartupProfile() {
+	LOG_INFO(app::logger::info_level_e::ZERO, startupProfileOverall, "Test " << this->getName() << " destructor");
+}
+
+std::map<std::string, double> tester::test::StartupProfile::readTrace(const QString & filename) const {
+	std::map<std::string, double> durations;
+
+	QFile traceFile(filename);
+	if (traceFile.open(QIODevice::ReadOnly) == true) {
+		const QJsonDocument trace(QJsonDocument::fromJson(traceFile.readAll()));
+		const QJsonArray events(trace.object().value("traceEvents").toArray());
+		for (const QJsonValue & eventValue : events) {
+			const QJsonObject event(eventValue.toObject());
+			// Complete events store their duration in microseconds
+			if (event.value("ph").toString().compare("X") == 0) {
+				durations[event.value("name").toString().toStdString()] = event.value("dur").toDouble() / 1000.0;
+			}
+		}
+	}
+
+	return durations;
+}
+
+std::map<std::string, double> tester::test::StartupProfile::readBaseline(const QString & filename) const {
+	std::map<std::string, double> durations;
+
+	QFile baselineFile(filename);
+	if (baselineFile.open(QIODevice::ReadOnly) == true) {
+		const QJsonObject baseline(QJsonDocument::fromJson(baselineFile.readAll()).object());
+		for (QJsonObject::const_iterator phaseIt = baseline.constBegin(); phaseIt != baseline.constEnd(); phaseIt++) {
+			durations[phaseIt.key().toStdString()] = phaseIt.value().toDouble();
+		}
+	}
+
+	return durations;
+}
+
+void tester::test::StartupProfile::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, startupProfileTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == false) {
+		return;
+	}
+
+	const QString browserPath(QCoreApplication::applicationDirPath() + "/" + tester::test::startup_profile::browserExecutable);
+	ASSERT((QFile::exists(browserPath) == true), tester::shared::error_type_e::TEST, "Unable to find the browser executable " + browserPath.toStdString());
+	if (QFile::exists(browserPath) == false) {
+		return;
+	}
+
+	// The browser quits as soon as its window is painted and it must not touch the session, the profile or the cache of the user
+	const QString traceFilename(directory.path() + "/startup_trace.json");
+	const QStringList arguments({ "--startup-profile", "exit", "--startup-trace", traceFilename, "--restore-session", "0", "--session-file", directory.path() + "/session.bin", "--profile-storage", "memory", "--profile-name", "startup-profile", "--profile-cache-dir", directory.path() + "/cache", "--log", directory.path() + "/browser.log" });
+
+	QProcessEnvironment environment(QProcessEnvironment::systemEnvironment());
+	environment.insert("QT_QPA_PLATFORM", tester::test::startup_profile::qpaPlatform);
+
+	QProcess browser;
+	browser.setProcessEnvironment(environment);
+	browser.start(browserPath, arguments);
+	const bool started = browser.waitForStarted();
+	ASSERT((started == true), tester::shared::error_type_e::TEST, "Unable to start the browser: " + browser.errorString().toStdString());
+	const bool finished = browser.waitForFinished(tester::test::startup_profile::startupTimeout);
+	ASSERT((finished == true), tester::shared::error_type_e::TEST, "Browser has not quit within " + std::to_string(tester::test::startup_profile::startupTimeout) + "ms after its window was expected to be painted");
+	if (finished == false) {
+		browser.kill();
+		browser.waitForFinished();
+		return;
+	}
+	ASSERT(((browser.exitStatus() == QProcess::NormalExit) && (browser.exitCode() == 0)), tester::shared::error_type_e::TEST, "Browser exited with code " + std::to_string(browser.exitCode()));
+
+	LOG_INFO(app::logger::info_level_e::ZERO, startupProfileTest, "Browser startup report:\n" << QString::fromUtf8(browser.readAllStandardOutput()));
+
+	ASSERT((QFile::exists(traceFilename) == true), tester::shared::error_type_e::TEST, "Startup trace " + traceFilename.toStdString() + " has not been written");
+	const std::map<std::string, double> durations(this->readTrace(traceFilename));
+	for (const std::string & phase : tester::test::startup_profile::expectedPhases) {
+		ASSERT((durations.find(phase) != durations.cend()), tester::shared::error_type_e::TEST, "Phase " + phase + " is not in the startup trace");
+	}
+
+	// Measured durations are printed in the format of the baseline file
+	QJsonObject measuredBaseline;
+	for (const auto & measured : durations) {
+		measuredBaseline.insert(QString::fromStdString(measured.first), measured.second);
+	}
+	LOG_INFO(app::logger::info_level_e::ZERO, startupProfileTest, "Measured startup phases:\n" << QString::fromUtf8(QJsonDocument(measuredBaseline).toJson(QJsonDocument::Indented)));
+
+	if (QFile::exists(tester::test::startup_profile::baselineFilename) == false) {
+		// The machine running the tests records its own baseline the first time
+		QDir().mkpath(QFileInfo(tester::test::startup_profile::baselineFilename).absolutePath());
+		QFile baselineFile(tester::test::startup_profile::baselineFilename);
+		const bool opened = baselineFile.open(QIODevice::WriteOnly | QIODevice::Truncate);
+		ASSERT((opened == true), tester::shared::error_type_e::TEST, "Unable to record the baseline of the startup to file " + tester::test::startup_profile::baselineFilename.toStdString() + ": " + baselineFile.errorString().toStdString());
+		if (opened == true) {
+			baselineFile.write(QJsonDocument(measuredBaseline).toJson(QJsonDocument::Indented));
+			baselineFile.close();
+			LOG_WARNING(startupProfileTest, "Baseline file " << tester::test::startup_profile::baselineFilename << " did not exist therefore the durations measured on platform " << tester::test::startup_profile::qpaPlatform << " have been recorded to it. They are checked from the next run onwards");
+		}
+		return;
+	}
+
+	const std::map<std::string, double> baseline(this->readBaseline(tester::test::startup_profile::baselineFilename));
+	ASSERT((baseline.empty() == false), tester::shared::error_type_e::TEST, "Unable to read the baseline of the startup from file " + tester::test::startup_profile::baselineFilename.toStdString());
+
+	for (const auto & expected : baseline) {
+		const std::map<std::string, double>::const_iterator measured = durations.find(expected.first);
+		if (measured != durations.cend()) {
+			const double limit = tester::test::startup_profile::slowdownThreshold * std::max(expected.second, tester::test::startup_profile::minimumBaseline);
+			LOG_INFO(app::logger::info_level_e::ZERO, startupProfileTest, "Phase " << expected.first << " took " << measured->second << "ms - baseline " << expected.second << "ms limit " << limit << "ms");
+			ASSERT((measured->second <= limit), tester::shared::error_type_e::PERFORMANCE, "Phase " + expected.first + " took " + std::to_string(measured->second) + "ms which is more than " + std::to_string(tester::test::startup_profile::slowdownThreshold) + " times the baseline of " + std::to_string(expected.second) + "ms");
+		}
+	}
+}
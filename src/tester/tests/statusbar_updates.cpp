@@ -0,0 +1,153 @@
+/**
+ * @copyright
+ * @file statusbar_updates.cpp
+ * @author Andrea Gianarda
+ * @date 05th September 2020
+ * @brief Statusbar updates functions
+ */
+
+#include <QtTest/QTest>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+
+#include <QtWidgets/QApplication>
+
+#include "app/shared/enums.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/statusbar/bar.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "tester/tests/statusbar_updates.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(statusbarUpdatesOverall, statusbarUpdates.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(statusbarUpdatesTest, statusbarUpdates.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace statusbar_updates {
+
+			namespace {
+
+				/**
+				 * @brief File scrolled through
+				 *
+				 */
+				static const std::string textFilename("statusbar_updates.txt");
+
+				/**
+				 * @brief Number of lines of the file scrolled through
+				 *
+				 */
+				static const int numberOfLines = 20000;
+
+				/**
+				 * @brief Number of scroll commands sent to the tab
+				 *
+				 */
+				static const int numberOfCommands = 500;
+
+				/**
+				 * @brief Interval in milliseconds between two updates of the status bar
+				 *
+				 */
+				static const std::int64_t updateInterval = 16;
+
+				/**
+				 * @brief Number of labels in the status bar
+				 * A repaint of the status bar may paint all of them
+				 *
+				 */
+				static const std::uint64_t numberOfLabels = 5;
+
+				/**
+				 * @brief Time in milliseconds given to the status bar to apply the last changes
+				 *
+				 */
+				static const int settleTime = 100;
+
+				/**
+				 * @brief Maximum time in milliseconds to wait for the page to load
+				 *
+				 */
+				static const int timeout = 10000;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::StatusbarUpdates::StatusbarUpdates(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Statusbar updates") {
+	LOG_INFO(app::logger::info_level_e::ZERO, statusbarUpdatesOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::StatusbarUpdates::~StatusbarUpdates() {
+	LOG_INFO(app::logger::info_level_e::ZERO, statusbarUpdatesOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::StatusbarUpdates::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, statusbarUpdatesTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	std::ofstream textFile(tester::test::statusbar_updates::textFilename, (std::ios::out | std::ios::trunc));
+	for (int lineIdx = 0; lineIdx < tester::test::statusbar_updates::numberOfLines; lineIdx++) {
+		textFile << "Line " << lineIdx << " of a long page\n";
+	}
+	textFile.close();
+
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+	const std::unique_ptr<app::main_window::statusbar::Bar> & statusbar = windowCore->bottomStatusBar;
+
+	tabs->openTabInBackground(app::main_window::page_type_e::TEXT, QString::fromStdString(tester::test::statusbar_updates::textFilename));
+	const int tabIdx = tabs->count() - 1;
+	tabs->setCurrentIndex(tabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	const std::shared_ptr<app::main_window::tab::Tab> tab = tabs->widget(tabIdx, true);
+	WAIT_FOR_CONDITION((tab->getLoadStatus() == app::base::tab::load_status_e::FINISHED), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " has not finished loading", tester::test::statusbar_updates::timeout);
+	QTest::qWait(tester::test::statusbar_updates::settleTime);
+
+	const std::uint64_t initialLabelUpdates = statusbar->getLabelUpdateCount();
+	const std::uint64_t initialPaintEvents = statusbar->getPaintEventCount();
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (int commandIdx = 0; commandIdx < tester::test::statusbar_updates::numberOfCommands; commandIdx++) {
+		tabs->scrollTab(tabIdx, app::shared::offset_type_e::DOWN);
+		QApplication::processEvents(QEventLoop::AllEvents);
+	}
+
+	WAIT_FOR_CONDITION((statusbar->getVScroll() == tab->getVerticalScroll()), tester::shared::error_type_e::STATUSBAR, "Vertical scroll in the status bar " + std::to_string(statusbar->getVScroll()) + " doesn't match the one of the tab " + std::to_string(tab->getVerticalScroll()), tester::test::statusbar_updates::timeout);
+	QTest::qWait(tester::test::statusbar_updates::settleTime);
+
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	const std::uint64_t labelUpdates = statusbar->getLabelUpdateCount() - initialLabelUpdates;
+	const std::uint64_t paintEvents = statusbar->getPaintEventCount() - initialPaintEvents;
+	const std::int64_t elapsedTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+	const double elapsedSeconds = static_cast<double>(elapsedTime) / 1000.0;
+	const double labelUpdateRate = (elapsedSeconds > 0.0) ? (static_cast<double>(labelUpdates) / elapsedSeconds) : 0.0;
+	const double paintEventRate = (elapsedSeconds > 0.0) ? (static_cast<double>(paintEvents) / elapsedSeconds) : 0.0;
+	LOG_INFO(app::logger::info_level_e::ZERO, statusbarUpdatesTest, tester::test::statusbar_updates::numberOfCommands << " scroll commands in " << elapsedTime << "ms: " << labelUpdates << " label updates (" << labelUpdateRate << "/s) and " << paintEvents << " paint events (" << paintEventRate << "/s)");
+
+	// Changes are applied at most once per interval
+	const std::uint64_t maxUpdates = static_cast<std::uint64_t>(elapsedTime / tester::test::statusbar_updates::updateInterval) + 2;
+	ASSERT((labelUpdates <= maxUpdates), tester::shared::error_type_e::PERFORMANCE, "Labels of the status bar have been updated " + std::to_string(labelUpdates) + " times in " + std::to_string(elapsedTime) + "ms whereas at most " + std::to_string(maxUpdates) + " updates are expected");
+	const std::uint64_t maxPaintEvents = maxUpdates * tester::test::statusbar_updates::numberOfLabels;
+	ASSERT((paintEvents <= maxPaintEvents), tester::shared::error_type_e::PERFORMANCE, "Labels of the status bar have been painted " + std::to_string(paintEvents) + " times in " + std::to_string(elapsedTime) + "ms whereas at most " + std::to_string(maxPaintEvents) + " paint events are expected");
+
+	tabs->removeTab(tabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	std::remove(tester::test::statusbar_updates::textFilename.c_str());
+}
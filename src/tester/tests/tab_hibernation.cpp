@@ -0,0 +1,223 @@
+/**
+ * @copyright
+ * @file tab_hibernation.cpp
+ * @author Andrea Gianarda
+ * @date 02nd September 2020
+ * @brief Tab hibernation functions
+ */
+
+#include <fstream>
+#include <algorithm>
+
+#include <QtCore/QUrl>
+#include <QtCore/QFileInfo>
+#include <QtWidgets/QApplication>
+
+#include "app/shared/enums.h"
+#include "app/utility/cpp/process_memory.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "app/windows/main_window/tabs/discard_manager.h"
+#include "app/windows/shared/find_settings.h"
+#include "tester/tests/tab_hibernation.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(tabHibernationOverall, tabHibernation.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(tabHibernationTest, tabHibernation.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace tab_hibernation {
+
+			namespace {
+
+				/**
+				 * @brief File printed in every TEXT tab
+				 *
+				 */
+				static const std::string textFilename("tab_hibernation.txt");
+
+				/**
+				 * @brief Page shown in every WEB_CONTENT tab
+				 *
+				 */
+				static const std::string webFilename("tab_hibernation.html");
+
+				/**
+				 * @brief Number of lines of the file printed or shown in every tab
+				 *
+				 */
+				static const int numberOfLines = 2000;
+
+				/**
+				 * @brief Number of tabs cycled through
+				 *
+				 */
+				static const int numberOfTabs = 50;
+
+				/**
+				 * @brief Maximum number of tabs whose web page is alive during the test
+				 *
+				 */
+				static const int maxLiveTabs = 5;
+
+				/**
+				 * @brief Maximum number of scroll down requests sent to a tab
+				 *
+				 */
+				static const int maxScrollSteps = 5;
+
+				/**
+				 * @brief Maximum ratio between the peak resident memory while restoring tabs and the one while setting their state up
+				 *
+				 */
+				static const double maxMemoryRatio = 1.25;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::TabHibernation::TabHibernation(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Tab hibernation"), verticalScrolls(), searchedTexts() {
+	LOG_INFO(app::logger::info_level_e::ZERO, tabHibernationOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::TabHibernation::~TabHibernation() {
+	LOG_INFO(app::logger::info_level_e::ZERO, tabHibernationOverall, "Test " << this->getName() << " destructor");
+}
+
+std::int64_t tester::test::TabHibernation::cycleTabs(const QString & source, const bool & restore) {
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+	const std::unique_ptr<app::main_window::tab::DiscardManager> & discardManager = tabs->getDiscardManager();
+
+	std::int64_t peakMemory = 0;
+
+	for (int tabIdx = 0; tabIdx < tester::test::tab_hibernation::numberOfTabs; tabIdx++) {
+		tabs->setCurrentIndex(tabIdx);
+		QApplication::processEvents(QEventLoop::AllEvents);
+
+		const std::shared_ptr<app::main_window::tab::Tab> tab = tabs->widget(tabIdx, true);
+		ASSERT((tab->isPlaceholder() == false), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " is still a placeholder after becoming the current tab");
+		WAIT_FOR_CONDITION((tab->getLoadStatus() == app::base::tab::load_status_e::FINISHED), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " has not finished loading", 5000);
+		ASSERT((tabs->getPageSource(tabIdx).compare(source) == 0), tester::shared::error_type_e::TABS, "Tab " + std::to_string(tabIdx) + " has source " + tabs->getPageSource(tabIdx).toStdString() + " whereas it is expected to be " + source.toStdString());
+
+		if (restore == true) {
+			const int expectedScroll = this->verticalScrolls.at(static_cast<std::size_t>(tabIdx));
+			WAIT_FOR_CONDITION((tab->getVerticalScroll() == expectedScroll), tester::shared::error_type_e::TABS, "Vertical scroll of tab " + std::to_string(tabIdx) + " is " + std::to_string(tab->getVerticalScroll()) + " whereas it is expected to be restored to " + std::to_string(expectedScroll), 5000);
+
+			const std::string & expectedText = this->searchedTexts.at(static_cast<std::size_t>(tabIdx));
+			const std::string searchedText(tab->getFindSettings().getText().toStdString());
+			ASSERT((searchedText.compare(expectedText) == 0), tester::shared::error_type_e::TABS, "Text searched in tab " + std::to_string(tabIdx) + " is " + searchedText + " whereas it is expected to be restored to " + expectedText);
+		} else {
+			const std::string text("Line " + std::to_string(tabIdx * 10));
+			const app::windows::shared::FindSettings settings(QString::fromStdString(text), app::shared::offset_type_e::DOWN, false, false);
+			tabs->findInTab(tabIdx, settings);
+			QApplication::processEvents(QEventLoop::AllEvents);
+
+			const int scrollSteps = (tabIdx % tester::test::tab_hibernation::maxScrollSteps) + 1;
+			for (int stepIdx = 0; stepIdx < scrollSteps; stepIdx++) {
+				const int previousScroll = tab->getVerticalScroll();
+				tabs->scrollTab(tabIdx, app::shared::offset_type_e::DOWN);
+				WAIT_FOR_CONDITION((tab->getVerticalScroll() > previousScroll), tester::shared::error_type_e::TABS, "Vertical scroll of tab " + std::to_string(tabIdx) + " is still " + std::to_string(previousScroll) + " after scrolling down", 5000);
+			}
+
+			this->verticalScrolls.push_back(tab->getVerticalScroll());
+			this->searchedTexts.push_back(text);
+		}
+
+		const int liveTabs = discardManager->getLiveTabs();
+		ASSERT((liveTabs <= tester::test::tab_hibernation::maxLiveTabs), tester::shared::error_type_e::TABS, std::to_string(liveTabs) + " tabs are alive whereas the limit is " + std::to_string(tester::test::tab_hibernation::maxLiveTabs));
+
+		peakMemory = std::max(peakMemory, app::utility::getResidentMemory());
+	}
+
+	return peakMemory;
+}
+
+void tester::test::TabHibernation::hibernateTabs(const app::main_window::page_type_e & type, const QString & source) {
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+	const std::unique_ptr<app::main_window::tab::DiscardManager> & discardManager = tabs->getDiscardManager();
+
+	// Close tabs opened by previous tests
+	while (tabs->count() > 0) {
+		tabs->removeTab(tabs->count() - 1);
+	}
+	this->verticalScrolls.clear();
+	this->searchedTexts.clear();
+
+	if (type == app::main_window::page_type_e::WEB_CONTENT) {
+		// Tabs are restored with the source as is in order not to turn the URL of the local page into a search
+		for (int tabIdx = 0; tabIdx < tester::test::tab_hibernation::numberOfTabs; tabIdx++) {
+			tabs->restoreTab(type, source, QByteArray(), 0);
+		}
+		tabs->restoreCurrentTab(0);
+	} else {
+		for (int tabIdx = 0; tabIdx < tester::test::tab_hibernation::numberOfTabs; tabIdx++) {
+			tabs->openTabInBackground(type, source);
+		}
+	}
+	QApplication::processEvents(QEventLoop::AllEvents);
+
+	const std::uint64_t initialDiscardedTabs = discardManager->getDiscardedTabs();
+	const std::int64_t setupPeakMemory = this->cycleTabs(source, false);
+	const std::int64_t restorePeakMemory = this->cycleTabs(source, true);
+	const std::uint64_t discardedTabs = discardManager->getDiscardedTabs() - initialDiscardedTabs;
+
+	LOG_INFO(app::logger::info_level_e::ZERO, tabHibernationTest, "[" << type << "] " << discardedTabs << " tabs hibernated - peak resident memory is " << (setupPeakMemory / 1024) << "kB while setting tabs up and " << (restorePeakMemory / 1024) << "kB while restoring them");
+
+	ASSERT((discardedTabs > 0), tester::shared::error_type_e::TABS, "No tab has been hibernated even though " + std::to_string(tester::test::tab_hibernation::numberOfTabs) + " tabs were cycled through with a limit of " + std::to_string(tester::test::tab_hibernation::maxLiveTabs) + " live tabs");
+	ASSERT((static_cast<double>(restorePeakMemory) <= (static_cast<double>(setupPeakMemory) * tester::test::tab_hibernation::maxMemoryRatio)), tester::shared::error_type_e::TABS, "Peak resident memory grew from " + std::to_string(setupPeakMemory) + " bytes to " + std::to_string(restorePeakMemory) + " bytes while restoring hibernated tabs");
+
+	// Keep the first tab only in order to speed up the closure of the tabs at the end of the test
+	tabs->setCurrentIndex(0);
+	while (tabs->count() > 1) {
+		tabs->removeTab(tabs->count() - 1);
+	}
+	QApplication::processEvents(QEventLoop::AllEvents);
+}
+
+void tester::test::TabHibernation::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, tabHibernationTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	std::ofstream textFile(tester::test::tab_hibernation::textFilename, (std::ios::out | std::ios::trunc));
+	for (int lineIdx = 0; lineIdx < tester::test::tab_hibernation::numberOfLines; lineIdx++) {
+		textFile << "Line " << lineIdx << " of the file printed in every tab of the hibernation test\n";
+	}
+	textFile.close();
+
+	std::ofstream webFile(tester::test::tab_hibernation::webFilename, (std::ios::out | std::ios::trunc));
+	webFile << "<!DOCTYPE html><html><head><meta charset=\"utf-8\"><title>Tab hibernation</title></head><body>\n";
+	for (int lineIdx = 0; lineIdx < tester::test::tab_hibernation::numberOfLines; lineIdx++) {
+		webFile << "<p>Line " << lineIdx << " of the page shown in every tab of the hibernation test</p>\n";
+	}
+	webFile << "</body></html>\n";
+	webFile.close();
+
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+	const std::unique_ptr<app::main_window::tab::DiscardManager> & discardManager = tabs->getDiscardManager();
+
+	const int initialMaxLiveTabs = discardManager->getMaxLiveTabs();
+	const std::int64_t initialMemoryBudget = discardManager->getMemoryBudget();
+	discardManager->setMaxLiveTabs(tester::test::tab_hibernation::maxLiveTabs);
+	discardManager->setMemoryBudget(0);
+
+	this->hibernateTabs(app::main_window::page_type_e::TEXT, QString::fromStdString(tester::test::tab_hibernation::textFilename));
+
+	const QString webFilepath(QFileInfo(QString::fromStdString(tester::test::tab_hibernation::webFilename)).absoluteFilePath());
+	this->hibernateTabs(app::main_window::page_type_e::WEB_CONTENT, QUrl::fromLocalFile(webFilepath).toString());
+
+	discardManager->setMaxLiveTabs(initialMaxLiveTabs);
+	discardManager->setMemoryBudget(initialMemoryBudget);
+}
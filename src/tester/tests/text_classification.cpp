@@ -0,0 +1,255 @@
+/**
+ * @copyright
+ * @file text_classification.cpp
+ * @author Andrea Gianarda
+ * @date 10th September 2020
+ * @brief Text classification functions
+ */
+
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+// Qt libraries
+#include <QtCore/QFile>
+#include <QtCore/QUrl>
+#include <QtCore/QTemporaryDir>
+
+#include "app/shared/constants.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/shared/shared_functions.h"
+#include "app/windows/main_window/shared/text_classifier.h"
+#include "tester/tests/text_classification.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(textClassificationOverall, textClassification.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(textClassificationTest, textClassification.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace text_classification {
+
+			namespace {
+
+				/**
+				 * @brief Number of texts classified
+				 *
+				 */
+				static const int numberOfInputs = 100000;
+
+				/**
+				 * @brief Number of distinct texts of every kind
+				 *
+				 */
+				static const int textsPerKind = 60;
+
+				/**
+				 * @brief Number of distinct texts typed more often than the others
+				 *
+				 */
+				static const std::size_t numberOfHotTexts = 200;
+
+				/**
+				 * @brief Percentage of classified texts taken from the texts typed more often
+				 *
+				 */
+				static const int hotTextPercentage = 80;
+
+				/**
+				 * @brief Seed of the random number generator
+				 *
+				 */
+				static const unsigned int seed = 13579;
+
+				/**
+				 * @brief Texts whose shape is unusual
+				 *
+				 */
+				static const std::vector<QString> unusualTexts({ "", ".", "..", "a b.c", "host.", ".hidden", "%zz.com", "under_score.com", "https://www.duckduckgo.com", "http://example.com", "www.", "1.2.3.4", "localhost:8080", "user@mail.com", "tab\tseparated.com", "new\nline.com" });
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::TextClassification::TextClassification(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Text classification") {
+	LOG_INFO(app::logger::info_level_e::ZERO, textClassificationOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::TextClassification::~TextClassification() {
+	LOG_INFO(app::logger::info_level_e::ZERO, textClassificationOverall, "Test " << this->getName() << " destructor");
+}
+
+std::vector<QString> tester::test::TextClassification::createInputs(const QString & directory) const {
+	std::vector<QString> inputs(tester::test::text_classification::unusualTexts);
+
+	for (int idx = 0; idx < tester::test::text_classification::textsPerKind; idx++) {
+		const QString number(QString::number(idx));
+
+		// Existing and missing files
+		const QString existingFile(directory + "/file" + number + ".txt");
+		QFile file(existingFile);
+		file.open(QIODevice::WriteOnly);
+		file.close();
+		inputs.push_back(existingFile);
+		inputs.push_back(directory + "/missing" + number + ".txt");
+		inputs.push_back(directory + "/file" + number);
+
+		// URLs
+		inputs.push_back("example" + number + ".com");
+		inputs.push_back("www.site" + number + ".org");
+		inputs.push_back("https://www.page" + number + ".net/path/to/" + number);
+		inputs.push_back("docs.host" + number + ".io/a?b=" + number);
+
+		// Search queries
+		inputs.push_back("word" + number);
+		inputs.push_back("search term " + number);
+		inputs.push_back("how to write c++ " + number);
+		inputs.push_back("version 1." + number);
+	}
+
+	return inputs;
+}
+
+bool tester::test::TextClassification::referenceIsUrl(const QString & text) const {
+
+	const bool containsWww = text.contains(app::shared::www);
+	const bool containsHttps = text.contains(app::shared::https);
+
+	QString urlStr = QString();
+
+	if (containsHttps == false) {
+		urlStr += app::shared::https;
+	}
+
+	if (containsWww == false) {
+		urlStr += app::shared::www;
+	}
+
+	urlStr += text;
+
+	QUrl url(urlStr, QUrl::StrictMode);
+
+	const int numberDots = text.count(".");
+
+	return ((url.isValid() == true) && (numberDots > 0));
+}
+
+app::main_window::page_type_e tester::test::TextClassification::referenceTextToPageType(const QString & text) const {
+	const bool validFile = app::main_window::TextClassifier::checkFile(text);
+	const bool validUrl = this->referenceIsUrl(text);
+	const bool validText = ((validUrl == false) && (app::main_window::TextClassifier::checkFile(text) == false));
+
+	app::main_window::page_type_e type = app::main_window::page_type_e::UNKNOWN;
+	if (validFile == true) {
+		type = app::main_window::page_type_e::TEXT;
+	} else if ((validUrl == true) || (validText == true)) {
+		type = app::main_window::page_type_e::WEB_CONTENT;
+	}
+	return type;
+}
+
+void tester::test::TextClassification::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, textClassificationTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == false) {
+		return;
+	}
+
+	app::main_window::TextClassifier * classifier = app::main_window::TextClassifier::getInstance();
+	classifier->clear();
+
+	std::vector<QString> distinctInputs(this->createInputs(directory.path()));
+
+	// Parsing shortcuts must not change how any text is classified
+	std::size_t urlMismatches = 0;
+	for (const QString & input : distinctInputs) {
+		if (app::main_window::TextClassifier::checkUrl(input) != this->referenceIsUrl(input)) {
+			urlMismatches++;
+			LOG_INFO(app::logger::info_level_e::ZERO, textClassificationTest, "Text " << input << " is classified differently when it is not parsed");
+		}
+	}
+	ASSERT((urlMismatches == 0), tester::shared::error_type_e::TEST, std::to_string(urlMismatches) + " texts out of " + std::to_string(distinctInputs.size()) + " are classified as URLs differently when they are not parsed");
+
+	// Some texts are typed much more often than others
+	std::mt19937 generator(tester::test::text_classification::seed);
+	std::shuffle(distinctInputs.begin(), distinctInputs.end(), generator);
+	const std::size_t numberOfHotTexts = std::min(tester::test::text_classification::numberOfHotTexts, distinctInputs.size());
+	std::uniform_int_distribution<int> percentageDistribution(0, 99);
+	std::uniform_int_distribution<std::size_t> hotDistribution(0, (numberOfHotTexts - 1));
+	std::uniform_int_distribution<std::size_t> allDistribution(0, (distinctInputs.size() - 1));
+
+	std::vector<QString> inputs;
+	inputs.reserve(static_cast<std::size_t>(tester::test::text_classification::numberOfInputs));
+	for (int inputIdx = 0; inputIdx < tester::test::text_classification::numberOfInputs; inputIdx++) {
+		if (percentageDistribution(generator) < tester::test::text_classification::hotTextPercentage) {
+			inputs.push_back(distinctInputs.at(hotDistribution(generator)));
+		} else {
+			inputs.push_back(distinctInputs.at(allDistribution(generator)));
+		}
+	}
+
+	// Classify texts as opening a tab does: deduce the page type and then check whether the text is a URL or a text to search
+	std::vector<int> referenceResults;
+	referenceResults.reserve(inputs.size());
+	const std::chrono::steady_clock::time_point referenceStart = std::chrono::steady_clock::now();
+	for (const QString & input : inputs) {
+		const app::main_window::page_type_e type = this->referenceTextToPageType(input);
+		const bool url = this->referenceIsUrl(input);
+		const bool text = ((url == false) && (app::main_window::TextClassifier::checkFile(input) == false));
+		referenceResults.push_back((static_cast<int>(type) << 2) | (static_cast<int>(url) << 1) | static_cast<int>(text));
+	}
+	const std::chrono::steady_clock::time_point referenceEnd = std::chrono::steady_clock::now();
+
+	const std::uint64_t initialHits = classifier->getHits();
+	const std::uint64_t initialMisses = classifier->getMisses();
+	std::vector<int> cachedResults;
+	cachedResults.reserve(inputs.size());
+	const std::chrono::steady_clock::time_point cachedStart = std::chrono::steady_clock::now();
+	for (const QString & input : inputs) {
+		const app::main_window::page_type_e type = app::main_window::textToPageType(input);
+		const bool url = app::main_window::isUrl(input);
+		const bool text = app::main_window::isText(input);
+		cachedResults.push_back((static_cast<int>(type) << 2) | (static_cast<int>(url) << 1) | static_cast<int>(text));
+	}
+	const std::chrono::steady_clock::time_point cachedEnd = std::chrono::steady_clock::now();
+
+	const std::int64_t referenceTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(referenceEnd - referenceStart).count());
+	const std::int64_t cachedTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(cachedEnd - cachedStart).count());
+	const double referenceLatency = static_cast<double>(referenceTime) / static_cast<double>(inputs.size());
+	const double cachedLatency = static_cast<double>(cachedTime) / static_cast<double>(inputs.size());
+	const double speedup = (cachedLatency > 0.0) ? (referenceLatency / cachedLatency) : 0.0;
+	const std::uint64_t hits = classifier->getHits() - initialHits;
+	const std::uint64_t misses = classifier->getMisses() - initialMisses;
+	LOG_INFO(app::logger::info_level_e::ZERO, textClassificationTest, inputs.size() << " texts (" << distinctInputs.size() << " distinct) - uncached: " << referenceLatency << " ns/text cached: " << cachedLatency << " ns/text speedup: " << speedup << " cache hits: " << hits << " misses: " << misses);
+
+	std::size_t mismatches = 0;
+	for (std::size_t idx = 0; idx < inputs.size(); idx++) {
+		if (referenceResults.at(idx) != cachedResults.at(idx)) {
+			mismatches++;
+		}
+	}
+	ASSERT((mismatches == 0), tester::shared::error_type_e::TEST, "Cached and uncached classification differ for " + std::to_string(mismatches) + " texts out of " + std::to_string(inputs.size()));
+
+	// Files are checked again against the filesystem once the timeout expires
+	const std::chrono::milliseconds initialTimeout(classifier->getFileCheckTimeout());
+	const QString removedFile(directory.path() + "/removed.txt");
+	QFile file(removedFile);
+	file.open(QIODevice::WriteOnly);
+	file.close();
+	ASSERT((app::main_window::isFile(removedFile) == true), tester::shared::error_type_e::TEST, "File " + removedFile.toStdString() + " is expected to exist");
+	file.remove();
+	classifier->setFileCheckTimeout(std::chrono::milliseconds(0));
+	ASSERT((app::main_window::isFile(removedFile) == false), tester::shared::error_type_e::TEST, "File " + removedFile.toStdString() + " was removed but it is still classified as a file after the timeout expired");
+	ASSERT((app::main_window::textToPageType(removedFile) == app::main_window::page_type_e::WEB_CONTENT), tester::shared::error_type_e::TEST, "Removed file " + removedFile.toStdString() + " is expected to be searched on the web");
+	classifier->setFileCheckTimeout(initialTimeout);
+	classifier->clear();
+}
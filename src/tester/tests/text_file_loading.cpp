@@ -0,0 +1,152 @@
+/**
+ * @copyright
+ * @file text_file_loading.cpp
+ * @author Andrea Gianarda
+ * @date 03rd September 2020
+ * @brief Text file loading functions
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <fstream>
+
+#include <QtWidgets/QApplication>
+
+#include "app/shared/enums.h"
+#include "app/shared/exception.h"
+#include "app/utility/cpp/process_memory.h"
+#include "app/utility/logger/macros.h"
+#include "app/windows/main_window/window/core.h"
+#include "app/windows/main_window/tabs/tab_widget.h"
+#include "app/windows/main_window/tabs/tab.h"
+#include "tester/tests/text_file_loading.h"
+#include "tester/base/suite.h"
+#include "tester/top/main_window_wrapper.h"
+
+LOGGING_CONTEXT(textFileLoadingOverall, textFileLoading.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(textFileLoadingTest, textFileLoading.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace text_file_loading {
+
+			namespace {
+
+				/**
+				 * @brief Size in bytes of the files opened
+				 *
+				 */
+				static const std::vector<std::int64_t> fileSizes({
+					static_cast<std::int64_t>(1) << 20,
+					static_cast<std::int64_t>(100) << 20,
+					static_cast<std::int64_t>(1) << 30
+				});
+
+				/**
+				 * @brief Size in bytes of the blocks written while generating a file
+				 *
+				 */
+				static const std::size_t blockSize = 1 << 20;
+
+				/**
+				 * @brief Maximum time in milliseconds to wait for a file to be shown
+				 *
+				 */
+				static const int loadTimeout = 60000;
+
+				/**
+				 * @brief Maximum increase in bytes of the resident memory of the process while opening a file
+				 * Only the portion of the file around the viewport is expected to be loaded regardless of the size of the file
+				 *
+				 */
+				static const std::int64_t maxMemoryIncrease = static_cast<std::int64_t>(128) << 20;
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::TextFileLoading::TextFileLoading(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Text file loading") {
+	LOG_INFO(app::logger::info_level_e::ZERO, textFileLoadingOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::TextFileLoading::~TextFileLoading() {
+	LOG_INFO(app::logger::info_level_e::ZERO, textFileLoadingOverall, "Test " << this->getName() << " destructor");
+}
+
+void tester::test::TextFileLoading::generateFile(const std::string & filename, const std::int64_t & size) const {
+	std::ofstream textFile(filename, (std::ios::out | std::ios::trunc | std::ios::binary));
+	EXCEPTION_ACTION_COND((textFile.is_open() == false), throw, "Unable to create file " << filename);
+
+	std::string block;
+	block.reserve(tester::test::text_file_loading::blockSize + 128);
+
+	std::int64_t written = 0;
+	std::int64_t lineIdx = 0;
+	while (written < size) {
+		block.clear();
+		while (block.size() < tester::test::text_file_loading::blockSize) {
+			block.append("Line " + std::to_string(lineIdx) + " of a generated log file: the quick brown fox jumps over the lazy dog\n");
+			lineIdx++;
+		}
+		const std::int64_t remaining = size - written;
+		const std::size_t count = (remaining < static_cast<std::int64_t>(block.size())) ? static_cast<std::size_t>(remaining) : block.size();
+		textFile.write(block.data(), static_cast<std::streamsize>(count));
+		written += static_cast<std::int64_t>(count);
+	}
+
+	textFile.close();
+}
+
+void tester::test::TextFileLoading::loadFile(const std::string & filename, const std::int64_t & size) {
+	const std::shared_ptr<app::main_window::window::Core> & windowCore = this->windowWrapper->getWindowCore();
+	const std::unique_ptr<app::main_window::tab::TabWidget> & tabs = windowCore->tabs;
+	const QString filepath(QString::fromStdString(filename));
+
+	QApplication::processEvents(QEventLoop::AllEvents);
+	const std::int64_t initialMemory = app::utility::getResidentMemory();
+	ASSERT((initialMemory >= 0), tester::shared::error_type_e::TEST, "Unable to read the resident memory of the process");
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	tabs->openTabInBackground(app::main_window::page_type_e::TEXT, filepath);
+	const int tabIdx = tabs->count() - 1;
+	tabs->setCurrentIndex(tabIdx);
+
+	const std::shared_ptr<app::main_window::tab::Tab> tab = tabs->widget(tabIdx, true);
+	this->waitForCondition([&] () {
+		return (tab->getLoadStatus() == app::base::tab::load_status_e::FINISHED);
+	}, std::chrono::milliseconds(tester::test::text_file_loading::loadTimeout));
+
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	const std::int64_t finalMemory = app::utility::getResidentMemory();
+	const std::int64_t peakMemory = app::utility::getPeakResidentMemory();
+
+	ASSERT((tab->getLoadStatus() == app::base::tab::load_status_e::FINISHED), tester::shared::error_type_e::TABS, "File " + filename + " of " + std::to_string(size) + " bytes has not been shown within " + std::to_string(tester::test::text_file_loading::loadTimeout) + "ms");
+
+	const std::int64_t elapsedTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+	const std::int64_t memoryIncrease = finalMemory - initialMemory;
+	LOG_INFO(app::logger::info_level_e::ZERO, textFileLoadingTest, "[" << (size >> 20) << "MB] time to first paint " << elapsedTime << "ms - resident memory increased by " << (memoryIncrease / 1024) << "kB to " << (finalMemory / 1024) << "kB - peak resident memory " << (peakMemory / 1024) << "kB");
+
+	ASSERT((memoryIncrease <= tester::test::text_file_loading::maxMemoryIncrease), tester::shared::error_type_e::PERFORMANCE, "Resident memory increased by " + std::to_string(memoryIncrease) + " bytes while opening file " + filename + " of " + std::to_string(size) + " bytes");
+
+	tabs->removeTab(tabIdx);
+	QApplication::processEvents(QEventLoop::AllEvents);
+}
+
+void tester::test::TextFileLoading::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, textFileLoadingTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	for (const std::int64_t & size : tester::test::text_file_loading::fileSizes) {
+		const std::string filename("text_file_loading_" + std::to_string(size >> 20) + "MB.txt");
+		this->generateFile(filename, size);
+		this->loadFile(filename, size);
+		std::remove(filename.c_str());
+	}
+}
@@ -0,0 +1,170 @@
+/**
+ * @copyright
+ * @file trace_log.cpp
+ * @author Andrea Gianarda
+ * @date 30th October 2020
+ * @brief Trace log functions
+ */
+
+#include <chrono>
+#include <sstream>
+#include <fstream>
+#include <iterator>
+
+// Qt libraries
+#include <QtCore/QFileInfo>
+#include <QtCore/QTemporaryDir>
+
+#include "app/utility/logger/backend.h"
+#include "app/utility/logger/macros.h"
+#include "app/utility/logger/trace_format.h"
+#include "tester/tests/trace_log.h"
+#include "tester/base/suite.h"
+
+LOGGING_CONTEXT(traceLogOverall, traceLog.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(traceLogTest, traceLog.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(traceLogMessage, traceLog.message, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+
+namespace tester {
+
+	namespace test {
+
+		namespace trace_log {
+
+			namespace {
+
+				/**
+				 * @brief Number of messages logged through each path
+				 *
+				 */
+				static const std::uint64_t messages = 200000;
+
+				/**
+				 * @brief Name logged in every message
+				 *
+				 */
+				static const std::string name("trace");
+
+			}
+
+		}
+
+	}
+
+}
+
+tester::test::TraceLog::TraceLog(const std::shared_ptr<tester::base::Suite> & testSuite) : tester::base::Test(testSuite, "Trace log") {
+	LOG_INFO(app::logger::info_level_e::ZERO, traceLogOverall, "Creating test " << this->getName() << " in suite " << this->getSuite()->getName());
+}
+
+tester::test::TraceLog::~TraceLog() {
+	LOG_INFO(app::logger::info_level_e::ZERO, traceLogOverall, "Test " << this->getName() << " destructor");
+}
+
+std::string tester::test::TraceLog::getExpectedMessage(const std::uint64_t & iteration) const {
+	std::ostringstream message;
+	message << "iteration " << iteration << " of " << tester::test::trace_log::messages << " ratio " << (static_cast<double>(iteration) * 0.5) << " name " << tester::test::trace_log::name;
+	return message.str();
+}
+
+void tester::test::TraceLog::checkCorruptedTrace(const std::string & trace, const std::string & corruption) {
+	std::istringstream input(trace);
+	std::ostringstream output;
+	app::logger::trace::Decoder decoder;
+	const bool decoded = decoder.decode(input, output);
+	ASSERT((decoded == false), tester::shared::error_type_e::TEST, "Decoder reported no error for a trace with " + corruption);
+	LOG_INFO(app::logger::info_level_e::ZERO, traceLogTest, "Trace with " << corruption << " rejected after " << decoder.getDecodedRecords() << " records: " << decoder.getError());
+}
+
+void tester::test::TraceLog::testBody() {
+
+	LOG_INFO(app::logger::info_level_e::ZERO, traceLogTest, "Starting test " << this->getName() << " in suite " << this->getSuite()->getName());
+
+	QTemporaryDir directory;
+	ASSERT((directory.isValid() == true), tester::shared::error_type_e::TEST, "Unable to create a temporary directory");
+	if (directory.isValid() == false) {
+		return;
+	}
+
+	app::logger::Backend * backend = app::logger::Backend::getInstance();
+	app::logger::Tracer * tracer = app::logger::Tracer::getInstance();
+	const app::logger::queue_policy_e initialPolicy = backend->getQueuePolicy();
+	const std::string initialTraceFilename(tracer->getFilename());
+
+	// Every message must reach the files in order to compare their sizes
+	backend->setQueuePolicy(app::logger::queue_policy_e::BLOCK);
+
+	const std::string textFilename(directory.path().toStdString() + "/text.log");
+	const std::string traceFilename(directory.path().toStdString() + "/trace.bin");
+	const std::uint64_t & messages = tester::test::trace_log::messages;
+
+	// Text path
+	const std::chrono::steady_clock::time_point textStart = std::chrono::steady_clock::now();
+	for (std::uint64_t iteration = 0; iteration < messages; iteration++) {
+		LOG_INFO_TO_FILE(app::logger::info_level_e::ZERO, traceLogMessage, textFilename, "iteration " << iteration << " of " << messages << " ratio " << (static_cast<double>(iteration) * 0.5) << " name " << tester::test::trace_log::name);
+	}
+	backend->flush();
+	const std::chrono::steady_clock::time_point textEnd = std::chrono::steady_clock::now();
+	backend->close(textFilename);
+
+	// Binary path
+	tracer->setFilename(traceFilename);
+	const std::chrono::steady_clock::time_point traceStart = std::chrono::steady_clock::now();
+	for (std::uint64_t iteration = 0; iteration < messages; iteration++) {
+		LOG_TRACE_INFO(app::logger::info_level_e::ZERO, traceLogMessage, "iteration {} of {} ratio {} name {}", iteration, messages, (static_cast<double>(iteration) * 0.5), tester::test::trace_log::name);
+	}
+	backend->flush();
+	const std::chrono::steady_clock::time_point traceEnd = std::chrono::steady_clock::now();
+	backend->close(traceFilename);
+	tracer->setFilename(initialTraceFilename);
+	backend->setQueuePolicy(initialPolicy);
+
+	const double textBytes = static_cast<double>(QFileInfo(QString::fromStdString(textFilename)).size()) / static_cast<double>(messages);
+	const double traceBytes = static_cast<double>(QFileInfo(QString::fromStdString(traceFilename)).size()) / static_cast<double>(messages);
+	const double textTime = std::chrono::duration<double, std::nano>(textEnd - textStart).count() / static_cast<double>(messages);
+	const double traceTime = std::chrono::duration<double, std::nano>(traceEnd - traceStart).count() / static_cast<double>(messages);
+	LOG_INFO(app::logger::info_level_e::ZERO, traceLogTest, "Text log: " << textBytes << " bytes/message " << textTime << " ns/message - binary trace: " << traceBytes << " bytes/message " << traceTime << " ns/message");
+
+	ASSERT((traceBytes < textBytes), tester::shared::error_type_e::PERFORMANCE, "Binary trace takes " + std::to_string(traceBytes) + " bytes per message whereas the text log takes " + std::to_string(textBytes));
+
+	// The decoder must reconstruct every message
+	std::ifstream input(traceFilename, std::ios::binary);
+	std::ostringstream output;
+	app::logger::trace::Decoder decoder;
+	const bool decoded = decoder.decode(input, output);
+	ASSERT((decoded == true), tester::shared::error_type_e::TEST, "Unable to decode " + traceFilename + ": " + decoder.getError());
+	ASSERT((decoder.getDecodedRecords() == messages), tester::shared::error_type_e::TEST, "Decoded " + std::to_string(decoder.getDecodedRecords()) + " records out of " + std::to_string(messages));
+
+	std::istringstream lines(output.str());
+	std::string line = std::string();
+	std::uint64_t iteration = 0;
+	std::uint64_t mismatches = 0;
+	while (std::getline(lines, line)) {
+		const std::string expected(" " + this->getExpectedMessage(iteration));
+		const bool match = (line.size() >= expected.size()) && (line.compare(line.size() - expected.size(), expected.size(), expected) == 0) && (line.find("[traceLog.message]") != std::string::npos);
+		if (match == false) {
+			mismatches++;
+		}
+		iteration++;
+	}
+	ASSERT((mismatches == 0), tester::shared::error_type_e::TEST, std::to_string(mismatches) + " decoded messages differ from the logged ones");
+
+	// Corrupted traces must be reported as such rather than decoded partially
+	std::ifstream traceFile(traceFilename, std::ios::binary);
+	const std::string trace((std::istreambuf_iterator<char>(traceFile)), std::istreambuf_iterator<char>());
+	ASSERT((trace.size() > app::logger::trace::recordHeaderSize), tester::shared::error_type_e::TEST, "Trace " + traceFilename + " is too short to be corrupted");
+	if (trace.size() > app::logger::trace::recordHeaderSize) {
+		this->checkCorruptedTrace(trace.substr(0, (trace.size() - 1)), "a truncated last entry");
+
+		// Append an entry whose size exceeds the maximum size of the body of an entry
+		std::string oversizedTrace(trace);
+		app::logger::trace::appendRaw(oversizedTrace, app::logger::trace::entry_type_e::RECORD);
+		app::logger::trace::appendRaw(oversizedTrace, static_cast<std::uint32_t>(app::logger::trace::maxBodySize + 1));
+		this->checkCorruptedTrace(oversizedTrace, "an oversized entry");
+
+		std::string unknownTypeTrace(trace);
+		app::logger::trace::appendRaw(unknownTypeTrace, static_cast<std::uint8_t>(static_cast<std::uint8_t>(app::logger::trace::entry_type_e::RECORD) + 1));
+		app::logger::trace::appendRaw(unknownTypeTrace, static_cast<std::uint32_t>(0));
+		this->checkCorruptedTrace(unknownTypeTrace, "an entry of unknown type");
+	}
+}
@@ -20,9 +20,9 @@
 #include "tester/top/main_window_wrapper.h"
 
 // Categories
-LOGGING_CONTEXT(mainWindowTesterWrapperOverall, mainWindowTesterWrapper.overall, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(mainWindowTesterWrapperOverall, mainWindowTesterWrapper.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
-tester::main_window_wrapper::MainWindowWrapper::MainWindowWrapper(QWidget * parent, Qt::WindowFlags flags) : app::main_window::window::Wrapper(parent, flags) {
+tester::main_window_wrapper::MainWindowWrapper::MainWindowWrapper(QWidget * parent, Qt::WindowFlags flags, const QString & sessionFile) : app::main_window::window::Wrapper(parent, flags, sessionFile) {
 
 	LOG_INFO(app::logger::info_level_e::ZERO, mainWindowTesterWrapperOverall, "Main window tester wrapper constructor");
 
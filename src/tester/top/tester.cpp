@@ -61,6 +61,11 @@ int main (int argc, char* argv[]) {
 
 		runner->run();
 		runner->printResults();
+		runner->writeReports();
+
+		if (runner->isSuccessful() == false) {
+			return EXIT_FAILURE;
+		}
 
 	} catch (const app::exception::Exception & bexc) {
 		std::string bexcMsg(bexc.print());
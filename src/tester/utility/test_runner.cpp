@@ -6,8 +6,21 @@
  * @brief Test runner functions
  */
 
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
 // Qt libraries
+#include <QtCore/QByteArray>
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonParseError>
 #include <QtCore/QUnhandledException>
+#include <QtCore/QXmlStreamWriter>
+#include <QtWidgets/QApplication>
 
 #include "app/shared/exception.h"
 #include "app/shared/enums.h"
@@ -18,9 +31,10 @@
 #include "tester/shared/error_data.h"
 #include "tester/utility/test_runner.h"
 
-LOGGING_CONTEXT(testRunnerOverall, testRunner.overall, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(testRunnerTests, testRunner.test, TYPE_LEVEL, INFO_VERBOSITY)
-LOGGING_CONTEXT(testRunnerResult, testRunner.result, TYPE_LEVEL, INFO_VERBOSITY)
+LOGGING_CONTEXT(testRunnerOverall, testRunner.overall, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(testRunnerTests, testRunner.test, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(testRunnerResult, testRunner.result, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
+LOGGING_CONTEXT(testRunnerReport, testRunner.report, DEFAULT_TYPE_LEVEL, DEFAULT_INFO_VERBOSITY)
 
 namespace tester {
 
@@ -46,6 +60,69 @@ namespace tester {
 				 *
 				 */
 				static const std::string jsonFullPath(jsonPath + jsonName);
+
+				/**
+				 * @brief Name of the test collection in the JUnit report
+				 *
+				 */
+				static const QString reportName("browser_tester");
+
+				/**
+				 * @brief Function: const std::string & getArgument(const std::string & key)
+				 *
+				 * \param key: name of the command line argument
+				 *
+				 * \return the value of the command line argument
+				 *
+				 * This function returns the value of a command line argument
+				 */
+				const std::string & getArgument(const std::string & key) {
+					const app::command_line::argument_map_t & settingsMap = app::settings::Global::getInstance()->getSettingsMap();
+					const auto & argument = settingsMap.find(key);
+					EXCEPTION_ACTION_COND((argument == settingsMap.cend()), throw, "Unable to find key " << key << " in command line argument map");
+					return argument->second;
+				}
+
+				/**
+				 * @brief Function: std::string getFullName(const std::string & suiteName, const std::string & testName)
+				 *
+				 * \param suiteName: name of the suite
+				 * \param testName: name of the test
+				 *
+				 * \return the name identifying the test in the baseline
+				 *
+				 * This function returns the name of the test prepended by the name of its suite as test names are only unique within a suite
+				 */
+				std::string getFullName(const std::string & suiteName, const std::string & testName) {
+					return suiteName + "::" + testName;
+				}
+
+				/**
+				 * @brief Function: QString getPlatformName()
+				 *
+				 * \return the Qt platform the tests run on
+				 *
+				 * This function returns the name of the Qt platform the tests run on. If no test has created the application yet, the platform requested through the environment is returned
+				 */
+				QString getPlatformName() {
+					if (QApplication::instance() != nullptr) {
+						return QApplication::platformName();
+					}
+					return QString::fromLocal8Bit(qgetenv("QT_QPA_PLATFORM"));
+				}
+
+				/**
+				 * @brief Function: QString toSeconds(const std::chrono::nanoseconds & duration)
+				 *
+				 * \param duration: duration to convert
+				 *
+				 * \return the duration in seconds as expected by the JUnit report
+				 *
+				 * This function converts a duration to seconds
+				 */
+				QString toSeconds(const std::chrono::nanoseconds & duration) {
+					return QString::number(std::chrono::duration_cast<std::chrono::duration<double>>(duration).count(), 'f', 6);
+				}
 			}
 
 		}
@@ -54,7 +131,7 @@ namespace tester {
 
 }
 
-tester::utility::TestRunner::TestRunner(int & argc, char** argv) : factory(new tester::factory::TestFactory(argc, argv)), testList(tester::base::Suite::tests_container_t()), failedTests(tester::base::Suite::tests_container_t()) {
+tester::utility::TestRunner::TestRunner(int & argc, char** argv) : factory(new tester::factory::TestFactory(argc, argv)), testList(tester::base::Suite::tests_container_t()), failedTests(tester::base::Suite::tests_container_t()), baseline(std::map<std::string, std::chrono::nanoseconds>()), baselineTolerance(0.0) {
 	LOG_INFO(app::logger::info_level_e::ZERO, testRunnerOverall, "Creating test runner");
 
 	app::settings::Global::getInstance()->appendActionData(tester::utility::test_runner::jsonFullPath);
@@ -169,9 +246,16 @@ void tester::utility::TestRunner::run() {
 
 	std::string listPrint;
 
+	const bool runTests = ((listElements.empty() == true) || (listElements.compare("none") == 0));
+	if (runTests == true) {
+		this->loadBaseline();
+	}
+
 	for (const auto & test : this->testList) {
+		// Measure the time spent by the test here so that tests throwing an exception are accounted for as well
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 		try {
-			if ((listElements.empty() == true) || (listElements.compare("none") == 0)) {
+			if (runTests == true) {
 				test->run();
 				tester::shared::test_status_e status = test->getStatus();
 				if (status == tester::shared::test_status_e::FAIL) {
@@ -199,6 +283,11 @@ void tester::utility::TestRunner::run() {
 			test->addExceptionThrown(__LINE__, __FILE__, condition, exc.what());
 			this->failedTests.insert(test);
 		}
+		test->duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+	}
+
+	if (runTests == true) {
+		this->checkBaseline();
 	}
 
 	if (listPrint.empty() == false) {
@@ -206,11 +295,253 @@ void tester::utility::TestRunner::run() {
 	}
 }
 
+void tester::utility::TestRunner::loadBaseline() {
+	const std::string & baselineFilename = tester::utility::test_runner::getArgument("Baseline");
+	if (baselineFilename.empty() == true) {
+		return;
+	}
+
+	const std::string & toleranceText = tester::utility::test_runner::getArgument("Baseline Tolerance");
+	std::size_t parsedCharacters = 0;
+	try {
+		this->baselineTolerance = std::stod(toleranceText, &parsedCharacters);
+	} catch (const std::exception & exc) {
+		EXCEPTION_ACTION(throw, "Baseline tolerance " << toleranceText << " is not a number: " << exc.what());
+	}
+	EXCEPTION_ACTION_COND(((parsedCharacters != toleranceText.size()) || (std::isfinite(this->baselineTolerance) == false) || (this->baselineTolerance < 0.0)), throw, "Baseline tolerance " << toleranceText << " must be a non-negative percentage");
+
+	QFile baselineFile(QString::fromStdString(baselineFilename));
+	const bool opened = baselineFile.open(QIODevice::ReadOnly);
+	EXCEPTION_ACTION_COND((opened == false), throw, "Unable to open baseline " << baselineFilename << ": " << baselineFile.errorString().toStdString());
+	QJsonParseError parseError;
+	const QJsonDocument baselineDocument(QJsonDocument::fromJson(baselineFile.readAll(), &parseError));
+	EXCEPTION_ACTION_COND((baselineDocument.isObject() == false), throw, "Baseline " << baselineFilename << " is not a valid timing report: " << parseError.errorString().toStdString());
+
+	const QJsonArray tests(baselineDocument.object().value("tests").toArray());
+	for (const QJsonValue & testValue : tests) {
+		const QJsonObject testObject(testValue.toObject());
+		const std::string fullName(tester::utility::test_runner::getFullName(testObject.value("suite").toString().toStdString(), testObject.value("test").toString().toStdString()));
+
+		// A baseline may merge several runs of the same test. In such a case, all durations are listed
+		std::vector<double> durations;
+		if (testObject.contains("durations") == true) {
+			const QJsonArray durationValues(testObject.value("durations").toArray());
+			for (const QJsonValue & durationValue : durationValues) {
+				durations.push_back(durationValue.toDouble());
+			}
+		} else if (testObject.contains("duration") == true) {
+			durations.push_back(testObject.value("duration").toDouble());
+		}
+		EXCEPTION_ACTION_COND((durations.empty() == true), throw, "Test " << fullName << " in baseline " << baselineFilename << " has no recorded duration");
+
+		std::sort(durations.begin(), durations.end());
+		const std::vector<double>::size_type middle = durations.size() / 2;
+		const double median = ((durations.size() % 2) == 0) ? ((durations.at(middle - 1) + durations.at(middle)) / 2.0) : durations.at(middle);
+		this->baseline.insert_or_assign(fullName, std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(std::llround(median))));
+	}
+
+	LOG_INFO(app::logger::info_level_e::ZERO, testRunnerReport, "Loaded baseline of " << this->baseline.size() << " tests from " << baselineFilename << " with a tolerance of " << this->baselineTolerance << "%");
+}
+
+void tester::utility::TestRunner::checkBaseline() {
+	if (this->baseline.empty() == true) {
+		return;
+	}
+
+	for (const auto & test : this->testList) {
+		const std::string fullName(tester::utility::test_runner::getFullName(test->getSuite()->getName(), test->getName()));
+		const std::map<std::string, std::chrono::nanoseconds>::const_iterator baselineIt = this->baseline.find(fullName);
+		if (baselineIt == this->baseline.cend()) {
+			LOG_INFO(app::logger::info_level_e::ZERO, testRunnerReport, "Test " << fullName << " has no baseline");
+			continue;
+		}
+
+		const double limit = static_cast<double>(baselineIt->second.count()) * (1.0 + (this->baselineTolerance / 100.0));
+		const double duration = static_cast<double>(test->getDuration().count());
+		LOG_INFO(app::logger::info_level_e::ZERO, testRunnerReport, "Test " << fullName << " took " << test->getDuration().count() << "ns - baseline " << baselineIt->second.count() << "ns");
+		if (duration > limit) {
+			const double slowdown = ((duration / static_cast<double>(baselineIt->second.count())) - 1.0) * 100.0;
+			const std::string message("Test took " + std::to_string(test->getDuration().count()) + "ns which is " + std::to_string(slowdown) + "% slower than its baseline of " + std::to_string(baselineIt->second.count()) + "ns. Tolerance is " + std::to_string(this->baselineTolerance) + "%");
+			test->addAssertionFailure(__LINE__, __FILE__, "duration <= baseline * (1 + tolerance)", tester::shared::error_type_e::PERFORMANCE, message);
+			test->status = tester::shared::test_status_e::FAIL;
+			this->failedTests.insert(test);
+		}
+	}
+}
+
+void tester::utility::TestRunner::writeReports() const {
+	const std::string & listElements = tester::utility::test_runner::getArgument("List");
+	if ((listElements.empty() == false) && (listElements.compare("none") != 0)) {
+		return;
+	}
+
+	const std::string & junitFilename = tester::utility::test_runner::getArgument("JUnit Report");
+	const std::string & timingFilename = tester::utility::test_runner::getArgument("Timing Report");
+
+	if ((junitFilename.empty() == false) || (timingFilename.empty() == false)) {
+		LOG_INFO(app::logger::info_level_e::ZERO, testRunnerReport, "Writing reports of tests run on Qt platform " << tester::utility::test_runner::getPlatformName());
+	}
+
+	if (junitFilename.empty() == false) {
+		this->writeJUnitReport(junitFilename);
+	}
+
+	if (timingFilename.empty() == false) {
+		this->writeTimingReport(timingFilename);
+	}
+}
+
+void tester::utility::TestRunner::writeJUnitReport(const std::string & filename) const {
+	// Group tests by suite
+	std::map<std::string, std::vector<std::shared_ptr<tester::base::Test>>> suites;
+	for (const auto & test : this->testList) {
+		suites[test->getSuite()->getName()].push_back(test);
+	}
+
+	std::chrono::nanoseconds totalDuration(std::chrono::nanoseconds::zero());
+	for (const auto & test : this->testList) {
+		totalDuration += test->getDuration();
+	}
+
+	QByteArray report;
+	QXmlStreamWriter writer(&report);
+	writer.setAutoFormatting(true);
+	writer.writeStartDocument();
+	writer.writeStartElement("testsuites");
+	writer.writeAttribute("name", tester::utility::test_runner::reportName);
+	writer.writeAttribute("tests", QString::number(this->testList.size()));
+	writer.writeAttribute("failures", QString::number(this->failedTests.size()));
+	writer.writeAttribute("time", tester::utility::test_runner::toSeconds(totalDuration));
+
+	for (std::map<std::string, std::vector<std::shared_ptr<tester::base::Test>>>::const_iterator suiteIt = suites.cbegin(); suiteIt != suites.cend(); suiteIt++) {
+		std::chrono::nanoseconds suiteDuration(std::chrono::nanoseconds::zero());
+		std::size_t suiteFailures = 0;
+		for (const auto & test : suiteIt->second) {
+			suiteDuration += test->getDuration();
+			if (this->failedTests.find(test) != this->failedTests.cend()) {
+				suiteFailures++;
+			}
+		}
+
+		writer.writeStartElement("testsuite");
+		writer.writeAttribute("name", QString::fromStdString(suiteIt->first));
+		writer.writeAttribute("tests", QString::number(suiteIt->second.size()));
+		writer.writeAttribute("failures", QString::number(suiteFailures));
+		writer.writeAttribute("time", tester::utility::test_runner::toSeconds(suiteDuration));
+		writer.writeAttribute("timestamp", QDateTime::currentDateTime().toString(Qt::ISODate));
+
+		writer.writeStartElement("properties");
+		writer.writeStartElement("property");
+		writer.writeAttribute("name", "platform");
+		writer.writeAttribute("value", tester::utility::test_runner::getPlatformName());
+		writer.writeEndElement();
+		writer.writeEndElement();
+
+		for (const auto & test : suiteIt->second) {
+			writer.writeStartElement("testcase");
+			writer.writeAttribute("name", QString::fromStdString(test->getName()));
+			writer.writeAttribute("classname", QString::fromStdString(suiteIt->first));
+			writer.writeAttribute("time", tester::utility::test_runner::toSeconds(test->getDuration()));
+
+			writer.writeStartElement("properties");
+			const std::map<QString, std::chrono::nanoseconds> phases = {
+				{ "setup", test->getSetupDuration() },
+				{ "testBody", test->getBodyDuration() },
+				{ "wrapup", test->getWrapupDuration() }
+			};
+			for (std::map<QString, std::chrono::nanoseconds>::const_iterator phaseIt = phases.cbegin(); phaseIt != phases.cend(); phaseIt++) {
+				writer.writeStartElement("property");
+				writer.writeAttribute("name", phaseIt->first);
+				writer.writeAttribute("value", tester::utility::test_runner::toSeconds(phaseIt->second));
+				writer.writeEndElement();
+			}
+			writer.writeEndElement();
+
+			if (this->failedTests.find(test) != this->failedTests.cend()) {
+				const tester::base::Test::test_error_container_t & errorMap = test->getErrorMap();
+				if (errorMap.empty() == true) {
+					writer.writeStartElement("failure");
+					writer.writeAttribute("message", "Test ended in state " + QString::fromStdString(std::string() + test->getState()));
+					writer.writeEndElement();
+				}
+				for (const auto & e : errorMap) {
+					writer.writeStartElement("failure");
+					writer.writeAttribute("type", QString::fromStdString(std::string() + e.first));
+					writer.writeAttribute("message", QString::fromStdString(e.second.getMessage()));
+					writer.writeCharacters(QString::fromStdString(std::string() + e.second));
+					writer.writeEndElement();
+				}
+			}
+
+			writer.writeEndElement();
+		}
+
+		writer.writeEndElement();
+	}
+
+	writer.writeEndElement();
+	writer.writeEndDocument();
+
+	QFile reportFile(QString::fromStdString(filename));
+	const bool opened = reportFile.open(QIODevice::WriteOnly | QIODevice::Truncate);
+	EXCEPTION_ACTION_COND((opened == false), throw, "Unable to open file " << filename << " to write the JUnit report: " << reportFile.errorString().toStdString());
+	const qint64 writtenBytes = reportFile.write(report);
+	EXCEPTION_ACTION_COND((writtenBytes != static_cast<qint64>(report.size())), throw, "Unable to write the JUnit report to file " << filename << ": " << reportFile.errorString().toStdString());
+
+	LOG_INFO(app::logger::info_level_e::ZERO, testRunnerReport, "JUnit report written to " << filename);
+}
+
+void tester::utility::TestRunner::writeTimingReport(const std::string & filename) const {
+	QJsonArray tests;
+	for (const auto & test : this->testList) {
+		QJsonObject testObject;
+		testObject.insert("suite", QString::fromStdString(test->getSuite()->getName()));
+		testObject.insert("test", QString::fromStdString(test->getName()));
+		testObject.insert("status", QString::fromStdString(std::string() + test->getStatus()));
+		testObject.insert("duration", static_cast<double>(test->getDuration().count()));
+		testObject.insert("setup", static_cast<double>(test->getSetupDuration().count()));
+		testObject.insert("testBody", static_cast<double>(test->getBodyDuration().count()));
+		testObject.insert("wrapup", static_cast<double>(test->getWrapupDuration().count()));
+
+		const std::map<std::string, std::chrono::nanoseconds>::const_iterator baselineIt = this->baseline.find(tester::utility::test_runner::getFullName(test->getSuite()->getName(), test->getName()));
+		if (baselineIt != this->baseline.cend()) {
+			testObject.insert("baseline", static_cast<double>(baselineIt->second.count()));
+		}
+
+		tests.append(testObject);
+	}
+
+	QJsonObject report;
+	report.insert("platform", tester::utility::test_runner::getPlatformName());
+	report.insert("timestamp", QDateTime::currentDateTime().toString(Qt::ISODate));
+	report.insert("unit", "ns");
+	if (this->baseline.empty() == false) {
+		report.insert("baselineTolerance", this->baselineTolerance);
+	}
+	report.insert("tests", tests);
+
+	QFile reportFile(QString::fromStdString(filename));
+	const bool opened = reportFile.open(QIODevice::WriteOnly | QIODevice::Truncate);
+	EXCEPTION_ACTION_COND((opened == false), throw, "Unable to open file " << filename << " to write the timing report: " << reportFile.errorString().toStdString());
+	const QByteArray reportData(QJsonDocument(report).toJson(QJsonDocument::Indented));
+	const qint64 writtenBytes = reportFile.write(reportData);
+	EXCEPTION_ACTION_COND((writtenBytes != static_cast<qint64>(reportData.size())), throw, "Unable to write the timing report to file " << filename << ": " << reportFile.errorString().toStdString());
+
+	LOG_INFO(app::logger::info_level_e::ZERO, testRunnerReport, "Timing report written to " << filename);
+}
+
+bool tester::utility::TestRunner::isSuccessful() const {
+	return this->failedTests.empty();
+}
+
 void tester::utility::TestRunner::printResults() const {
 	LOG_INFO(app::logger::info_level_e::ZERO, testRunnerResult, "Runner results");
 	LOG_INFO(app::logger::info_level_e::ZERO, testRunnerResult, "Statistics:");
 	LOG_INFO(app::logger::info_level_e::ZERO, testRunnerResult, "- test run: " << this->testList.size());
 	LOG_INFO(app::logger::info_level_e::ZERO, testRunnerResult, "- test failed: " << this->failedTests.size());
+	for (const auto & test : this->testList) {
+		LOG_INFO(app::logger::info_level_e::ZERO, testRunnerResult, "Test \"" << test->getName() << "\" took " << test->getDuration().count() << "ns (setup " << test->getSetupDuration().count() << "ns, test body " << test->getBodyDuration().count() << "ns, wrapup " << test->getWrapupDuration().count() << "ns)");
+	}
 	for (const auto & test : this->failedTests) {
 		const tester::base::Test::test_error_container_t & errorMap = test->getErrorMap();
 		if (errorMap.empty() == false) {